@@ -55,6 +55,9 @@ function(Zivc_initZivcKernelOptions)
 
   set(option_description "Use built-in 'asin', 'acos' and 'atan' instead of the Zivc funcs.")
   Zivc_setBooleanOption(ZIVC_MATH_BUILTIN_INV_TRIGONOMETRIC ON ${option_description})
+
+  set(option_description "Build CPU kernels for x86-64 ISA levels and select one at runtime.")
+  Zivc_setBooleanOption(ZIVC_CPU_KERNEL_ISA_DISPATCH ON ${option_description})
 endfunction(Zivc_initZivcKernelOptions)
 
 
@@ -123,8 +126,8 @@ endfunction(Zivc_issueKernelSetNumber)
 
 function(Zivc_addKernelSet kernel_set_name kernel_set_version)
   # Parse arguments
-  set(options "")
-  set(one_value_args SPIRV_VERSION)
+  set(options BUFFER_DEVICE_ADDRESS)
+  set(one_value_args SPIRV_VERSION MATH_PROFILE)
   set(multi_value_args SOURCE_FILES INCLUDE_DIRS DEFINITIONS DEPENDS)
   cmake_parse_arguments(PARSE_ARGV 2 ZIVC "${options}" "${one_value_args}" "${multi_value_args}")
 
@@ -155,6 +158,22 @@ function(Zivc_addKernelSet kernel_set_name kernel_set_version)
     message(WARNING "The specified SPIR-V version '${kernel_set_spirv_version}' isn't supported. Use '1.3' instead.")
     set(kernel_set_spirv_version 1.3)
   endif()
+  # Math profile
+  if(ZIVC_MATH_PROFILE)
+    set(kernel_set_math_profile ${ZIVC_MATH_PROFILE})
+  else()
+    set(kernel_set_math_profile DEFAULT)
+  endif()
+  set(supported_math_profiles STRICT DEFAULT FAST)
+  if(NOT (kernel_set_math_profile IN_LIST supported_math_profiles))
+    message(FATAL_ERROR "The math profile '${kernel_set_math_profile}' of the kernel set '${kernel_set_name}' isn't supported.")
+  endif()
+  # Buffer arguments are passed as device addresses in the POD block
+  if(ZIVC_BUFFER_DEVICE_ADDRESS)
+    set(kernel_set_buffer_device_address true)
+  else()
+    set(kernel_set_buffer_device_address false)
+  endif()
 
   # Make a CMakeLists.txt of the given kernel set
   set(kernel_set_dir ${PROJECT_BINARY_DIR}/KernelSet/${kernel_set_name})
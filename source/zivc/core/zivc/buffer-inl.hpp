@@ -17,6 +17,7 @@
 
 #include "buffer.hpp"
 // Standard C++ library
+#include <algorithm>
 #include <cstring>
 #include <memory>
 #include <type_traits>
@@ -56,6 +57,29 @@ Buffer<T>::~Buffer() noexcept
 {
 }
 
+/*!
+  \details The elements of the source in the range of the launch options
+  are copied after the last element of the buffer.
+  The contents are preserved on the queue of the launch options
+  if the buffer is extended.
+  The dest offset of the launch options is ignored
+
+  \param [in] source No description.
+  \param [in] launch_options No description.
+  \return No description
+  */
+template <KernelArg T> inline
+LaunchResult Buffer<T>::appendFrom(const Buffer& source,
+                                   const LaunchOptions& launch_options)
+{
+  const std::size_t offset = size();
+  resize(offset + launch_options.size(), launch_options);
+  LaunchOptions options = launch_options;
+  options.setDestOffset(offset);
+  auto result = zivc::copy(source, this, options);
+  return result;
+}
+
 /*!
   \details No detailed description
 
@@ -202,6 +226,25 @@ auto Buffer<T>::reinterp() const noexcept -> ConstReinterpBufferT<NewType>
   return new_buffer;
 }
 
+/*!
+  \details The capacity grows geometrically when the buffer is extended,
+  so repeated resizing copies the contents only a logarithmic number of times.
+  The contents are preserved unlike setSize(). They are copied on
+  the queue of the launch options, which is the fixed queue 0 by default,
+  so the buffer must not be used by the commands in flight on the other queues
+
+  \param [in] s No description.
+  \param [in] launch_options No description.
+  */
+template <KernelArg T> inline
+void Buffer<T>::resize(const std::size_t s, const LaunchOptions& launch_options)
+{
+  const std::size_t cap = capacity();
+  if (cap < s)
+    reserve((std::max)(s, 2 * cap), launch_options);
+  setSize(s);
+}
+
 /*!
   \details No detailed description
 
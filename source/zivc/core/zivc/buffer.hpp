@@ -74,6 +74,10 @@ class Buffer : public BufferCommon
   ~Buffer() noexcept override;
 
 
+  //! Append the elements of the given buffer to the end of the buffer
+  [[nodiscard("The result can have a fence when external sync mode is on.")]]
+  LaunchResult appendFrom(const Buffer& source, const LaunchOptions& launch_options);
+
   //! Return the capacity of the buffer
   std::size_t capacity() const noexcept;
 
@@ -117,6 +121,9 @@ class Buffer : public BufferCommon
   [[nodiscard]]
   ConstReinterpBufferT<NewType> reinterp() const noexcept;
 
+  //! Change the number of elements preserving the contents
+  void resize(const std::size_t s, const LaunchOptions& launch_options = LaunchOptions{});
+
   //! Return the number of elements of the buffer
   std::size_t size() const noexcept;
 
@@ -24,6 +24,7 @@
 // Zivc
 #include "zivc_config.hpp"
 #include "utility/id_data.hpp"
+#include "utility/launch_options.hpp"
 #include "utility/zivc_object.hpp"
 
 namespace zivc {
@@ -58,6 +59,9 @@ class BufferCommon : public ZivcObject
   template <KernelArg T>
   std::size_t getCapacity() const noexcept;
 
+  //! Return the device address of the buffer memory
+  virtual uint64b deviceAddress() const noexcept = 0;
+
   //! Return the number of elements of the buffer
   template <KernelArg T>
   std::size_t getSize() const noexcept;
@@ -92,6 +96,10 @@ class BufferCommon : public ZivcObject
   //! Return the underlying buffer data
   virtual const void* rawBufferData() const noexcept = 0;
 
+  //! Reserve the memory for the given number of elements preserving the contents
+  virtual void reserve(const std::size_t s,
+                       const LaunchOptions& launch_options = LaunchOptions{}) = 0;
+
   //! Change the number of elements
   virtual void setSize(const std::size_t s) = 0;
 
@@ -146,6 +146,16 @@ FloatN Algorithm::sign(const FloatN x) noexcept
   return result;
 }
 
+/*!
+  */
+template <typename IntegerN> inline
+IntegerN Algorithm::mulHi(const IntegerN x, const IntegerN y) noexcept
+{
+  static_assert(kIsInteger<IntegerN>, "The IntegerN isn't integer type.");
+  const auto result = ZIVC_GLOBAL_NAMESPACE::mul_hi(x, y);
+  return result;
+}
+
 /*!
   */
 template <typename IntegerN> inline
@@ -217,6 +227,16 @@ FloatN sign(const FloatN x) noexcept
   const auto result = Algorithm::sign(x);
   return result;
 }
+/*!
+  */
+template <typename IntegerN> inline
+IntegerN mulHi(const IntegerN x, const IntegerN y) noexcept
+{
+  static_assert(kIsInteger<IntegerN>, "The IntegerN isn't integer type.");
+  const auto result = Algorithm::mulHi(x, y);
+  return result;
+}
+
 /*!
   */
 template <typename IntegerN> inline
@@ -64,6 +64,10 @@ class Algorithm
   static FloatN sign(const FloatN x) noexcept;
 
   // Integer
+  //! Return the high half of the product of x and y
+  template <typename IntegerN>
+  static IntegerN mulHi(const IntegerN x, const IntegerN y) noexcept;
+
   //! Return the number of non-zero bits in the given x
   template <typename IntegerN>
   static IntegerN popcount(const IntegerN x) noexcept;
@@ -91,7 +95,11 @@ ArithN min(const ArithN x, const ArithN y) noexcept;
 template <typename Float1N, typename Float2N>
 Float1N mix(const Float1N x, const Float1N y, const Float2N a) noexcept;
 
-//! Return the smaller of the given values
+//! Return the high half of the product of x and y
+template <typename IntegerN>
+IntegerN mulHi(const IntegerN x, const IntegerN y) noexcept;
+
+//! Return the number of non-zero bits in the given x
 template <typename IntegerN>
 IntegerN popcount(const IntegerN x) noexcept;
 
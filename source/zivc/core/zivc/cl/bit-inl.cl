@@ -31,7 +31,9 @@ namespace zivc {
   }
 
 ZIVC_CL_DEFINE_CAST_BIT_IMPL(uchar4);
+ZIVC_CL_DEFINE_CAST_BIT_IMPL(int);
 ZIVC_CL_DEFINE_CAST_BIT_IMPL(uint);
+ZIVC_CL_DEFINE_CAST_BIT_IMPL(float);
 
 template <typename To, typename From> inline
 To Bit::castBit(const From& from) noexcept
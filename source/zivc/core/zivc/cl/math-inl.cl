@@ -620,6 +620,164 @@ FloatN Math::Builtin::copysign(const FloatN x, const FloatN y) noexcept
   return z;
 }
 
+/*!
+  */
+template <typename FloatN> inline
+FloatN Math::Fast::exp(const FloatN x) noexcept
+{
+  static_assert(kIsFloatingPoint<FloatN>, "The FloatN isn't floating point.");
+  using Float = typename VectorTypeInfo<FloatN>::ElementType;
+  using FLimits = NumericLimits<Float>;
+  using IntN = IntegerTypeFromVec<FloatN>;
+
+  constexpr auto zero = static_cast<Float>(0.0);
+  constexpr auto one = static_cast<Float>(1.0);
+  constexpr auto bound = Zivc::getExpCoeff<Float, 2>();
+  constexpr auto threshold = Zivc::getExpCoeff<Float, 3>();
+  auto flag = zivc::isnan(x);
+  const auto d = zivc::select(zivc::clamp(x, -bound, bound), make<FloatN>(zero), flag);
+  // e^x = e^s * 2^q, where s = x - q * log(2)
+  constexpr auto inv_ln2 = Zivc::getInvLn2<Float, 0>();
+  const auto q = Zivc::rintImpl(d * inv_ln2);
+  constexpr auto l2u = Zivc::getExpCoeff<Float, 0>();
+  constexpr auto l2l = Zivc::getExpCoeff<Float, 1>();
+  auto s = d - q * l2u;
+  s = s - q * l2l;
+  const auto u = Zivc::expPolyImpl(s);
+  auto y = zivc::fma(s * s, u, s) + one;
+  y = Zivc::ldexpImpl(y, cast<IntN>(q));
+
+  y = zivc::select(y, x, flag);
+  flag = zivc::isgreater(x, make<FloatN>(threshold));
+  y = zivc::select(y, make<FloatN>(FLimits::infinity()), flag);
+  flag = zivc::isless(x, make<FloatN>(-bound));
+  y = zivc::select(y, make<FloatN>(zero), flag);
+  return y;
+}
+
+/*!
+  */
+template <typename FloatN> inline
+FloatN Math::Fast::exp2(const FloatN x) noexcept
+{
+  static_assert(kIsFloatingPoint<FloatN>, "The FloatN isn't floating point.");
+  using Float = typename VectorTypeInfo<FloatN>::ElementType;
+  using FLimits = NumericLimits<Float>;
+  using IntN = IntegerTypeFromVec<FloatN>;
+
+  constexpr auto zero = static_cast<Float>(0.0);
+  constexpr auto one = static_cast<Float>(1.0);
+  constexpr auto bound = Zivc::getExpCoeff<Float, 4>();
+  constexpr auto threshold = Zivc::getExpCoeff<Float, 5>();
+  auto flag = zivc::isnan(x);
+  const auto d = zivc::select(zivc::clamp(x, -bound, bound), make<FloatN>(zero), flag);
+  // 2^x = e^((x - q) * log(2)) * 2^q
+  const auto q = Zivc::rintImpl(d);
+  constexpr auto ln2 = Zivc::getLn2<Float, 0>();
+  const auto s = (d - q) * ln2;
+  const auto u = Zivc::expPolyImpl(s);
+  auto y = zivc::fma(s * s, u, s) + one;
+  y = Zivc::ldexpImpl(y, cast<IntN>(q));
+
+  y = zivc::select(y, x, flag);
+  flag = zivc::isgreaterequal(x, make<FloatN>(threshold));
+  y = zivc::select(y, make<FloatN>(FLimits::infinity()), flag);
+  flag = zivc::isless(x, make<FloatN>(-bound));
+  y = zivc::select(y, make<FloatN>(zero), flag);
+  return y;
+}
+
+/*!
+  */
+template <typename FloatN> inline
+FloatN Math::Fast::log(const FloatN x) noexcept
+{
+  static_assert(kIsFloatingPoint<FloatN>, "The FloatN isn't floating point.");
+  using Float = typename VectorTypeInfo<FloatN>::ElementType;
+  using FLimits = NumericLimits<Float>;
+  using IntN = IntegerTypeFromVec<FloatN>;
+  using Constants = Zivc::LogPolyConstants;
+
+  constexpr auto zero = static_cast<Float>(0.0);
+  constexpr auto one = static_cast<Float>(1.0);
+  auto e = make<IntN>(0);
+  const auto m = Zivc::logReduceImpl(x, &e);
+  // log(m) = 2 * atanh(z), where z = (m - 1) / (m + 1)
+  const auto z = (m - one) / (m + one);
+  const auto z2 = z * z;
+  const auto t = Zivc::logPolyImpl(z2);
+  constexpr size_t c_index = (sizeof(Float) == 4) ? 3 : 9;
+  constexpr auto c = Constants::template get<Float, c_index>();
+  const auto l = zivc::fma(z * z2, zivc::fma(t, z2, make<FloatN>(c)), z + z);
+  constexpr auto l2u = Zivc::getExpCoeff<Float, 0>();
+  constexpr auto l2l = Zivc::getExpCoeff<Float, 1>();
+  const auto ef = cast<FloatN>(e);
+  auto y = zivc::fma(ef, make<FloatN>(l2u), l + ef * l2l);
+
+  const auto inf = make<FloatN>(FLimits::infinity());
+  auto flag = zivc::isequal(x, inf);
+  y = zivc::select(y, inf, flag);
+  flag = zivc::isless(x, make<FloatN>(zero)) | zivc::isnan(x);
+  y = zivc::select(y, make<FloatN>(FLimits::quietNan()), flag);
+  flag = zivc::isequal(x, make<FloatN>(zero));
+  y = zivc::select(y, -inf, flag);
+  return y;
+}
+
+/*!
+  */
+template <typename FloatN> inline
+FloatN Math::Fast::log2(const FloatN x) noexcept
+{
+  static_assert(kIsFloatingPoint<FloatN>, "The FloatN isn't floating point.");
+  using Float = typename VectorTypeInfo<FloatN>::ElementType;
+  using FLimits = NumericLimits<Float>;
+  using IntN = IntegerTypeFromVec<FloatN>;
+  using Constants = Zivc::LogPolyConstants;
+
+  constexpr auto zero = static_cast<Float>(0.0);
+  constexpr auto one = static_cast<Float>(1.0);
+  auto e = make<IntN>(0);
+  const auto m = Zivc::logReduceImpl(x, &e);
+  // log2(m) = 2 * atanh(z) / log(2), where z = (m - 1) / (m + 1)
+  const auto z = (m - one) / (m + one);
+  const auto z2 = z * z;
+  const auto t = Zivc::logPolyImpl(z2);
+  constexpr size_t c_index = (sizeof(Float) == 4) ? 3 : 9;
+  constexpr auto c = Constants::template get<Float, c_index>();
+  const auto l = zivc::fma(z * z2, zivc::fma(t, z2, make<FloatN>(c)), z + z);
+  constexpr auto inv_ln2 = Zivc::getInvLn2<Float, 0>();
+  auto y = zivc::fma(l, make<FloatN>(inv_ln2), cast<FloatN>(e));
+
+  const auto inf = make<FloatN>(FLimits::infinity());
+  auto flag = zivc::isequal(x, inf);
+  y = zivc::select(y, inf, flag);
+  flag = zivc::isless(x, make<FloatN>(zero)) | zivc::isnan(x);
+  y = zivc::select(y, make<FloatN>(FLimits::quietNan()), flag);
+  flag = zivc::isequal(x, make<FloatN>(zero));
+  y = zivc::select(y, -inf, flag);
+  return y;
+}
+
+/*!
+  \details The error grows with the magnitude of e * log2(base)
+  since the product is rounded to the working precision
+  */
+template <typename FloatN> inline
+FloatN Math::Fast::pow(const FloatN base, const FloatN e) noexcept
+{
+  static_assert(kIsFloatingPoint<FloatN>, "The FloatN isn't floating point.");
+  using Float = typename VectorTypeInfo<FloatN>::ElementType;
+
+  constexpr auto zero = static_cast<Float>(0.0);
+  const auto l = e * Fast::log2(zivc::abs(base));
+  // The product is NaN for 0^0 and 1^inf, which are fixed in the special cases
+  const auto d = zivc::select(l, make<FloatN>(zero), zivc::isnan(l));
+  auto y = Fast::exp2(d);
+  y = Zivc::powSpecialImpl(y, base, e);
+  return y;
+}
+
 /*!
   */
 template <typename FloatN> inline
@@ -629,7 +787,6 @@ FloatN Math::Zivc::round(const FloatN x) noexcept
   using Float = typename VectorTypeInfo<FloatN>::ElementType;
   using FloatInfo = FloatingPointFromBytes<sizeof(Float)>;
 
-  //! \todo Support double
   constexpr auto h = static_cast<Float>(0.5);
   auto y = x + h;
   auto fr = initFraction(y);
@@ -704,9 +861,21 @@ template <typename FloatN> inline
 FloatN Math::Zivc::exp(const FloatN x) noexcept
 {
   static_assert(kIsFloatingPoint<FloatN>, "The FloatN isn't floating point.");
-  static_assert(Config::isBuiltinMathExpUsed(),
-                "Zivc 'exp' isn't implemented yet.");
-  const auto y = ZIVC_GLOBAL_NAMESPACE::exp(x);
+  using Float = typename VectorTypeInfo<FloatN>::ElementType;
+  using FLimits = NumericLimits<Float>;
+
+  constexpr auto zero = static_cast<Float>(0.0);
+  constexpr auto bound = getExpCoeff<Float, 2>();
+  constexpr auto threshold = getExpCoeff<Float, 3>();
+  auto flag = zivc::isnan(x);
+  const auto d = zivc::select(zivc::clamp(x, -bound, bound), make<FloatN>(zero), flag);
+  auto y = expF2Impl(F2<FloatN>{d, make<FloatN>(zero)});
+
+  y = zivc::select(y, x, flag);
+  flag = zivc::isgreater(x, make<FloatN>(threshold));
+  y = zivc::select(y, make<FloatN>(FLimits::infinity()), flag);
+  flag = zivc::isless(x, make<FloatN>(-bound));
+  y = zivc::select(y, make<FloatN>(zero), flag);
   return y;
 }
 
@@ -716,9 +885,25 @@ template <typename FloatN> inline
 FloatN Math::Zivc::exp2(const FloatN x) noexcept
 {
   static_assert(kIsFloatingPoint<FloatN>, "The FloatN isn't floating point.");
-  static_assert(Config::isBuiltinMathExpUsed(),
-                "Zivc 'exp2' isn't implemented yet.");
-  const auto y = ZIVC_GLOBAL_NAMESPACE::exp2(x);
+  using Float = typename VectorTypeInfo<FloatN>::ElementType;
+  using FLimits = NumericLimits<Float>;
+
+  constexpr auto zero = static_cast<Float>(0.0);
+  constexpr auto bound = getExpCoeff<Float, 4>();
+  constexpr auto threshold = getExpCoeff<Float, 5>();
+  auto flag = zivc::isnan(x);
+  const auto d = zivc::select(zivc::clamp(x, -bound, bound), make<FloatN>(zero), flag);
+  // 2^x = e^((x - q) * log(2)) * 2^q
+  const auto q = rintImpl(d);
+  const F2<FloatN> ln2{make<FloatN>(getLn2<Float, 0>()),
+                       make<FloatN>(getLn2<Float, 1>())};
+  auto y = expReducedImpl(mulF2F(ln2, d - q), q);
+
+  y = zivc::select(y, x, flag);
+  flag = zivc::isgreaterequal(x, make<FloatN>(threshold));
+  y = zivc::select(y, make<FloatN>(FLimits::infinity()), flag);
+  flag = zivc::isless(x, make<FloatN>(-bound));
+  y = zivc::select(y, make<FloatN>(zero), flag);
   return y;
 }
 
@@ -728,9 +913,20 @@ template <typename FloatN> inline
 FloatN Math::Zivc::log(const FloatN x) noexcept
 {
   static_assert(kIsFloatingPoint<FloatN>, "The FloatN isn't floating point.");
-  static_assert(Config::isBuiltinMathLogUsed(),
-                "Zivc 'log' isn't implemented yet.");
-  const auto y = ZIVC_GLOBAL_NAMESPACE::log(x);
+  using Float = typename VectorTypeInfo<FloatN>::ElementType;
+  using FLimits = NumericLimits<Float>;
+
+  const auto l = logF2Impl(x);
+  auto y = l.x_ + l.y_;
+
+  constexpr auto zero = static_cast<Float>(0.0);
+  const auto inf = make<FloatN>(FLimits::infinity());
+  auto flag = zivc::isequal(x, inf);
+  y = zivc::select(y, inf, flag);
+  flag = zivc::isless(x, make<FloatN>(zero)) | zivc::isnan(x);
+  y = zivc::select(y, make<FloatN>(FLimits::quietNan()), flag);
+  flag = zivc::isequal(x, make<FloatN>(zero));
+  y = zivc::select(y, -inf, flag);
   return y;
 }
 
@@ -740,9 +936,23 @@ template <typename FloatN> inline
 FloatN Math::Zivc::log2(const FloatN x) noexcept
 {
   static_assert(kIsFloatingPoint<FloatN>, "The FloatN isn't floating point.");
-  static_assert(Config::isBuiltinMathLogUsed(),
-                "Zivc 'log2' isn't implemented yet.");
-  const auto y = ZIVC_GLOBAL_NAMESPACE::log2(x);
+  using Float = typename VectorTypeInfo<FloatN>::ElementType;
+  using FLimits = NumericLimits<Float>;
+
+  // The powers of 2 are exact since 1/log(2) is multiplied in double-float
+  const F2<FloatN> inv_ln2{make<FloatN>(getInvLn2<Float, 0>()),
+                           make<FloatN>(getInvLn2<Float, 1>())};
+  const auto l = mulF2F2(logF2Impl(x), inv_ln2);
+  auto y = l.x_ + l.y_;
+
+  constexpr auto zero = static_cast<Float>(0.0);
+  const auto inf = make<FloatN>(FLimits::infinity());
+  auto flag = zivc::isequal(x, inf);
+  y = zivc::select(y, inf, flag);
+  flag = zivc::isless(x, make<FloatN>(zero)) | zivc::isnan(x);
+  y = zivc::select(y, make<FloatN>(FLimits::quietNan()), flag);
+  flag = zivc::isequal(x, make<FloatN>(zero));
+  y = zivc::select(y, -inf, flag);
   return y;
 }
 
@@ -752,9 +962,26 @@ template <typename FloatN> inline
 FloatN Math::Zivc::pow(const FloatN base, const FloatN e) noexcept
 {
   static_assert(kIsFloatingPoint<FloatN>, "The FloatN isn't floating point.");
-  static_assert(Config::isBuiltinMathPowUsed(),
-                "Zivc 'pow' isn't implemented yet.");
-  const auto y = ZIVC_GLOBAL_NAMESPACE::pow(base, e);
+  using Float = typename VectorTypeInfo<FloatN>::ElementType;
+  using FLimits = NumericLimits<Float>;
+
+  constexpr auto zero = static_cast<Float>(0.0);
+  const auto zerov = make<FloatN>(zero);
+  const auto inf = make<FloatN>(FLimits::infinity());
+
+  // |base|^e = e^(e * log(|base|)) computed in double-float
+  constexpr auto bound = getExpCoeff<Float, 2>();
+  constexpr auto threshold = getExpCoeff<Float, 3>();
+  auto l = mulF2F(logF2Impl(zivc::abs(base)), e);
+  const auto is_over = zivc::isgreater(l.x_, make<FloatN>(threshold));
+  const auto is_under = zivc::isless(l.x_, make<FloatN>(-bound)) | zivc::isnan(l.x_);
+  l.x_ = zivc::select(l.x_, zerov, is_over | is_under);
+  l.y_ = zivc::select(l.y_, zerov, is_over | is_under);
+  auto y = expF2Impl(l);
+  y = zivc::select(y, zerov, is_under);
+  y = zivc::select(y, inf, is_over);
+
+  y = powSpecialImpl(y, base, e);
   return y;
 }
 
@@ -1314,6 +1541,104 @@ constexpr Float Math::Zivc::AtanPolyConstants::get() noexcept
   return c;
 }
 
+/*!
+  */
+template <typename Float, size_t kIndex> inline
+constexpr Float Math::Zivc::ExpPolyConstants::get() noexcept
+{
+  static_assert(kIsFloatingPoint<Float>, "The Float isn't floating point.");
+  Float c = static_cast<Float>(0.0);
+  if constexpr (sizeof(Float) == 4) {
+    if constexpr (kIndex == 0)
+      c = 0.00136324646882712841033936f;
+    else if constexpr (kIndex == 1)
+      c = 0.00836596917361021041870117f;
+    else if constexpr (kIndex == 2)
+      c = 0.0416710823774337768554688f;
+    else if constexpr (kIndex == 3)
+      c = 0.166665524244308471679688f;
+    else if constexpr (kIndex == 4)
+      c = 0.499999850988388061523438f;
+  }
+  else if constexpr (sizeof(Float) == 8) {
+    if constexpr (kIndex == 0)
+      c = 2.51069683420950419527139e-08;
+    else if constexpr (kIndex == 1)
+      c = 2.76286166770270649116855e-07;
+    else if constexpr (kIndex == 2)
+      c = 2.75572496725023574143864e-06;
+    else if constexpr (kIndex == 3)
+      c = 2.48014973989819794114153e-05;
+    else if constexpr (kIndex == 4)
+      c = 0.000198412698809069797676111;
+    else if constexpr (kIndex == 5)
+      c = 0.0013888888939977128960529;
+    else if constexpr (kIndex == 6)
+      c = 0.00833333333332371417601081;
+    else if constexpr (kIndex == 7)
+      c = 0.0416666666665409524128449;
+    else if constexpr (kIndex == 8)
+      c = 0.166666666666666740681535;
+    else if constexpr (kIndex == 9)
+      c = 0.500000000000000999200722;
+  }
+  else {
+    static_assert(sizeof(Float) == 0, "Unsupported floating point is specified.");
+  }
+  return c;
+}
+
+/*!
+  \details The last two constants are the upper and lower parts of
+  the double-float coefficient of x^3
+  */
+template <typename Float, size_t kIndex> inline
+constexpr Float Math::Zivc::LogPolyConstants::get() noexcept
+{
+  static_assert(kIsFloatingPoint<Float>, "The Float isn't floating point.");
+  Float c = static_cast<Float>(0.0);
+  if constexpr (sizeof(Float) == 4) {
+    if constexpr (kIndex == 0)
+      c = 0.240320354700088500976562f;
+    else if constexpr (kIndex == 1)
+      c = 0.285112679004669189453125f;
+    else if constexpr (kIndex == 2)
+      c = 0.400007992982864379882812f;
+    else if constexpr (kIndex == 3)
+      c = 0.66666662693023681640625f;
+    else if constexpr (kIndex == 4)
+      c = 3.69183861259614332084311e-09f;
+  }
+  else if constexpr (sizeof(Float) == 8) {
+    if constexpr (kIndex == 0)
+      c = 0.116255524079935043668677;
+    else if constexpr (kIndex == 1)
+      c = 0.103239680901072952701192;
+    else if constexpr (kIndex == 2)
+      c = 0.117754809412463995466069;
+    else if constexpr (kIndex == 3)
+      c = 0.13332981086846273921509;
+    else if constexpr (kIndex == 4)
+      c = 0.153846227114512262845736;
+    else if constexpr (kIndex == 5)
+      c = 0.181818180850050775676507;
+    else if constexpr (kIndex == 6)
+      c = 0.222222222230083560345903;
+    else if constexpr (kIndex == 7)
+      c = 0.285714285714249172087875;
+    else if constexpr (kIndex == 8)
+      c = 0.400000000000000077715612;
+    else if constexpr (kIndex == 9)
+      c = 0.666666666666666629659233;
+    else if constexpr (kIndex == 10)
+      c = 3.80554962542412056336616e-17;
+  }
+  else {
+    static_assert(sizeof(Float) == 0, "Unsupported floating point is specified.");
+  }
+  return c;
+}
+
 template <typename FloatN> inline
 FloatN Math::Zivc::upper(const FloatN x) noexcept
 {
@@ -1376,6 +1701,133 @@ auto Math::Zivc::normalizeF2(const F2<FloatN> x) noexcept -> F2<FloatN>
   return result;
 }
 
+template <typename FloatN> inline
+auto Math::Zivc::addFF2(const FloatN lhs, const F2<FloatN> rhs) noexcept
+    -> F2<FloatN>
+{
+  static_assert(kIsFloatingPoint<FloatN>, "The FloatN isn't floating point.");
+  auto result = rhs;
+  result.x_ = lhs + rhs.x_;
+  result.y_ = lhs - result.x_ + rhs.x_ + rhs.y_;
+  return result;
+}
+
+template <typename FloatN> inline
+auto Math::Zivc::addF2F2(const F2<FloatN> lhs, const F2<FloatN> rhs) noexcept
+    -> F2<FloatN>
+{
+  static_assert(kIsFloatingPoint<FloatN>, "The FloatN isn't floating point.");
+  auto result = lhs;
+  result.x_ = lhs.x_ + rhs.x_;
+  result.y_ = lhs.x_ - result.x_ + rhs.x_ + lhs.y_ + rhs.y_;
+  return result;
+}
+
+template <typename FloatN> inline
+auto Math::Zivc::add2FF(const FloatN lhs, const FloatN rhs) noexcept
+    -> F2<FloatN>
+{
+  static_assert(kIsFloatingPoint<FloatN>, "The FloatN isn't floating point.");
+  F2<FloatN> result{lhs, rhs};
+  result.x_ = lhs + rhs;
+  const auto v = result.x_ - lhs;
+  result.y_ = (lhs - (result.x_ - v)) + (rhs - v);
+  return result;
+}
+
+template <typename FloatN> inline
+auto Math::Zivc::add2F2F(const F2<FloatN> lhs, const FloatN rhs) noexcept
+    -> F2<FloatN>
+{
+  static_assert(kIsFloatingPoint<FloatN>, "The FloatN isn't floating point.");
+  auto result = lhs;
+  result.x_ = lhs.x_ + rhs;
+  const auto v = result.x_ - lhs.x_;
+  result.y_ = (lhs.x_ - (result.x_ - v)) + (rhs - v);
+  result.y_ = result.y_ + lhs.y_;
+  return result;
+}
+
+template <typename FloatN> inline
+auto Math::Zivc::mulF2F(const F2<FloatN> lhs, const FloatN rhs) noexcept
+    -> F2<FloatN>
+{
+  static_assert(kIsFloatingPoint<FloatN>, "The FloatN isn't floating point.");
+  const auto xh = upper(lhs.x_);
+  const auto yh = upper(rhs);
+  const auto xl = lhs.x_ - xh;
+  const auto yl = rhs - yh;
+
+  auto result = lhs;
+  result.x_ = lhs.x_ * rhs;
+  result.y_ = xh * yh - result.x_ + xl * yh + xh * yl + xl * yl + lhs.y_ * rhs;
+  return result;
+}
+
+template <typename FloatN> inline
+auto Math::Zivc::mulF2F2(const F2<FloatN> lhs, const F2<FloatN> rhs) noexcept
+    -> F2<FloatN>
+{
+  static_assert(kIsFloatingPoint<FloatN>, "The FloatN isn't floating point.");
+  const auto xh = upper(lhs.x_);
+  const auto yh = upper(rhs.x_);
+  const auto xl = lhs.x_ - xh;
+  const auto yl = rhs.x_ - yh;
+
+  auto result = lhs;
+  result.x_ = lhs.x_ * rhs.x_;
+  result.y_ = xh * yh - result.x_ + xl * yh + xh * yl + xl * yl +
+              lhs.x_ * rhs.y_ + lhs.y_ * rhs.x_;
+  return result;
+}
+
+template <typename FloatN> inline
+auto Math::Zivc::squF2(const F2<FloatN> x) noexcept -> F2<FloatN>
+{
+  static_assert(kIsFloatingPoint<FloatN>, "The FloatN isn't floating point.");
+  const auto xh = upper(x.x_);
+  const auto xl = x.x_ - xh;
+
+  auto result = x;
+  result.x_ = x.x_ * x.x_;
+  result.y_ = xh * xh - result.x_ + (xh + xh) * xl + xl * xl + x.x_ * (x.y_ + x.y_);
+  return result;
+}
+
+template <typename FloatN> inline
+auto Math::Zivc::divF2F2(const F2<FloatN> lhs, const F2<FloatN> rhs) noexcept
+    -> F2<FloatN>
+{
+  static_assert(kIsFloatingPoint<FloatN>, "The FloatN isn't floating point.");
+  const auto t = Algorithm::invert(rhs.x_);
+  const auto dh = upper(rhs.x_);
+  const auto dl = rhs.x_ - dh;
+  const auto th = upper(t);
+  const auto tl = t - th;
+  const auto nh = upper(lhs.x_);
+  const auto nl = lhs.x_ - nh;
+
+  using Float = typename VectorTypeInfo<FloatN>::ElementType;
+  constexpr auto one = static_cast<Float>(1.0);
+  auto result = lhs;
+  result.x_ = lhs.x_ * t;
+  const auto u = -result.x_ + nh * th + nh * tl + nl * th + nl * tl +
+                 result.x_ * (one - dh * th - dh * tl - dl * th - dl * tl);
+  result.y_ = t * (lhs.y_ - result.x_ * rhs.y_) + u;
+  return result;
+}
+
+template <typename FloatN> inline
+auto Math::Zivc::scaleF2(const F2<FloatN> x, const FloatN s) noexcept
+    -> F2<FloatN>
+{
+  static_assert(kIsFloatingPoint<FloatN>, "The FloatN isn't floating point.");
+  auto result = x;
+  result.x_ = x.x_ * s;
+  result.y_ = x.y_ * s;
+  return result;
+}
+
 template <typename FloatN> inline
 FloatN Math::Zivc::toward0(const FloatN x) noexcept
 {
@@ -1939,6 +2391,102 @@ constexpr auto Math::Zivc::getAtanCoeff() noexcept
   }
 }
 
+/*!
+  \details 0: upper part of log(2), 1: lower part of log(2),
+  2: bound of exp, 3: overflow threshold of exp,
+  4: bound of exp2, 5: overflow threshold of exp2
+  */
+template <typename Float, size_t kIndex> inline
+constexpr Float Math::Zivc::getExpCoeff() noexcept
+{
+  static_assert(kIsFloatingPoint<Float>, "The Float isn't floating point.");
+  Float c = static_cast<Float>(0.0);
+  if constexpr (sizeof(Float) == 4) {
+    if constexpr (kIndex == 0)
+      c = 0.693145751953125f;
+    else if constexpr (kIndex == 1)
+      c = 1.428606765330187045e-06f;
+    else if constexpr (kIndex == 2)
+      c = 104.0f;
+    else if constexpr (kIndex == 3)
+      c = 88.72283935546875f;
+    else if constexpr (kIndex == 4)
+      c = 150.0f;
+    else if constexpr (kIndex == 5)
+      c = 128.0f;
+  }
+  else if constexpr (sizeof(Float) == 8) {
+    if constexpr (kIndex == 0)
+      c = 0.69314718055966295651160180568695068359375;
+    else if constexpr (kIndex == 1)
+      c = 0.28235290563031577122588448175013436025525412068e-12;
+    else if constexpr (kIndex == 2)
+      c = 1000.0;
+    else if constexpr (kIndex == 3)
+      c = 709.782712893383973096;
+    else if constexpr (kIndex == 4)
+      c = 1100.0;
+    else if constexpr (kIndex == 5)
+      c = 1024.0;
+  }
+  else {
+    static_assert(sizeof(Float) == 0, "Unsupported floating point is specified.");
+  }
+  return c;
+}
+
+/*!
+  \details The upper and the lower parts of log(2) in double-float
+  */
+template <typename Float, size_t kIndex> inline
+constexpr Float Math::Zivc::getLn2() noexcept
+{
+  static_assert(kIsFloatingPoint<Float>, "The Float isn't floating point.");
+  Float c = static_cast<Float>(0.0);
+  if constexpr (sizeof(Float) == 4) {
+    if constexpr (kIndex == 0)
+      c = 0.69314718246459960938f;
+    else if constexpr (kIndex == 1)
+      c = -1.904654323148236017e-09f;
+  }
+  else if constexpr (sizeof(Float) == 8) {
+    if constexpr (kIndex == 0)
+      c = 0.693147180559945286226764;
+    else if constexpr (kIndex == 1)
+      c = 2.319046813846299558417771e-17;
+  }
+  else {
+    static_assert(sizeof(Float) == 0, "Unsupported floating point is specified.");
+  }
+  return c;
+}
+
+/*!
+  \details The upper and the lower parts of 1/log(2) in double-float
+  */
+template <typename Float, size_t kIndex> inline
+constexpr Float Math::Zivc::getInvLn2() noexcept
+{
+  static_assert(kIsFloatingPoint<Float>, "The Float isn't floating point.");
+  Float c = static_cast<Float>(0.0);
+  if constexpr (sizeof(Float) == 4) {
+    if constexpr (kIndex == 0)
+      c = 1.44269502162933349609375f;
+    else if constexpr (kIndex == 1)
+      c = 1.925963033500011079e-08f;
+  }
+  else if constexpr (sizeof(Float) == 8) {
+    if constexpr (kIndex == 0)
+      c = 1.442695040888963387004650940071;
+    else if constexpr (kIndex == 1)
+      c = 2.0355273740931033e-17;
+  }
+  else {
+    static_assert(sizeof(Float) == 0, "Unsupported floating point is specified.");
+  }
+  return c;
+}
+
 /*!
   */
 template <typename FloatN> inline
@@ -2006,6 +2554,227 @@ FloatN Math::Zivc::ldexpImpl(const FloatN x, const IntegerN e) noexcept
   return y;
 }
 
+/*!
+  */
+template <typename FloatN> inline
+auto Math::Zivc::ilogbRawImpl(const FloatN x) noexcept
+{
+  static_assert(kIsFloatingPoint<FloatN>, "The FloatN isn't floating point.");
+  using Float = typename VectorTypeInfo<FloatN>::ElementType;
+  using FloatInfo = FloatingPointFromBytes<sizeof(Float)>;
+  using BitVec = UIntegerTypeFromVec<FloatN>;
+  using IntN = IntegerTypeFromVec<FloatN>;
+  using Integer = typename VectorTypeInfo<IntN>::ElementType;
+
+  constexpr auto exp_mask = FloatInfo::exponentBitMask();
+  constexpr size_t sig_size = FloatInfo::significandBitSize();
+  constexpr auto exp_bias = static_cast<Integer>(FloatInfo::exponentBias());
+  const auto e = cast<IntN>((treatAs<BitVec>(x) & exp_mask) >> sig_size) - exp_bias;
+  return e;
+}
+
+/*!
+  */
+template <typename FloatN, typename IntegerN> inline
+FloatN Math::Zivc::ldexpRawImpl(const FloatN x, const IntegerN e) noexcept
+{
+  static_assert(kIsFloatingPoint<FloatN>, "The FloatN isn't floating point.");
+  static_assert(kIsInteger<IntegerN>, "The IntegerN isn't integer type.");
+  using Float = typename VectorTypeInfo<FloatN>::ElementType;
+  using FloatInfo = FloatingPointFromBytes<sizeof(Float)>;
+  using BitVec = UIntegerTypeFromVec<FloatN>;
+
+  constexpr size_t sig_size = FloatInfo::significandBitSize();
+  const auto u = treatAs<BitVec>(x) + (cast<BitVec>(e) << sig_size);
+  return treatAs<FloatN>(u);
+}
+
+/*!
+  \details The significand m is taken from [0.75, 1.5), and
+  log(m) = 2 * atanh((m - 1) / (m + 1)) is evaluated in double-float
+  */
+template <typename FloatN> inline
+auto Math::Zivc::logF2Impl(const FloatN x) noexcept -> F2<FloatN>
+{
+  static_assert(kIsFloatingPoint<FloatN>, "The FloatN isn't floating point.");
+  using Float = typename VectorTypeInfo<FloatN>::ElementType;
+  using IntN = IntegerTypeFromVec<FloatN>;
+  using Constants = LogPolyConstants;
+
+  constexpr auto one = static_cast<Float>(1.0);
+  constexpr auto two = static_cast<Float>(2.0);
+
+  auto e = make<IntN>(0);
+  const auto m = logReduceImpl(x, &e);
+
+  const auto z = divF2F2(add2FF(make<FloatN>(-one), m), add2FF(make<FloatN>(one), m));
+  const auto z2 = squF2(z);
+  const auto t = logPolyImpl(z2.x_);
+  constexpr size_t c_index = (sizeof(Float) == 4) ? 3 : 9;
+  const F2<FloatN> c{make<FloatN>(Constants::template get<Float, c_index>()),
+                     make<FloatN>(Constants::template get<Float, c_index + 1>())};
+  const F2<FloatN> ln2{make<FloatN>(getLn2<Float, 0>()),
+                       make<FloatN>(getLn2<Float, 1>())};
+
+  auto y = mulF2F(ln2, cast<FloatN>(e));
+  y = addF2F2(y, scaleF2(z, make<FloatN>(two)));
+  y = addF2F2(y, mulF2F2(mulF2F2(z2, z), add2F2F2(mulF2F(z2, t), c)));
+  return y;
+}
+
+/*!
+  \details The input should be in the range where the result is finite
+  */
+template <typename FloatN> inline
+FloatN Math::Zivc::expF2Impl(const F2<FloatN> x) noexcept
+{
+  static_assert(kIsFloatingPoint<FloatN>, "The FloatN isn't floating point.");
+  using Float = typename VectorTypeInfo<FloatN>::ElementType;
+
+  constexpr auto inv_ln2 = getInvLn2<Float, 0>();
+  const auto q = rintImpl((x.x_ + x.y_) * inv_ln2);
+  constexpr auto l2u = -getExpCoeff<Float, 0>();
+  constexpr auto l2l = -getExpCoeff<Float, 1>();
+  auto s = add2F2F(x, q * l2u);
+  s = add2F2F(s, q * l2l);
+  const auto y = expReducedImpl(s, q);
+  return y;
+}
+
+/*!
+  */
+template <typename FloatN> inline
+FloatN Math::Zivc::expReducedImpl(const F2<FloatN> s, const FloatN q) noexcept
+{
+  static_assert(kIsFloatingPoint<FloatN>, "The FloatN isn't floating point.");
+  using Float = typename VectorTypeInfo<FloatN>::ElementType;
+  using IntN = IntegerTypeFromVec<FloatN>;
+
+  const auto r = normalizeF2(s);
+  const auto u = expPolyImpl(r.x_);
+  constexpr auto one = static_cast<Float>(1.0);
+  auto t = addF2F2(r, mulF2F(squF2(r), u));
+  t = addFF2(make<FloatN>(one), t);
+  const auto y = ldexpImpl(t.x_ + t.y_, cast<IntN>(q));
+  return y;
+}
+
+/*!
+  */
+template <typename FloatN> inline
+FloatN Math::Zivc::expPolyImpl(const FloatN s) noexcept
+{
+  static_assert(kIsFloatingPoint<FloatN>, "The FloatN isn't floating point.");
+  using Float = typename VectorTypeInfo<FloatN>::ElementType;
+  using Constants = ExpPolyConstants;
+
+  auto u = make<FloatN>(Constants::template get<Float, 0>());
+  u = zivc::fma(u, s, make<FloatN>(Constants::template get<Float, 1>()));
+  u = zivc::fma(u, s, make<FloatN>(Constants::template get<Float, 2>()));
+  u = zivc::fma(u, s, make<FloatN>(Constants::template get<Float, 3>()));
+  u = zivc::fma(u, s, make<FloatN>(Constants::template get<Float, 4>()));
+  if constexpr (sizeof(Float) == 8) {
+    u = zivc::fma(u, s, make<FloatN>(Constants::template get<Float, 5>()));
+    u = zivc::fma(u, s, make<FloatN>(Constants::template get<Float, 6>()));
+    u = zivc::fma(u, s, make<FloatN>(Constants::template get<Float, 7>()));
+    u = zivc::fma(u, s, make<FloatN>(Constants::template get<Float, 8>()));
+    u = zivc::fma(u, s, make<FloatN>(Constants::template get<Float, 9>()));
+  }
+  return u;
+}
+
+/*!
+  \details Subnormal numbers are scaled by 2^64 before the decomposition
+  */
+template <typename FloatN, typename IntegerNPtr> inline
+FloatN Math::Zivc::logReduceImpl(const FloatN x, IntegerNPtr e) noexcept
+{
+  static_assert(kIsFloatingPoint<FloatN>, "The FloatN isn't floating point.");
+  using Float = typename VectorTypeInfo<FloatN>::ElementType;
+  using FLimits = NumericLimits<Float>;
+
+  constexpr auto two = static_cast<Float>(2.0);
+  const auto is_subnormal = zivc::isless(x, make<FloatN>(FLimits::min()));
+  const auto d = zivc::select(x, x * static_cast<Float>(1ull << 63) * two, is_subnormal);
+  const auto k = ilogbRawImpl(d * static_cast<Float>(1.0 / 0.75));
+  const auto m = ldexpRawImpl(d, -k);
+  *e = zivc::select(k, k - 64, is_subnormal);
+  return m;
+}
+
+/*!
+  */
+template <typename FloatN> inline
+FloatN Math::Zivc::logPolyImpl(const FloatN z2) noexcept
+{
+  static_assert(kIsFloatingPoint<FloatN>, "The FloatN isn't floating point.");
+  using Float = typename VectorTypeInfo<FloatN>::ElementType;
+  using Constants = LogPolyConstants;
+
+  auto t = make<FloatN>(Constants::template get<Float, 0>());
+  t = zivc::fma(t, z2, make<FloatN>(Constants::template get<Float, 1>()));
+  t = zivc::fma(t, z2, make<FloatN>(Constants::template get<Float, 2>()));
+  if constexpr (sizeof(Float) == 8) {
+    t = zivc::fma(t, z2, make<FloatN>(Constants::template get<Float, 3>()));
+    t = zivc::fma(t, z2, make<FloatN>(Constants::template get<Float, 4>()));
+    t = zivc::fma(t, z2, make<FloatN>(Constants::template get<Float, 5>()));
+    t = zivc::fma(t, z2, make<FloatN>(Constants::template get<Float, 6>()));
+    t = zivc::fma(t, z2, make<FloatN>(Constants::template get<Float, 7>()));
+    t = zivc::fma(t, z2, make<FloatN>(Constants::template get<Float, 8>()));
+  }
+  return t;
+}
+
+/*!
+  \details The given result is |base|^e
+  */
+template <typename FloatN> inline
+FloatN Math::Zivc::powSpecialImpl(FloatN y, const FloatN base, const FloatN e) noexcept
+{
+  static_assert(kIsFloatingPoint<FloatN>, "The FloatN isn't floating point.");
+  using Float = typename VectorTypeInfo<FloatN>::ElementType;
+  using FloatInfo = FloatingPointFromBytes<sizeof(Float)>;
+  using FLimits = NumericLimits<Float>;
+  using IntN = IntegerTypeFromVec<FloatN>;
+
+  constexpr auto zero = static_cast<Float>(0.0);
+  constexpr auto one = static_cast<Float>(1.0);
+  const auto zerov = make<FloatN>(zero);
+  const auto onev = make<FloatN>(one);
+  const auto inf = make<FloatN>(FLimits::infinity());
+
+  // Parity of the exponent. All floats not less than 2^p are even integers
+  constexpr size_t sig_size = FloatInfo::significandBitSize();
+  constexpr auto large = static_cast<Float>(1ull << (sig_size + 1));
+  const auto is_small = zivc::isless(zivc::abs(e), make<FloatN>(large));
+  const auto is_frac = zivc::isnotequal(zivc::trunc(e), e);
+  const auto is_odd = zivc::isequal(zivc::trunc(e), e) & is_small &
+      Algorithm::isOdd(cast<IntN>(zivc::select(zerov, e, is_small)));
+
+  // Negative base
+  {
+    const auto is_negative = zivc::isless(base, zerov);
+    y = zivc::select(y, -y, is_negative & is_odd);
+    y = zivc::select(y, make<FloatN>(FLimits::quietNan()), is_negative & is_frac);
+  }
+  // Special cases
+  {
+    const auto efx = mulsign(zivc::abs(base) - onev, e);
+    auto t = zivc::select(inf, onev, zivc::isequal(efx, zerov));
+    t = zivc::select(t, zerov, zivc::isless(efx, zerov));
+    y = zivc::select(y, t, zivc::isinf(e));
+
+    const auto s = zivc::select(onev, mulsign(onev, base), is_odd);
+    const auto ex = zivc::select(e, -e, zivc::isequal(base, zerov));
+    t = s * zivc::select(inf, zerov, zivc::isless(ex, zerov));
+    y = zivc::select(y, t, zivc::isinf(base) | zivc::isequal(base, zerov));
+
+    y = zivc::select(y, make<FloatN>(FLimits::quietNan()), zivc::isnan(base) | zivc::isnan(e));
+    y = zivc::select(y, onev, zivc::isequal(e, zerov) | zivc::isequal(base, onev));
+  }
+  return y;
+}
+
 /*!
   */
 template <typename FloatN> inline
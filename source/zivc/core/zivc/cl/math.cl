@@ -260,9 +260,53 @@ class Math
   };
 
   /*!
+    \brief Approximate math functions with the documented error bounds
+
+    The functions are computed in the working precision instead of
+    the double-float of the Zivc functions. The maximum errors are
+    exp, exp2: 2 ulp, log, log2: 3 ulp and
+    pow: 4 + 2 |e log2(base)| ulp, and the special cases are same as
+    the Zivc functions. Unlike the builtin native functions,
+    the results don't depend on devices
+    */
+  class Fast
+  {
+   public:
+    // Exponential functions
+
+    //! Return e raised to the given power
+    template <typename FloatN>
+    static FloatN exp(const FloatN x) noexcept;
+
+    //! Return 2 raised to the given power
+    template <typename FloatN>
+    static FloatN exp2(const FloatN x) noexcept;
+
+    //! Compute natural logarithm of the given number
+    template <typename FloatN>
+    static FloatN log(const FloatN x) noexcept;
+
+    //! Compute base2 logarithm of the given number
+    template <typename FloatN>
+    static FloatN log2(const FloatN x) noexcept;
+
+    // Power functions
+
+    //! Raise a number to the given power
+    template <typename FloatN>
+    static FloatN pow(const FloatN base, const FloatN e) noexcept;
+  };
+
+  /*!
+    \brief Math functions which are implemented in software
+
+    exp, exp2, log, log2 and pow are computed in double-float arithmetic,
+    so their results are within 1 ulp of the exact results
     */
   class Zivc
   {
+    friend class Fast;
+
    public:
     // Nearest integer floating point operations
 
@@ -389,6 +433,18 @@ class Math
       static constexpr Float get() noexcept;
     };
 
+    struct ExpPolyConstants
+    {
+      template <typename Float, size_t kIndex>
+      static constexpr Float get() noexcept;
+    };
+
+    struct LogPolyConstants
+    {
+      template <typename Float, size_t kIndex>
+      static constexpr Float get() noexcept;
+    };
+
     template <typename FloatN>
     struct F2
     {
@@ -411,6 +467,33 @@ class Math
     template <typename FloatN>
     static F2<FloatN> normalizeF2(const F2<FloatN> x) noexcept;
 
+    template <typename FloatN>
+    static F2<FloatN> addFF2(const FloatN lhs, const F2<FloatN> rhs) noexcept;
+
+    template <typename FloatN>
+    static F2<FloatN> addF2F2(const F2<FloatN> lhs, const F2<FloatN> rhs) noexcept;
+
+    template <typename FloatN>
+    static F2<FloatN> add2FF(const FloatN lhs, const FloatN rhs) noexcept;
+
+    template <typename FloatN>
+    static F2<FloatN> add2F2F(const F2<FloatN> lhs, const FloatN rhs) noexcept;
+
+    template <typename FloatN>
+    static F2<FloatN> mulF2F(const F2<FloatN> lhs, const FloatN rhs) noexcept;
+
+    template <typename FloatN>
+    static F2<FloatN> mulF2F2(const F2<FloatN> lhs, const F2<FloatN> rhs) noexcept;
+
+    template <typename FloatN>
+    static F2<FloatN> squF2(const F2<FloatN> x) noexcept;
+
+    template <typename FloatN>
+    static F2<FloatN> divF2F2(const F2<FloatN> lhs, const F2<FloatN> rhs) noexcept;
+
+    template <typename FloatN>
+    static F2<FloatN> scaleF2(const F2<FloatN> x, const FloatN s) noexcept;
+
     template <typename FloatN>
     static FloatN toward0(const FloatN x) noexcept;
 
@@ -510,6 +593,51 @@ class Math
     template <typename Float, size_t kIndex>
     static constexpr auto getAtanCoeff() noexcept;
 
+    template <typename Float, size_t kIndex>
+    static constexpr Float getExpCoeff() noexcept;
+
+    template <typename Float, size_t kIndex>
+    static constexpr Float getLn2() noexcept;
+
+    template <typename Float, size_t kIndex>
+    static constexpr Float getInvLn2() noexcept;
+
+    //! Extracts exponent of the given number without the special cases
+    template <typename FloatN>
+    static auto ilogbRawImpl(const FloatN x) noexcept;
+
+    //! Add the exponent of the given number without the special cases
+    template <typename FloatN, typename IntegerN>
+    static FloatN ldexpRawImpl(const FloatN x, const IntegerN e) noexcept;
+
+    //! Compute natural logarithm in double-float precision
+    template <typename FloatN>
+    static F2<FloatN> logF2Impl(const FloatN x) noexcept;
+
+    //! Compute e raised to the given double-float power
+    template <typename FloatN>
+    static FloatN expF2Impl(const F2<FloatN> x) noexcept;
+
+    //! Compute e^s * 2^q of the reduced argument s
+    template <typename FloatN>
+    static FloatN expReducedImpl(const F2<FloatN> s, const FloatN q) noexcept;
+
+    //! Evaluate the polynomial u of e^s = 1 + s + s^2 * u(s)
+    template <typename FloatN>
+    static FloatN expPolyImpl(const FloatN s) noexcept;
+
+    //! Decompose x into m * 2^e, where m is in [0.75, 1.5)
+    template <typename FloatN, typename IntegerNPtr>
+    static FloatN logReduceImpl(const FloatN x, IntegerNPtr e) noexcept;
+
+    //! Evaluate the polynomial t of log((1 + z) / (1 - z)) = 2z + z^3 * (c + z^2 * t(z^2))
+    template <typename FloatN>
+    static FloatN logPolyImpl(const FloatN z2) noexcept;
+
+    //! Apply the special cases of pow to the given result
+    template <typename FloatN>
+    static FloatN powSpecialImpl(FloatN y, const FloatN base, const FloatN e) noexcept;
+
     //! Extracts exponent of the given number
     template <typename FloatN>
     static auto ilogbImpl(FloatN x) noexcept;
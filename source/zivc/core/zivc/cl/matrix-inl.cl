@@ -0,0 +1,442 @@
+/*!
+  \file matrix-inl.cl
+  \author Sho Ikeda
+
+  Copyright (c) 2015-2021 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZIVC_MATRIX_INL_CL
+#define ZIVC_MATRIX_INL_CL
+
+#include "matrix.cl"
+// Zivc
+#include "types.cl"
+#include "type_traits.cl"
+#include "utility.cl"
+
+namespace zivc {
+
+/*!
+  */
+template <typename T, size_t kRows, size_t kCols> inline
+Matrix<T, kRows, kCols>::Matrix() noexcept
+{
+  for (size_t i = 0; i < kRows; ++i)
+    rows_[i] = RowVector{};
+}
+
+/*!
+  */
+template <typename T, size_t kRows, size_t kCols> inline
+Matrix<T, kRows, kCols>::Matrix(const RowVector r0, const RowVector r1) noexcept
+    : rows_{r0, r1}
+{
+  static_assert(kRows == 2, "The number of rows isn't 2.");
+}
+
+/*!
+  */
+template <typename T, size_t kRows, size_t kCols> inline
+Matrix<T, kRows, kCols>::Matrix(const RowVector r0,
+                                const RowVector r1,
+                                const RowVector r2) noexcept
+    : rows_{r0, r1, r2}
+{
+  static_assert(kRows == 3, "The number of rows isn't 3.");
+}
+
+/*!
+  */
+template <typename T, size_t kRows, size_t kCols> inline
+Matrix<T, kRows, kCols>::Matrix(const RowVector r0,
+                                const RowVector r1,
+                                const RowVector r2,
+                                const RowVector r3) noexcept
+    : rows_{r0, r1, r2, r3}
+{
+  static_assert(kRows == 4, "The number of rows isn't 4.");
+}
+
+/*!
+  */
+template <typename T, size_t kRows, size_t kCols> inline
+auto Matrix<T, kRows, kCols>::operator[](const size_t row) noexcept -> RowVector&
+{
+  return rows_[row];
+}
+
+/*!
+  */
+template <typename T, size_t kRows, size_t kCols> inline
+auto Matrix<T, kRows, kCols>::operator[](const size_t row) const noexcept
+    -> const RowVector&
+{
+  return rows_[row];
+}
+
+/*!
+  */
+template <typename T, size_t kRows, size_t kCols> inline
+auto Matrix<T, kRows, kCols>::operator()(const size_t row,
+                                         const size_t column) const noexcept -> Type
+{
+  return at(row, column);
+}
+
+/*!
+  */
+template <typename T, size_t kRows, size_t kCols> inline
+auto Matrix<T, kRows, kCols>::operator+=(const Matrix& other) noexcept -> Matrix&
+{
+  for (size_t i = 0; i < kRows; ++i)
+    rows_[i] = rows_[i] + other.rows_[i];
+  return *this;
+}
+
+/*!
+  */
+template <typename T, size_t kRows, size_t kCols> inline
+auto Matrix<T, kRows, kCols>::operator-=(const Matrix& other) noexcept -> Matrix&
+{
+  for (size_t i = 0; i < kRows; ++i)
+    rows_[i] = rows_[i] - other.rows_[i];
+  return *this;
+}
+
+/*!
+  */
+template <typename T, size_t kRows, size_t kCols> inline
+auto Matrix<T, kRows, kCols>::operator*=(const Type scalar) noexcept -> Matrix&
+{
+  for (size_t i = 0; i < kRows; ++i)
+    rows_[i] = rows_[i] * scalar;
+  return *this;
+}
+
+/*!
+  */
+template <typename T, size_t kRows, size_t kCols> inline
+auto Matrix<T, kRows, kCols>::column(const size_t column) const noexcept
+    -> ColumnVector
+{
+  ColumnVector c = ColumnVector{};
+  for (size_t i = 0; i < kRows; ++i)
+    c[i] = at(i, column);
+  return c;
+}
+
+/*!
+  \details The determinant of a 4x4 matrix is computed from the 2x2 minors
+  of the upper and lower two rows
+  */
+template <typename T, size_t kRows, size_t kCols> inline
+auto Matrix<T, kRows, kCols>::determinant() const noexcept -> Type
+{
+  static_assert(kRows == kCols, "The matrix isn't square.");
+  const Matrix& m = *this;
+  Type d = static_cast<Type>(0);
+  if constexpr (kRows == 2) {
+    d = m(0, 0) * m(1, 1) - m(0, 1) * m(1, 0);
+  }
+  else if constexpr (kRows == 3) {
+    d = m(0, 0) * (m(1, 1) * m(2, 2) - m(1, 2) * m(2, 1)) -
+        m(0, 1) * (m(1, 0) * m(2, 2) - m(1, 2) * m(2, 0)) +
+        m(0, 2) * (m(1, 0) * m(2, 1) - m(1, 1) * m(2, 0));
+  }
+  else {
+    const Type s0 = m(0, 0) * m(1, 1) - m(1, 0) * m(0, 1);
+    const Type s1 = m(0, 0) * m(1, 2) - m(1, 0) * m(0, 2);
+    const Type s2 = m(0, 0) * m(1, 3) - m(1, 0) * m(0, 3);
+    const Type s3 = m(0, 1) * m(1, 2) - m(1, 1) * m(0, 2);
+    const Type s4 = m(0, 1) * m(1, 3) - m(1, 1) * m(0, 3);
+    const Type s5 = m(0, 2) * m(1, 3) - m(1, 2) * m(0, 3);
+    const Type c0 = m(2, 0) * m(3, 1) - m(3, 0) * m(2, 1);
+    const Type c1 = m(2, 0) * m(3, 2) - m(3, 0) * m(2, 2);
+    const Type c2 = m(2, 0) * m(3, 3) - m(3, 0) * m(2, 3);
+    const Type c3 = m(2, 1) * m(3, 2) - m(3, 1) * m(2, 2);
+    const Type c4 = m(2, 1) * m(3, 3) - m(3, 1) * m(2, 3);
+    const Type c5 = m(2, 2) * m(3, 3) - m(3, 2) * m(2, 3);
+    d = s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+  }
+  return d;
+}
+
+/*!
+  */
+template <typename T, size_t kRows, size_t kCols> inline
+auto Matrix<T, kRows, kCols>::get(const size_t row,
+                                  const size_t column) const noexcept -> Type
+{
+  return at(row, column);
+}
+
+/*!
+  */
+template <typename T, size_t kRows, size_t kCols> inline
+auto Matrix<T, kRows, kCols>::identity() noexcept -> Matrix
+{
+  static_assert(kRows == kCols, "The matrix isn't square.");
+  Matrix m{};
+  for (size_t i = 0; i < kRows; ++i)
+    m.set(i, i, static_cast<Type>(1));
+  return m;
+}
+
+/*!
+  \details The inverse is the adjugate divided by the determinant.
+  The result is undefined if the matrix is singular
+  */
+template <typename T, size_t kRows, size_t kCols> inline
+auto Matrix<T, kRows, kCols>::inverse() const noexcept -> Matrix
+{
+  static_assert(kRows == kCols, "The matrix isn't square.");
+  const Matrix& m = *this;
+  Matrix r{};
+  if constexpr (kRows == 2) {
+    const Type inv_d = static_cast<Type>(1) / determinant();
+    r.rows_[0] = RowVector{m(1, 1), -m(0, 1)} * inv_d;
+    r.rows_[1] = RowVector{-m(1, 0), m(0, 0)} * inv_d;
+  }
+  else if constexpr (kRows == 3) {
+    const RowVector r0 = RowVector{m(1, 1) * m(2, 2) - m(1, 2) * m(2, 1),
+                                   m(0, 2) * m(2, 1) - m(0, 1) * m(2, 2),
+                                   m(0, 1) * m(1, 2) - m(0, 2) * m(1, 1)};
+    const RowVector r1 = RowVector{m(1, 2) * m(2, 0) - m(1, 0) * m(2, 2),
+                                   m(0, 0) * m(2, 2) - m(0, 2) * m(2, 0),
+                                   m(0, 2) * m(1, 0) - m(0, 0) * m(1, 2)};
+    const RowVector r2 = RowVector{m(1, 0) * m(2, 1) - m(1, 1) * m(2, 0),
+                                   m(0, 1) * m(2, 0) - m(0, 0) * m(2, 1),
+                                   m(0, 0) * m(1, 1) - m(0, 1) * m(1, 0)};
+    const Type d = m(0, 0) * r0[0] + m(0, 1) * r1[0] + m(0, 2) * r2[0];
+    const Type inv_d = static_cast<Type>(1) / d;
+    r.rows_[0] = r0 * inv_d;
+    r.rows_[1] = r1 * inv_d;
+    r.rows_[2] = r2 * inv_d;
+  }
+  else {
+    const Type s0 = m(0, 0) * m(1, 1) - m(1, 0) * m(0, 1);
+    const Type s1 = m(0, 0) * m(1, 2) - m(1, 0) * m(0, 2);
+    const Type s2 = m(0, 0) * m(1, 3) - m(1, 0) * m(0, 3);
+    const Type s3 = m(0, 1) * m(1, 2) - m(1, 1) * m(0, 2);
+    const Type s4 = m(0, 1) * m(1, 3) - m(1, 1) * m(0, 3);
+    const Type s5 = m(0, 2) * m(1, 3) - m(1, 2) * m(0, 3);
+    const Type c0 = m(2, 0) * m(3, 1) - m(3, 0) * m(2, 1);
+    const Type c1 = m(2, 0) * m(3, 2) - m(3, 0) * m(2, 2);
+    const Type c2 = m(2, 0) * m(3, 3) - m(3, 0) * m(2, 3);
+    const Type c3 = m(2, 1) * m(3, 2) - m(3, 1) * m(2, 2);
+    const Type c4 = m(2, 1) * m(3, 3) - m(3, 1) * m(2, 3);
+    const Type c5 = m(2, 2) * m(3, 3) - m(3, 2) * m(2, 3);
+    const Type d = s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+    const Type inv_d = static_cast<Type>(1) / d;
+    r.rows_[0] = RowVector{ m(1, 1) * c5 - m(1, 2) * c4 + m(1, 3) * c3,
+                           -m(0, 1) * c5 + m(0, 2) * c4 - m(0, 3) * c3,
+                            m(3, 1) * s5 - m(3, 2) * s4 + m(3, 3) * s3,
+                           -m(2, 1) * s5 + m(2, 2) * s4 - m(2, 3) * s3} * inv_d;
+    r.rows_[1] = RowVector{-m(1, 0) * c5 + m(1, 2) * c2 - m(1, 3) * c1,
+                            m(0, 0) * c5 - m(0, 2) * c2 + m(0, 3) * c1,
+                           -m(3, 0) * s5 + m(3, 2) * s2 - m(3, 3) * s1,
+                            m(2, 0) * s5 - m(2, 2) * s2 + m(2, 3) * s1} * inv_d;
+    r.rows_[2] = RowVector{ m(1, 0) * c4 - m(1, 1) * c2 + m(1, 3) * c0,
+                           -m(0, 0) * c4 + m(0, 1) * c2 - m(0, 3) * c0,
+                            m(3, 0) * s4 - m(3, 1) * s2 + m(3, 3) * s0,
+                           -m(2, 0) * s4 + m(2, 1) * s2 - m(2, 3) * s0} * inv_d;
+    r.rows_[3] = RowVector{-m(1, 0) * c3 + m(1, 1) * c1 - m(1, 2) * c0,
+                            m(0, 0) * c3 - m(0, 1) * c1 + m(0, 2) * c0,
+                           -m(3, 0) * s3 + m(3, 1) * s1 - m(3, 2) * s0,
+                            m(2, 0) * s3 - m(2, 1) * s1 + m(2, 2) * s0} * inv_d;
+  }
+  return r;
+}
+
+/*!
+  */
+template <typename T, size_t kRows, size_t kCols> inline
+auto Matrix<T, kRows, kCols>::row(const size_t row) const noexcept -> RowVector
+{
+  return rows_[row];
+}
+
+/*!
+  */
+template <typename T, size_t kRows, size_t kCols> inline
+void Matrix<T, kRows, kCols>::set(const size_t row,
+                                  const size_t column,
+                                  const Type value) noexcept
+{
+  rows_[row][column] = value;
+}
+
+/*!
+  */
+template <typename T, size_t kRows, size_t kCols> inline
+void Matrix<T, kRows, kCols>::setRow(const size_t row, const RowVector value) noexcept
+{
+  rows_[row] = value;
+}
+
+/*!
+  */
+template <typename T, size_t kRows, size_t kCols> inline
+auto Matrix<T, kRows, kCols>::transform(const RowVector v) const noexcept
+    -> ColumnVector
+{
+  ColumnVector result = ColumnVector{};
+  for (size_t i = 0; i < kRows; ++i) {
+    const RowVector p = rows_[i] * v;
+    Type sum = p[0];
+    for (size_t j = 1; j < kCols; ++j)
+      sum += p[j];
+    result[i] = sum;
+  }
+  return result;
+}
+
+/*!
+  \details The last column of the matrix is treated as the translation
+  */
+template <typename T, size_t kRows, size_t kCols> inline
+auto Matrix<T, kRows, kCols>::transformDirection(const PointVector v) const noexcept
+    -> PointVector
+{
+  static_assert((kRows == kCols) && (3 <= kCols), "The matrix isn't a homogeneous transformation.");
+  PointVector result = PointVector{};
+  for (size_t i = 0; i < (kRows - 1); ++i) {
+    Type sum = at(i, 0) * v[0];
+    for (size_t j = 1; j < (kCols - 1); ++j)
+      sum += at(i, j) * v[j];
+    result[i] = sum;
+  }
+  return result;
+}
+
+/*!
+  \details The point is extended with w = 1. The result is divided by w
+  unless the last row is (0, ..., 0, 1)
+  */
+template <typename T, size_t kRows, size_t kCols> inline
+auto Matrix<T, kRows, kCols>::transformPoint(const PointVector p) const noexcept
+    -> PointVector
+{
+  static_assert((kRows == kCols) && (3 <= kCols), "The matrix isn't a homogeneous transformation.");
+  PointVector result = PointVector{};
+  Type w = at(kRows - 1, kCols - 1);
+  for (size_t j = 0; j < (kCols - 1); ++j)
+    w += at(kRows - 1, j) * p[j];
+  for (size_t i = 0; i < (kRows - 1); ++i) {
+    Type sum = at(i, kCols - 1);
+    for (size_t j = 0; j < (kCols - 1); ++j)
+      sum += at(i, j) * p[j];
+    result[i] = sum;
+  }
+  if (w != static_cast<Type>(1))
+    result = result * (static_cast<Type>(1) / w);
+  return result;
+}
+
+/*!
+  */
+template <typename T, size_t kRows, size_t kCols> inline
+auto Matrix<T, kRows, kCols>::transposed() const noexcept -> TransposedMatrix
+{
+  TransposedMatrix m{};
+  for (size_t i = 0; i < kCols; ++i)
+    m.setRow(i, column(i));
+  return m;
+}
+
+/*!
+  */
+template <typename T, size_t kRows, size_t kCols> inline
+auto Matrix<T, kRows, kCols>::at(const size_t row,
+                                 const size_t column) const noexcept -> Type
+{
+  return rows_[row][column];
+}
+
+/*!
+  */
+template <typename Type, size_t kRows, size_t kCols> inline
+Matrix<Type, kRows, kCols> operator+(const Matrix<Type, kRows, kCols>& lhs,
+                                     const Matrix<Type, kRows, kCols>& rhs) noexcept
+{
+  Matrix<Type, kRows, kCols> result = lhs;
+  result += rhs;
+  return result;
+}
+
+/*!
+  */
+template <typename Type, size_t kRows, size_t kCols> inline
+Matrix<Type, kRows, kCols> operator-(const Matrix<Type, kRows, kCols>& lhs,
+                                     const Matrix<Type, kRows, kCols>& rhs) noexcept
+{
+  Matrix<Type, kRows, kCols> result = lhs;
+  result -= rhs;
+  return result;
+}
+
+/*!
+  */
+template <typename Type, size_t kRows, size_t kCols> inline
+Matrix<Type, kRows, kCols> operator*(const Matrix<Type, kRows, kCols>& lhs,
+                                     const Type rhs) noexcept
+{
+  Matrix<Type, kRows, kCols> result = lhs;
+  result *= rhs;
+  return result;
+}
+
+/*!
+  */
+template <typename Type, size_t kRows, size_t kCols> inline
+Matrix<Type, kRows, kCols> operator*(const Type lhs,
+                                     const Matrix<Type, kRows, kCols>& rhs) noexcept
+{
+  return rhs * lhs;
+}
+
+/*!
+  \details Each row of the result is a linear combination of the rows of
+  the rhs, so the product is computed with vector multiply-adds
+  */
+template <typename Type, size_t kRows, size_t kN, size_t kCols> inline
+Matrix<Type, kRows, kCols> operator*(const Matrix<Type, kRows, kN>& lhs,
+                                     const Matrix<Type, kN, kCols>& rhs) noexcept
+{
+  using RowVector = typename Matrix<Type, kRows, kCols>::RowVector;
+  Matrix<Type, kRows, kCols> result{};
+  for (size_t i = 0; i < kRows; ++i) {
+    RowVector r = rhs[0] * lhs(i, 0);
+    for (size_t k = 1; k < kN; ++k)
+      r = r + rhs[k] * lhs(i, k);
+    result.setRow(i, r);
+  }
+  return result;
+}
+
+/*!
+  \details The points are processed with a grid-stride loop,
+  so adjacent work-items load and store adjacent points.
+  The points have (kN - 1) components
+
+  \param [in] matrix No description.
+  \param [in] points No description.
+  \param [out] results No description.
+  \param [in] n No description.
+  */
+template <typename Type, size_t kN, typename PointPtr, typename OutputPtr> inline
+void transformPoints(const Matrix<Type, kN, kN>& matrix,
+                     PointPtr points,
+                     OutputPtr results,
+                     const size_t n) noexcept
+{
+  const size_t stride = getGlobalSizeX();
+  for (size_t i = getGlobalIdX(); i < n; i += stride)
+    results[i] = matrix.transformPoint(points[i]);
+}
+
+} // namespace zivc
+
+#endif /* ZIVC_MATRIX_INL_CL */
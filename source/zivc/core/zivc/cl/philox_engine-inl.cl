@@ -0,0 +1,133 @@
+/*!
+  \file philox_engine-inl.cl
+  \author Sho Ikeda
+
+  Copyright (c) 2015-2021 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZIVC_PHILOX_ENGINE_INL_CL
+#define ZIVC_PHILOX_ENGINE_INL_CL
+
+#include "philox_engine.cl"
+// Zivc
+#include "algorithm.cl"
+#include "math.cl"
+#include "math_const.cl"
+#include "types.cl"
+#include "utility.cl"
+
+namespace zivc {
+
+/*!
+  \details The results are same as the Philox4x32-10 of Random123
+  */
+inline
+uint4 PhiloxEngine::generate(uint4 counter, uint2 key) noexcept
+{
+  for (uint32b i = 0; i < kNumOfRounds - 1; ++i) {
+    counter = round(counter, key);
+    key = bumpKey(key);
+  }
+  counter = round(counter, key);
+  return counter;
+}
+
+/*!
+  \details The numbers are computed with the Box-Muller transform of
+  the pairs (x, y) and (z, w)
+  */
+inline
+float4 PhiloxEngine::generateNormal(const uint4 counter, const uint2 key) noexcept
+{
+  const float4 u = generateUniform(counter, key);
+  const float2 n0 = mapToNormal(u.x, u.y);
+  const float2 n1 = mapToNormal(u.z, u.w);
+  return makeFloat4(n0.x, n0.y, n1.x, n1.y);
+}
+
+/*!
+  */
+inline
+float4 PhiloxEngine::generateUniform(const uint4 counter, const uint2 key) noexcept
+{
+  const uint4 x = generate(counter, key);
+  return makeFloat4(mapTo01(x.x), mapTo01(x.y), mapTo01(x.z), mapTo01(x.w));
+}
+
+/*!
+  \details Different streams of the same seed don't overlap
+  */
+inline
+uint4 PhiloxEngine::makeCounter(const uint32b index_lo,
+                                const uint32b index_hi,
+                                const uint32b stream) noexcept
+{
+  return makeUInt4(index_lo, index_hi, stream, 0u);
+}
+
+/*!
+  */
+inline
+uint2 PhiloxEngine::makeKey(const uint32b seed_lo, const uint32b seed_hi) noexcept
+{
+  return makeUInt2(seed_lo, seed_hi);
+}
+
+/*!
+  \details The upper 24 bits are used, so the result is exactly representable
+  and never be 1
+  */
+inline
+float PhiloxEngine::mapTo01(const uint32b x) noexcept
+{
+  constexpr float k = 1.0f / static_cast<float>(0b1u << 24u);
+  const float result = k * static_cast<float>(x >> 8u);
+  return result;
+}
+
+/*!
+  \details The u1 is flipped into (0, 1] so that the log is finite
+  */
+inline
+float2 PhiloxEngine::mapToNormal(const float u1, const float u2) noexcept
+{
+  constexpr float two_pi = 2.0f * mathconst::Math::pi<float>();
+  const float r = Math::sqrt(-2.0f * Math::log(1.0f - u1));
+  const float theta = two_pi * u2;
+  return makeFloat2(r * Math::cos(theta), r * Math::sin(theta));
+}
+
+/*!
+  */
+inline
+constexpr size_t PhiloxEngine::numOfWords() noexcept
+{
+  const size_t n = 4;
+  return n;
+}
+
+/*!
+  */
+inline
+uint2 PhiloxEngine::bumpKey(const uint2 key) noexcept
+{
+  return makeUInt2(key.x + kWeyl0, key.y + kWeyl1);
+}
+
+/*!
+  */
+inline
+uint4 PhiloxEngine::round(const uint4 counter, const uint2 key) noexcept
+{
+  const uint32b hi0 = mulHi(kMultiplier0, counter.x);
+  const uint32b lo0 = kMultiplier0 * counter.x;
+  const uint32b hi1 = mulHi(kMultiplier1, counter.z);
+  const uint32b lo1 = kMultiplier1 * counter.z;
+  return makeUInt4(hi1 ^ counter.y ^ key.x, lo1, hi0 ^ counter.w ^ key.y, lo0);
+}
+
+} // namespace zivc
+
+#endif /* ZIVC_PHILOX_ENGINE_INL_CL */
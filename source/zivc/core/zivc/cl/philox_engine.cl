@@ -0,0 +1,75 @@
+/*!
+  \file philox_engine.cl
+  \author Sho Ikeda
+
+  Copyright (c) 2015-2021 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZIVC_PHILOX_ENGINE_CL
+#define ZIVC_PHILOX_ENGINE_CL
+
+// Zivc
+#include "types.cl"
+#include "utility.cl"
+
+namespace zivc {
+
+/*!
+  \brief Philox4x32-10 counter-based random number generator
+
+  The engine is stateless. A (counter, key) pair is mapped to four
+  independent 32bit random numbers, so any position of a stream can be
+  generated directly without sequential state.
+  A 64bit seed is used as the key and a 128bit counter selects the position.
+  */
+class PhiloxEngine
+{
+ public:
+  //! Generate four 32bit random numbers of the counter
+  static uint4 generate(uint4 counter, uint2 key) noexcept;
+
+  //! Generate four standard normal random numbers of the counter
+  static float4 generateNormal(const uint4 counter, const uint2 key) noexcept;
+
+  //! Generate four [0, 1) float random numbers of the counter
+  static float4 generateUniform(const uint4 counter, const uint2 key) noexcept;
+
+  //! Make a counter of the 64bit block index in the stream
+  static uint4 makeCounter(const uint32b index_lo,
+                           const uint32b index_hi,
+                           const uint32b stream = 0) noexcept;
+
+  //! Make a key from the 64bit seed
+  static uint2 makeKey(const uint32b seed_lo, const uint32b seed_hi) noexcept;
+
+  //! Map a 32bit random number into a [0, 1) float
+  static float mapTo01(const uint32b x) noexcept;
+
+  //! Map two [0, 1) floats into two standard normal floats
+  static float2 mapToNormal(const float u1, const float u2) noexcept;
+
+  //! Return the number of 32bit random numbers generated per counter
+  static constexpr size_t numOfWords() noexcept;
+
+ private:
+  static constexpr uint32b kNumOfRounds = 10;
+  static constexpr uint32b kMultiplier0 = 0xd2511f53u;
+  static constexpr uint32b kMultiplier1 = 0xcd9e8d57u;
+  static constexpr uint32b kWeyl0 = 0x9e3779b9u;
+  static constexpr uint32b kWeyl1 = 0xbb67ae85u;
+
+
+  //! Bump the key for the next round
+  static uint2 bumpKey(const uint2 key) noexcept;
+
+  //! Apply a round of the s-box
+  static uint4 round(const uint4 counter, const uint2 key) noexcept;
+};
+
+} // namespace zivc
+
+#include "philox_engine-inl.cl"
+
+#endif /* ZIVC_PHILOX_ENGINE_CL */
@@ -0,0 +1,121 @@
+/*!
+  \file specialization-inl.cl
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2021 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZIVC_SPECIALIZATION_INL_CL
+#define ZIVC_SPECIALIZATION_INL_CL
+
+#include "specialization.cl"
+// Zivc
+#include "types.cl"
+
+namespace zivc {
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+template <typename Type, Type kV> inline
+constexpr SpecConstant<Type, kV>::operator ValueType() const noexcept
+{
+  return kValue;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+template <typename Type, Type kV> inline
+constexpr auto SpecConstant<Type, kV>::value() noexcept -> ValueType
+{
+  return kValue;
+}
+
+/*!
+  \details The function is called as func(constant, args...), where the constant
+  is a SpecConstant of the matched candidate or the value itself
+
+  \tparam Function No description.
+  \tparam Args No description.
+  \param [in] value No description.
+  \param [in] func No description.
+  \param [in] args No description.
+  \return No description
+  */
+template <typename Type, Type ...kCandidates>
+template <typename Function, typename ...Args> inline
+auto Specializer<Type, kCandidates...>::dispatch(const Type value,
+                                                 const Function& func,
+                                                 Args... args) noexcept
+{
+  if constexpr (0 < numOfVariants())
+    return dispatchImpl<kCandidates...>(value, func, args...);
+  else
+    return func(value, args...);
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] value No description.
+  \return No description
+  */
+template <typename Type, Type ...kCandidates> inline
+constexpr bool Specializer<Type, kCandidates...>::isSpecialized(const Type value) noexcept
+{
+  const bool result = (false || ... || (value == kCandidates));
+  return result;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+template <typename Type, Type ...kCandidates> inline
+constexpr size_t Specializer<Type, kCandidates...>::numOfVariants() noexcept
+{
+  return sizeof...(kCandidates);
+}
+
+/*!
+  \details No detailed description
+
+  \tparam kCandidate No description.
+  \tparam kRest No description.
+  \tparam Function No description.
+  \tparam Args No description.
+  \param [in] value No description.
+  \param [in] func No description.
+  \param [in] args No description.
+  \return No description
+  */
+template <typename Type, Type ...kCandidates>
+template <Type kCandidate, Type ...kRest, typename Function, typename ...Args> inline
+auto Specializer<Type, kCandidates...>::dispatchImpl(const Type value,
+                                                     const Function& func,
+                                                     Args... args) noexcept
+{
+  if (value == kCandidate)
+    return func(SpecConstant<Type, kCandidate>{}, args...);
+  if constexpr (0 < sizeof...(kRest))
+    return dispatchImpl<kRest...>(value, func, args...);
+  else
+    return func(value, args...);
+}
+
+} // namespace zivc
+
+#endif // ZIVC_SPECIALIZATION_INL_CL
@@ -0,0 +1,80 @@
+/*!
+  \file specialization.cl
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2021 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZIVC_SPECIALIZATION_CL
+#define ZIVC_SPECIALIZATION_CL
+
+// Zivc
+#include "types.cl"
+
+namespace zivc {
+
+/*!
+  \brief A compile-time value which a specialized function receives
+
+  The constant is implicitly converted to the value type,
+  so a function can be written once for both constant and runtime values.
+
+  \tparam Type No description.
+  \tparam kV No description.
+  */
+template <typename Type, Type kV>
+struct SpecConstant
+{
+  using ValueType = Type;
+  static constexpr ValueType kValue = kV;
+
+  //! Return the value
+  constexpr operator ValueType() const noexcept;
+
+  //! Return the value
+  static constexpr ValueType value() noexcept;
+};
+
+/*!
+  \brief Dispatch a runtime value to the variant specialized on the value
+
+  A function is instantiated with a SpecConstant for each candidate value,
+  so the value is constant-folded in the variant. A value which isn't
+  in the candidates takes the generic variant which receives the runtime value.
+  The value should be uniform in a kernel launch to avoid divergence.
+
+  \tparam Type No description.
+  \tparam kCandidates No description.
+  */
+template <typename Type, Type ...kCandidates>
+class Specializer
+{
+ public:
+  //! Call the function variant of the given value
+  template <typename Function, typename ...Args>
+  static auto dispatch(const Type value, const Function& func, Args... args) noexcept;
+
+  //! Check if the given value has a specialized variant
+  static constexpr bool isSpecialized(const Type value) noexcept;
+
+  //! Return the number of the specialized variants
+  static constexpr size_t numOfVariants() noexcept;
+
+ private:
+  //! Compare the value with the candidate and dispatch the function
+  template <Type kCandidate, Type ...kRest, typename Function, typename ...Args>
+  static auto dispatchImpl(const Type value, const Function& func, Args... args) noexcept;
+};
+
+} // namespace zivc
+
+#include "specialization-inl.cl"
+
+#endif // ZIVC_SPECIALIZATION_CL
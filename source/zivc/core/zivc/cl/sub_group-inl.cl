@@ -0,0 +1,211 @@
+/*!
+  \file sub_group-inl.cl
+  \author Sho Ikeda
+
+  Copyright (c) 2015-2021 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZIVC_SUB_GROUP_INL_CL
+#define ZIVC_SUB_GROUP_INL_CL
+
+#include "sub_group.cl"
+// Zivc
+#include "types.cl"
+
+namespace zivc {
+
+/*!
+  */
+inline
+uint32b SubGroup::id() noexcept
+{
+  const uint32b result = static_cast<uint32b>(ZIVC_GLOBAL_NAMESPACE::get_sub_group_id());
+  return result;
+}
+
+/*!
+  */
+inline
+uint32b SubGroup::localId() noexcept
+{
+  const uint32b result = static_cast<uint32b>(ZIVC_GLOBAL_NAMESPACE::get_sub_group_local_id());
+  return result;
+}
+
+/*!
+  */
+inline
+uint32b SubGroup::maxSize() noexcept
+{
+  const uint32b result = static_cast<uint32b>(ZIVC_GLOBAL_NAMESPACE::get_max_sub_group_size());
+  return result;
+}
+
+/*!
+  */
+inline
+uint32b SubGroup::numOfSubGroups() noexcept
+{
+  const uint32b result = static_cast<uint32b>(ZIVC_GLOBAL_NAMESPACE::get_num_sub_groups());
+  return result;
+}
+
+/*!
+  */
+inline
+uint32b SubGroup::size() noexcept
+{
+  const uint32b result = static_cast<uint32b>(ZIVC_GLOBAL_NAMESPACE::get_sub_group_size());
+  return result;
+}
+
+/*!
+  */
+inline
+bool SubGroup::all(const bool predicate) noexcept
+{
+  const int32b result = ZIVC_GLOBAL_NAMESPACE::sub_group_all(predicate ? 1 : 0);
+  return result != 0;
+}
+
+/*!
+  */
+inline
+bool SubGroup::any(const bool predicate) noexcept
+{
+  const int32b result = ZIVC_GLOBAL_NAMESPACE::sub_group_any(predicate ? 1 : 0);
+  return result != 0;
+}
+
+/*!
+  */
+inline
+uint4 SubGroup::ballot(const bool predicate) noexcept
+{
+  const uint4 result = ZIVC_GLOBAL_NAMESPACE::sub_group_ballot(predicate ? 1 : 0);
+  return result;
+}
+
+/*!
+  */
+inline
+uint32b SubGroup::ballotCount(const bool predicate) noexcept
+{
+  const uint4 mask = ballot(predicate);
+  const uint32b result = ZIVC_GLOBAL_NAMESPACE::sub_group_ballot_bit_count(mask);
+  return result;
+}
+
+/*!
+  */
+template <typename Type> inline
+Type SubGroup::broadcast(const Type value, const uint32b local_id) noexcept
+{
+  const Type result = ZIVC_GLOBAL_NAMESPACE::sub_group_broadcast(value, local_id);
+  return result;
+}
+
+/*!
+  */
+template <typename Type> inline
+Type SubGroup::reduceAdd(const Type value) noexcept
+{
+  const Type result = ZIVC_GLOBAL_NAMESPACE::sub_group_reduce_add(value);
+  return result;
+}
+
+/*!
+  */
+template <typename Type> inline
+Type SubGroup::reduceMax(const Type value) noexcept
+{
+  const Type result = ZIVC_GLOBAL_NAMESPACE::sub_group_reduce_max(value);
+  return result;
+}
+
+/*!
+  */
+template <typename Type> inline
+Type SubGroup::reduceMin(const Type value) noexcept
+{
+  const Type result = ZIVC_GLOBAL_NAMESPACE::sub_group_reduce_min(value);
+  return result;
+}
+
+/*!
+  */
+template <typename Type> inline
+Type SubGroup::scanExclusiveAdd(const Type value) noexcept
+{
+  const Type result = ZIVC_GLOBAL_NAMESPACE::sub_group_scan_exclusive_add(value);
+  return result;
+}
+
+/*!
+  */
+template <typename Type> inline
+Type SubGroup::scanExclusiveMax(const Type value) noexcept
+{
+  const Type result = ZIVC_GLOBAL_NAMESPACE::sub_group_scan_exclusive_max(value);
+  return result;
+}
+
+/*!
+  */
+template <typename Type> inline
+Type SubGroup::scanExclusiveMin(const Type value) noexcept
+{
+  const Type result = ZIVC_GLOBAL_NAMESPACE::sub_group_scan_exclusive_min(value);
+  return result;
+}
+
+/*!
+  */
+template <typename Type> inline
+Type SubGroup::scanInclusiveAdd(const Type value) noexcept
+{
+  const Type result = ZIVC_GLOBAL_NAMESPACE::sub_group_scan_inclusive_add(value);
+  return result;
+}
+
+/*!
+  */
+template <typename Type> inline
+Type SubGroup::scanInclusiveMax(const Type value) noexcept
+{
+  const Type result = ZIVC_GLOBAL_NAMESPACE::sub_group_scan_inclusive_max(value);
+  return result;
+}
+
+/*!
+  */
+template <typename Type> inline
+Type SubGroup::scanInclusiveMin(const Type value) noexcept
+{
+  const Type result = ZIVC_GLOBAL_NAMESPACE::sub_group_scan_inclusive_min(value);
+  return result;
+}
+
+/*!
+  */
+template <typename Type> inline
+Type SubGroup::shuffle(const Type value, const uint32b local_id) noexcept
+{
+  const Type result = ZIVC_GLOBAL_NAMESPACE::sub_group_shuffle(value, local_id);
+  return result;
+}
+
+/*!
+  */
+template <typename Type> inline
+Type SubGroup::shuffleXor(const Type value, const uint32b mask) noexcept
+{
+  const Type result = ZIVC_GLOBAL_NAMESPACE::sub_group_shuffle_xor(value, mask);
+  return result;
+}
+
+} // namespace zivc
+
+#endif /* ZIVC_SUB_GROUP_INL_CL */
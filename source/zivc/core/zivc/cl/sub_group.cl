@@ -0,0 +1,108 @@
+/*!
+  \file sub_group.cl
+  \author Sho Ikeda
+
+  Copyright (c) 2015-2021 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZIVC_SUB_GROUP_CL
+#define ZIVC_SUB_GROUP_CL
+
+#include "types.cl"
+
+namespace zivc {
+
+/*!
+  \brief Sub-group queries and collective functions
+
+  The functions map to the cl_khr_subgroups family of built-in functions,
+  which are compiled into the SPIR-V group non-uniform operations.
+  All work-items of a sub-group must call a collective function.
+  A sub-group of the CPU backend consists of a single work-item.
+  */
+class SubGroup
+{
+ public:
+  //! Return the sub-group ID in the work-group
+  static uint32b id() noexcept;
+
+  //! Return the work-item ID in the sub-group
+  static uint32b localId() noexcept;
+
+  //! Return the maximum number of work-items in a sub-group
+  static uint32b maxSize() noexcept;
+
+  //! Return the number of sub-groups in the work-group
+  static uint32b numOfSubGroups() noexcept;
+
+  //! Return the number of work-items in the sub-group
+  static uint32b size() noexcept;
+
+  //! Check if the predicate is true for all work-items
+  static bool all(const bool predicate) noexcept;
+
+  //! Check if the predicate is true for any work-item
+  static bool any(const bool predicate) noexcept;
+
+  //! Return the bit mask of the work-items whose predicate is true
+  static uint4 ballot(const bool predicate) noexcept;
+
+  //! Return the number of the work-items whose predicate is true
+  static uint32b ballotCount(const bool predicate) noexcept;
+
+  //! Return the value of the work-item specified by the local ID
+  template <typename Type>
+  static Type broadcast(const Type value, const uint32b local_id) noexcept;
+
+  //! Return the sum of the values
+  template <typename Type>
+  static Type reduceAdd(const Type value) noexcept;
+
+  //! Return the maximum of the values
+  template <typename Type>
+  static Type reduceMax(const Type value) noexcept;
+
+  //! Return the minimum of the values
+  template <typename Type>
+  static Type reduceMin(const Type value) noexcept;
+
+  //! Return the exclusive prefix sum of the values
+  template <typename Type>
+  static Type scanExclusiveAdd(const Type value) noexcept;
+
+  //! Return the exclusive prefix maximum of the values
+  template <typename Type>
+  static Type scanExclusiveMax(const Type value) noexcept;
+
+  //! Return the exclusive prefix minimum of the values
+  template <typename Type>
+  static Type scanExclusiveMin(const Type value) noexcept;
+
+  //! Return the inclusive prefix sum of the values
+  template <typename Type>
+  static Type scanInclusiveAdd(const Type value) noexcept;
+
+  //! Return the inclusive prefix maximum of the values
+  template <typename Type>
+  static Type scanInclusiveMax(const Type value) noexcept;
+
+  //! Return the inclusive prefix minimum of the values
+  template <typename Type>
+  static Type scanInclusiveMin(const Type value) noexcept;
+
+  //! Return the value of the work-item specified by the local ID
+  template <typename Type>
+  static Type shuffle(const Type value, const uint32b local_id) noexcept;
+
+  //! Return the value of the work-item whose local ID is (localId() ^ mask)
+  template <typename Type>
+  static Type shuffleXor(const Type value, const uint32b mask) noexcept;
+};
+
+} // namespace zivc
+
+#include "sub_group-inl.cl"
+
+#endif /* ZIVC_SUB_GROUP_CL */
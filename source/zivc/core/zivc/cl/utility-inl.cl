@@ -832,6 +832,23 @@ Type treatAs(T object) noexcept
   return result;
 }
 
+/*!
+  \details The address is a device address of a buffer given by Buffer::deviceAddress().
+  The kernel set must be built with BUFFER_DEVICE_ADDRESS option on Vulkan
+  */
+template <typename Type> inline
+GlobalPtr<Type> toGlobalPtr(const uint64b address) noexcept
+{
+#if defined(ZIVC_CPU)
+  using Pointer = typename GlobalPtr<Type>::Pointer;
+  auto data = reinterpret_cast<Pointer>(static_cast<size_t>(address));
+  return GlobalPtr<Type>{data};
+#else // ZIVC_CPU
+  auto result = reinterpret_cast<GlobalPtr<Type>>(address);
+  return result;
+#endif // ZIVC_CPU
+}
+
 /*!
   */
 template <typename Type> inline
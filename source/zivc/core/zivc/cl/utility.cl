@@ -341,6 +341,10 @@ bool equal(const Type1& lhs, const Type2& rhs) noexcept;
 template <typename Type, typename T>
 Type treatAs(T object) noexcept;
 
+//! Make a global pointer from the given buffer device address
+template <typename Type>
+GlobalPtr<Type> toGlobalPtr(const uint64b address) noexcept;
+
 //!
 template <typename Type>
 Type&& forward(RemoveReferenceType<Type>& t) noexcept;
@@ -119,10 +119,22 @@ auto VectorData::loadHalfImpl(const size_t offset, AddressSpaceType p) noexcept
       static_assert(0 < kN, "The size of vector is wrong.");
     }
 #else // ZIVC_CPU
-    (void)offset;
-    (void)p;
-    const auto data = make<FloatVec<kN>>(0.0f);
-    return data;
+    // The half elements are converted one by one as a storage type
+    if constexpr (kN == 1) {
+      const float data = static_cast<float>(p[offset]);
+      return data;
+    }
+    else {
+      FloatVec<kN> data{};
+      const size_t index = kN * offset;
+      data.x = static_cast<float>(p[index]);
+      data.y = static_cast<float>(p[index + 1]);
+      if constexpr (3 <= kN)
+        data.z = static_cast<float>(p[index + 2]);
+      if constexpr (4 <= kN)
+        data.w = static_cast<float>(p[index + 3]);
+      return data;
+    }
 #endif // ZIVC_CPU
   }
   else if constexpr (kIsSame<uint16b, ElemType>) {
@@ -220,9 +232,19 @@ void VectorData::storeHalfImpl(const VectorType data,
       static_assert(0 < n, "The size of vector is wrong.");
     }
 #else // ZIVC_CPU
-    (void)data;
-    (void)offset;
-    (void)p;
+    // The half elements are converted one by one as a storage type
+    if constexpr (n == 1) {
+      p[offset] = static_cast<half>(data);
+    }
+    else {
+      const size_t index = n * offset;
+      p[index] = static_cast<half>(data.x);
+      p[index + 1] = static_cast<half>(data.y);
+      if constexpr (3 <= n)
+        p[index + 2] = static_cast<half>(data.z);
+      if constexpr (4 <= n)
+        p[index + 3] = static_cast<half>(data.w);
+    }
 #endif // ZIVC_CPU
   }
   else if constexpr (kIsSame<uint16b, ElemType>) {
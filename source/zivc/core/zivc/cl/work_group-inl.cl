@@ -0,0 +1,231 @@
+/*!
+  \file work_group-inl.cl
+  \author Sho Ikeda
+
+  Copyright (c) 2015-2021 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZIVC_WORK_GROUP_INL_CL
+#define ZIVC_WORK_GROUP_INL_CL
+
+#include "work_group.cl"
+// Zivc
+#include "algorithm.cl"
+#include "sub_group.cl"
+#include "synchronization.cl"
+#include "types.cl"
+#include "utility.cl"
+
+namespace zivc {
+
+/*!
+  */
+inline
+bool WorkGroup::all(const bool predicate, LocalPtr<uint32b> storage) noexcept
+{
+  const uint32b n = reduceImpl<kMin>(predicate ? 1u : 0u, storage);
+  return n != 0;
+}
+
+/*!
+  */
+inline
+bool WorkGroup::any(const bool predicate, LocalPtr<uint32b> storage) noexcept
+{
+  const uint32b n = reduceImpl<kMax>(predicate ? 1u : 0u, storage);
+  return n != 0;
+}
+
+/*!
+  */
+template <typename Type> inline
+Type WorkGroup::broadcast(const Type value,
+                          const size_t local_id,
+                          LocalPtr<Type> storage) noexcept
+{
+  if (getLocalLinearId() == local_id)
+    storage[0] = value;
+  Synchronization::barrierLocal();
+  const Type result = storage[0];
+  Synchronization::barrierLocal();
+  return result;
+}
+
+/*!
+  */
+template <typename Type> inline
+Type WorkGroup::reduceAdd(const Type value, LocalPtr<Type> storage) noexcept
+{
+  return reduceImpl<kAdd>(value, storage);
+}
+
+/*!
+  */
+template <typename Type> inline
+Type WorkGroup::reduceMax(const Type value, LocalPtr<Type> storage) noexcept
+{
+  return reduceImpl<kMax>(value, storage);
+}
+
+/*!
+  */
+template <typename Type> inline
+Type WorkGroup::reduceMin(const Type value, LocalPtr<Type> storage) noexcept
+{
+  return reduceImpl<kMin>(value, storage);
+}
+
+/*!
+  */
+template <typename Type> inline
+Type WorkGroup::scanExclusiveAdd(const Type value, LocalPtr<Type> storage) noexcept
+{
+  return scanImpl<kAdd, true>(value, storage);
+}
+
+/*!
+  */
+template <typename Type> inline
+Type WorkGroup::scanExclusiveMax(const Type value, LocalPtr<Type> storage) noexcept
+{
+  return scanImpl<kMax, true>(value, storage);
+}
+
+/*!
+  */
+template <typename Type> inline
+Type WorkGroup::scanExclusiveMin(const Type value, LocalPtr<Type> storage) noexcept
+{
+  return scanImpl<kMin, true>(value, storage);
+}
+
+/*!
+  */
+template <typename Type> inline
+Type WorkGroup::scanInclusiveAdd(const Type value, LocalPtr<Type> storage) noexcept
+{
+  return scanImpl<kAdd, false>(value, storage);
+}
+
+/*!
+  */
+template <typename Type> inline
+Type WorkGroup::scanInclusiveMax(const Type value, LocalPtr<Type> storage) noexcept
+{
+  return scanImpl<kMax, false>(value, storage);
+}
+
+/*!
+  */
+template <typename Type> inline
+Type WorkGroup::scanInclusiveMin(const Type value, LocalPtr<Type> storage) noexcept
+{
+  return scanImpl<kMin, false>(value, storage);
+}
+
+/*!
+  */
+template <uint32b kOp, typename Type> inline
+Type WorkGroup::apply(const Type lhs, const Type rhs) noexcept
+{
+  Type result = lhs;
+  if constexpr (kOp == kAdd)
+    result = lhs + rhs;
+  else if constexpr (kOp == kMin)
+    result = zivc::min(lhs, rhs);
+  else
+    result = zivc::max(lhs, rhs);
+  return result;
+}
+
+/*!
+  \details Each sub-group stores its partial result into the storage,
+  then every work-item folds the partial results.
+  The number of sub-groups is small, so the fold is cheaper than
+  another round of barriers
+  */
+template <uint32b kOp, typename Type> inline
+Type WorkGroup::reduceImpl(const Type value, LocalPtr<Type> storage) noexcept
+{
+  const Type partial = reduceSubGroup<kOp>(value);
+  if (SubGroup::localId() == 0)
+    storage[SubGroup::id()] = partial;
+  Synchronization::barrierLocal();
+  Type result = storage[0];
+  for (uint32b i = 1; i < SubGroup::numOfSubGroups(); ++i)
+    result = apply<kOp>(result, storage[i]);
+  Synchronization::barrierLocal();
+  return result;
+}
+
+/*!
+  */
+template <uint32b kOp, typename Type> inline
+Type WorkGroup::reduceSubGroup(const Type value) noexcept
+{
+  Type result = value;
+  if constexpr (kOp == kAdd)
+    result = SubGroup::reduceAdd(value);
+  else if constexpr (kOp == kMin)
+    result = SubGroup::reduceMin(value);
+  else
+    result = SubGroup::reduceMax(value);
+  return result;
+}
+
+/*!
+  \details The last work-item of each sub-group stores the aggregate of
+  the sub-group into the storage, then the prefix of the preceding
+  sub-groups is combined with the scan of the sub-group
+  */
+template <uint32b kOp, bool kIsExclusive, typename Type> inline
+Type WorkGroup::scanImpl(const Type value, LocalPtr<Type> storage) noexcept
+{
+  const Type inclusive = scanSubGroup<kOp, false>(value);
+  if (SubGroup::localId() == (SubGroup::size() - 1))
+    storage[SubGroup::id()] = inclusive;
+  Synchronization::barrierLocal();
+  Type result = kIsExclusive ? scanSubGroup<kOp, true>(value) : inclusive;
+  const uint32b group_id = SubGroup::id();
+  if (0 < group_id) {
+    Type prefix = storage[0];
+    for (uint32b i = 1; i < group_id; ++i)
+      prefix = apply<kOp>(prefix, storage[i]);
+    // The exclusive scan of the first work-item is the identity
+    const bool is_first = kIsExclusive && (SubGroup::localId() == 0);
+    result = is_first ? prefix : apply<kOp>(prefix, result);
+  }
+  Synchronization::barrierLocal();
+  return result;
+}
+
+/*!
+  */
+template <uint32b kOp, bool kIsExclusive, typename Type> inline
+Type WorkGroup::scanSubGroup(const Type value) noexcept
+{
+  Type result = value;
+  if constexpr (kIsExclusive) {
+    if constexpr (kOp == kAdd)
+      result = SubGroup::scanExclusiveAdd(value);
+    else if constexpr (kOp == kMin)
+      result = SubGroup::scanExclusiveMin(value);
+    else
+      result = SubGroup::scanExclusiveMax(value);
+  }
+  else {
+    if constexpr (kOp == kAdd)
+      result = SubGroup::scanInclusiveAdd(value);
+    else if constexpr (kOp == kMin)
+      result = SubGroup::scanInclusiveMin(value);
+    else
+      result = SubGroup::scanInclusiveMax(value);
+  }
+  return result;
+}
+
+} // namespace zivc
+
+#endif /* ZIVC_WORK_GROUP_INL_CL */
@@ -0,0 +1,112 @@
+/*!
+  \file work_group.cl
+  \author Sho Ikeda
+
+  Copyright (c) 2015-2021 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZIVC_WORK_GROUP_CL
+#define ZIVC_WORK_GROUP_CL
+
+#include "types.cl"
+
+namespace zivc {
+
+/*!
+  \brief Work-group collective functions
+
+  The collectives are built on the sub-group collectives.
+  The partial results of sub-groups are exchanged through the given
+  local memory, which must have numOfSubGroups() elements at least.
+  The local memory can be reused after a collective returns.
+  All work-items of a work-group must call a collective function.
+  */
+class WorkGroup
+{
+ public:
+  //! Check if the predicate is true for all work-items
+  static bool all(const bool predicate, LocalPtr<uint32b> storage) noexcept;
+
+  //! Check if the predicate is true for any work-item
+  static bool any(const bool predicate, LocalPtr<uint32b> storage) noexcept;
+
+  //! Return the value of the work-item specified by the local linear ID
+  template <typename Type>
+  static Type broadcast(const Type value,
+                        const size_t local_id,
+                        LocalPtr<Type> storage) noexcept;
+
+  //! Return the sum of the values
+  template <typename Type>
+  static Type reduceAdd(const Type value, LocalPtr<Type> storage) noexcept;
+
+  //! Return the maximum of the values
+  template <typename Type>
+  static Type reduceMax(const Type value, LocalPtr<Type> storage) noexcept;
+
+  //! Return the minimum of the values
+  template <typename Type>
+  static Type reduceMin(const Type value, LocalPtr<Type> storage) noexcept;
+
+  //! Return the exclusive prefix sum of the values
+  template <typename Type>
+  static Type scanExclusiveAdd(const Type value, LocalPtr<Type> storage) noexcept;
+
+  //! Return the exclusive prefix maximum of the values
+  template <typename Type>
+  static Type scanExclusiveMax(const Type value, LocalPtr<Type> storage) noexcept;
+
+  //! Return the exclusive prefix minimum of the values
+  template <typename Type>
+  static Type scanExclusiveMin(const Type value, LocalPtr<Type> storage) noexcept;
+
+  //! Return the inclusive prefix sum of the values
+  template <typename Type>
+  static Type scanInclusiveAdd(const Type value, LocalPtr<Type> storage) noexcept;
+
+  //! Return the inclusive prefix maximum of the values
+  template <typename Type>
+  static Type scanInclusiveMax(const Type value, LocalPtr<Type> storage) noexcept;
+
+  //! Return the inclusive prefix minimum of the values
+  template <typename Type>
+  static Type scanInclusiveMin(const Type value, LocalPtr<Type> storage) noexcept;
+
+ private:
+  //! Binary operations of the collectives
+  enum Operation : uint32b
+  {
+    kAdd = 0,
+    kMin,
+    kMax
+  };
+
+
+  //! Apply the operation to the two values
+  template <uint32b kOp, typename Type>
+  static Type apply(const Type lhs, const Type rhs) noexcept;
+
+  //! Reduce the values of the work-group
+  template <uint32b kOp, typename Type>
+  static Type reduceImpl(const Type value, LocalPtr<Type> storage) noexcept;
+
+  //! Reduce the values of the sub-group
+  template <uint32b kOp, typename Type>
+  static Type reduceSubGroup(const Type value) noexcept;
+
+  //! Scan the values of the work-group
+  template <uint32b kOp, bool kIsExclusive, typename Type>
+  static Type scanImpl(const Type value, LocalPtr<Type> storage) noexcept;
+
+  //! Scan the values of the sub-group
+  template <uint32b kOp, bool kIsExclusive, typename Type>
+  static Type scanSubGroup(const Type value) noexcept;
+};
+
+} // namespace zivc
+
+#include "work_group-inl.cl"
+
+#endif /* ZIVC_WORK_GROUP_CL */
@@ -15,6 +15,38 @@
 
 namespace zivc {
 
+/*!
+  \details The Zivc functions are used instead of the builtin functions
+  except 'sqrt' and 'rsqrt', so the results don't depend on devices.
+  The profile is given to each kernel set
+  */
+inline
+constexpr bool Config::isStrictMathProfileUsed() noexcept
+{
+#if defined(ZIVC_MATH_PROFILE_STRICT)
+  const bool flag = true;
+#else // ZIVC_MATH_PROFILE_STRICT
+  const bool flag = false;
+#endif // ZIVC_MATH_PROFILE_STRICT
+  return flag;
+}
+
+/*!
+  \details The builtin functions are used except the functions
+  which don't lose precision, such as 'frexp' and 'ldexp'.
+  The profile is given to each kernel set
+  */
+inline
+constexpr bool Config::isFastMathProfileUsed() noexcept
+{
+#if defined(ZIVC_MATH_PROFILE_FAST)
+  const bool flag = true;
+#else // ZIVC_MATH_PROFILE_FAST
+  const bool flag = false;
+#endif // ZIVC_MATH_PROFILE_FAST
+  return flag;
+}
+
 /*!
   */
 inline
@@ -37,6 +69,8 @@ constexpr bool Config::isBuiltinMathFrexpUsed() noexcept
 #if defined(ZIVC_MATH_BUILTIN_FREXP)
   flag = true;
 #endif // ZIVC_MATH_BUILTIN_FREXP
+  if (isStrictMathProfileUsed())
+    flag = false;
   return flag;
 }
 
@@ -49,6 +83,8 @@ constexpr bool Config::isBuiltinMathLdexpUsed() noexcept
 #if defined(ZIVC_MATH_BUILTIN_LDEXP)
   flag = true;
 #endif // ZIVC_MATH_BUILTIN_LDEXP
+  if (isStrictMathProfileUsed())
+    flag = false;
   return flag;
 }
 
@@ -61,6 +97,8 @@ constexpr bool Config::isBuiltinMathIlogbUsed() noexcept
 #if defined(ZIVC_MATH_BUILTIN_ILOGB)
   flag = true;
 #endif // ZIVC_MATH_BUILTIN_ILOGB
+  if (isStrictMathProfileUsed())
+    flag = false;
   return flag;
 }
 
@@ -73,6 +111,8 @@ constexpr bool Config::isBuiltinMathModfUsed() noexcept
 #if defined(ZIVC_MATH_BUILTIN_MODF)
   flag = true;
 #endif // ZIVC_MATH_BUILTIN_MODF
+  if (isStrictMathProfileUsed())
+    flag = false;
   return flag;
 }
 
@@ -85,6 +125,10 @@ constexpr bool Config::isBuiltinMathRoundUsed() noexcept
 #if defined(ZIVC_MATH_BUILTIN_ROUND)
   flag = true;
 #endif // ZIVC_MATH_BUILTIN_ROUND
+  if (isStrictMathProfileUsed())
+    flag = false;
+  else if (isFastMathProfileUsed())
+    flag = true;
   return flag;
 }
 
@@ -97,6 +141,10 @@ constexpr bool Config::isBuiltinMathFmodUsed() noexcept
 #if defined(ZIVC_MATH_BUILTIN_FMOD)
   flag = true;
 #endif // ZIVC_MATH_BUILTIN_FMOD
+  if (isStrictMathProfileUsed())
+    flag = false;
+  else if (isFastMathProfileUsed())
+    flag = true;
   return flag;
 }
 
@@ -109,6 +157,10 @@ constexpr bool Config::isBuiltinMathExpUsed() noexcept
 #if defined(ZIVC_MATH_BUILTIN_EXP)
   flag = true;
 #endif // ZIVC_MATH_BUILTIN_EXP
+  if (isStrictMathProfileUsed())
+    flag = false;
+  else if (isFastMathProfileUsed())
+    flag = true;
   return flag;
 }
 
@@ -121,6 +173,10 @@ constexpr bool Config::isBuiltinMathLogUsed() noexcept
 #if defined(ZIVC_MATH_BUILTIN_LOG)
   flag = true;
 #endif // ZIVC_MATH_BUILTIN_LOG
+  if (isStrictMathProfileUsed())
+    flag = false;
+  else if (isFastMathProfileUsed())
+    flag = true;
   return flag;
 }
 
@@ -133,6 +189,10 @@ constexpr bool Config::isBuiltinMathPowUsed() noexcept
 #if defined(ZIVC_MATH_BUILTIN_POW)
   flag = true;
 #endif // ZIVC_MATH_BUILTIN_POW
+  if (isStrictMathProfileUsed())
+    flag = false;
+  else if (isFastMathProfileUsed())
+    flag = true;
   return flag;
 }
 
@@ -145,6 +205,8 @@ constexpr bool Config::isBuiltinMathSqrtUsed() noexcept
 #if defined(ZIVC_MATH_BUILTIN_SQRT)
   flag = true;
 #endif // ZIVC_MATH_BUILTIN_SQRT
+  if (isFastMathProfileUsed())
+    flag = true;
   return flag;
 }
 
@@ -157,6 +219,8 @@ constexpr bool Config::isBuiltinMathCbrtUsed() noexcept
 #if defined(ZIVC_MATH_BUILTIN_CBRT)
   flag = true;
 #endif // ZIVC_MATH_BUILTIN_CBRT
+  if (isStrictMathProfileUsed())
+    flag = false;
   return flag;
 }
 
@@ -169,6 +233,10 @@ constexpr bool Config::isBuiltinMathTrigonometricUsed() noexcept
 #if defined(ZIVC_MATH_BUILTIN_TRIGONOMETRIC)
   flag = true;
 #endif // ZIVC_MATH_BUILTIN_TRIGONOMETRIC
+  if (isStrictMathProfileUsed())
+    flag = false;
+  else if (isFastMathProfileUsed())
+    flag = true;
   return flag;
 }
 
@@ -181,6 +249,10 @@ constexpr bool Config::isBuiltinMathInvTrigonometricUsed() noexcept
 #if defined(ZIVC_MATH_BUILTIN_INV_TRIGONOMETRIC)
   flag = true;
 #endif // ZIVC_MATH_BUILTIN_INV_TRIGONOMETRIC
+  if (isStrictMathProfileUsed())
+    flag = false;
+  else if (isFastMathProfileUsed())
+    flag = true;
   return flag;
 }
 
@@ -20,6 +20,12 @@ class Config
  public:
   // Math library config
 
+  //! Check if the strict math profile is used
+  static constexpr bool isStrictMathProfileUsed() noexcept;
+
+  //! Check if the fast math profile is used
+  static constexpr bool isFastMathProfileUsed() noexcept;
+
   //! Check if built-in math library is used
   static constexpr bool isBuiltinMathUsed() noexcept;
 
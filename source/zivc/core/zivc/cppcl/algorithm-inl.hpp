@@ -237,6 +237,29 @@ IntegerN Algorithm::clz(const IntegerN& x) noexcept
   }
 }
 
+/*!
+  \details The integers are multiplied in 64bit
+  */
+template <typename IntegerN> inline
+IntegerN Algorithm::mul_hi(const IntegerN& x, const IntegerN& y) noexcept
+{
+  constexpr bool is_scalar_type = std::is_integral_v<IntegerN>;
+  // Scalar
+  if constexpr (is_scalar_type) {
+    static_assert(sizeof(IntegerN) <= 4, "64bit mul_hi isn't supported.");
+    using WideInteger = std::conditional_t<std::is_signed_v<IntegerN>, int64b, uint64b>;
+    constexpr WideInteger shift = 8 * sizeof(IntegerN);
+    const WideInteger p = zisc::cast<WideInteger>(x) * zisc::cast<WideInteger>(y);
+    const auto result = zisc::cast<IntegerN>(p >> shift);
+    return result;
+  }
+  // Vector
+  else {
+    const auto result = Vec::mul_hi(x, y);
+    return result;
+  }
+}
+
 /*!
   */
 template <typename IntegerN> inline
@@ -376,6 +399,18 @@ auto Algorithm::Vec::clz(const Vector<Integer, kN>& x) noexcept
   return result;
 }
 
+/*!
+  */
+template <typename Integer, size_t kN> inline
+auto Algorithm::Vec::mul_hi(const Vector<Integer, kN>& x,
+                            const Vector<Integer, kN>& y) noexcept
+{
+  Vector<Integer, kN> result;
+  for (size_t i = 0; i < kN; ++i)
+    result[i] = Algorithm::mul_hi(x[i], y[i]);
+  return result;
+}
+
 /*!
   */
 template <typename Integer, size_t kN> inline
@@ -477,6 +512,15 @@ IntegerN clz(const IntegerN& x) noexcept
   return result;
 }
 
+/*!
+  */
+template <typename IntegerN> inline
+IntegerN mul_hi(const IntegerN& x, const IntegerN& y) noexcept
+{
+  const auto result = Algorithm::mul_hi(x, y);
+  return result;
+}
+
 /*!
   */
 template <typename IntegerN> inline
@@ -69,6 +69,10 @@ class Algorithm
   template <typename IntegerN>
   static IntegerN clz(const IntegerN& x) noexcept;
 
+  //! Return the high half of the product of x and y
+  template <typename IntegerN>
+  static IntegerN mul_hi(const IntegerN& x, const IntegerN& y) noexcept;
+
   //! Return the number of non-zero bits
   template <typename IntegerN>
   static IntegerN popcount(const IntegerN& x) noexcept;
@@ -137,6 +141,11 @@ class Algorithm
     template <typename Integer, size_t kN>
     static auto clz(const Vector<Integer, kN>& x) noexcept;
 
+    //! Return the high half of the product of x and y
+    template <typename Integer, size_t kN>
+    static auto mul_hi(const Vector<Integer, kN>& x,
+                       const Vector<Integer, kN>& y) noexcept;
+
     //! Return the number of non-zero bits
     template <typename Integer, size_t kN>
     static auto popcount(const Vector<Integer, kN>& x) noexcept;
@@ -187,6 +196,10 @@ FloatN sign(const FloatN& x) noexcept;
 template <typename IntegerN>
 IntegerN clz(const IntegerN& x) noexcept;
 
+//! Return the high half of the product of x and y
+template <typename IntegerN>
+IntegerN mul_hi(const IntegerN& x, const IntegerN& y) noexcept;
+
 //! Return the number of non-zero bits
 template <typename IntegerN>
 IntegerN popcount(const IntegerN& x) noexcept;
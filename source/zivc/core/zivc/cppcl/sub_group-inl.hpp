@@ -0,0 +1,295 @@
+/*!
+  \file sub_group-inl.hpp
+  \author Sho Ikeda
+
+  Copyright (c) 2015-2021 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZIVC_CL_SUB_GROUP_INL_HPP
+#define ZIVC_CL_SUB_GROUP_INL_HPP
+
+#include "sub_group.hpp"
+// Standard C++ library
+#include <limits>
+// Zivc
+#include "types.hpp"
+#include "vector.hpp"
+#include "zivc/zivc_config.hpp"
+
+namespace zivc {
+
+namespace cl {
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+constexpr uint32b get_max_sub_group_size() noexcept
+{
+  return 1u;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+constexpr uint32b get_num_sub_groups() noexcept
+{
+  return 1u;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+constexpr uint32b get_sub_group_id() noexcept
+{
+  return 0u;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+constexpr uint32b get_sub_group_local_id() noexcept
+{
+  return 0u;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+constexpr uint32b get_sub_group_size() noexcept
+{
+  return 1u;
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] predicate No description.
+  \return No description
+  */
+inline
+constexpr int32b sub_group_all(const int32b predicate) noexcept
+{
+  return predicate;
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] predicate No description.
+  \return No description
+  */
+inline
+constexpr int32b sub_group_any(const int32b predicate) noexcept
+{
+  return predicate;
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] predicate No description.
+  \return No description
+  */
+inline
+uint4 sub_group_ballot(const int32b predicate) noexcept
+{
+  const uint4 mask{(predicate != 0) ? 1u : 0u, 0u, 0u, 0u};
+  return mask;
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] mask No description.
+  \return No description
+  */
+inline
+uint32b sub_group_ballot_bit_count(const uint4& mask) noexcept
+{
+  const uint32b count = mask.x & 1u;
+  return count;
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Type No description.
+  \param [in] value No description.
+  \param [in] local_id No description.
+  \return No description
+  */
+template <typename Type> inline
+Type sub_group_broadcast(const Type value, [[maybe_unused]] const uint32b local_id) noexcept
+{
+  return value;
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Type No description.
+  \param [in] value No description.
+  \param [in] local_id No description.
+  \return No description
+  */
+template <typename Type> inline
+Type sub_group_shuffle(const Type value, [[maybe_unused]] const uint32b local_id) noexcept
+{
+  return value;
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Type No description.
+  \param [in] value No description.
+  \param [in] mask No description.
+  \return No description
+  */
+template <typename Type> inline
+Type sub_group_shuffle_xor(const Type value, [[maybe_unused]] const uint32b mask) noexcept
+{
+  return value;
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Type No description.
+  \param [in] value No description.
+  \return No description
+  */
+template <typename Type> inline
+Type sub_group_reduce_add(const Type value) noexcept
+{
+  return value;
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Type No description.
+  \param [in] value No description.
+  \return No description
+  */
+template <typename Type> inline
+Type sub_group_reduce_max(const Type value) noexcept
+{
+  return value;
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Type No description.
+  \param [in] value No description.
+  \return No description
+  */
+template <typename Type> inline
+Type sub_group_reduce_min(const Type value) noexcept
+{
+  return value;
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Type No description.
+  \param [in] value No description.
+  \return No description
+  */
+template <typename Type> inline
+Type sub_group_scan_exclusive_add([[maybe_unused]] const Type value) noexcept
+{
+  return static_cast<Type>(0);
+}
+
+/*!
+  \details The identity is the lowest value of the type or -infinity
+
+  \tparam Type No description.
+  \param [in] value No description.
+  \return No description
+  */
+template <typename Type> inline
+Type sub_group_scan_exclusive_max([[maybe_unused]] const Type value) noexcept
+{
+  using Limits = std::numeric_limits<Type>;
+  return Limits::has_infinity ? -Limits::infinity() : Limits::lowest();
+}
+
+/*!
+  \details The identity is the max value of the type or infinity
+
+  \tparam Type No description.
+  \param [in] value No description.
+  \return No description
+  */
+template <typename Type> inline
+Type sub_group_scan_exclusive_min([[maybe_unused]] const Type value) noexcept
+{
+  using Limits = std::numeric_limits<Type>;
+  return Limits::has_infinity ? Limits::infinity() : (Limits::max)();
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Type No description.
+  \param [in] value No description.
+  \return No description
+  */
+template <typename Type> inline
+Type sub_group_scan_inclusive_add(const Type value) noexcept
+{
+  return value;
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Type No description.
+  \param [in] value No description.
+  \return No description
+  */
+template <typename Type> inline
+Type sub_group_scan_inclusive_max(const Type value) noexcept
+{
+  return value;
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Type No description.
+  \param [in] value No description.
+  \return No description
+  */
+template <typename Type> inline
+Type sub_group_scan_inclusive_min(const Type value) noexcept
+{
+  return value;
+}
+
+} // namespace cl
+
+} // namespace zivc
+
+#endif // ZIVC_CL_SUB_GROUP_INL_HPP
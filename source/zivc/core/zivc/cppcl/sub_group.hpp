@@ -0,0 +1,106 @@
+/*!
+  \file sub_group.hpp
+  \author Sho Ikeda
+
+  Copyright (c) 2015-2021 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZIVC_CL_SUB_GROUP_HPP
+#define ZIVC_CL_SUB_GROUP_HPP
+
+// Zivc
+#include "types.hpp"
+#include "vector.hpp"
+#include "zivc/zivc_config.hpp"
+
+namespace zivc {
+
+namespace cl {
+
+// A sub-group of the CPU backend consists of a single work-item,
+// since a work-group has a single work-item
+
+//! Return the maximum number of work-items in a sub-group
+constexpr uint32b get_max_sub_group_size() noexcept;
+
+//! Return the number of sub-groups in the work-group
+constexpr uint32b get_num_sub_groups() noexcept;
+
+//! Return the sub-group ID in the work-group
+constexpr uint32b get_sub_group_id() noexcept;
+
+//! Return the work-item ID in the sub-group
+constexpr uint32b get_sub_group_local_id() noexcept;
+
+//! Return the number of work-items in the sub-group
+constexpr uint32b get_sub_group_size() noexcept;
+
+//! Check if the predicate is true for all work-items
+constexpr int32b sub_group_all(const int32b predicate) noexcept;
+
+//! Check if the predicate is true for any work-item
+constexpr int32b sub_group_any(const int32b predicate) noexcept;
+
+//! Return the bit mask of the work-items whose predicate is true
+uint4 sub_group_ballot(const int32b predicate) noexcept;
+
+//! Return the number of bits set in the ballot mask
+uint32b sub_group_ballot_bit_count(const uint4& mask) noexcept;
+
+//! Return the value of the work-item specified by the local ID
+template <typename Type>
+Type sub_group_broadcast(const Type value, const uint32b local_id) noexcept;
+
+//! Return the value of the work-item specified by the local ID
+template <typename Type>
+Type sub_group_shuffle(const Type value, const uint32b local_id) noexcept;
+
+//! Return the value of the work-item whose local ID is (local ID ^ mask)
+template <typename Type>
+Type sub_group_shuffle_xor(const Type value, const uint32b mask) noexcept;
+
+//! Return the sum of the values
+template <typename Type>
+Type sub_group_reduce_add(const Type value) noexcept;
+
+//! Return the maximum of the values
+template <typename Type>
+Type sub_group_reduce_max(const Type value) noexcept;
+
+//! Return the minimum of the values
+template <typename Type>
+Type sub_group_reduce_min(const Type value) noexcept;
+
+//! Return the exclusive prefix sum of the values
+template <typename Type>
+Type sub_group_scan_exclusive_add(const Type value) noexcept;
+
+//! Return the exclusive prefix maximum of the values
+template <typename Type>
+Type sub_group_scan_exclusive_max(const Type value) noexcept;
+
+//! Return the exclusive prefix minimum of the values
+template <typename Type>
+Type sub_group_scan_exclusive_min(const Type value) noexcept;
+
+//! Return the inclusive prefix sum of the values
+template <typename Type>
+Type sub_group_scan_inclusive_add(const Type value) noexcept;
+
+//! Return the inclusive prefix maximum of the values
+template <typename Type>
+Type sub_group_scan_inclusive_max(const Type value) noexcept;
+
+//! Return the inclusive prefix minimum of the values
+template <typename Type>
+Type sub_group_scan_inclusive_min(const Type value) noexcept;
+
+} // namespace cl
+
+} // namespace zivc
+
+#include "sub_group-inl.hpp"
+
+#endif // ZIVC_CL_SUB_GROUP_HPP
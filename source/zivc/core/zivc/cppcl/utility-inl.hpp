@@ -33,13 +33,28 @@ namespace cl {
 namespace inner {
 
 /*!
-  \brief No brief description
+  \brief Execution context of work-items in a CPU kernel launch
 
-  No detailed description.
+  A context is created by each worker thread once per launch and is made
+  current for the thread before any work-item runs. Unused dimensions are
+  padded (offset 0, 1 group) so that the getters are plain array reads.
+  The work-group ID is advanced incrementally within a task batch.
   */
 class WorkItem
 {
  public:
+  //! Create a work-item context of a launch
+  WorkItem(const uint32b dimension,
+           const std::array<uint32b, 3>& global_id_offset,
+           const std::array<uint32b, 3>& num_of_work_groups) noexcept;
+
+
+  //! Advance the work-group ID to the next one in linear order
+  void advanceWorkGroupId() noexcept;
+
+  //! Return the context which is current in the calling thread
+  static const WorkItem& current() noexcept;
+
   //! Return the number of dimensions in use
   static uint32b getDimension() noexcept;
 
@@ -52,25 +67,172 @@ class WorkItem
   //! Return the work-group ID for dimension
   static size_t getWorkGroupId(const uint32b dimension) noexcept;
 
-  //! Set the number of dimensions in use
-  static void setDimension(const uint32b dimension) noexcept;
+  //! Make the given context current in the calling thread
+  static void makeCurrent(const WorkItem* context) noexcept;
 
-  //! Set the 3d global offset used in global id calculation
-  static void setGlobalIdOffset(const std::array<uint32b, 3>& offset) noexcept;
+  //! Return the total number of work-groups
+  uint32b numOfWorkGroups() const noexcept;
 
-  //! Set the number of work-grous
-  static void setNumOfGroups(const std::array<uint32b, 3>& size) noexcept;
-
-  //! Set the work-group ID
-  static void setWorkGroupId(const uint32b id) noexcept;
+  //! Set the work-group ID from the given linear ID
+  void setWorkGroupId(const uint32b id) noexcept;
 
  private:
-  static thread_local uint32b dimension_;
-  static thread_local std::array<uint32b, 3> global_id_offset_;
-  static thread_local std::array<uint32b, 3> num_of_work_groups_;
-  static thread_local std::array<uint32b, 3> work_group_id_;
+  static constinit thread_local const WorkItem* current_;
+
+
+  std::array<uint32b, 3> global_id_offset_;
+  std::array<uint32b, 3> num_of_work_groups_;
+  std::array<uint32b, 3> work_group_id_{{0, 0, 0}};
+  uint32b dimension_;
 };
 
+/*!
+  \details No detailed description
+
+  \param [in] dimension No description.
+  \param [in] global_id_offset No description.
+  \param [in] num_of_work_groups No description.
+  */
+inline
+WorkItem::WorkItem(const uint32b dimension,
+                   const std::array<uint32b, 3>& global_id_offset,
+                   const std::array<uint32b, 3>& num_of_work_groups) noexcept :
+    global_id_offset_{{0, 0, 0}},
+    num_of_work_groups_{{1, 1, 1}},
+    dimension_{dimension}
+{
+  for (uint32b i = 0; i < dimension; ++i) {
+    global_id_offset_[i] = global_id_offset[i];
+    num_of_work_groups_[i] = num_of_work_groups[i];
+  }
+}
+
+/*!
+  \details No detailed description
+  */
+inline
+void WorkItem::advanceWorkGroupId() noexcept
+{
+  // Carry over to the next dimension instead of recomputing with div/mod
+  if (++work_group_id_[0] < num_of_work_groups_[0])
+    return;
+  work_group_id_[0] = 0;
+  if (++work_group_id_[1] < num_of_work_groups_[1])
+    return;
+  work_group_id_[1] = 0;
+  ++work_group_id_[2];
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+const WorkItem& WorkItem::current() noexcept
+{
+  ZISC_ASSERT(current_ != nullptr, "No work-item context is current.");
+  return *current_;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+uint32b WorkItem::getDimension() noexcept
+{
+  return current().dimension_;
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] dimension No description.
+  \return No description
+  */
+inline
+size_t WorkItem::getGlobalIdOffset(const uint32b dimension) noexcept
+{
+  const size_t offset = (dimension < 3)
+      ? current().global_id_offset_[dimension]
+      : 0u;
+  return offset;
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] dimension No description.
+  \return No description
+  */
+inline
+size_t WorkItem::getNumOfGroups(const uint32b dimension) noexcept
+{
+  const size_t size = (dimension < 3)
+      ? current().num_of_work_groups_[dimension]
+      : 1u;
+  return size;
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] dimension No description.
+  \return No description
+  */
+inline
+size_t WorkItem::getWorkGroupId(const uint32b dimension) noexcept
+{
+  const size_t id = (dimension < 3)
+      ? current().work_group_id_[dimension]
+      : 0u;
+  return id;
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] context No description.
+  */
+inline
+void WorkItem::makeCurrent(const WorkItem* context) noexcept
+{
+  current_ = context;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+uint32b WorkItem::numOfWorkGroups() const noexcept
+{
+  const uint32b n = num_of_work_groups_[0] *
+                    num_of_work_groups_[1] *
+                    num_of_work_groups_[2];
+  return n;
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] id No description.
+  */
+inline
+void WorkItem::setWorkGroupId(const uint32b id) noexcept
+{
+  const uint32b nwx = num_of_work_groups_[0];
+  const uint32b nwy = num_of_work_groups_[1];
+  work_group_id_[0] = id % nwx;
+  work_group_id_[1] = (id / nwx) % nwy;
+  work_group_id_[2] = id / (nwx * nwy);
+  ZISC_ASSERT(work_group_id_[2] < num_of_work_groups_[2],
+              "The given work-group ID is invalid: ID=", id);
+}
+
 } // namespace inner
 
 /*!
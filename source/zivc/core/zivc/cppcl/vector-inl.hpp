@@ -13,8 +13,13 @@
 #include "vector.hpp"
 // Standard C++ library
 #include <cstddef>
+#include <cstring>
 #include <type_traits>
+#if defined(__F16C__)
+#include <immintrin.h>
+#endif // __F16C__
 // Zisc
+#include "zisc/bit.hpp"
 #include "zisc/concepts.hpp"
 #include "zisc/ieee_754_binary.hpp"
 #include "zisc/utility.hpp"
@@ -1233,7 +1238,11 @@ float VectorData::vload_half(
     const half* p) noexcept
 {
   const half* address = p + offset;
+#if defined(__F16C__)
+  const float result = _cvtsh_ss(zisc::bit_cast<uint16b>(*address));
+#else // __F16C__
   const float result = zisc::cast<float>(*address);
+#endif // __F16C__
   return result;
 }
 
@@ -1391,7 +1400,12 @@ void VectorData::vstore_half(
     half* p) noexcept
 {
   half* address = p + offset;
+#if defined(__F16C__)
+  const half fdata = zisc::bit_cast<half>(
+      zisc::cast<uint16b>(_cvtss_sh(data, _MM_FROUND_TO_NEAREST_INT)));
+#else // __F16C__
   const half fdata = zisc::cast<half>(data);
+#endif // __F16C__
   *address = fdata;
 }
 
@@ -1491,10 +1505,20 @@ Vector<float, kN> VectorData::Vec::vload_halfn(
 {
   Vector<float, kN> data;
   const half* address = p + offset * kN;
+#if defined(__F16C__)
+  // Convert all elements at once with F16C
+  __m128i hdata = _mm_setzero_si128();
+  std::memcpy(&hdata, address, kN * sizeof(half));
+  float fdata[4];
+  _mm_storeu_ps(fdata, _mm_cvtph_ps(hdata));
+  for (size_t i = 0; i < kN; ++i)
+    data[i] = fdata[i];
+#else // __F16C__
   for (size_t i = 0; i < kN; ++i) {
     const float v = zisc::cast<float>(address[i]);
     data[i] = v;
   }
+#endif // __F16C__
   return data;
 }
 
@@ -1516,10 +1540,19 @@ void VectorData::Vec::vstore_halfn(
     half* p) noexcept
 {
   half* address = p + offset * kN;
+#if defined(__F16C__)
+  // Convert all elements at once with F16C
+  float fdata[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+  for (size_t i = 0; i < kN; ++i)
+    fdata[i] = data[i];
+  const __m128i hdata = _mm_cvtps_ph(_mm_loadu_ps(fdata), _MM_FROUND_TO_NEAREST_INT);
+  std::memcpy(address, &hdata, kN * sizeof(half));
+#else // __F16C__
   for (size_t i = 0; i < kN; ++i) {
     const half v = zisc::cast<half>(data[i]);
     address[i] = v;
   }
+#endif // __F16C__
 }
 
 /*!
@@ -19,22 +19,29 @@
 // Standard C++ library
 #include <algorithm>
 #include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
 #include <memory>
+#include <system_error>
 #include <type_traits>
 #include <utility>
-#include <vector>
 // Zisc
+#include "zisc/bit.hpp"
 #include "zisc/concepts.hpp"
 #include "zisc/error.hpp"
 #include "zisc/utility.hpp"
 #include "zisc/memory/std_memory_resource.hpp"
 // Zivc
+#include "cpu_buffer_impl.hpp"
 #include "cpu_device.hpp"
 #include "zivc/buffer.hpp"
 #include "zivc/sub_platform.hpp"
 #include "zivc/zivc_config.hpp"
 #include "zivc/utility/buffer_init_params.hpp"
 #include "zivc/utility/buffer_launch_options.hpp"
+#include "zivc/utility/error.hpp"
 #include "zivc/utility/id_data.hpp"
 #include "zivc/utility/launch_result.hpp"
 #include "zivc/utility/zivc_object.hpp"
@@ -58,6 +65,17 @@ CpuBuffer<T>::~CpuBuffer() noexcept
   Buffer<T>::destroy();
 }
 
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+template <KernelArg T> inline
+std::size_t CpuBuffer<T>::alignment() const noexcept
+{
+  return alignment_;
+}
+
 /*!
   \details No detailed description
 
@@ -66,8 +84,7 @@ CpuBuffer<T>::~CpuBuffer() noexcept
 template <KernelArg T> inline
 std::size_t CpuBuffer<T>::capacityInBytes() const noexcept
 {
-  const std::size_t n = (buffer_data_) ? rawBuffer().capacity() : 0;
-  const std::size_t c = sizeof(Type) * n;
+  const std::size_t c = rawBuffer().size_;
   return c;
 }
 
@@ -79,7 +96,7 @@ std::size_t CpuBuffer<T>::capacityInBytes() const noexcept
 template <KernelArg T> inline
 auto CpuBuffer<T>::data() noexcept -> Pointer
 {
-  return buffer_data_ ? rawBuffer().data() : nullptr;
+  return zisc::cast<Pointer>(rawBuffer().data_);
 }
 
 /*!
@@ -90,7 +107,19 @@ auto CpuBuffer<T>::data() noexcept -> Pointer
 template <KernelArg T> inline
 auto CpuBuffer<T>::data() const noexcept -> ConstPointer
 {
-  return buffer_data_ ? rawBuffer().data() : nullptr;
+  return zisc::cast<ConstPointer>(rawBuffer().data_);
+}
+
+/*!
+  \details The address is the raw pointer value of the buffer memory
+
+  \return No description
+  */
+template <KernelArg T> inline
+uint64b CpuBuffer<T>::deviceAddress() const noexcept
+{
+  const auto address = zisc::reinterp<std::uintptr_t>(data());
+  return zisc::cast<uint64b>(address);
 }
 
 /*!
@@ -104,6 +133,17 @@ std::size_t CpuBuffer<T>::heapIndex() const noexcept
   return 0;
 }
 
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+template <KernelArg T> inline
+auto CpuBuffer<T>::hugePageMode() const noexcept -> HugePageMode
+{
+  return rawBuffer().huge_page_mode_;
+}
+
 /*!
   \details No detailed description
 
@@ -137,6 +177,18 @@ bool CpuBuffer<T>::isHostCoherent() const noexcept
   return true;
 }
 
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+template <KernelArg T> inline
+bool CpuBuffer<T>::isFileMapped() const noexcept
+{
+  const bool result = rawBuffer().is_file_mapped_ == zisc::kTrue;
+  return result;
+}
+
 /*!
   \details No detailed description
 
@@ -148,6 +200,46 @@ bool CpuBuffer<T>::isHostVisible() const noexcept
   return true;
 }
 
+/*!
+  \details The buffer becomes a zero-copy view of the file range,
+  which starts at the given offset and holds as many elements as fit into
+  the rest of the file. The view is copy-on-write; writes to the buffer
+  aren't written back to the file. Growing the buffer with setSize copies
+  the contents into a regular memory. The data is aligned only as much as
+  the offset is, instead of the buffer alignment
+
+  \param [in] file_path No description.
+  \param [in] offset_in_bytes No description.
+  */
+template <KernelArg T> inline
+void CpuBuffer<T>::mapFile(const std::filesystem::path& file_path,
+                           const std::size_t offset_in_bytes)
+{
+  std::error_code error;
+  const std::size_t file_size = std::filesystem::file_size(file_path, error);
+  if (error || (file_size < offset_in_bytes) ||
+      (offset_in_bytes % alignof(Type) != 0)) {
+    char message[512] = "";
+    std::snprintf(message, sizeof(message),
+                  "The file range can't be mapped: %s, offset=%zu.",
+                  file_path.string().c_str(), offset_in_bytes);
+    throw SystemError{ErrorCode::kFileIoFailed, message};
+  }
+
+  Buffer<T>::clear();
+  const std::size_t n = (file_size - offset_in_bytes) / sizeof(Type);
+  if (0 < n) {
+    CpuBufferImpl impl{std::addressof(parentImpl())};
+    impl.mapFile(file_path,
+                 offset_in_bytes,
+                 sizeof(Type) * n,
+                 alignment(),
+                 Buffer<T>::memoryResource(),
+                 std::addressof(rawBuffer()));
+  }
+  size_ = n;
+}
+
 /*!
   \details No detailed description
 
@@ -167,9 +259,9 @@ void* CpuBuffer<T>::mapMemoryData() const
   \return No description
   */
 template <KernelArg T> inline
-auto CpuBuffer<T>::rawBuffer() noexcept -> zisc::pmr::vector<Type>&
+auto CpuBuffer<T>::rawBuffer() noexcept -> BufferData&
 {
-  return *buffer_data_;
+  return buffer_data_;
 }
 
 /*!
@@ -178,9 +270,9 @@ auto CpuBuffer<T>::rawBuffer() noexcept -> zisc::pmr::vector<Type>&
   \return No description
   */
 template <KernelArg T> inline
-auto CpuBuffer<T>::rawBuffer() const noexcept -> const zisc::pmr::vector<Type>&
+auto CpuBuffer<T>::rawBuffer() const noexcept -> const BufferData&
 {
-  return *buffer_data_;
+  return buffer_data_;
 }
 
 /*!
@@ -207,6 +299,20 @@ const void* CpuBuffer<T>::rawBufferData() const noexcept
   return p;
 }
 
+/*!
+  \details The contents are copied on the host, so the launch options are ignored
+
+  \param [in] s No description.
+  \param [in] launch_options No description.
+  */
+template <KernelArg T> inline
+void CpuBuffer<T>::reserve(const std::size_t s,
+                           [[maybe_unused]] const zivc::LaunchOptions& launch_options)
+{
+  if (Buffer<T>::capacity() < s)
+    reallocate(s);
+}
+
 /*!
   \details No detailed description
 
@@ -216,20 +322,18 @@ template <KernelArg T> inline
 void CpuBuffer<T>::setSize(const std::size_t s)
 {
   //! \todo Throw exception when this method is called from reinterp buffer
-  const std::size_t prev_size = Buffer<T>::size();
+  const std::size_t prev_size = size_;
   if (s != prev_size) {
-    prepareBuffer();
-    auto& buff = rawBuffer();
-    const std::size_t prev_cap = buff.capacity();
-    buff.resize(s);
-    const std::size_t cap = buff.capacity();
-    if (cap != prev_cap) {
-      auto& device = parentImpl();
-      const std::size_t prev_mem_size = sizeof(Type) * prev_cap;
-      device.notifyDeallocation(prev_mem_size);
-      const std::size_t mem_size = sizeof(Type) * cap;
-      device.notifyAllocation(mem_size);
-    }
+    const bool is_reallocated = Buffer<T>::capacity() < s;
+    if (is_reallocated)
+      reallocate(s);
+    // Value-initialize the new elements like std::vector::resize does.
+    // Freshly mapped pages are already zero-filled by the kernel
+    const bool is_zero_filled = is_reallocated &&
+                                (hugePageMode() != HugePageMode::kNone);
+    if ((prev_size < s) && !is_zero_filled)
+      std::uninitialized_value_construct_n(data() + prev_size, s - prev_size);
+    size_ = s;
   }
 }
 
@@ -241,8 +345,7 @@ void CpuBuffer<T>::setSize(const std::size_t s)
 template <KernelArg T> inline
 std::size_t CpuBuffer<T>::sizeInBytes() const noexcept
 {
-  const std::size_t n = (buffer_data_) ? rawBuffer().size() : 0;
-  const std::size_t s = sizeof(Type) * n;
+  const std::size_t s = sizeof(Type) * size_;
   return s;
 }
 
@@ -260,7 +363,9 @@ void CpuBuffer<T>::unmapMemoryData() const noexcept
 template <KernelArg T> inline
 void CpuBuffer<T>::destroyData() noexcept
 {
-  buffer_data_.reset();
+  CpuBufferImpl impl{std::addressof(parentImpl())};
+  impl.deallocateMemory(Buffer<T>::memoryResource(), std::addressof(rawBuffer()));
+  size_ = 0;
 }
 
 /*!
@@ -269,9 +374,16 @@ void CpuBuffer<T>::destroyData() noexcept
   \param [in] params No description.
   */
 template <KernelArg T> inline
-void CpuBuffer<T>::initData([[maybe_unused]] const BufferInitParams& params)
+void CpuBuffer<T>::initData(const BufferInitParams& params)
 {
-  prepareBuffer();
+  const std::size_t a = params.alignment();
+  if (!zisc::has_single_bit(a)) {
+    char message[256] = "";
+    std::sprintf(message, "The buffer alignment isn't a power of 2: %zu.", a);
+    throw SystemError{ErrorCode::kInitializationFailed, message};
+  }
+  alignment_ = (std::max)({a, BufferInitParams::defaultAlignment(), alignof(Type)});
+  huge_page_mode_ = params.hugePageMode();
 }
 
 /*!
@@ -352,18 +464,24 @@ const CpuDevice& CpuBuffer<T>::parentImpl() const noexcept
 
 /*!
   \details No detailed description
+
+  \param [in] s No description.
   */
 template <KernelArg T> inline
-void CpuBuffer<T>::prepareBuffer() noexcept
-{
-  if (!buffer_data_) {
-    auto mem_resource = Buffer<T>::memoryResource();
-    using BufferImplType = typename decltype(buffer_data_)::element_type;
-    typename BufferImplType::allocator_type alloc{mem_resource};
-    BufferImplType buffer{alloc};
-    buffer_data_ = zisc::pmr::allocateUnique<BufferImplType>(mem_resource,
-                                                             std::move(buffer));
-  }
+void CpuBuffer<T>::reallocate(const std::size_t s)
+{
+  auto* mem_resource = Buffer<T>::memoryResource();
+  CpuBufferImpl impl{std::addressof(parentImpl())};
+  BufferData new_data{};
+  impl.allocateMemory(sizeof(Type) * s,
+                      alignment(),
+                      huge_page_mode_,
+                      mem_resource,
+                      std::addressof(new_data));
+  if (0 < size_)
+    std::memcpy(new_data.data_, rawBuffer().data_, sizeInBytes());
+  impl.deallocateMemory(mem_resource, std::addressof(rawBuffer()));
+  buffer_data_ = new_data;
 }
 
 } // namespace zivc
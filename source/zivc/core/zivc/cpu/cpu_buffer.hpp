@@ -17,12 +17,13 @@
 
 // Standard C++ library
 #include <cstddef>
+#include <filesystem>
 #include <memory>
-#include <vector>
 // Zisc
 #include "zisc/concepts.hpp"
 #include "zisc/memory/std_memory_resource.hpp"
 // Zivc
+#include "cpu_buffer_impl.hpp"
 #include "zivc/buffer.hpp"
 #include "zivc/zivc_config.hpp"
 #include "zivc/utility/buffer_init_params.hpp"
@@ -54,6 +55,8 @@ class CpuBuffer : public Buffer<T>
   using Pointer = typename Buffer<T>::Pointer;
   using ConstPointer = typename Buffer<T>::ConstPointer;
   using LaunchOptions = typename Buffer<T>::LaunchOptions;
+  using BufferData = CpuBufferImpl::MemoryBlock;
+  using HugePageMode = BufferInitParams::HugePageMode;
 
 
   //! Initialize the buffer
@@ -63,6 +66,9 @@ class CpuBuffer : public Buffer<T>
   ~CpuBuffer() noexcept override;
 
 
+  //! Return the alignment of the buffer memory in bytes
+  std::size_t alignment() const noexcept;
+
   //! Return the capacity of the buffer in bytes
   std::size_t capacityInBytes() const noexcept override;
 
@@ -72,9 +78,15 @@ class CpuBuffer : public Buffer<T>
   //! Return the underlying data pointer
   ConstPointer data() const noexcept;
 
+  //! Return the device address of the buffer memory
+  uint64b deviceAddress() const noexcept override;
+
   //! Return the index of used heap
   std::size_t heapIndex() const noexcept override;
 
+  //! Return the huge page mode which actually backs the buffer memory
+  HugePageMode hugePageMode() const noexcept;
+
   //! Check if the buffer is the most efficient for the device access
   bool isDeviceLocal() const noexcept override;
 
@@ -84,18 +96,25 @@ class CpuBuffer : public Buffer<T>
   //! Check if the buffer doesn't need to be unmapped
   bool isHostCoherent() const noexcept override;
 
+  //! Check if the buffer is backed by a memory-mapped file
+  bool isFileMapped() const noexcept;
+
   //! Check if the buffer can be mapped for the host access
   bool isHostVisible() const noexcept override;
 
+  //! Map the contents of the given file into the buffer without copying
+  void mapFile(const std::filesystem::path& file_path,
+               const std::size_t offset_in_bytes = 0);
+
   //! Map a buffer memory to a host
   [[nodiscard]]
   void* mapMemoryData() const override;
 
   //! Return the underlying buffer data
-  zisc::pmr::vector<Type>& rawBuffer() noexcept;
+  BufferData& rawBuffer() noexcept;
 
   //! Return the underlying buffer data
-  const zisc::pmr::vector<Type>& rawBuffer() const noexcept;
+  const BufferData& rawBuffer() const noexcept;
 
   //! Return the underlying buffer data
   void* rawBufferData() noexcept override;
@@ -103,6 +122,10 @@ class CpuBuffer : public Buffer<T>
   //! Return the underlying buffer data
   const void* rawBufferData() const noexcept override;
 
+  //! Reserve the memory for the given number of elements preserving the contents
+  void reserve(const std::size_t s,
+               const zivc::LaunchOptions& launch_options) override;
+
   //! Change the number of elements
   void setSize(const std::size_t s) override;
 
@@ -144,11 +167,15 @@ class CpuBuffer : public Buffer<T>
   //! Return the device
   const CpuDevice& parentImpl() const noexcept;
 
-  //! Prepare a buffer for use
-  void prepareBuffer() noexcept;
+  //! Reallocate the buffer memory preserving the contents
+  void reallocate(const std::size_t s);
 
 
-  zisc::pmr::unique_ptr<zisc::pmr::vector<Type>> buffer_data_;
+  BufferData buffer_data_;
+  std::size_t size_ = 0;
+  std::size_t alignment_ = BufferInitParams::defaultAlignment();
+  HugePageMode huge_page_mode_ = HugePageMode::kNone;
+  [[maybe_unused]] Padding<7> pad_;
 };
 
 } // namespace zivc
@@ -0,0 +1,37 @@
+/*!
+  \file cpu_buffer_impl-inl.hpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2021 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZIVC_CPU_BUFFER_IMPL_INL_HPP
+#define ZIVC_CPU_BUFFER_IMPL_INL_HPP
+
+#include "cpu_buffer_impl.hpp"
+// Standard C++ library
+#include <cstddef>
+
+namespace zivc {
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+constexpr std::size_t CpuBufferImpl::hugePageSize() noexcept
+{
+  return 2ull * 1024ull * 1024ull; // 2 MB
+}
+
+} // namespace zivc
+
+#endif // ZIVC_CPU_BUFFER_IMPL_INL_HPP
@@ -0,0 +1,263 @@
+/*!
+  \file cpu_buffer_impl.cpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2021 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#include "cpu_buffer_impl.hpp"
+// Standard C++ library
+#include <cstddef>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <ios>
+#include <memory>
+// Zisc
+#include "zisc/utility.hpp"
+#include "zisc/zisc_config.hpp"
+#include "zisc/memory/std_memory_resource.hpp"
+// Zivc
+#include "cpu_device.hpp"
+#include "zivc/zivc_config.hpp"
+#include "zivc/utility/buffer_init_params.hpp"
+#include "zivc/utility/error.hpp"
+
+#if defined(Z_LINUX)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif // Z_LINUX
+
+namespace zivc {
+
+/*!
+  \details No detailed description
+
+  \param [in] device No description.
+  */
+CpuBufferImpl::CpuBufferImpl(CpuDevice* device) noexcept : device_{device}
+{
+}
+
+/*!
+  \details No detailed description
+  */
+CpuBufferImpl::~CpuBufferImpl() noexcept
+{
+}
+
+/*!
+  \details Buffers smaller than a huge page always come from the memory resource
+
+  \param [in] size No description.
+  \param [in] alignment No description.
+  \param [in] mode No description.
+  \param [in,out] mem_resource No description.
+  \param [out] block No description.
+  */
+void CpuBufferImpl::allocateMemory(const std::size_t size,
+                                   const std::size_t alignment,
+                                   const HugePageMode mode,
+                                   zisc::pmr::memory_resource* mem_resource,
+                                   MemoryBlock* block)
+{
+  const bool use_huge_page = (mode != HugePageMode::kNone) &&
+                             (hugePageSize() <= size) &&
+                             mapHugePages(size, mode, block);
+  if (!use_huge_page) {
+    block->data_ = mem_resource->allocate(size, alignment);
+    block->size_ = size;
+    block->alignment_ = alignment;
+    block->huge_page_mode_ = HugePageMode::kNone;
+  }
+  device().notifyAllocation(block->size_);
+}
+
+/*!
+  \details No detailed description
+
+  \param [in,out] mem_resource No description.
+  \param [in,out] block No description.
+  */
+void CpuBufferImpl::deallocateMemory(zisc::pmr::memory_resource* mem_resource,
+                                     MemoryBlock* block) noexcept
+{
+  if (block->data_ == nullptr)
+    return;
+
+  const std::size_t size = block->size_;
+  const bool is_mapped = (block->is_file_mapped_ == zisc::kTrue) ||
+                         (block->huge_page_mode_ != HugePageMode::kNone);
+  if (is_mapped)
+    unmapPages(block);
+  else
+    mem_resource->deallocate(block->data_, block->size_, block->alignment_);
+  device().notifyDeallocation(size);
+
+  *block = MemoryBlock{};
+}
+
+/*!
+  \details The range is mapped privately (copy-on-write),
+  so kernels can write to the buffer without modifying the file.
+  Pages are read on demand, so the cost of the mapping doesn't depend on
+  the file size. On hosts without mmap support the range is read into
+  a memory allocated from the memory resource instead
+
+  \param [in] file_path No description.
+  \param [in] offset The offset of the range in bytes.
+  \param [in] size The size of the range in bytes.
+  \param [in] alignment No description.
+  \param [in,out] mem_resource No description.
+  \param [out] block No description.
+  */
+void CpuBufferImpl::mapFile(const std::filesystem::path& file_path,
+                            const std::size_t offset,
+                            const std::size_t size,
+                            [[maybe_unused]] const std::size_t alignment,
+                            [[maybe_unused]] zisc::pmr::memory_resource* mem_resource,
+                            MemoryBlock* block)
+{
+#if defined(Z_LINUX)
+  const int fd = ::open(file_path.c_str(), O_RDONLY);
+  if (fd == -1)
+    throwFileException(file_path, "Opening a file failed");
+
+  // The offset of mmap must be a multiple of the page size
+  const auto page_size = zisc::cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+  const std::size_t map_offset = offset % page_size;
+  const std::size_t map_size = size + map_offset;
+  constexpr int prot = PROT_READ | PROT_WRITE;
+  const auto file_offset = zisc::cast<off_t>(offset - map_offset);
+  void* p = ::mmap(nullptr, map_size, prot, MAP_PRIVATE, fd, file_offset);
+  // The mapping keeps a reference to the file
+  ::close(fd);
+  if (p == MAP_FAILED)
+    throwFileException(file_path, "Mapping a file failed");
+
+  block->data_ = zisc::cast<uint8b*>(p) + map_offset;
+  block->size_ = size;
+  block->alignment_ = page_size;
+  block->map_offset_ = map_offset;
+  block->huge_page_mode_ = HugePageMode::kNone;
+  block->is_file_mapped_ = zisc::kTrue;
+  device().notifyAllocation(block->size_);
+#else // Z_LINUX
+  allocateMemory(size, alignment, HugePageMode::kNone, mem_resource, block);
+  std::ifstream file{file_path, std::ios_base::binary};
+  file.seekg(zisc::cast<std::streamoff>(offset));
+  file.read(zisc::cast<char*>(block->data_), zisc::cast<std::streamsize>(size));
+  if (!file) {
+    deallocateMemory(mem_resource, block);
+    throwFileException(file_path, "Reading a file failed");
+  }
+#endif // Z_LINUX
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+CpuDevice& CpuBufferImpl::device() noexcept
+{
+  return *device_;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+const CpuDevice& CpuBufferImpl::device() const noexcept
+{
+  return *device_;
+}
+
+/*!
+  \details Explicit huge pages (MAP_HUGETLB) require a reserved huge page pool.
+  When the reservation fails, regular anonymous pages are mapped and the kernel
+  is advised to back them with transparent huge pages.
+  The mapped size is rounded up to a multiple of the huge page size.
+  Freshly mapped pages are zero-filled by the kernel
+
+  \param [in] size No description.
+  \param [in] mode No description.
+  \param [out] block No description.
+  \return True if the pages are mapped, false otherwise
+  */
+bool CpuBufferImpl::mapHugePages([[maybe_unused]] const std::size_t size,
+                                 [[maybe_unused]] const HugePageMode mode,
+                                 [[maybe_unused]] MemoryBlock* block) noexcept
+{
+  bool result = false;
+#if defined(Z_LINUX)
+  constexpr std::size_t page_size = hugePageSize();
+  const std::size_t s = ((size + page_size - 1) / page_size) * page_size;
+  constexpr int prot = PROT_READ | PROT_WRITE;
+  constexpr int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+
+  void* p = MAP_FAILED;
+  HugePageMode actual_mode = mode;
+#if defined(MAP_HUGETLB)
+  if (mode == HugePageMode::kExplicit)
+    p = ::mmap(nullptr, s, prot, flags | MAP_HUGETLB, -1, 0);
+#endif // MAP_HUGETLB
+  if (p == MAP_FAILED) {
+    actual_mode = HugePageMode::kTransparent;
+    p = ::mmap(nullptr, s, prot, flags, -1, 0);
+#if defined(MADV_HUGEPAGE)
+    if (p != MAP_FAILED)
+      ::madvise(p, s, MADV_HUGEPAGE);
+#endif // MADV_HUGEPAGE
+  }
+
+  result = p != MAP_FAILED;
+  if (result) {
+    block->data_ = p;
+    block->size_ = s;
+    block->alignment_ = page_size;
+    block->huge_page_mode_ = actual_mode;
+  }
+#endif // Z_LINUX
+  return result;
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] file_path No description.
+  \param [in] message No description.
+  */
+void CpuBufferImpl::throwFileException(const std::filesystem::path& file_path,
+                                       const char* message)
+{
+  char m[512] = "";
+  std::snprintf(m, sizeof(m), "%s: %s", message, file_path.string().c_str());
+  throw SystemError{ErrorCode::kFileIoFailed, m};
+}
+
+/*!
+  \details No detailed description
+
+  \param [in,out] block No description.
+  */
+void CpuBufferImpl::unmapPages([[maybe_unused]] MemoryBlock* block) noexcept
+{
+#if defined(Z_LINUX)
+  void* p = zisc::cast<uint8b*>(block->data_) - block->map_offset_;
+  ::munmap(p, block->size_ + block->map_offset_);
+#endif // Z_LINUX
+}
+
+} // namespace zivc
@@ -0,0 +1,119 @@
+/*!
+  \file cpu_buffer_impl.hpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2021 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZIVC_CPU_BUFFER_IMPL_HPP
+#define ZIVC_CPU_BUFFER_IMPL_HPP
+
+// Standard C++ library
+#include <cstddef>
+#include <filesystem>
+// Zisc
+#include "zisc/non_copyable.hpp"
+#include "zisc/utility.hpp"
+#include "zisc/memory/std_memory_resource.hpp"
+// Zivc
+#include "zivc/zivc_config.hpp"
+#include "zivc/utility/buffer_init_params.hpp"
+
+namespace zivc {
+
+// Forward declaration
+class CpuDevice;
+
+/*!
+  \brief No brief description
+
+  No detailed description.
+  */
+class CpuBufferImpl : private zisc::NonCopyable<CpuBufferImpl>
+{
+ public:
+  // Type aliases
+  using HugePageMode = BufferInitParams::HugePageMode;
+
+
+  /*!
+    \brief No brief description
+
+    No detailed description.
+    */
+  struct MemoryBlock
+  {
+    void* data_ = nullptr;
+    std::size_t size_ = 0; //!< The allocated size in bytes
+    std::size_t alignment_ = 0;
+    std::size_t map_offset_ = 0; //!< The offset of the data from the mapped file page
+    HugePageMode huge_page_mode_ = HugePageMode::kNone; //!< The mode actually used
+    uint8b is_file_mapped_ = zisc::kFalse;
+    [[maybe_unused]] Padding<6> pad_;
+  };
+
+
+  //! Initialize the cpu buffer impl
+  CpuBufferImpl(CpuDevice* device) noexcept;
+
+  //! Finalize the cpu buffer impl
+  ~CpuBufferImpl() noexcept;
+
+
+  //! Allocate a memory for the device
+  void allocateMemory(const std::size_t size,
+                      const std::size_t alignment,
+                      const HugePageMode mode,
+                      zisc::pmr::memory_resource* mem_resource,
+                      MemoryBlock* block);
+
+  //! Deallocate a device memory
+  void deallocateMemory(zisc::pmr::memory_resource* mem_resource,
+                        MemoryBlock* block) noexcept;
+
+  //! Return the size of a huge page in bytes
+  static constexpr std::size_t hugePageSize() noexcept;
+
+  //! Map the given range of a file into the memory
+  void mapFile(const std::filesystem::path& file_path,
+               const std::size_t offset,
+               const std::size_t size,
+               const std::size_t alignment,
+               zisc::pmr::memory_resource* mem_resource,
+               MemoryBlock* block);
+
+ private:
+  //! Return the underlying device object
+  CpuDevice& device() noexcept;
+
+  //! Return the underlying device object
+  const CpuDevice& device() const noexcept;
+
+  //! Map anonymous pages backed by huge pages
+  static bool mapHugePages(const std::size_t size,
+                           const HugePageMode mode,
+                           MemoryBlock* block) noexcept;
+
+  //! Throw an exception of a file error
+  [[noreturn]] static void throwFileException(const std::filesystem::path& file_path,
+                                              const char* message);
+
+  //! Unmap the pages mapped by mapHugePages or mapFile
+  static void unmapPages(MemoryBlock* block) noexcept;
+
+
+  CpuDevice* device_ = nullptr;
+};
+
+} // namespace zivc
+
+#include "cpu_buffer_impl-inl.hpp"
+
+#endif // ZIVC_CPU_BUFFER_IMPL_HPP
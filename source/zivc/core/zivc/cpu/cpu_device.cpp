@@ -14,11 +14,13 @@
 
 #include "cpu_device.hpp"
 // Standard C++ library
+#include <algorithm>
 #include <array>
 #include <atomic>
 #include <cstddef>
 #include <limits>
 #include <memory>
+#include <utility>
 // Zisc
 #include "zisc/utility.hpp"
 #include "zisc/memory/memory.hpp"
@@ -134,6 +136,7 @@ void CpuDevice::setFenceSize([[maybe_unused]] const std::size_t s)
   \param [in] dimension No description.
   \param [in] work_size No description.
   \param [in] global_id_offset No description.
+  \param [in] priority No description.
   \param [in] id No description.
   \param [out] fence No description.
   */
@@ -141,31 +144,84 @@ void CpuDevice::submit(const Command& command,
                        const uint32b dimension,
                        const std::array<uint32b, 3>& work_size,
                        const std::array<uint32b, 3>& global_id_offset,
+                       const QueuePriority priority,
                        std::atomic<uint32b>* id,
                        Fence* fence)
 {
   const auto batch_size = zisc::cast<uint32b>(taskBatchSize());
-  auto task = [command, id, dimension, work_size, global_id_offset, batch_size]
+  const bool is_high = isHighPriority(priority);
+  auto* counter = std::addressof(num_of_high_priority_tasks_);
+  auto task = [command, id, dimension, work_size, global_id_offset, batch_size,
+               is_high, counter]
   (const int64b, const int64b) noexcept
   {
-    cl::inner::WorkItem::setDimension(dimension);
-    cl::inner::WorkItem::setGlobalIdOffset(global_id_offset);
-    cl::inner::WorkItem::setNumOfGroups(work_size);
-    const uint32b num_of_works = work_size[0] * work_size[1] * work_size[2];
+    cl::inner::WorkItem context{dimension, global_id_offset, work_size};
+    cl::inner::WorkItem::makeCurrent(std::addressof(context));
+    const uint32b num_of_works = context.numOfWorkGroups();
     const uint32b n = (num_of_works + (batch_size - 1)) / batch_size;
-    for (uint32b block_id = issue(id); block_id < n; block_id = issue(id))
-      execBatchCommand(command, block_id, num_of_works, batch_size);
+    for (uint32b block_id = issue(id); block_id < n; block_id = issue(id)) {
+      if (!is_high)
+        waitForHighPriority(counter);
+      const uint32b group_id = block_id * batch_size;
+      const uint32b num_of_groups = (std::min)(batch_size, num_of_works - group_id);
+      execBatchCommand(command, group_id, num_of_groups, std::addressof(context));
+    }
+    cl::inner::WorkItem::makeCurrent(nullptr);
+    if (is_high)
+      exitHighPriority(counter);
   };
+  enqueue(std::move(task), is_high, fence);
+}
 
-  auto& manager = threadManager();
-  constexpr int64b start = 0;
-  const int64b end = manager.numOfThreads();
-  constexpr auto parent_id = zisc::ThreadManager::kAllPrecedences;
-  auto result = manager.enqueueLoop(std::move(task), start, end, parent_id);
-  if (fence->isActive()) {
-    auto* fen = zisc::reinterp<CpuFence*>(std::addressof(fence->data()));
-    *fen = std::move(result);
-  }
+/*!
+  \details The work size is read from the dims when the command is executed,
+  so it can be computed by the preceding commands. It's clamped to the bound
+  and the dimensions which the kernel doesn't have are regarded as 1
+
+  \param [in] command No description.
+  \param [in] dimension No description.
+  \param [in] dims No description.
+  \param [in] bound No description.
+  \param [in] global_id_offset No description.
+  \param [in] priority No description.
+  \param [in] id No description.
+  \param [out] fence No description.
+  */
+void CpuDevice::submitIndirect(const Command& command,
+                               const uint32b dimension,
+                               const uint32b* dims,
+                               const std::array<uint32b, 3>& bound,
+                               const std::array<uint32b, 3>& global_id_offset,
+                               const QueuePriority priority,
+                               std::atomic<uint32b>* id,
+                               Fence* fence)
+{
+  const auto batch_size = zisc::cast<uint32b>(taskBatchSize());
+  const bool is_high = isHighPriority(priority);
+  auto* counter = std::addressof(num_of_high_priority_tasks_);
+  auto task = [command, id, dimension, dims, bound, global_id_offset, batch_size,
+               is_high, counter]
+  (const int64b, const int64b) noexcept
+  {
+    std::array<uint32b, 3> work_size{{1, 1, 1}};
+    for (std::size_t i = 0; i < dimension; ++i)
+      work_size[i] = (std::min)(dims[i], bound[i]);
+    cl::inner::WorkItem context{dimension, global_id_offset, work_size};
+    cl::inner::WorkItem::makeCurrent(std::addressof(context));
+    const uint32b num_of_works = context.numOfWorkGroups();
+    const uint32b n = (num_of_works + (batch_size - 1)) / batch_size;
+    for (uint32b block_id = issue(id); block_id < n; block_id = issue(id)) {
+      if (!is_high)
+        waitForHighPriority(counter);
+      const uint32b group_id = block_id * batch_size;
+      const uint32b num_of_groups = (std::min)(batch_size, num_of_works - group_id);
+      execBatchCommand(command, group_id, num_of_groups, std::addressof(context));
+    }
+    cl::inner::WorkItem::makeCurrent(nullptr);
+    if (is_high)
+      exitHighPriority(counter);
+  };
+  enqueue(std::move(task), is_high, fence);
 }
 
 /*!
@@ -186,6 +242,8 @@ void CpuDevice::waitForCompletion() const
 {
   auto& manager = const_cast<CpuDevice*>(this)->threadManager();
   manager.waitForCompletion();
+  if (high_priority_thread_manager_)
+    high_priority_thread_manager_->waitForCompletion();
 }
 
 /*!
@@ -217,7 +275,9 @@ void CpuDevice::waitForCompletion(const Fence& fence) const
   */
 void CpuDevice::destroyData() noexcept
 {
+  high_priority_thread_manager_.reset();
   thread_manager_.reset();
+  num_of_high_priority_tasks_.store(0, std::memory_order::release);
 }
 
 /*!
@@ -234,6 +294,12 @@ void CpuDevice::initData()
   thread_manager_ = zisc::pmr::allocateUnique(alloc,
                                               platform.numOfThreads(),
                                               mem_resource);
+  // High priority launches don't wait for the tasks of the other threads
+  if (platform.isHighPriorityEnabled()) {
+    high_priority_thread_manager_ = zisc::pmr::allocateUnique(alloc,
+                                                              platform.numOfThreads(),
+                                                              mem_resource);
+  }
 }
 
 /*!
@@ -247,25 +313,63 @@ void CpuDevice::updateDebugInfoImpl()
   \details No detailed description
 
   \param [in] command No description.
-  \param [in] block_id No description.
-  \param [in] group_id_max No description.
-  \param [in] batch_size No description.
+  \param [in] group_id No description.
+  \param [in] num_of_groups No description.
+  \param [in,out] context No description.
   */
 inline
 void CpuDevice::execBatchCommand(const Command& command,
-                                 const uint32b block_id,
-                                 const uint32b group_id_max,
-                                 const uint32b batch_size) noexcept
+                                 const uint32b group_id,
+                                 const uint32b num_of_groups,
+                                 cl::inner::WorkItem* context) noexcept
 {
-  for (uint32b i = 0; i < batch_size; ++i) {
-    const uint32b group_id = block_id * batch_size + i;
-    if (group_id < group_id_max) {
-      cl::inner::WorkItem::setWorkGroupId(group_id);
-      command();
-    }
+  // Only the first work-group ID of the batch is decomposed with div/mod
+  context->setWorkGroupId(group_id);
+  command();
+  for (uint32b i = 1; i < num_of_groups; ++i) {
+    context->advanceWorkGroupId();
+    command();
+  }
+}
+
+/*!
+  \details A high priority task is enqueued into its own thread manager,
+  so it doesn't wait for the tasks which were submitted before it.
+  The tasks of the other priorities yield their threads to it per batch
+
+  \param [in] task No description.
+  \param [in] is_high_priority No description.
+  \param [out] fence No description.
+  */
+template <typename Task> inline
+void CpuDevice::enqueue(Task&& task, const bool is_high_priority, Fence* fence)
+{
+  auto& manager = is_high_priority ? *high_priority_thread_manager_ : threadManager();
+  constexpr int64b start = 0;
+  const int64b end = manager.numOfThreads();
+  if (is_high_priority)
+    num_of_high_priority_tasks_.fetch_add(zisc::cast<uint32b>(end), std::memory_order::acq_rel);
+  constexpr auto parent_id = zisc::ThreadManager::kAllPrecedences;
+  auto result = manager.enqueueLoop(std::forward<Task>(task), start, end, parent_id);
+  if (fence->isActive()) {
+    auto* fen = zisc::reinterp<CpuFence*>(std::addressof(fence->data()));
+    *fen = std::move(result);
   }
 }
 
+/*!
+  \details No detailed description
+
+  \param [in,out] counter No description.
+  */
+inline
+void CpuDevice::exitHighPriority(std::atomic<uint32b>* counter) noexcept
+{
+  const uint32b n = counter->fetch_sub(1, std::memory_order::acq_rel);
+  if (n == 1)
+    counter->notify_all();
+}
+
 /*!
   \details No detailed description
 
@@ -279,4 +383,33 @@ uint32b CpuDevice::issue(std::atomic<uint32b>* counter) noexcept
   return id;
 }
 
+/*!
+  \details No detailed description
+
+  \param [in] priority No description.
+  \return No description
+  */
+inline
+bool CpuDevice::isHighPriority(const QueuePriority priority) const noexcept
+{
+  const bool result = (priority == QueuePriority::kHigh) &&
+                      static_cast<bool>(high_priority_thread_manager_);
+  return result;
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] counter No description.
+  */
+inline
+void CpuDevice::waitForHighPriority(const std::atomic<uint32b>* counter) noexcept
+{
+  for (uint32b n = counter->load(std::memory_order::acquire);
+       0 < n;
+       n = counter->load(std::memory_order::acquire)) {
+    counter->wait(n, std::memory_order::acquire);
+  }
+}
+
 } // namespace zivc
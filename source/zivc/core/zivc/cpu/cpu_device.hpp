@@ -28,6 +28,7 @@
 // Zivc
 #include "zivc/device.hpp"
 #include "zivc/zivc_config.hpp"
+#include "zivc/cppcl/utility.hpp"
 #include "zivc/utility/id_data.hpp"
 
 namespace zivc {
@@ -92,9 +93,20 @@ class CpuDevice : public Device
               const uint32b dimension,
               const std::array<uint32b, 3>& work_size,
               const std::array<uint32b, 3>& global_id_offset,
+              const QueuePriority priority,
               std::atomic<uint32b>* id,
               Fence* fence);
 
+  //! Submit a kernel command which reads the work size on execution
+  void submitIndirect(const Command& command,
+                      const uint32b dimension,
+                      const uint32b* dims,
+                      const std::array<uint32b, 3>& bound,
+                      const std::array<uint32b, 3>& global_id_offset,
+                      const QueuePriority priority,
+                      std::atomic<uint32b>* id,
+                      Fence* fence);
+
   //! Take a use of a fence from the device
   void takeFence(Fence* fence) override;
 
@@ -129,22 +141,37 @@ class CpuDevice : public Device
  private:
   //! Execute a command on a number of the given batch size
   static void execBatchCommand(const Command& command,
-                               const uint32b block_id,
-                               const uint32b group_id_max,
-                               const uint32b batch_size) noexcept;
+                               const uint32b group_id,
+                               const uint32b num_of_groups,
+                               cl::inner::WorkItem* context) noexcept;
+
+  //! Enqueue the given task into the thread manager of the priority
+  template <typename Task>
+  void enqueue(Task&& task, const bool is_high_priority, Fence* fence);
+
+  //! Notify that a high priority task finished
+  static void exitHighPriority(std::atomic<uint32b>* counter) noexcept;
 
   //! Issue new block ID
   static uint32b issue(std::atomic<uint32b>* counter) noexcept;
 
+  //! Check if the given priority runs on the high priority threads
+  bool isHighPriority(const QueuePriority priority) const noexcept;
+
   //! Return the sub-platform
   CpuSubPlatform& parentImpl() noexcept;
 
   //! Return the sub-platform
   const CpuSubPlatform& parentImpl() const noexcept;
 
+  //! Wait for the high priority tasks to finish
+  static void waitForHighPriority(const std::atomic<uint32b>* counter) noexcept;
+
 
   zisc::Memory::Usage heap_usage_;
   zisc::pmr::unique_ptr<zisc::ThreadManager> thread_manager_;
+  zisc::pmr::unique_ptr<zisc::ThreadManager> high_priority_thread_manager_;
+  std::atomic<uint32b> num_of_high_priority_tasks_{0};
 };
 
 } // namespace zivc
@@ -14,6 +14,7 @@
 
 #include "cpu_device_info.hpp"
 // Standard C++ library
+#include <algorithm>
 #include <array>
 #include <cstddef>
 #include <cstring>
@@ -22,6 +23,7 @@
 #include <string_view>
 #include <utility>
 // Zisc
+#include "zisc/utility.hpp"
 #include "zisc/memory/memory.hpp"
 #include "zisc/memory/std_memory_resource.hpp"
 // Zivc
@@ -50,7 +52,10 @@ CpuDeviceInfo::CpuDeviceInfo(CpuDeviceInfo&& other) noexcept :
     DeviceInfo(std::move(other)),
     name_{other.name_},
     vendor_name_{other.vendor_name_},
-    memory_stats_{other.memory_stats_}
+    memory_stats_{other.memory_stats_},
+    topology_{other.topology_},
+    feature_flags_{other.feature_flags_},
+    isa_level_{other.isa_level_}
 {
 }
 
@@ -72,10 +77,46 @@ CpuDeviceInfo& CpuDeviceInfo::operator=(CpuDeviceInfo&& other) noexcept
   name_ = other.name_;
   vendor_name_ = other.vendor_name_;
   memory_stats_ = other.memory_stats_;
+  topology_ = other.topology_;
+  feature_flags_ = other.feature_flags_;
+  isa_level_ = other.isa_level_;
   DeviceInfo::operator=(std::move(other));
   return *this;
 }
 
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+std::size_t CpuDeviceInfo::cacheLineSize() const noexcept
+{
+  return topology_.cache_line_size_;
+}
+
+/*!
+  \details Zero is returned if the cache size isn't available
+
+  \param [in] level No description.
+  \return No description
+  */
+std::size_t CpuDeviceInfo::cacheSize(const uint32b level) const noexcept
+{
+  const auto& size_list = topology_.cache_size_list_;
+  const bool is_valid = (1 <= level) && (level <= size_list.size());
+  return is_valid ? size_list[level - 1] : 0;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+uint64b CpuDeviceInfo::featureFlags() const noexcept
+{
+  return feature_flags_;
+}
+
 /*!
   \details No detailed description
   */
@@ -85,6 +126,48 @@ void CpuDeviceInfo::fetch() noexcept
   initHeapInfoList();
 }
 
+/*!
+  \details No detailed description
+
+  \param [in] feature No description.
+  \return No description
+  */
+bool CpuDeviceInfo::hasFeature(const CpuFeature feature) const noexcept
+{
+  const uint64b bit = getCpuFeatureBit(feature);
+  return (featureFlags() & bit) == bit;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+CpuIsaLevel CpuDeviceInfo::isaLevel() const noexcept
+{
+  return isa_level_;
+}
+
+/*!
+  \details Kernels of the CPU backend always take raw pointers
+
+  \return No description
+  */
+bool CpuDeviceInfo::isBufferDeviceAddressSupported() const noexcept
+{
+  return true;
+}
+
+/*!
+  \details Kernels of the CPU backend are compiled as C++
+
+  \return No description
+  */
+bool CpuDeviceInfo::isFloat64Supported() const noexcept
+{
+  return true;
+}
+
 /*!
   \details No detailed description
 
@@ -128,6 +211,47 @@ auto CpuDeviceInfo::memoryStats() const noexcept -> const MemoryStats&
   return memory_stats_;
 }
 
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+uint32b CpuDeviceInfo::numOfLogicalCores() const noexcept
+{
+  return topology_.num_of_logical_cores_;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+uint32b CpuDeviceInfo::numOfNumaNodes() const noexcept
+{
+  return topology_.num_of_numa_nodes_;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+uint32b CpuDeviceInfo::numOfPhysicalCores() const noexcept
+{
+  return topology_.num_of_physical_cores_;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+uint32b CpuDeviceInfo::numOfThreadsPerCore() const noexcept
+{
+  const uint32b n = numOfLogicalCores() / (std::max)(numOfPhysicalCores(), 1u);
+  return (std::max)(n, 1u);
+}
+
 /*!
   \details No detailed description
 
@@ -139,6 +263,48 @@ std::string_view CpuDeviceInfo::name() const noexcept
   return n;
 }
 
+/*!
+  \details One worker thread per physical core is recommended.
+  SMT siblings share the execution units and the L1/L2 caches of a core,
+  so an extra worker on a sibling mostly competes with the first one
+  in compute bound kernels
+
+  \return No description
+  */
+uint32b CpuDeviceInfo::recommendedNumOfThreads() const noexcept
+{
+  return (std::max)(numOfPhysicalCores(), 1u);
+}
+
+/*!
+  \details The batch size is chosen so that a batch of work items, each of
+  which touches a cache line of a few buffers, fits in the L1 data cache
+  of a core. If the cache info isn't available, 32 is returned
+
+  \return No description
+  */
+uint32b CpuDeviceInfo::recommendedTaskBatchSize() const noexcept
+{
+  constexpr std::size_t default_batch_size = 32;
+  constexpr std::size_t num_of_lines_per_item = 8;
+  const std::size_t l1_size = cacheSize(1);
+  const std::size_t line_size = cacheLineSize();
+  const std::size_t batch_size = ((l1_size != 0) && (line_size != 0))
+      ? l1_size / (line_size * num_of_lines_per_item)
+      : default_batch_size;
+  return zisc::cast<uint32b>((std::max)(batch_size, std::size_t{1}));
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+const CpuTopology& CpuDeviceInfo::topology() const noexcept
+{
+  return topology_;
+}
+
 /*!
   \details No detailed description
 
@@ -175,7 +341,9 @@ uint32b CpuDeviceInfo::workGroupSize() const noexcept
   */
 void CpuDeviceInfo::initCpuInfo() noexcept
 {
-  getCpuFeatures(name_.data(), vendor_name_.data());
+  getCpuFeatures(name_.data(), vendor_name_.data(), std::addressof(feature_flags_));
+  isa_level_ = getCpuIsaLevel(feature_flags_);
+  getCpuTopology(std::addressof(topology_));
 }
 
 /*!
@@ -24,6 +24,7 @@
 #include "zisc/memory/memory.hpp"
 #include "zisc/memory/std_memory_resource.hpp"
 // Zivc
+#include "utility/cpu_features.hpp"
 #include "zivc/device_info.hpp"
 #include "zivc/zivc_config.hpp"
 #include "zivc/utility/id_data.hpp"
@@ -56,9 +57,30 @@ class CpuDeviceInfo : public DeviceInfo
   CpuDeviceInfo& operator=(CpuDeviceInfo&& other) noexcept;
 
 
+  //! Return the size of a cache line in bytes
+  std::size_t cacheLineSize() const noexcept override;
+
+  //! Return the size of the data cache of the given level (1-3) in bytes
+  std::size_t cacheSize(const uint32b level) const noexcept override;
+
+  //! Return the bits of the features supported by the CPU
+  uint64b featureFlags() const noexcept;
+
   //! Fetch device info from the host
   void fetch() noexcept;
 
+  //! Check if the CPU supports the given feature
+  bool hasFeature(const CpuFeature feature) const noexcept;
+
+  //! Return the highest instruction set level supported by the CPU
+  CpuIsaLevel isaLevel() const noexcept;
+
+  //! Check if buffers can be passed to kernels as device addresses
+  bool isBufferDeviceAddressSupported() const noexcept override;
+
+  //! Check if kernels can use double precision floating point
+  bool isFloat64Supported() const noexcept override;
+
   //! Return the possible maximum size of an allocation in bytes
   std::size_t maxAllocationSize() const noexcept override;
 
@@ -71,9 +93,30 @@ class CpuDeviceInfo : public DeviceInfo
   //! Return the memory stats of the device
   const MemoryStats& memoryStats() const noexcept;
 
+  //! Return the number of hardware threads
+  uint32b numOfLogicalCores() const noexcept override;
+
+  //! Return the number of NUMA nodes
+  uint32b numOfNumaNodes() const noexcept override;
+
+  //! Return the number of physical cores
+  uint32b numOfPhysicalCores() const noexcept override;
+
+  //! Return the number of hardware threads per physical core
+  uint32b numOfThreadsPerCore() const noexcept override;
+
   //! Return the device name
   std::string_view name() const noexcept override;
 
+  //! Return the number of worker threads suitable for the CPU
+  uint32b recommendedNumOfThreads() const noexcept;
+
+  //! Return the number of work groups per task suitable for the CPU
+  uint32b recommendedTaskBatchSize() const noexcept;
+
+  //! Return the core and cache layout of the CPU
+  const CpuTopology& topology() const noexcept;
+
   //! Return the sub-platform type
   SubPlatformType type() const noexcept override;
 
@@ -94,6 +137,10 @@ class CpuDeviceInfo : public DeviceInfo
   IdData::NameType name_;
   IdData::NameType vendor_name_;
   MemoryStats memory_stats_;
+  CpuTopology topology_;
+  uint64b feature_flags_ = 0;
+  CpuIsaLevel isa_level_ = CpuIsaLevel::kBaseline;
+  [[maybe_unused]] Padding<4> pad_;
 };
 
 } // namespace zivc
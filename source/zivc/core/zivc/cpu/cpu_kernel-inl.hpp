@@ -24,6 +24,7 @@
 #include <memory>
 #include <tuple>
 #include <type_traits>
+#include <utility>
 // Zisc
 #include "zisc/error.hpp"
 #include "zisc/utility.hpp"
@@ -31,6 +32,7 @@
 // Zivc
 #include "cpu_buffer.hpp"
 #include "cpu_device.hpp"
+#include "cpu_device_info.hpp"
 #include "zivc/kernel.hpp"
 #include "zivc/kernel_set.hpp"
 #include "zivc/zivc_config.hpp"
@@ -56,20 +58,7 @@ template <typename CKernel, typename Type> inline
 LaunchResult CpuKernelHelper::run(CKernel* kernel, const Type& launch_options)
 {
   using KernelT = std::remove_cvref_t<CKernel>;
-  // Command recording
-  auto c = [kernel]() noexcept
-  {
-    kernel->template runImpl<0, 0>();
-  };
-  using CommandT = decltype(c);
-  using CommandStorage = typename KernelT::CommandStorage;
-  static_assert(sizeof(CommandStorage) == sizeof(CommandT));
-  static_assert(std::alignment_of_v<CommandStorage> == std::alignment_of_v<CommandT>);
-  auto command_mem = zisc::cast<void*>(kernel->commandStorage());
-  CommandT* command = ::new (command_mem) CommandT{c};
-  // id counter
-  auto atomic_mem = zisc::cast<void*>(kernel->atomicStorage());
-  std::atomic<uint32b>* id = ::new (atomic_mem) std::atomic<uint32b>{0};
+  auto [command, id] = prepareCommand(kernel);
 
   LaunchResult result{};
   CpuDevice& device = kernel->parentImpl();
@@ -81,12 +70,76 @@ LaunchResult CpuKernelHelper::run(CKernel* kernel, const Type& launch_options)
     const auto work_size = KernelT::expandWorkSize(launch_options.workSize(), 1);
     const auto global_offset =
         KernelT::expandWorkSize(launch_options.globalIdOffset(), 0);
-    device.submit(*command, dim, work_size, global_offset, id, std::addressof(fence));
+    device.submit(*command, dim, work_size, global_offset,
+                  launch_options.queuePriority(), id, std::addressof(fence));
+  }
+  result.setAsync(true);
+  return result;
+}
+
+/*!
+  \details The dims are read by the worker threads when the kernel is executed,
+  so the preceding kernels can write the work size without host synchronization.
+  The work size of the launch options is the upper bound of the dims
+
+  \param [in] kernel No description.
+  \param [in] dims No description.
+  \param [in] launch_options No description.
+  \return No description
+  */
+template <typename CKernel, typename Type> inline
+LaunchResult CpuKernelHelper::runIndirect(CKernel* kernel,
+                                          const Buffer<uint32b>& dims,
+                                          const Type& launch_options)
+{
+  using KernelT = std::remove_cvref_t<CKernel>;
+  auto [command, id] = prepareCommand(kernel);
+
+  LaunchResult result{};
+  CpuDevice& device = kernel->parentImpl();
+  // Command submission
+  {
+    Fence& fence = result.fence();
+    fence.setDevice(launch_options.isExternalSyncMode() ? &device : nullptr);
+    constexpr uint32b dim = KernelT::dimension();
+    const auto* dims_data = zisc::cast<const uint32b*>(dims.rawBufferData());
+    const auto bound = KernelT::expandWorkSize(launch_options.workSize(), 1);
+    const auto global_offset =
+        KernelT::expandWorkSize(launch_options.globalIdOffset(), 0);
+    device.submitIndirect(*command, dim, dims_data, bound, global_offset,
+                          launch_options.queuePriority(), id, std::addressof(fence));
   }
   result.setAsync(true);
   return result;
 }
 
+/*!
+  \details No detailed description
+
+  \param [in] kernel No description.
+  \return The command and the id counter of the kernel
+  */
+template <typename CKernel> inline
+auto CpuKernelHelper::prepareCommand(CKernel* kernel) noexcept
+{
+  using KernelT = std::remove_cvref_t<CKernel>;
+  // Command recording
+  auto c = [kernel]() noexcept
+  {
+    kernel->template runImpl<0, 0>();
+  };
+  using CommandT = decltype(c);
+  using CommandStorage = typename KernelT::CommandStorage;
+  static_assert(sizeof(CommandStorage) == sizeof(CommandT));
+  static_assert(std::alignment_of_v<CommandStorage> == std::alignment_of_v<CommandT>);
+  auto command_mem = zisc::cast<void*>(kernel->commandStorage());
+  CommandT* command = ::new (command_mem) CommandT{c};
+  // id counter
+  auto atomic_mem = zisc::cast<void*>(kernel->atomicStorage());
+  std::atomic<uint32b>* id = ::new (atomic_mem) std::atomic<uint32b>{0};
+  return std::make_pair(command, id);
+}
+
 /*!
   \details No detailed description
 
@@ -134,7 +187,9 @@ destroyData() noexcept
 }
 
 /*!
-  \details No detailed description
+  \details If the kernel set has a variant of the kernel compiled for
+  the instruction set of the host, the variant is used instead of
+  the given function
 
   \param [in] params No description.
   */
@@ -144,6 +199,10 @@ void CpuKernel<KernelInitParams<kDim, KSet, FuncArgs...>, Args...>::
 initData(const Params& params)
 {
   kernel_ = params.func();
+  const CpuIsaLevel level = parentImpl().deviceInfoImpl().isaLevel();
+  const auto variant = KSet::findCpuKernel(level, params.kernelName());
+  if (variant != nullptr)
+    kernel_ = reinterpret_cast<Function>(variant);
 }
 
 /*!
@@ -268,9 +327,13 @@ runImpl(Types&&... cl_args) noexcept
       runImpl<kIndex + 1, kCacheIndex + 1>(std::forward<Types>(cl_args)..., cl_arg);
     }
     else { // Process a global argument
-      using ElementType = typename ArgTypeInfo::ElementType;
-      using PointerT = typename ArgType::Pointer;
-      BufferCommon* cache = arg_cache_.template get<kCacheIndex>();
+      // A read only buffer is cached as a pointer to const
+      using ElementType = std::conditional_t<
+          std::is_const_v<std::remove_pointer_t<CacheType>>,
+          std::add_const_t<typename ArgTypeInfo::ElementType>,
+          typename ArgTypeInfo::ElementType>;
+      using PointerT = std::add_pointer_t<ElementType>;
+      const auto cache = arg_cache_.template get<kCacheIndex>();
       auto data = zisc::cast<PointerT>(cache->rawBufferData());
       cl::AddressSpacePointer<cl::AddressSpaceType::kGlobal, ElementType> cl_arg{data};
       runImpl<kIndex + 1, kCacheIndex + 1>(std::forward<Types>(cl_args)..., cl_arg);
@@ -324,6 +387,27 @@ updateArgCache(Buffer<Type>& value, Types&&... values) noexcept
     updateArgCache<kIndex + 1>(std::forward<Types>(values)...);
 }
 
+/*!
+  \details No detailed description
+
+  \tparam kIndex No description.
+  \tparam Type No description.
+  \tparam Types No description.
+  \param [in] value No description.
+  \param [in] values No description.
+  */
+template <std::size_t kDim, DerivedKSet KSet, typename ...FuncArgs, typename ...Args>
+template <std::size_t kIndex, KernelArg Type, typename ...Types> inline
+void
+CpuKernel<KernelInitParams<kDim, KSet, FuncArgs...>, Args...>::
+updateArgCache(const Buffer<Type>& value, Types&&... values) noexcept
+{
+  constexpr std::size_t num_of_rest = sizeof...(Types);
+  arg_cache_.template set<kIndex>(std::addressof(value));
+  if constexpr (0 < num_of_rest)
+    updateArgCache<kIndex + 1>(std::forward<Types>(values)...);
+}
+
 } // namespace zivc
 
 #endif // ZIVC_CPU_KERNEL_INL_HPP
@@ -50,6 +50,16 @@ class CpuKernelHelper
  public:
   template <typename CKernel, typename Type>
   static LaunchResult run(CKernel* kernel, const Type& launch_options);
+
+  template <typename CKernel, typename Type>
+  static LaunchResult runIndirect(CKernel* kernel,
+                                  const Buffer<uint32b>& dims,
+                                  const Type& launch_options);
+
+ private:
+  //! Prepare the command of the given kernel
+  template <typename CKernel>
+  static auto prepareCommand(CKernel* kernel) noexcept;
 };
 
 /*!
@@ -93,6 +103,17 @@ class CpuKernel<KernelInitParams<kDim, KSet, FuncArgs...>, Args...> :
     return CpuKernelHelper::run(this, launch_options);
   }
 
+  //! Execute a kernel with the work size which is read from the given buffer on the device
+  [[nodiscard("The result can have a fence when external sync mode is on.")]]
+  LaunchResult runIndirect(Buffer<uint32b>& dims,
+                           Args... args,
+                           const LaunchOptions& launch_options) override
+  {
+    //! \note Separate declaration and definition cause a build error on visual studio
+    updateArgCache<0>(args...);
+    return CpuKernelHelper::runIndirect(this, dims, launch_options);
+  }
+
  protected:
   //! Clear the contents of the kernel
   void destroyData() noexcept override;
@@ -146,6 +167,10 @@ class CpuKernel<KernelInitParams<kDim, KSet, FuncArgs...>, Args...> :
   template <std::size_t kIndex, KernelArg Type, typename ...Types>
   void updateArgCache(Buffer<Type>& value, Types&&... values) noexcept;
 
+  //! Update arg cache
+  template <std::size_t kIndex, KernelArg Type, typename ...Types>
+  void updateArgCache(const Buffer<Type>& value, Types&&... values) noexcept;
+
 
   Function kernel_ = nullptr;
   ArgCache arg_cache_;
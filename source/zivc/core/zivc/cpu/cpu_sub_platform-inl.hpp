@@ -28,6 +28,17 @@
 
 namespace zivc {
 
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+bool CpuSubPlatform::isHighPriorityEnabled() const noexcept
+{
+  return high_priority_enabled_;
+}
+
 /*!
   \details No detailed description
 
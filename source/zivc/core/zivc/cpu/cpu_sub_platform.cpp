@@ -130,6 +130,14 @@ SubPlatformType CpuSubPlatform::type() const noexcept
 void CpuSubPlatform::updateDeviceInfoList()
 {
   device_info_->fetch();
+  // Decide the parameters which aren't specified by the options
+  if (num_of_threads_ == 0)
+    num_of_threads_ = device_info_->recommendedNumOfThreads();
+  if (task_batch_size_ == 0) {
+    constexpr uint32b max_batch_size = maxTaskBatchSize();
+    task_batch_size_ = device_info_->recommendedTaskBatchSize();
+    task_batch_size_ = zisc::clamp(task_batch_size_, 1U, max_batch_size);
+  }
 }
 
 /*!
@@ -139,6 +147,7 @@ void CpuSubPlatform::destroyData() noexcept
 {
   num_of_threads_ = 0;
   task_batch_size_ = 0;
+  high_priority_enabled_ = false;
   device_info_.reset();
 }
 
@@ -152,10 +161,14 @@ void CpuSubPlatform::initData(PlatformOptions& options)
   auto* mem_resource = memoryResource();
   zisc::pmr::polymorphic_allocator<CpuDeviceInfo> alloc{mem_resource};
   device_info_ = zisc::pmr::allocateUnique<CpuDeviceInfo>(alloc, mem_resource);
+  // Zero means that the parameter is decided from the device info
   num_of_threads_ = options.cpuNumOfThreads();
   constexpr uint32b max_batch_size = maxTaskBatchSize();
   task_batch_size_ = options.cpuTaskBatchSize();
-  task_batch_size_ = zisc::clamp(task_batch_size_, 1U, max_batch_size);
+  if (task_batch_size_ != 0)
+    task_batch_size_ = zisc::clamp(task_batch_size_, 1U, max_batch_size);
+  // High priority launches run on own threads if high priority queues are declared
+  high_priority_enabled_ = 0 < options.numOfHighPriorityQueues();
 }
 
 /*!
@@ -54,6 +54,9 @@ class CpuSubPlatform : public SubPlatform
   //! Check if the sub-platform is available
   bool isAvailable() const noexcept override;
 
+  //! Check if high priority launches run on their own threads
+  bool isHighPriorityEnabled() const noexcept;
+
   //! Make a unique device
   [[nodiscard]]
   SharedDevice makeDevice(const DeviceInfo& device_info) override;
@@ -96,6 +99,8 @@ class CpuSubPlatform : public SubPlatform
   zisc::pmr::unique_ptr<CpuDeviceInfo> device_info_;
   uint32b num_of_threads_ = 0;
   uint32b task_batch_size_ = 0;
+  bool high_priority_enabled_ = false;
+  [[maybe_unused]] Padding<7> pad_;
 };
 
 } // namespace zivc
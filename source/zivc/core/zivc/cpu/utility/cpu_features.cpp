@@ -14,9 +14,16 @@
 
 #include "cpu_features.hpp"
 // Standard C++ library
+#include <algorithm>
 #include <array>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
 #include <cstring>
+#include <initializer_list>
+#include <memory>
 #include <string_view>
+#include <thread>
 
 #if defined(Z_GCC) || defined(Z_CLANG)
 #pragma GCC diagnostic push
@@ -41,10 +48,186 @@
 #pragma GCC diagnostic pop
 #endif // Z_GCC || Z_CLANG
 
+// Zisc
+#include "zisc/utility.hpp"
 // Zivc
 #include "zivc/device_info.hpp"
+#include "zivc/zivc_config.hpp"
 #include "zivc/utility/id_data.hpp"
 
+namespace {
+
+#if defined(Z_LINUX)
+
+/*!
+  \details No detailed description
+
+  \param [in] path No description.
+  \param [out] line No description.
+  \param [in] size No description.
+  \return True if the first line of the file is read, false otherwise
+  */
+bool readSysFile(const char* path, char* line, const std::size_t size) noexcept
+{
+  std::FILE* file = std::fopen(path, "r");
+  if (file == nullptr)
+    return false;
+  const bool result = std::fgets(line, zisc::cast<int>(size), file) != nullptr;
+  std::fclose(file);
+  return result;
+}
+
+/*!
+  \details Apply the given function to each index of a list like "0-3,8-11"
+
+  \param [in] list No description.
+  \param [in] func No description.
+  */
+template <typename Function>
+void forEachListEntry(const char* list, Function&& func) noexcept
+{
+  const char* p = list;
+  while ((*p != '\0') && (*p != '\n')) {
+    char* end = nullptr;
+    const auto first = zisc::cast<zivc::uint32b>(std::strtoul(p, &end, 10));
+    if (end == p)
+      break;
+    zivc::uint32b last = first;
+    p = end;
+    if (*p == '-') {
+      last = zisc::cast<zivc::uint32b>(std::strtoul(p + 1, &end, 10));
+      p = end;
+    }
+    for (zivc::uint32b index = first; index <= last; ++index)
+      func(index);
+    if (*p == ',')
+      ++p;
+  }
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] list No description.
+  \return No description
+  */
+zivc::uint32b countListEntries(const char* list) noexcept
+{
+  zivc::uint32b count = 0;
+  forEachListEntry(list, [&count](const zivc::uint32b) noexcept {++count;});
+  return count;
+}
+
+/*!
+  \details Parse a size like "48K" or "32M"
+
+  \param [in] str No description.
+  \return The size in bytes
+  */
+std::size_t parseSize(const char* str) noexcept
+{
+  char* end = nullptr;
+  std::size_t size = std::strtoull(str, &end, 10);
+  if (*end == 'K')
+    size *= 1024;
+  else if (*end == 'M')
+    size *= 1024 * 1024;
+  else if (*end == 'G')
+    size *= 1024 * 1024 * 1024;
+  return size;
+}
+
+/*!
+  \details The cores are read from /sys/devices/system/cpu and
+  the NUMA nodes from /sys/devices/system/node
+
+  \param [out] topology No description.
+  */
+void initTopologyFromSysfs(zivc::CpuTopology* topology) noexcept
+{
+  constexpr std::size_t n = 256;
+  char path[n] = "";
+  char line[n] = "";
+
+  // Cores
+  if (readSysFile("/sys/devices/system/cpu/online", line, n)) {
+    char online_list[n] = "";
+    std::strncpy(online_list, line, n - 1);
+    zivc::uint32b num_of_logical_cores = 0;
+    zivc::uint32b num_of_physical_cores = 0;
+    auto count_core = [&](const zivc::uint32b index) noexcept
+    {
+      ++num_of_logical_cores;
+      // A physical core is counted at its first hardware thread
+      const char* format = "/sys/devices/system/cpu/cpu%u/topology/thread_siblings_list";
+      std::snprintf(path, n, format, index);
+      const bool has_siblings = readSysFile(path, line, n);
+      if (!has_siblings || (std::strtoul(line, nullptr, 10) == index))
+        ++num_of_physical_cores;
+    };
+    forEachListEntry(online_list, count_core);
+    topology->num_of_logical_cores_ = num_of_logical_cores;
+    topology->num_of_physical_cores_ = num_of_physical_cores;
+  }
+
+  // NUMA nodes
+  if (readSysFile("/sys/devices/system/node/online", line, n))
+    topology->num_of_numa_nodes_ = countListEntries(line);
+
+  // Data caches
+  constexpr zivc::uint32b max_num_of_caches = 16;
+  for (zivc::uint32b i = 0; i < max_num_of_caches; ++i) {
+    const char* dir = "/sys/devices/system/cpu/cpu0/cache/index";
+    std::snprintf(path, n, "%s%u/level", dir, i);
+    if (!readSysFile(path, line, n))
+      break;
+    const auto level = zisc::cast<std::size_t>(std::strtoul(line, nullptr, 10));
+    std::snprintf(path, n, "%s%u/type", dir, i);
+    if (!readSysFile(path, line, n) || (std::strncmp(line, "Instruction", 11) == 0))
+      continue;
+    if ((level < 1) || (topology->cache_size_list_.size() < level))
+      continue;
+    std::snprintf(path, n, "%s%u/size", dir, i);
+    if (readSysFile(path, line, n))
+      topology->cache_size_list_[level - 1] = parseSize(line);
+    std::snprintf(path, n, "%s%u/coherency_line_size", dir, i);
+    if ((topology->cache_line_size_ == 0) && readSysFile(path, line, n))
+      topology->cache_line_size_ = parseSize(line);
+  }
+}
+
+#endif // Z_LINUX
+
+#if defined(CPU_FEATURES_ARCH_X86)
+
+/*!
+  \details Only the caches which aren't reported by the OS are set
+
+  \param [in,out] topology No description.
+  */
+void initCacheInfoFromCpuid(zivc::CpuTopology* topology) noexcept
+{
+  namespace cpu = cpu_features;
+  const cpu::CacheInfo info = cpu::GetX86CacheInfo();
+  for (int i = 0; i < info.size; ++i) {
+    const cpu::CacheLevelInfo& cache = info.levels[i];
+    const bool is_data_cache = (cache.cache_type == cpu::CPU_FEATURE_CACHE_DATA) ||
+                               (cache.cache_type == cpu::CPU_FEATURE_CACHE_UNIFIED);
+    const auto level = zisc::cast<std::size_t>(cache.level);
+    if (!is_data_cache || (level < 1) || (topology->cache_size_list_.size() < level))
+      continue;
+    std::size_t& size = topology->cache_size_list_[level - 1];
+    if (size == 0)
+      size = zisc::cast<std::size_t>(cache.cache_size);
+    if (topology->cache_line_size_ == 0)
+      topology->cache_line_size_ = zisc::cast<std::size_t>(cache.line_size);
+  }
+}
+
+#endif // CPU_FEATURES_ARCH_X86
+
+} // namespace
+
 namespace zivc {
 
 /*!
@@ -52,8 +235,11 @@ namespace zivc {
 
   \param [out] cpu_name No description.
   \param [out] vendor_name No description.
+  \param [out] feature_flags The bits of the features supported by the CPU.
   */
-void getCpuFeatures(char* cpu_name, char* vendor_name) noexcept
+void getCpuFeatures(char* cpu_name,
+                    char* vendor_name,
+                    uint64b* feature_flags) noexcept
 {
   IdData::NameType cpu_n;
   IdData::NameType vendor_n;
@@ -66,6 +252,13 @@ void getCpuFeatures(char* cpu_name, char* vendor_name) noexcept
     copyStr(name, vendor_n.data());
   };
 
+  uint64b flags = 0;
+  auto set_feature = [&flags](const CpuFeature feature, const bool has_feature)
+  {
+    if (has_feature)
+      flags |= getCpuFeatureBit(feature);
+  };
+
   // Init data
   set_cpu_name(DeviceInfo::invalidName());
   set_vendor_name(DeviceInfo::invalidName());
@@ -82,6 +275,25 @@ void getCpuFeatures(char* cpu_name, char* vendor_name) noexcept
   {
     const cpu::X86Info info = cpu::GetX86Info();
     set_vendor_name(info.vendor);
+    // AVX features are reported only if the OS saves the extended registers
+    const cpu::X86Features& f = info.features;
+    set_feature(CpuFeature::kSse3, f.sse3);
+    set_feature(CpuFeature::kSsse3, f.ssse3);
+    set_feature(CpuFeature::kSse41, f.sse4_1);
+    set_feature(CpuFeature::kSse42, f.sse4_2);
+    set_feature(CpuFeature::kPopcnt, f.popcnt);
+    set_feature(CpuFeature::kAvx, f.avx);
+    set_feature(CpuFeature::kAvx2, f.avx2);
+    set_feature(CpuFeature::kBmi1, f.bmi1);
+    set_feature(CpuFeature::kBmi2, f.bmi2);
+    set_feature(CpuFeature::kF16c, f.f16c);
+    set_feature(CpuFeature::kFma, f.fma3);
+    set_feature(CpuFeature::kMovbe, f.movbe);
+    set_feature(CpuFeature::kAvx512f, f.avx512f);
+    set_feature(CpuFeature::kAvx512bw, f.avx512bw);
+    set_feature(CpuFeature::kAvx512cd, f.avx512cd);
+    set_feature(CpuFeature::kAvx512dq, f.avx512dq);
+    set_feature(CpuFeature::kAvx512vl, f.avx512vl);
   }
 #elif defined(CPU_FEATURES_ARCH_ARM)
   static_assert(false, "Not implemented yet.");
@@ -109,6 +321,69 @@ void getCpuFeatures(char* cpu_name, char* vendor_name) noexcept
   //
   copyStr(cpu_n.data(), cpu_name);
   copyStr(vendor_n.data(), vendor_name);
+  *feature_flags = flags;
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] feature_flags No description.
+  \return No description
+  */
+CpuIsaLevel getCpuIsaLevel(const uint64b feature_flags) noexcept
+{
+  auto has_features = [feature_flags](const std::initializer_list<CpuFeature> list)
+  {
+    uint64b mask = 0;
+    for (const CpuFeature feature : list)
+      mask |= getCpuFeatureBit(feature);
+    return (feature_flags & mask) == mask;
+  };
+
+  CpuIsaLevel level = CpuIsaLevel::kBaseline;
+  if (has_features({CpuFeature::kSse3, CpuFeature::kSsse3, CpuFeature::kSse41,
+                    CpuFeature::kSse42, CpuFeature::kPopcnt})) {
+    level = CpuIsaLevel::kX86_64V2;
+    if (has_features({CpuFeature::kAvx, CpuFeature::kAvx2, CpuFeature::kBmi1,
+                      CpuFeature::kBmi2, CpuFeature::kF16c, CpuFeature::kFma,
+                      CpuFeature::kMovbe})) {
+      level = CpuIsaLevel::kX86_64V3;
+      if (has_features({CpuFeature::kAvx512f, CpuFeature::kAvx512bw,
+                        CpuFeature::kAvx512cd, CpuFeature::kAvx512dq,
+                        CpuFeature::kAvx512vl}))
+        level = CpuIsaLevel::kX86_64V4;
+    }
+  }
+  return level;
+}
+
+/*!
+  \details The layout is read from sysfs on Linux and the cache sizes
+  which aren't available there are taken from cpuid.
+  When the cores can't be read, all hardware threads are regarded as
+  physical cores
+
+  \param [out] topology No description.
+  */
+void getCpuTopology(CpuTopology* topology) noexcept
+{
+  CpuTopology t{};
+#if defined(Z_LINUX)
+  ::initTopologyFromSysfs(std::addressof(t));
+#endif // Z_LINUX
+#if defined(CPU_FEATURES_ARCH_X86)
+  ::initCacheInfoFromCpuid(std::addressof(t));
+#endif // CPU_FEATURES_ARCH_X86
+
+  if (t.num_of_logical_cores_ == 0) {
+    const uint32b n = std::thread::hardware_concurrency();
+    t.num_of_logical_cores_ = (std::max)(n, 1u);
+  }
+  if (t.num_of_physical_cores_ == 0)
+    t.num_of_physical_cores_ = t.num_of_logical_cores_;
+  if (t.num_of_numa_nodes_ == 0)
+    t.num_of_numa_nodes_ = 1;
+  *topology = t;
 }
 
 } // namespace zivc
@@ -15,10 +15,47 @@
 #ifndef ZIVC_CPU_FEATURES_HPP
 #define ZIVC_CPU_FEATURES_HPP
 
+// Standard C++ library
+#include <array>
+#include <cstddef>
+// Zisc
+#include "zisc/utility.hpp"
+// Zivc
+#include "zivc/zivc_config.hpp"
+
 namespace zivc {
 
+/*!
+  \brief The core and cache layout of the host CPU
+
+  A value of zero means that the information isn't available.
+  */
+struct CpuTopology
+{
+  std::array<std::size_t, 3> cache_size_list_{{0, 0, 0}}; //!< L1d, L2 and L3 sizes in bytes
+  std::size_t cache_line_size_ = 0;
+  uint32b num_of_logical_cores_ = 0;
+  uint32b num_of_physical_cores_ = 0;
+  uint32b num_of_numa_nodes_ = 0;
+  [[maybe_unused]] Padding<4> pad_;
+};
+
 //! Get cpu features
-void getCpuFeatures(char* cpu_name, char* vendor_name) noexcept;
+void getCpuFeatures(char* cpu_name,
+                    char* vendor_name,
+                    uint64b* feature_flags) noexcept;
+
+//! Return the highest ISA level supported by the given features
+CpuIsaLevel getCpuIsaLevel(const uint64b feature_flags) noexcept;
+
+//! Get the core and cache layout of the host CPU
+void getCpuTopology(CpuTopology* topology) noexcept;
+
+//! Return the bit of the given feature in feature flags
+constexpr uint64b getCpuFeatureBit(const CpuFeature feature) noexcept
+{
+  return 0b1ull << zisc::cast<uint32b>(feature);
+}
 
 } // namespace zivc
 
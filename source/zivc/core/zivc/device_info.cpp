@@ -14,10 +14,13 @@
 
 #include "device_info.hpp"
 // Standard C++ library
+#include <cstddef>
 #include <utility>
 #include <vector>
 // Zisc
 #include "zisc/memory/std_memory_resource.hpp"
+// Zivc
+#include "zivc_config.hpp"
 
 namespace zivc {
 
@@ -46,6 +49,67 @@ DeviceInfo::~DeviceInfo() noexcept
 {
 }
 
+/*!
+  \details Zero is returned if the device doesn't report it
+
+  \return No description
+  */
+std::size_t DeviceInfo::cacheLineSize() const noexcept
+{
+  return 0;
+}
+
+/*!
+  \details Zero is returned if the device doesn't report it
+
+  \param [in] level No description.
+  \return No description
+  */
+std::size_t DeviceInfo::cacheSize([[maybe_unused]] const uint32b level) const noexcept
+{
+  return 0;
+}
+
+/*!
+  \details Zero is returned if the device doesn't report it
+
+  \return No description
+  */
+uint32b DeviceInfo::numOfLogicalCores() const noexcept
+{
+  return 0;
+}
+
+/*!
+  \details Zero is returned if the device doesn't report it
+
+  \return No description
+  */
+uint32b DeviceInfo::numOfNumaNodes() const noexcept
+{
+  return 0;
+}
+
+/*!
+  \details Zero is returned if the device doesn't report it
+
+  \return No description
+  */
+uint32b DeviceInfo::numOfPhysicalCores() const noexcept
+{
+  return 0;
+}
+
+/*!
+  \details Zero is returned if the device doesn't report it
+
+  \return No description
+  */
+uint32b DeviceInfo::numOfThreadsPerCore() const noexcept
+{
+  return 0;
+}
+
 /*!
   \details No detailed description
 
@@ -51,6 +51,12 @@ class DeviceInfo : private zisc::NonCopyable<DeviceInfo>
   DeviceInfo& operator=(DeviceInfo&& other) noexcept;
 
 
+  //! Return the size of a cache line in bytes
+  virtual std::size_t cacheLineSize() const noexcept;
+
+  //! Return the size of the data cache of the given level (1-3) in bytes
+  virtual std::size_t cacheSize(const uint32b level) const noexcept;
+
   //! Return the heap info by the given index
   MemoryHeapInfo& heapInfo(const std::size_t heap_index) noexcept;
 
@@ -66,6 +72,12 @@ class DeviceInfo : private zisc::NonCopyable<DeviceInfo>
   //! Return invalid name string
   static std::string_view invalidName() noexcept;
 
+  //! Check if buffers can be passed to kernels as device addresses
+  virtual bool isBufferDeviceAddressSupported() const noexcept = 0;
+
+  //! Check if kernels can use double precision floating point
+  virtual bool isFloat64Supported() const noexcept = 0;
+
   //! Return the possible maximum size of an allocation in bytes
   virtual std::size_t maxAllocationSize() const noexcept = 0;
 
@@ -78,6 +90,18 @@ class DeviceInfo : private zisc::NonCopyable<DeviceInfo>
   //! Return the device name
   virtual std::string_view name() const noexcept = 0;
 
+  //! Return the number of hardware threads
+  virtual uint32b numOfLogicalCores() const noexcept;
+
+  //! Return the number of NUMA nodes
+  virtual uint32b numOfNumaNodes() const noexcept;
+
+  //! Return the number of physical cores
+  virtual uint32b numOfPhysicalCores() const noexcept;
+
+  //! Return the number of hardware threads per physical core
+  virtual uint32b numOfThreadsPerCore() const noexcept;
+
   //! Return the sub-platform type
   virtual SubPlatformType type() const noexcept = 0;
 
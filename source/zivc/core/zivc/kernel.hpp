@@ -113,6 +113,12 @@ class Kernel<KernelInitParams<kDim, KSet, FuncArgs...>, Args...> : public Kernel
   [[nodiscard("The result can have a fence when external sync mode is on.")]]
   virtual LaunchResult run(Args... args, const LaunchOptions& launch_options) = 0;
 
+  //! Execute a kernel with the work size which is read from the given buffer on the device
+  [[nodiscard("The result can have a fence when external sync mode is on.")]]
+  virtual LaunchResult runIndirect(Buffer<uint32b>& dims,
+                                   Args... args,
+                                   const LaunchOptions& launch_options) = 0;
+
  protected:
   //! Clear the contents of the kernel
   virtual void destroyData() noexcept = 0;
@@ -27,6 +27,23 @@
 
 namespace zivc {
 
+/*!
+  \details The kernel compiled for the highest level which doesn't exceed
+  the given level is returned. Null is returned if the kernel set has no
+  such variant, then the baseline kernel should be used
+
+  \param [in] level No description.
+  \param [in] kernel_name No description.
+  \return No description
+  */
+template <typename SetType> inline
+auto KernelSet<SetType>::findCpuKernel(const CpuIsaLevel level,
+                                       const std::string_view kernel_name) noexcept
+    -> CpuKernelPtr
+{
+  return SetType::findCpuKernel(level, kernel_name);
+}
+
 /*!
   \details No detailed description
 
@@ -63,6 +80,18 @@ constexpr std::string_view KernelSet<SetType>::name() noexcept
   return n;
 }
 
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+template <typename SetType> inline
+constexpr bool KernelSet<SetType>::usesBufferDeviceAddress() noexcept
+{
+  constexpr bool result = SetType::usesBufferDeviceAddress();
+  return result;
+}
+
 } // namespace zivc
 
 #endif // ZIVC_KERNEL_SET_INL_HPP
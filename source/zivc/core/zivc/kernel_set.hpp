@@ -38,6 +38,14 @@ template <typename SetType>
 class KernelSet
 {
  public:
+  // Type aliases
+  using CpuKernelPtr = void (*)();
+
+
+  //! Find a CPU kernel compiled for the given instruction set level
+  static CpuKernelPtr findCpuKernel(const CpuIsaLevel level,
+                                    const std::string_view kernel_name) noexcept;
+
   //! Return the ID number of the kernel set
   static constexpr uint64b id() noexcept;
 
@@ -46,6 +54,9 @@ class KernelSet
 
   //! Return the kernel set name
   static constexpr std::string_view name() noexcept;
+
+  //! Check if the kernels take buffer arguments as device addresses
+  static constexpr bool usesBufferDeviceAddress() noexcept;
 };
 
 //! Specify a type is derived from KernelSet
@@ -47,12 +47,15 @@ PlatformOptions::PlatformOptions(zisc::pmr::memory_resource* mem_resource)
     noexcept :
         platform_name_{{"Platform"}},
         vulkan_library_name_{{""}},
+        work_group_size_cache_path_{{"zivc_work_group_size.txt"}},
         mem_resource_{mem_resource},
         platform_version_major_{0},
         platform_version_minor_{0},
         platform_version_patch_{0},
         cpu_num_of_threads_{0},
-        cpu_task_batch_size_{32},
+        cpu_task_batch_size_{0},
+        num_of_high_priority_queues_{0},
+        num_of_low_priority_queues_{0},
         vulkan_instance_ptr_{nullptr},
         vulkan_get_proc_addr_ptr_{nullptr}
 {
@@ -69,6 +72,7 @@ inline
 PlatformOptions::PlatformOptions(PlatformOptions&& other) noexcept :
     platform_name_{std::move(other.platform_name_)},
     vulkan_library_name_{std::move(other.vulkan_library_name_)},
+    work_group_size_cache_path_{std::move(other.work_group_size_cache_path_)},
     mem_resource_{std::move(other.mem_resource_)},
     platform_version_major_{other.platform_version_major_},
     platform_version_minor_{other.platform_version_minor_},
@@ -76,6 +80,8 @@ PlatformOptions::PlatformOptions(PlatformOptions&& other) noexcept :
     debug_mode_enabled_{other.debug_mode_enabled_},
     cpu_num_of_threads_{other.cpu_num_of_threads_},
     cpu_task_batch_size_{other.cpu_task_batch_size_},
+    num_of_high_priority_queues_{other.num_of_high_priority_queues_},
+    num_of_low_priority_queues_{other.num_of_low_priority_queues_},
     vulkan_sub_platform_enabled_{other.vulkan_sub_platform_enabled_},
     vulkan_instance_ptr_{other.vulkan_instance_ptr_},
     vulkan_get_proc_addr_ptr_{other.vulkan_get_proc_addr_ptr_}
@@ -93,6 +99,7 @@ PlatformOptions& PlatformOptions::operator=(PlatformOptions&& other) noexcept
 {
   platform_name_ = std::move(other.platform_name_);
   vulkan_library_name_ = std::move(other.vulkan_library_name_);
+  work_group_size_cache_path_ = std::move(other.work_group_size_cache_path_);
   mem_resource_ = std::move(other.mem_resource_);
   platform_version_major_ = other.platform_version_major_;
   platform_version_minor_ = other.platform_version_minor_;
@@ -100,6 +107,8 @@ PlatformOptions& PlatformOptions::operator=(PlatformOptions&& other) noexcept
   debug_mode_enabled_ = other.debug_mode_enabled_;
   cpu_num_of_threads_ = other.cpu_num_of_threads_;
   cpu_task_batch_size_ = other.cpu_task_batch_size_;
+  num_of_high_priority_queues_ = other.num_of_high_priority_queues_;
+  num_of_low_priority_queues_ = other.num_of_low_priority_queues_;
   vulkan_sub_platform_enabled_ = other.vulkan_sub_platform_enabled_;
   vulkan_instance_ptr_ = other.vulkan_instance_ptr_;
   vulkan_get_proc_addr_ptr_ = other.vulkan_get_proc_addr_ptr_;
@@ -191,6 +200,29 @@ const zisc::pmr::memory_resource* PlatformOptions::memoryResource() const noexce
   return mem_resource_;
 }
 
+/*!
+  \details The high priority queues are taken from the head of the compute queues.
+  The CPU device runs high priority launches on its own threads if it isn't 0
+
+  \return No description
+  */
+inline
+uint32b PlatformOptions::numOfHighPriorityQueues() const noexcept
+{
+  return num_of_high_priority_queues_;
+}
+
+/*!
+  \details The low priority queues are taken from the tail of the compute queues
+
+  \return No description
+  */
+inline
+uint32b PlatformOptions::numOfLowPriorityQueues() const noexcept
+{
+  return num_of_low_priority_queues_;
+}
+
 /*!
   \details No detailed description
 
@@ -249,7 +281,8 @@ bool PlatformOptions::debugModeEnabled() const noexcept
 }
 
 /*!
-  \details No detailed description
+  \details If zero is set, the number is decided from the topology of the CPU,
+  which is one thread per physical core
 
   \param [in] num_of_threads No description.
   */
@@ -260,7 +293,7 @@ void PlatformOptions::setCpuNumOfThreads(const uint32b num_of_threads) noexcept
 }
 
 /*!
-  \details No detailed description
+  \details If zero is set, the size is decided from the cache sizes of the CPU
 
   \param [in] task_batch_size No description.
   */
@@ -281,6 +314,28 @@ void PlatformOptions::setMemoryResource(zisc::pmr::memory_resource* mem_resource
   mem_resource_ = mem_resource;
 }
 
+/*!
+  \details No detailed description
+
+  \param [in] num_of_queues No description.
+  */
+inline
+void PlatformOptions::setNumOfHighPriorityQueues(const uint32b num_of_queues) noexcept
+{
+  num_of_high_priority_queues_ = num_of_queues;
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] num_of_queues No description.
+  */
+inline
+void PlatformOptions::setNumOfLowPriorityQueues(const uint32b num_of_queues) noexcept
+{
+  num_of_low_priority_queues_ = num_of_queues;
+}
+
 /*!
   \details No detailed description
 
@@ -381,6 +436,19 @@ std::string_view PlatformOptions::vulkanLibraryName() const noexcept
   return name;
 }
 
+/*!
+  \details The file is a text file. The sizes are saved per kernel and
+  device UUID, so a file can be shared by several devices.
+  An empty path disables saving the tuned sizes
+
+  \param [in] path No description.
+  */
+inline
+void PlatformOptions::setWorkGroupSizeCachePath(std::string_view path) noexcept
+{
+  copyStr(path, work_group_size_cache_path_.data());
+}
+
 /*!
   \details No detailed description
 
@@ -416,6 +484,18 @@ bool PlatformOptions::vulkanWSIExtensionEnabled() const noexcept
   return result;
 }
 
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+std::string_view PlatformOptions::workGroupSizeCachePath() const noexcept
+{
+  const std::string_view path{work_group_size_cache_path_.data()};
+  return path;
+}
+
 /*!
   \details No detailed description
   */
@@ -70,6 +70,12 @@ class PlatformOptions : private zisc::NonCopyable<PlatformOptions>
   //! Return the underlying memory resource
   const zisc::pmr::memory_resource* memoryResource() const noexcept;
 
+  //! Return the number of the compute queues which have high priority
+  uint32b numOfHighPriorityQueues() const noexcept;
+
+  //! Return the number of the compute queues which have low priority
+  uint32b numOfLowPriorityQueues() const noexcept;
+
   //! Return the platform name
   std::string_view platformName() const noexcept;
 
@@ -94,6 +100,12 @@ class PlatformOptions : private zisc::NonCopyable<PlatformOptions>
   //! Set memory resource for Zivc
   void setMemoryResource(zisc::pmr::memory_resource* mem_resource) noexcept;
 
+  //! Set the number of the compute queues which have high priority
+  void setNumOfHighPriorityQueues(const uint32b num_of_queues) noexcept;
+
+  //! Set the number of the compute queues which have low priority
+  void setNumOfLowPriorityQueues(const uint32b num_of_queues) noexcept;
+
   //! Set the platform name
   void setPlatformName(std::string_view name) noexcept;
 
@@ -115,6 +127,9 @@ class PlatformOptions : private zisc::NonCopyable<PlatformOptions>
   //! Set a ptr of a PFN_vkGetInstanceProcAddr which is used instead of internal function
   void setVulkanGetProcAddrPtr(void* get_proc_addr_ptr) noexcept;
 
+  //! Set the path of the file which the tuned work-group sizes are saved into
+  void setWorkGroupSizeCachePath(std::string_view path) noexcept;
+
   //! Return a ptr of a VkInstance object
   void* vulkanInstancePtr() noexcept;
 
@@ -130,6 +145,9 @@ class PlatformOptions : private zisc::NonCopyable<PlatformOptions>
   //! Check whether WSI (Window System Integration) extension is enabled
   bool vulkanWSIExtensionEnabled() const noexcept;
 
+  //! Return the path of the file which the tuned work-group sizes are saved into
+  std::string_view workGroupSizeCachePath() const noexcept;
+
  private:
   //! Initialize options
   void initialize() noexcept;
@@ -137,6 +155,7 @@ class PlatformOptions : private zisc::NonCopyable<PlatformOptions>
 
   IdData::NameType platform_name_;
   IdData::NameType vulkan_library_name_;
+  IdData::NameType work_group_size_cache_path_;
   zisc::pmr::memory_resource* mem_resource_;
   uint32b platform_version_major_;
   uint32b platform_version_minor_;
@@ -144,6 +163,8 @@ class PlatformOptions : private zisc::NonCopyable<PlatformOptions>
   int32b debug_mode_enabled_; //!< Enable debugging in Zivc
   uint32b cpu_num_of_threads_ = 0;
   uint32b cpu_task_batch_size_ = 32;
+  uint32b num_of_high_priority_queues_ = 0;
+  uint32b num_of_low_priority_queues_ = 0;
   int32b vulkan_sub_platform_enabled_;
   int32b vulkan_wsi_extension_enabled_;
   void* vulkan_instance_ptr_ = nullptr;
@@ -0,0 +1,164 @@
+/*!
+  \file primitives-inl.hpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2021 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZIVC_PRIMITIVES_INL_HPP
+#define ZIVC_PRIMITIVES_INL_HPP
+
+#include "primitives.hpp"
+// Standard C++ library
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+// Zivc
+#include "buffer.hpp"
+#include "utility/buffer_launch_options.hpp"
+#include "utility/launch_result.hpp"
+#include "utility/sort_storage.hpp"
+#include "zivc/zivc_config.hpp"
+
+namespace zivc {
+
+/*!
+  \details The segment i is the range [segment_offsets[i], segment_offsets[i + 1])
+  of the keys, where the offsets are relative to the source offset of
+  the launch options and ascending. The segments must cover the range.
+  The values are moved with the keys.
+  The temporary buffers are taken from the storage if it's given
+
+  \tparam Key No description.
+  \tparam Value No description.
+  \param [in,out] keys No description.
+  \param [in,out] values No description.
+  \param [in] segment_offsets No description.
+  \param [in] num_of_segments No description.
+  \param [in] launch_options No description.
+  \param [in,out] storage No description.
+  \return No description
+  */
+template <SortKey Key, SortValue Value> inline
+LaunchResult segmentedSort(Buffer<Key>* keys,
+                           Buffer<Value>* values,
+                           const Buffer<uint32b>& segment_offsets,
+                           const std::size_t num_of_segments,
+                           const BufferLaunchOptions<Key>& launch_options,
+                           SortStorage* storage)
+{
+  using KeyBits = std::conditional_t<sizeof(Key) == 4, uint32b, uint64b>;
+  constexpr SortKeyKind kind = std::is_floating_point_v<Key> ? SortKeyKind::kFloat :
+                               std::is_signed_v<Key>         ? SortKeyKind::kSigned
+                                                             : SortKeyKind::kUnsigned;
+  BufferLaunchOptions<KeyBits> options{launch_options.size(), launch_options.queueIndex()};
+  options.setQueuePriority(launch_options.queuePriority());
+  options.setSourceOffset(launch_options.sourceOffset());
+  options.setDestOffset(launch_options.sourceOffset());
+  options.setLabel(launch_options.label());
+  options.setLabelColor(launch_options.labelColor());
+
+  auto key_buffer = keys->template reinterp<KeyBits>();
+  if (values == nullptr) {
+    return radixSort(std::addressof(key_buffer), nullptr, 0,
+                     std::addressof(segment_offsets), num_of_segments,
+                     kind, options, storage);
+  }
+  auto value_buffer = values->template reinterp<uint32b>();
+  constexpr std::size_t num_of_words = sizeof(Value) / sizeof(uint32b);
+  return radixSort(std::addressof(key_buffer), std::addressof(value_buffer),
+                   num_of_words, std::addressof(segment_offsets), num_of_segments,
+                   kind, options, storage);
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Key No description.
+  \param [in,out] keys No description.
+  \param [in] segment_offsets No description.
+  \param [in] num_of_segments No description.
+  \param [in] launch_options No description.
+  \param [in,out] storage No description.
+  \return No description
+  */
+template <SortKey Key> inline
+LaunchResult segmentedSort(Buffer<Key>* keys,
+                           const Buffer<uint32b>& segment_offsets,
+                           const std::size_t num_of_segments,
+                           const BufferLaunchOptions<Key>& launch_options,
+                           SortStorage* storage)
+{
+  Buffer<uint32b>* values = nullptr;
+  return segmentedSort(keys, values, segment_offsets, num_of_segments,
+                       launch_options, storage);
+}
+
+/*!
+  \details The sort is stable. The values are moved with the keys.
+  The temporary buffers are taken from the storage if it's given
+
+  \tparam Key No description.
+  \tparam Value No description.
+  \param [in,out] keys No description.
+  \param [in,out] values No description.
+  \param [in] launch_options No description.
+  \param [in,out] storage No description.
+  \return No description
+  */
+template <SortKey Key, SortValue Value> inline
+LaunchResult sort(Buffer<Key>* keys,
+                  Buffer<Value>* values,
+                  const BufferLaunchOptions<Key>& launch_options,
+                  SortStorage* storage)
+{
+  using KeyBits = std::conditional_t<sizeof(Key) == 4, uint32b, uint64b>;
+  constexpr SortKeyKind kind = std::is_floating_point_v<Key> ? SortKeyKind::kFloat :
+                               std::is_signed_v<Key>         ? SortKeyKind::kSigned
+                                                             : SortKeyKind::kUnsigned;
+  BufferLaunchOptions<KeyBits> options{launch_options.size(), launch_options.queueIndex()};
+  options.setQueuePriority(launch_options.queuePriority());
+  options.setSourceOffset(launch_options.sourceOffset());
+  options.setDestOffset(launch_options.sourceOffset());
+  options.setLabel(launch_options.label());
+  options.setLabelColor(launch_options.labelColor());
+
+  auto key_buffer = keys->template reinterp<KeyBits>();
+  if (values == nullptr) {
+    return radixSort(std::addressof(key_buffer), nullptr, 0, nullptr, 0,
+                     kind, options, storage);
+  }
+  auto value_buffer = values->template reinterp<uint32b>();
+  constexpr std::size_t num_of_words = sizeof(Value) / sizeof(uint32b);
+  return radixSort(std::addressof(key_buffer), std::addressof(value_buffer),
+                   num_of_words, nullptr, 0, kind, options, storage);
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Key No description.
+  \param [in,out] keys No description.
+  \param [in] launch_options No description.
+  \param [in,out] storage No description.
+  \return No description
+  */
+template <SortKey Key> inline
+LaunchResult sort(Buffer<Key>* keys,
+                  const BufferLaunchOptions<Key>& launch_options,
+                  SortStorage* storage)
+{
+  Buffer<uint32b>* values = nullptr;
+  return sort(keys, values, launch_options, storage);
+}
+
+} // namespace zivc
+
+#endif // ZIVC_PRIMITIVES_INL_HPP
@@ -0,0 +1,1587 @@
+/*!
+  \file primitives.cpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2021 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#include "primitives.hpp"
+// Standard C++ library
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+// Zisc
+#include "zisc/bit.hpp"
+#include "zisc/error.hpp"
+#include "zisc/utility.hpp"
+// Zivc
+#include "buffer.hpp"
+#include "device.hpp"
+#include "device_info.hpp"
+#include "kernel_common.hpp"
+#include "zivc.hpp"
+#include "cpu/cpu_device.hpp"
+#include "cpu/cpu_device_info.hpp"
+#include "utility/buffer_launch_options.hpp"
+#include "utility/error.hpp"
+#include "utility/gemm_launch_options.hpp"
+#include "utility/gemm_storage.hpp"
+#include "utility/launch_result.hpp"
+#include "utility/primitive_storage.hpp"
+#include "utility/sort_storage.hpp"
+#include "zivc/zivc_config.hpp"
+#include "zivc/kernel_set/kernel_set-zivc_internal_kernel.hpp"
+
+namespace {
+
+using PrimitiveInfoT = zivc::cl::zivc_internal_kernel::zivc::PrimitiveInfo;
+
+static_assert(zisc::cast<zivc::uint32b>(zivc::PrimitiveOp::kAdd) == PrimitiveInfoT::kAdd);
+static_assert(zisc::cast<zivc::uint32b>(zivc::PrimitiveOp::kMin) == PrimitiveInfoT::kMin);
+static_assert(zisc::cast<zivc::uint32b>(zivc::PrimitiveOp::kMax) == PrimitiveInfoT::kMax);
+
+/*!
+  \details A work-group of the Vulkan device processes a tile which has
+  a few rows of elements, a row has an element per work-item.
+  The tiles of the CPU device are large enough to amortize the look-back,
+  but there are several batches of tiles per thread so that the threads
+  are balanced
+
+  \param [in] device No description.
+  \param [in] size No description.
+  \return No description
+  */
+std::size_t calcTileSize(const zivc::Device& device, const std::size_t size) noexcept
+{
+  constexpr std::size_t num_of_rows = 8;
+  std::size_t tile_size = num_of_rows * device.deviceInfo().workGroupSize();
+  if (device.type() == zivc::SubPlatformType::kCpu) {
+    const auto* cpu_device = zisc::cast<const zivc::CpuDevice*>(std::addressof(device));
+    const std::size_t num_of_tiles = 4 * cpu_device->numOfThreads() *
+                                     cpu_device->taskBatchSize();
+    constexpr std::size_t min_tile_size = 1024;
+    tile_size = (size + num_of_tiles - 1) / num_of_tiles;
+    tile_size = (std::max)(tile_size, min_tile_size);
+  }
+  return tile_size;
+}
+
+/*!
+  \details Return the number of work-items which process the tiles.
+  A work-group processes a tile. The work-groups iterate over the tiles
+  if the tiles exceed the limit of the work-group count
+
+  \param [in] device No description.
+  \param [in] num_of_tiles No description.
+  \return No description
+  */
+std::size_t calcWorkSize(const zivc::Device& device, const std::size_t num_of_tiles) noexcept
+{
+  const zivc::DeviceInfo& device_info = device.deviceInfo();
+  const std::size_t group_size = device_info.workGroupSize();
+  const std::size_t num_of_groups = (std::min)(num_of_tiles,
+      zisc::cast<std::size_t>(device_info.maxWorkGroupCount()[0]));
+  return num_of_groups * group_size;
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Type No description.
+  \param [in] op No description.
+  \return No description
+  */
+template <typename Type>
+Type identity(const zivc::PrimitiveOp op) noexcept
+{
+  using Limits = std::numeric_limits<Type>;
+  Type result = zisc::cast<Type>(0);
+  if constexpr (Limits::has_infinity) {
+    if (op == zivc::PrimitiveOp::kMin)
+      result = Limits::infinity();
+    else if (op == zivc::PrimitiveOp::kMax)
+      result = -Limits::infinity();
+  }
+  else {
+    if (op == zivc::PrimitiveOp::kMin)
+      result = (Limits::max)();
+    else if (op == zivc::PrimitiveOp::kMax)
+      result = Limits::lowest();
+  }
+  return result;
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Type No description.
+  \param [in] device No description.
+  \return No description
+  */
+template <typename Type>
+[[nodiscard]]
+auto makeCompactKernel(zivc::Device* device)
+{
+  if constexpr (std::is_same_v<zivc::int32b, Type>) {
+    auto p = ZIVC_MAKE_KERNEL_INIT_PARAMS(zivc_internal_kernel, Zivc_compactI32Kernel, 1);
+    return zivc::makeKernel(device, p);
+  }
+  else if constexpr (std::is_same_v<zivc::uint32b, Type>) {
+    auto p = ZIVC_MAKE_KERNEL_INIT_PARAMS(zivc_internal_kernel, Zivc_compactU32Kernel, 1);
+    return zivc::makeKernel(device, p);
+  }
+  else {
+    auto p = ZIVC_MAKE_KERNEL_INIT_PARAMS(zivc_internal_kernel, Zivc_compactF32Kernel, 1);
+    return zivc::makeKernel(device, p);
+  }
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Type No description.
+  \param [in] device No description.
+  \return No description
+  */
+template <typename Type>
+[[nodiscard]]
+auto makeHistogramKernel(zivc::Device* device)
+{
+  if constexpr (std::is_same_v<zivc::int32b, Type>) {
+    auto p = ZIVC_MAKE_KERNEL_INIT_PARAMS(zivc_internal_kernel, Zivc_histogramI32Kernel, 1);
+    return zivc::makeKernel(device, p);
+  }
+  else if constexpr (std::is_same_v<zivc::uint32b, Type>) {
+    auto p = ZIVC_MAKE_KERNEL_INIT_PARAMS(zivc_internal_kernel, Zivc_histogramU32Kernel, 1);
+    return zivc::makeKernel(device, p);
+  }
+  else {
+    auto p = ZIVC_MAKE_KERNEL_INIT_PARAMS(zivc_internal_kernel, Zivc_histogramF32Kernel, 1);
+    return zivc::makeKernel(device, p);
+  }
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Type No description.
+  \param [in] device No description.
+  \return No description
+  */
+template <typename Type>
+[[nodiscard]]
+auto makeReduceKernel(zivc::Device* device)
+{
+  if constexpr (std::is_same_v<zivc::int32b, Type>) {
+    auto p = ZIVC_MAKE_KERNEL_INIT_PARAMS(zivc_internal_kernel, Zivc_reduceI32Kernel, 1);
+    return zivc::makeKernel(device, p);
+  }
+  else if constexpr (std::is_same_v<zivc::uint32b, Type>) {
+    auto p = ZIVC_MAKE_KERNEL_INIT_PARAMS(zivc_internal_kernel, Zivc_reduceU32Kernel, 1);
+    return zivc::makeKernel(device, p);
+  }
+  else {
+    auto p = ZIVC_MAKE_KERNEL_INIT_PARAMS(zivc_internal_kernel, Zivc_reduceF32Kernel, 1);
+    return zivc::makeKernel(device, p);
+  }
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Type No description.
+  \param [in] device No description.
+  \return No description
+  */
+template <typename Type>
+[[nodiscard]]
+auto makeScanKernel(zivc::Device* device)
+{
+  if constexpr (std::is_same_v<zivc::int32b, Type>) {
+    auto p = ZIVC_MAKE_KERNEL_INIT_PARAMS(zivc_internal_kernel, Zivc_scanI32Kernel, 1);
+    return zivc::makeKernel(device, p);
+  }
+  else if constexpr (std::is_same_v<zivc::uint32b, Type>) {
+    auto p = ZIVC_MAKE_KERNEL_INIT_PARAMS(zivc_internal_kernel, Zivc_scanU32Kernel, 1);
+    return zivc::makeKernel(device, p);
+  }
+  else {
+    auto p = ZIVC_MAKE_KERNEL_INIT_PARAMS(zivc_internal_kernel, Zivc_scanF32Kernel, 1);
+    return zivc::makeKernel(device, p);
+  }
+}
+
+/*!
+  \details Clear the status buffer of the look-back with zero.
+  The clear isn't waited for on the Vulkan device. It's submitted to
+  the queue of the launch options, and the kernel submitted to
+  the same queue after it sees the cleared status
+
+  \param [in,out] status No description.
+  \param [in] num_of_tiles No description.
+  \param [in] launch_options No description.
+  */
+void clearStatus(zivc::Buffer<zivc::uint32b>* status,
+                 const std::size_t num_of_tiles,
+                 const zivc::LaunchOptions& launch_options)
+{
+  auto* device = zisc::cast<zivc::Device*>(status->getParent());
+  const bool is_cpu = device->type() == zivc::SubPlatformType::kCpu;
+  auto options = status->makeOptions();
+  options.setSize(PrimitiveInfoT::statusSize(num_of_tiles));
+  options.setQueueIndex(launch_options.queueIndex());
+  options.setQueuePriority(launch_options.queuePriority());
+  options.setQueueSelection(zivc::QueueSelection::kFixed);
+  options.setExternalSyncMode(is_cpu);
+  options.setLabel(launch_options.label());
+  options.setLabelColor(launch_options.labelColor());
+  const zivc::LaunchResult result = status->fill(0u, options);
+  if (is_cpu && result.isAsync())
+    device->waitForCompletion(result.fence());
+}
+
+/*!
+  \details The launch is waited for and an empty result is returned
+  unless it's asynchronous
+
+  \param [in] device No description.
+  \param [in] result No description.
+  \param [in] is_async No description.
+  \return No description
+  */
+zivc::LaunchResult finishLaunch(const zivc::Device& device,
+                                zivc::LaunchResult result,
+                                const bool is_async)
+{
+  if (!is_async) {
+    if (result.isAsync())
+      device.waitForCompletion(result.fence());
+    result = zivc::LaunchResult{};
+  }
+  return result;
+}
+
+/*!
+  \details Return the kernel type of the element type.
+  The kernel types of a primitive are in the order I32, U32 and F32
+
+  \tparam Type No description.
+  \param [in] base The kernel type of I32.
+  \return No description
+  */
+template <typename Type>
+zivc::PrimitiveStorage::KernelType toKernelType(
+    const zivc::PrimitiveStorage::KernelType base) noexcept
+{
+  using zivc::uint32b;
+  const uint32b offset = std::is_same_v<zivc::int32b, Type>  ? 0 :
+                         std::is_same_v<zivc::uint32b, Type> ? 1
+                                                             : 2;
+  const uint32b type = zisc::cast<uint32b>(base) + offset;
+  return zisc::cast<zivc::PrimitiveStorage::KernelType>(type);
+}
+
+/*!
+  \details Return the kernel cached in the storage.
+  The kernel is made if the storage doesn't have it yet
+
+  \tparam Storage No description.
+  \tparam Maker No description.
+  \param [in,out] storage No description.
+  \param [in] type No description.
+  \param [in] maker No description.
+  \return No description
+  */
+template <typename Storage, typename Maker>
+auto* getCachedKernel(Storage* storage,
+                      const typename Storage::KernelType type,
+                      Maker maker)
+{
+  using KernelT = typename decltype(maker())::element_type;
+  std::shared_ptr<zivc::KernelCommon>& kernel = storage->kernel(type);
+  if (!kernel)
+    kernel = maker();
+  return zisc::cast<KernelT*>(kernel.get());
+}
+
+/*!
+  \details No detailed description
+
+  \tparam KernelP No description.
+  \param [in] kernel No description.
+  \param [in] num_of_tiles No description.
+  \param [in] launch_options No description.
+  \return No description
+  */
+template <typename KernelP>
+auto makeKernelOptions(KernelP& kernel,
+                       const std::size_t num_of_tiles,
+                       const zivc::LaunchOptions& launch_options)
+{
+  auto options = kernel->makeOptions();
+  options.setWorkSize({zisc::cast<zivc::uint32b>(num_of_tiles)});
+  options.setQueueIndex(launch_options.queueIndex());
+  options.setQueuePriority(launch_options.queuePriority());
+  options.setExternalSyncMode(true);
+  options.setLabel(launch_options.label());
+  options.setLabelColor(launch_options.labelColor());
+  return options;
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Type No description.
+  \param [in] source No description.
+  \param [out] dest No description.
+  \param [in] op No description.
+  \param [in] is_exclusive No description.
+  \param [in] launch_options No description.
+  \param [in,out] storage No description.
+  \return No description
+  */
+template <typename Type>
+zivc::LaunchResult scan(const zivc::Buffer<Type>& source,
+                        zivc::Buffer<Type>* dest,
+                        const zivc::PrimitiveOp op,
+                        const bool is_exclusive,
+                        const zivc::BufferLaunchOptions<Type>& launch_options,
+                        zivc::PrimitiveStorage* storage)
+{
+  using KernelType = zivc::PrimitiveStorage::KernelType;
+
+  const std::size_t size = launch_options.size();
+  if (size == 0)
+    return zivc::LaunchResult{};
+
+  auto* device = zisc::cast<zivc::Device*>(dest->getParent());
+  const bool is_async = (storage != nullptr) && (device->type() != zivc::SubPlatformType::kCpu);
+  zivc::PrimitiveStorage local_storage;
+  if (storage == nullptr)
+    storage = std::addressof(local_storage);
+  storage->setDevice(device);
+
+  PrimitiveInfoT info{};
+  info.setSourceOffset(launch_options.sourceOffset());
+  info.setDestOffset(launch_options.destOffset());
+  info.setSize(size);
+  info.setTileSize(::calcTileSize(*device, size));
+  info.setOperation(zisc::cast<zivc::uint32b>(op), is_exclusive);
+  const std::size_t num_of_tiles = info.numOfTiles();
+
+  auto* status = storage->statusBuffer(PrimitiveInfoT::statusSize(num_of_tiles));
+  ::clearStatus(status, num_of_tiles, launch_options);
+  auto* kernel = ::getCachedKernel(
+      storage,
+      ::toKernelType<Type>(KernelType::kScanI32),
+      [device]() {return ::makeScanKernel<Type>(device);});
+  const std::size_t work_size = ::calcWorkSize(*device, num_of_tiles);
+  auto options = ::makeKernelOptions(kernel, work_size, launch_options);
+  if (is_async)
+    options.setExternalSyncMode(launch_options.isExternalSyncMode());
+  return ::finishLaunch(*device,
+                        kernel->run(source, *dest, *status, info, options),
+                        is_async);
+}
+
+/*!
+  \details The uint16b elements are the bits of bfloat16
+
+  \tparam Source No description.
+  \tparam Dest No description.
+  \param [in] device No description.
+  \return No description
+  */
+template <typename Source, typename Dest>
+[[nodiscard]]
+auto makeConvertKernel(zivc::Device* device)
+{
+  if constexpr (std::is_same_v<zivc::half, Dest>) {
+    auto p = ZIVC_MAKE_KERNEL_INIT_PARAMS(zivc_internal_kernel, Zivc_convertF32ToF16Kernel, 1);
+    return zivc::makeKernel(device, p);
+  }
+  else if constexpr (std::is_same_v<zivc::half, Source>) {
+    auto p = ZIVC_MAKE_KERNEL_INIT_PARAMS(zivc_internal_kernel, Zivc_convertF16ToF32Kernel, 1);
+    return zivc::makeKernel(device, p);
+  }
+  else if constexpr (std::is_same_v<zivc::uint16b, Dest>) {
+    auto p = ZIVC_MAKE_KERNEL_INIT_PARAMS(zivc_internal_kernel, Zivc_convertF32ToBf16Kernel, 1);
+    return zivc::makeKernel(device, p);
+  }
+  else {
+    auto p = ZIVC_MAKE_KERNEL_INIT_PARAMS(zivc_internal_kernel, Zivc_convertBf16ToF32Kernel, 1);
+    return zivc::makeKernel(device, p);
+  }
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Source No description.
+  \tparam Dest No description.
+  \return No description
+  */
+template <typename Source, typename Dest>
+constexpr zivc::PrimitiveStorage::KernelType getConvertKernelType() noexcept
+{
+  using KernelType = zivc::PrimitiveStorage::KernelType;
+  if constexpr (std::is_same_v<zivc::half, Dest>)
+    return KernelType::kConvertF32ToF16;
+  else if constexpr (std::is_same_v<zivc::half, Source>)
+    return KernelType::kConvertF16ToF32;
+  else if constexpr (std::is_same_v<zivc::uint16b, Dest>)
+    return KernelType::kConvertF32ToBf16;
+  else
+    return KernelType::kConvertBf16ToF32;
+}
+
+/*!
+  \details A work-item converts vectors of four elements with a grid-stride loop.
+  The work size covers the remaining elements of the last vector too
+
+  \tparam Source No description.
+  \tparam Dest No description.
+  \param [in] source No description.
+  \param [out] dest No description.
+  \param [in] launch_options No description.
+  \param [in,out] storage No description.
+  \return No description
+  */
+template <typename Source, typename Dest>
+zivc::LaunchResult convert(const zivc::Buffer<Source>& source,
+                           zivc::Buffer<Dest>* dest,
+                           const zivc::BufferLaunchOptions<Source>& launch_options,
+                           zivc::PrimitiveStorage* storage)
+{
+  const std::size_t size = launch_options.size();
+  if (size == 0)
+    return zivc::LaunchResult{};
+
+  auto* device = zisc::cast<zivc::Device*>(dest->getParent());
+  const bool is_async = (storage != nullptr) && (device->type() != zivc::SubPlatformType::kCpu);
+  zivc::PrimitiveStorage local_storage;
+  if (storage == nullptr)
+    storage = std::addressof(local_storage);
+  storage->setDevice(device);
+
+  PrimitiveInfoT info{};
+  info.setSourceOffset(launch_options.sourceOffset());
+  info.setDestOffset(launch_options.destOffset());
+  info.setSize(size);
+
+  constexpr std::size_t vector_size = 4;
+  const zivc::DeviceInfo& device_info = device->deviceInfo();
+  const std::size_t max_work_size = device_info.workGroupSize() *
+      zisc::cast<std::size_t>(device_info.maxWorkGroupCount()[0]);
+  const std::size_t work_size = (std::min)(
+      (std::max)(size / vector_size, size % vector_size),
+      max_work_size);
+
+  auto* kernel = ::getCachedKernel(
+      storage,
+      ::getConvertKernelType<Source, Dest>(),
+      [device]() {return ::makeConvertKernel<Source, Dest>(device);});
+  auto options = ::makeKernelOptions(kernel, work_size, launch_options);
+  if (is_async)
+    options.setExternalSyncMode(launch_options.isExternalSyncMode());
+  return ::finishLaunch(*device, kernel->run(source, *dest, info, options), is_async);
+}
+
+using GemmInfoT = zivc::cl::zivc_internal_kernel::zivc::GemmInfo;
+
+/*!
+  \details No detailed description
+
+  \tparam Type No description.
+  \tparam kTile No description.
+  \param [in] device No description.
+  \return No description
+  */
+template <typename Type, std::size_t kTile>
+[[nodiscard]]
+auto makeGemmTileKernel(zivc::Device* device)
+{
+  if constexpr (std::is_same_v<float, Type> && (kTile == 16)) {
+    auto p = ZIVC_MAKE_KERNEL_INIT_PARAMS(zivc_internal_kernel, Zivc_gemmTile16F32Kernel, 1);
+    return zivc::makeKernel(device, p);
+  }
+  else if constexpr (std::is_same_v<float, Type>) {
+    auto p = ZIVC_MAKE_KERNEL_INIT_PARAMS(zivc_internal_kernel, Zivc_gemmTile32F32Kernel, 1);
+    return zivc::makeKernel(device, p);
+  }
+  else if constexpr (kTile == 16) {
+    auto p = ZIVC_MAKE_KERNEL_INIT_PARAMS(zivc_internal_kernel, Zivc_gemmTile16F16Kernel, 1);
+    return zivc::makeKernel(device, p);
+  }
+  else {
+    auto p = ZIVC_MAKE_KERNEL_INIT_PARAMS(zivc_internal_kernel, Zivc_gemmTile32F16Kernel, 1);
+    return zivc::makeKernel(device, p);
+  }
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Type No description.
+  \param [in] device No description.
+  \return No description
+  */
+template <typename Type>
+[[nodiscard]]
+auto makeGemmBlockKernel(zivc::Device* device)
+{
+  if constexpr (std::is_same_v<float, Type>) {
+    auto p = ZIVC_MAKE_KERNEL_INIT_PARAMS(zivc_internal_kernel, Zivc_gemmBlockF32Kernel, 1);
+    return zivc::makeKernel(device, p);
+  }
+  else {
+    auto p = ZIVC_MAKE_KERNEL_INIT_PARAMS(zivc_internal_kernel, Zivc_gemmBlockF16Kernel, 1);
+    return zivc::makeKernel(device, p);
+  }
+}
+
+/*!
+  \details Return the size of the square tile of C computed by a work-group.
+  A larger tile reads A and B fewer times, but a work-item has to hold
+  more accumulators unless the work-group is large enough.
+  The work-items of a row of the tile compute regBlockCols() columns each,
+  and the rows of the tile are divided evenly among the rows of work-items.
+  Zero is returned if the device computes blocks per work-item instead
+
+  \param [in] device No description.
+  \return No description
+  */
+std::size_t calcGemmTileSize(const zivc::Device& device) noexcept
+{
+  if (device.type() == zivc::SubPlatformType::kCpu)
+    return 0;
+  const std::size_t group_size = device.deviceInfo().workGroupSize();
+  const auto fits = [group_size](const std::size_t tile) noexcept
+  {
+    const std::size_t n = tile * tile;
+    const std::size_t item_cols = tile / GemmInfoT::regBlockCols();
+    return (item_cols <= group_size) && ((group_size % item_cols) == 0) &&
+           ((tile % (group_size / item_cols)) == 0) &&
+           ((n / group_size) <= GemmInfoT::maxElemsPerItem());
+  };
+  std::size_t tile_size = 0;
+  if (fits(32))
+    tile_size = 32;
+  else if (fits(16))
+    tile_size = 16;
+  return tile_size;
+}
+
+/*!
+  \details The columns of a block are chosen so that the panel of B
+  which a block reads fits in the half of the L2 cache.
+  The rows are reduced until there are enough blocks for the threads
+
+  \tparam Type No description.
+  \param [in] device No description.
+  \param [in,out] info No description.
+  */
+template <typename Type>
+void setGemmBlockSize(const zivc::Device& device, GemmInfoT* info) noexcept
+{
+  std::size_t cache_size = 256 * 1024;
+  std::size_t num_of_threads = 1;
+  if (device.type() == zivc::SubPlatformType::kCpu) {
+    const auto* cpu_device = zisc::cast<const zivc::CpuDevice*>(std::addressof(device));
+    const std::size_t l2_size = cpu_device->deviceInfoImpl().cacheSize(2);
+    cache_size = (l2_size != 0) ? l2_size : cache_size;
+    num_of_threads = cpu_device->numOfThreads();
+  }
+
+  const std::size_t k = (std::max)(info->k(), std::size_t{1});
+  std::size_t cols = GemmInfoT::maxBlockCols();
+  while ((8 < cols) && ((cache_size / 2) < (k * cols * sizeof(Type))))
+    cols >>= 1;
+  cols = (std::min)(cols, info->n());
+
+  const std::size_t num_of_col_tiles = (info->n() + cols - 1) / cols;
+  const std::size_t num_of_tiles = 4 * num_of_threads;
+  const auto count_tiles = [info, num_of_col_tiles](const std::size_t rows) noexcept
+  {
+    return ((info->m() + rows - 1) / rows) * num_of_col_tiles * info->batchSize();
+  };
+  std::size_t rows = 64;
+  while ((1 < rows) && (count_tiles(rows) < num_of_tiles))
+    rows >>= 1;
+  info->setTileSize(rows, cols);
+}
+
+/*!
+  \details The launch takes the external sync mode of the given options
+  if it's asynchronous. Otherwise the launch is waited for and
+  an empty result is returned
+
+  \tparam Type No description.
+  \tparam KernelP No description.
+  \param [in] kernel No description.
+  \param [in] a No description.
+  \param [in] b No description.
+  \param [in,out] c No description.
+  \param [in] info No description.
+  \param [in] work_size No description.
+  \param [in] launch_options No description.
+  \param [in] is_async No description.
+  \return No description
+  */
+template <typename Type, typename KernelP>
+zivc::LaunchResult runGemmKernel(KernelP* kernel,
+                                 const zivc::Buffer<Type>& a,
+                                 const zivc::Buffer<Type>& b,
+                                 zivc::Buffer<Type>* c,
+                                 const GemmInfoT& info,
+                                 const std::size_t work_size,
+                                 const zivc::LaunchOptions& launch_options,
+                                 const bool is_async)
+{
+  auto options = ::makeKernelOptions(kernel, work_size, launch_options);
+  if (is_async)
+    options.setExternalSyncMode(launch_options.isExternalSyncMode());
+  const auto* device = zisc::cast<const zivc::Device*>(c->getParent());
+  return ::finishLaunch(*device, kernel->run(a, b, *c, info, options), is_async);
+}
+
+using RandomInfoT = zivc::cl::zivc_internal_kernel::zivc::RandomInfo;
+
+/*!
+  \details No detailed description
+
+  \tparam Type No description.
+  \tparam kIsNormal No description.
+  \param [in] device No description.
+  \return No description
+  */
+template <typename Type, bool kIsNormal>
+[[nodiscard]]
+auto makeRandomKernel(zivc::Device* device)
+{
+  if constexpr (std::is_same_v<zivc::uint32b, Type>) {
+    auto p = ZIVC_MAKE_KERNEL_INIT_PARAMS(zivc_internal_kernel, Zivc_randomU32Kernel, 1);
+    return zivc::makeKernel(device, p);
+  }
+  else if constexpr (kIsNormal) {
+    auto p = ZIVC_MAKE_KERNEL_INIT_PARAMS(zivc_internal_kernel, Zivc_randomNormalF32Kernel, 1);
+    return zivc::makeKernel(device, p);
+  }
+  else {
+    auto p = ZIVC_MAKE_KERNEL_INIT_PARAMS(zivc_internal_kernel, Zivc_randomUniformF32Kernel, 1);
+    return zivc::makeKernel(device, p);
+  }
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Type No description.
+  \tparam kIsNormal No description.
+  \return No description
+  */
+template <typename Type, bool kIsNormal>
+constexpr zivc::PrimitiveStorage::KernelType getRandomKernelType() noexcept
+{
+  using KernelType = zivc::PrimitiveStorage::KernelType;
+  if constexpr (std::is_same_v<zivc::uint32b, Type>)
+    return KernelType::kRandomU32;
+  else if constexpr (kIsNormal)
+    return KernelType::kRandomNormalF32;
+  else
+    return KernelType::kRandomUniformF32;
+}
+
+/*!
+  \details A work-item generates blocks of four numbers with a grid-stride loop
+
+  \tparam Type No description.
+  \tparam kIsNormal No description.
+  \param [out] dest No description.
+  \param [in] seed No description.
+  \param [in] offset No description.
+  \param [in] launch_options No description.
+  \param [in,out] storage No description.
+  \return No description
+  */
+template <typename Type, bool kIsNormal>
+zivc::LaunchResult generateRandom(zivc::Buffer<Type>* dest,
+                                  const zivc::uint64b seed,
+                                  const zivc::uint64b offset,
+                                  const zivc::BufferLaunchOptions<Type>& launch_options,
+                                  zivc::PrimitiveStorage* storage)
+{
+  const std::size_t size = launch_options.size();
+  if (size == 0)
+    return zivc::LaunchResult{};
+
+  auto* device = zisc::cast<zivc::Device*>(dest->getParent());
+  const bool is_async = (storage != nullptr) && (device->type() != zivc::SubPlatformType::kCpu);
+  zivc::PrimitiveStorage local_storage;
+  if (storage == nullptr)
+    storage = std::addressof(local_storage);
+  storage->setDevice(device);
+
+  RandomInfoT info{};
+  info.setSeed(zisc::cast<zivc::uint32b>(seed), zisc::cast<zivc::uint32b>(seed >> 32));
+  info.setOffset(zisc::cast<zivc::uint32b>(offset), zisc::cast<zivc::uint32b>(offset >> 32));
+  info.setDestOffset(launch_options.destOffset());
+  info.setSize(size);
+
+  const zivc::DeviceInfo& device_info = device->deviceInfo();
+  const std::size_t max_work_size = device_info.workGroupSize() *
+      zisc::cast<std::size_t>(device_info.maxWorkGroupCount()[0]);
+  const std::size_t work_size = (std::min)(info.numOfBlocks(), max_work_size);
+
+  auto* kernel = ::getCachedKernel(
+      storage,
+      ::getRandomKernelType<Type, kIsNormal>(),
+      [device]() {return ::makeRandomKernel<Type, kIsNormal>(device);});
+  auto options = ::makeKernelOptions(kernel, work_size, launch_options);
+  if (is_async)
+    options.setExternalSyncMode(launch_options.isExternalSyncMode());
+  return ::finishLaunch(*device, kernel->run(*dest, info, options), is_async);
+}
+
+using SortInfoT = zivc::cl::zivc_internal_kernel::zivc::SortInfo;
+
+static_assert(zisc::cast<zivc::uint32b>(zivc::SortKeyKind::kUnsigned) == SortInfoT::kUnsigned);
+static_assert(zisc::cast<zivc::uint32b>(zivc::SortKeyKind::kSigned) == SortInfoT::kSigned);
+static_assert(zisc::cast<zivc::uint32b>(zivc::SortKeyKind::kFloat) == SortInfoT::kFloat);
+
+/*!
+  \details No detailed description
+
+  \tparam KeyBits No description.
+  \param [in] device No description.
+  \return No description
+  */
+template <typename KeyBits>
+[[nodiscard]]
+auto makeRadixSortHistogramKernel(zivc::Device* device)
+{
+  if constexpr (sizeof(KeyBits) == 4) {
+    auto p = ZIVC_MAKE_KERNEL_INIT_PARAMS(zivc_internal_kernel, Zivc_radixSortHistogram32Kernel, 1);
+    return zivc::makeKernel(device, p);
+  }
+  else {
+    auto p = ZIVC_MAKE_KERNEL_INIT_PARAMS(zivc_internal_kernel, Zivc_radixSortHistogram64Kernel, 1);
+    return zivc::makeKernel(device, p);
+  }
+}
+
+/*!
+  \details No detailed description
+
+  \tparam KeyBits No description.
+  \param [in] device No description.
+  \return No description
+  */
+template <typename KeyBits>
+[[nodiscard]]
+auto makeRadixSortScatterKernel(zivc::Device* device)
+{
+  if constexpr (sizeof(KeyBits) == 4) {
+    auto p = ZIVC_MAKE_KERNEL_INIT_PARAMS(zivc_internal_kernel, Zivc_radixSortScatter32Kernel, 1);
+    return zivc::makeKernel(device, p);
+  }
+  else {
+    auto p = ZIVC_MAKE_KERNEL_INIT_PARAMS(zivc_internal_kernel, Zivc_radixSortScatter64Kernel, 1);
+    return zivc::makeKernel(device, p);
+  }
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] device No description.
+  \return No description
+  */
+[[nodiscard]]
+auto makeRadixSortSegmentKernel(zivc::Device* device)
+{
+  auto p = ZIVC_MAKE_KERNEL_INIT_PARAMS(zivc_internal_kernel, Zivc_radixSortSegmentKernel, 1);
+  return zivc::makeKernel(device, p);
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] value No description.
+  \return No description
+  */
+constexpr std::size_t calcNumOfDigits(std::size_t value) noexcept
+{
+  std::size_t n = 0;
+  for (; 0 < value; value >>= SortInfoT::radixBits())
+    ++n;
+  return n;
+}
+
+/*!
+  \details A tile of the sort has more rows than the tiles of the other
+  primitives, so that the histogram, which has the counts of all digits
+  of each tile, is smaller than the elements
+
+  \param [in] device No description.
+  \param [in] size No description.
+  \return No description
+  */
+std::size_t calcSortTileSize(const zivc::Device& device, const std::size_t size) noexcept
+{
+  constexpr std::size_t num_of_rows = 32;
+  std::size_t tile_size = num_of_rows * device.deviceInfo().workGroupSize();
+  if (device.type() == zivc::SubPlatformType::kCpu)
+    tile_size = ::calcTileSize(device, size);
+  return tile_size;
+}
+
+/*!
+  \details Sort the keys with the LSD radix sort.
+  Each pass counts the digits of the tiles, scans the counts and
+  scatters the elements into the other buffer of a ping-pong pair.
+  The segment indices are sorted after the keys so that
+  the elements are grouped by the segments.
+  The passes are submitted to one queue and the host waits once at the end.
+  The kernels get the pass from the counters on the device,
+  so they are launched with the same arguments in all passes and
+  the launches don't wait for the preceding ones on the host.
+  The CPU kernels keep their arguments in the kernel objects,
+  so each launch on the CPU is completed before the next one
+
+  \tparam KeyBits No description.
+  \param [in,out] keys No description.
+  \param [in,out] values No description.
+  \param [in] num_of_value_words No description.
+  \param [in] segment_offsets No description.
+  \param [in] num_of_segments No description.
+  \param [in] kind No description.
+  \param [in] launch_options No description.
+  \param [in,out] storage No description.
+  */
+template <typename KeyBits>
+void radixSortImpl(zivc::Buffer<KeyBits>* keys,
+                   zivc::Buffer<zivc::uint32b>* values,
+                   const std::size_t num_of_value_words,
+                   const zivc::Buffer<zivc::uint32b>* segment_offsets,
+                   std::size_t num_of_segments,
+                   const zivc::SortKeyKind kind,
+                   const zivc::BufferLaunchOptions<KeyBits>& launch_options,
+                   zivc::SortStorage* storage)
+{
+  using zivc::uint32b;
+  using BufferType = zivc::SortStorage::BufferType;
+  using KernelType = zivc::SortStorage::KernelType;
+
+  const std::size_t size = launch_options.size();
+  if (size <= 1)
+    return;
+  // A single segment is the same as no segments
+  if (num_of_segments <= 1)
+    num_of_segments = 0;
+  const std::size_t num_of_words = (values != nullptr) ? num_of_value_words : 0;
+
+  auto* device = zisc::cast<zivc::Device*>(keys->getParent());
+  zivc::SortStorage local_storage;
+  if (storage == nullptr)
+    storage = std::addressof(local_storage);
+  storage->setDevice(device);
+
+  constexpr std::size_t num_of_key_passes = 8 * sizeof(KeyBits) / SortInfoT::radixBits();
+  SortInfoT info{};
+  info.setSourceOffset(launch_options.sourceOffset());
+  info.setSize(size);
+  info.setTileSize(::calcSortTileSize(*device, size));
+  info.setKeyKind(zisc::cast<uint32b>(kind));
+  info.setNumOfKeyPasses(num_of_key_passes);
+  info.setNumOfValueWords(num_of_words);
+  info.setNumOfSegments(num_of_segments);
+  ZISC_ASSERT(device->deviceInfo().workGroupSize() <= SortInfoT::maxWorkGroupSize(),
+              "The work-group size exceeds the limit of the sort.");
+  const std::size_t num_of_tiles = info.numOfTiles();
+  const std::size_t histogram_size = SortInfoT::radixSize() * num_of_tiles;
+  const std::size_t work_size = ::calcWorkSize(*device, num_of_tiles);
+
+  constexpr std::size_t key_words = sizeof(KeyBits) / sizeof(uint32b);
+  auto tmp_keys = storage->buffer(BufferType::kKey, key_words * size)->template reinterp<KeyBits>();
+  auto* tmp_values = storage->buffer(BufferType::kValue, (std::max)(num_of_words * size, std::size_t{1}));
+  // The pass counters of the histogram and the scatter kernels follow the counts
+  auto* histogram = storage->buffer(BufferType::kHistogram, histogram_size + 2);
+  auto* segments0 = histogram;
+  auto* segments1 = histogram;
+
+  const bool is_cpu = device->type() == zivc::SubPlatformType::kCpu;
+  auto make_options = [&launch_options, is_cpu](auto options)
+  {
+    options.setQueueIndex(launch_options.queueIndex());
+    options.setQueuePriority(launch_options.queuePriority());
+    options.setQueueSelection(zivc::QueueSelection::kFixed);
+    options.setExternalSyncMode(is_cpu);
+    return options;
+  };
+  zivc::LaunchResult result{};
+  auto submit = [device, is_cpu, &result](zivc::LaunchResult&& r)
+  {
+    result = std::move(r);
+    if (is_cpu)
+      device->waitForCompletion(result.fence());
+  };
+
+  {
+    auto counter_options = make_options(histogram->makeOptions());
+    counter_options.setDestOffset(histogram_size);
+    counter_options.setSize(2);
+    submit(histogram->fill(0u, counter_options));
+  }
+
+  // Compute the segment index of each element
+  if (info.hasSegments()) {
+    segments0 = storage->buffer(BufferType::kSegment0, size);
+    segments1 = storage->buffer(BufferType::kSegment1, size);
+    auto* kernel = ::getCachedKernel(storage, KernelType::kSegment, [device]()
+    {
+      return ::makeRadixSortSegmentKernel(device);
+    });
+    const auto options = make_options(::makeKernelOptions(kernel, work_size, launch_options));
+    submit(kernel->run(*segment_offsets, *segments0, info, options));
+  }
+
+  auto* histogram_kernel = ::getCachedKernel(
+      storage,
+      (key_words == 1) ? KernelType::kHistogram32 : KernelType::kHistogram64,
+      [device]() {return ::makeRadixSortHistogramKernel<KeyBits>(device);});
+  auto* scatter_kernel = ::getCachedKernel(
+      storage,
+      (key_words == 1) ? KernelType::kScatter32 : KernelType::kScatter64,
+      [device]() {return ::makeRadixSortScatterKernel<KeyBits>(device);});
+  auto* scan_kernel = ::getCachedKernel(storage, KernelType::kScan, [device]()
+  {
+    return ::makeScanKernel<uint32b>(device);
+  });
+
+  // The exclusive scan of the histogram gives the output offsets
+  PrimitiveInfoT scan_info{};
+  scan_info.setSize(histogram_size);
+  scan_info.setTileSize(::calcTileSize(*device, histogram_size));
+  scan_info.setOperation(PrimitiveInfoT::kAdd, true);
+  const std::size_t num_of_scan_tiles = scan_info.numOfTiles();
+  auto* status = storage->buffer(BufferType::kStatus,
+                                 PrimitiveInfoT::statusSize(num_of_scan_tiles));
+
+  const auto histogram_options = make_options(
+      ::makeKernelOptions(histogram_kernel, work_size, launch_options));
+  const auto scan_options = make_options(
+      ::makeKernelOptions(scan_kernel, ::calcWorkSize(*device, num_of_scan_tiles), launch_options));
+  auto scatter_options = make_options(
+      ::makeKernelOptions(scatter_kernel, work_size, launch_options));
+  auto status_options = make_options(status->makeOptions());
+  status_options.setSize(PrimitiveInfoT::statusSize(num_of_scan_tiles));
+
+  const std::size_t num_of_segment_passes = info.hasSegments()
+      ? ::calcNumOfDigits(num_of_segments - 1)
+      : 0;
+  const std::size_t num_of_passes = num_of_key_passes + num_of_segment_passes;
+  zivc::Buffer<uint32b>* value_list[] = {(values != nullptr) ? values : histogram,
+                                         (values != nullptr) ? tmp_values : histogram};
+  const bool is_copied_back = (num_of_passes % 2) == 1;
+  for (std::size_t pass = 0; pass < num_of_passes; ++pass) {
+    submit(histogram_kernel->run(*keys, tmp_keys, *segments0, *segments1, *histogram,
+                                 info, histogram_options));
+    submit(status->fill(0u, status_options));
+    submit(scan_kernel->run(*histogram, *histogram, *status, scan_info, scan_options));
+    // The host waits for the last launch
+    if (!is_copied_back && ((pass + 1) == num_of_passes))
+      scatter_options.setExternalSyncMode(true);
+    submit(scatter_kernel->run(*keys, tmp_keys, *value_list[0], *value_list[1],
+                               *segments0, *segments1, *histogram,
+                               info, scatter_options));
+  }
+
+  // Move the sorted elements back to the user buffers
+  if (is_copied_back) {
+    auto key_options = make_options(keys->makeOptions());
+    key_options.setDestOffset(launch_options.sourceOffset());
+    key_options.setSize(size);
+    key_options.setExternalSyncMode(is_cpu || (num_of_words == 0));
+    submit(zivc::copy(tmp_keys, keys, key_options));
+    if (0 < num_of_words) {
+      auto value_options = make_options(values->makeOptions());
+      value_options.setDestOffset(num_of_words * launch_options.sourceOffset());
+      value_options.setSize(num_of_words * size);
+      value_options.setExternalSyncMode(true);
+      submit(zivc::copy(*tmp_values, values, value_options));
+    }
+  }
+  if (!is_cpu)
+    device->waitForCompletion(result.fence());
+}
+
+} // namespace
+
+namespace zivc {
+
+/*!
+  \details The size of the launch options specifies the number of elements of
+  the source. The flags are read at the same offset as the source.
+  The number of selected elements is written into num_of_selected[0]
+
+  \tparam Type No description.
+  \param [in] source No description.
+  \param [in] flags No description.
+  \param [out] dest No description.
+  \param [out] num_of_selected No description.
+  \param [in] launch_options No description.
+  \param [in,out] storage No description.
+  \return No description
+  */
+template <PrimitiveArg Type>
+LaunchResult compact(const Buffer<Type>& source,
+                     const Buffer<uint32b>& flags,
+                     Buffer<Type>* dest,
+                     Buffer<uint32b>* num_of_selected,
+                     const BufferLaunchOptions<Type>& launch_options,
+                     PrimitiveStorage* storage)
+{
+  using KernelType = PrimitiveStorage::KernelType;
+
+  const std::size_t size = launch_options.size();
+  auto* device = zisc::cast<Device*>(dest->getParent());
+  const bool is_async = (storage != nullptr) && (device->type() != SubPlatformType::kCpu);
+  if (size == 0) {
+    auto options = num_of_selected->makeOptions();
+    options.setSize(1);
+    options.setQueueIndex(launch_options.queueIndex());
+    options.setQueuePriority(launch_options.queuePriority());
+    options.setExternalSyncMode(!is_async || launch_options.isExternalSyncMode());
+    return ::finishLaunch(*device, num_of_selected->fill(0u, options), is_async);
+  }
+
+  PrimitiveStorage local_storage;
+  if (storage == nullptr)
+    storage = std::addressof(local_storage);
+  storage->setDevice(device);
+
+  PrimitiveInfoT info{};
+  info.setSourceOffset(launch_options.sourceOffset());
+  info.setDestOffset(launch_options.destOffset());
+  info.setSize(size);
+  info.setTileSize(::calcTileSize(*device, size));
+  info.setOperation(PrimitiveInfoT::kAdd, false);
+  const std::size_t num_of_tiles = info.numOfTiles();
+
+  auto* status = storage->statusBuffer(PrimitiveInfoT::statusSize(num_of_tiles));
+  ::clearStatus(status, num_of_tiles, launch_options);
+  auto* kernel = ::getCachedKernel(
+      storage,
+      ::toKernelType<Type>(KernelType::kCompactI32),
+      [device]() {return ::makeCompactKernel<Type>(device);});
+  const std::size_t work_size = ::calcWorkSize(*device, num_of_tiles);
+  auto options = ::makeKernelOptions(kernel, work_size, launch_options);
+  if (is_async)
+    options.setExternalSyncMode(launch_options.isExternalSyncMode());
+  return ::finishLaunch(*device,
+                        kernel->run(source, flags, *dest, *num_of_selected,
+                                    *status, info, options),
+                        is_async);
+}
+
+/*!
+  \details The elements are rounded to the nearest even half
+
+  \param [in] source No description.
+  \param [out] dest No description.
+  \param [in] launch_options No description.
+  \param [in,out] storage No description.
+  \return No description
+  */
+LaunchResult convert(const Buffer<float>& source,
+                     Buffer<half>* dest,
+                     const BufferLaunchOptions<float>& launch_options,
+                     PrimitiveStorage* storage)
+{
+  return ::convert(source, dest, launch_options, storage);
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] source No description.
+  \param [out] dest No description.
+  \param [in] launch_options No description.
+  \param [in,out] storage No description.
+  \return No description
+  */
+LaunchResult convert(const Buffer<half>& source,
+                     Buffer<float>* dest,
+                     const BufferLaunchOptions<half>& launch_options,
+                     PrimitiveStorage* storage)
+{
+  return ::convert(source, dest, launch_options, storage);
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] source No description.
+  \param [out] dest No description.
+  \param [in] launch_options No description.
+  \param [in,out] storage No description.
+  \return No description
+  */
+LaunchResult convertFromBfloat16(const Buffer<uint16b>& source,
+                                 Buffer<float>* dest,
+                                 const BufferLaunchOptions<uint16b>& launch_options,
+                                 PrimitiveStorage* storage)
+{
+  return ::convert(source, dest, launch_options, storage);
+}
+
+/*!
+  \details The elements are rounded to the nearest even bfloat16.
+  NaNs stay NaNs
+
+  \param [in] source No description.
+  \param [out] dest No description.
+  \param [in] launch_options No description.
+  \param [in,out] storage No description.
+  \return No description
+  */
+LaunchResult convertToBfloat16(const Buffer<float>& source,
+                               Buffer<uint16b>* dest,
+                               const BufferLaunchOptions<float>& launch_options,
+                               PrimitiveStorage* storage)
+{
+  return ::convert(source, dest, launch_options, storage);
+}
+
+/*!
+  \details The first element of the dest range is the identity of the operation
+
+  \tparam Type No description.
+  \param [in] source No description.
+  \param [out] dest No description.
+  \param [in] op No description.
+  \param [in] launch_options No description.
+  \param [in,out] storage No description.
+  \return No description
+  */
+template <PrimitiveArg Type>
+LaunchResult exclusiveScan(const Buffer<Type>& source,
+                           Buffer<Type>* dest,
+                           const PrimitiveOp op,
+                           const BufferLaunchOptions<Type>& launch_options,
+                           PrimitiveStorage* storage)
+{
+  return ::scan(source, dest, op, true, launch_options, storage);
+}
+
+/*!
+  \details The matrices are row-major. C isn't read if beta is zero.
+  The uint16b elements are the bits of half, and they are multiplied and
+  accumulated in single precision.
+  The strided-batched multiplication is computed if the batch size of
+  the launch options is more than 1.
+  The kernels are cached in the given storage. The launch on a Vulkan device
+  with the storage isn't waited for, and the result has the fence if
+  the external sync mode of the launch options is on.
+  Otherwise the launch is waited for and the result is empty,
+  since the temporary kernel is released on return and a CPU kernel keeps
+  its arguments until the launch completes
+
+  \tparam Type No description.
+  \param [in] a No description.
+  \param [in] b No description.
+  \param [in,out] c No description.
+  \param [in] alpha No description.
+  \param [in] beta No description.
+  \param [in] launch_options No description.
+  \param [in,out] storage No description.
+  \return No description
+  */
+template <GemmArg Type>
+LaunchResult gemm(const Buffer<Type>& a,
+                  const Buffer<Type>& b,
+                  Buffer<Type>* c,
+                  const float alpha,
+                  const float beta,
+                  const GemmLaunchOptions& launch_options,
+                  GemmStorage* storage)
+{
+  using KernelType = GemmStorage::KernelType;
+  constexpr bool is_f32 = std::is_same_v<float, Type>;
+
+  const std::size_t m = launch_options.m();
+  const std::size_t n = launch_options.n();
+  const std::size_t batch_size = launch_options.batchSize();
+  if ((m == 0) || (n == 0) || (batch_size == 0))
+    return LaunchResult{};
+
+  auto* device = zisc::cast<Device*>(c->getParent());
+  const bool is_async = (storage != nullptr) && (device->type() != SubPlatformType::kCpu);
+  GemmStorage local_storage;
+  if (storage == nullptr)
+    storage = std::addressof(local_storage);
+  storage->setDevice(device);
+
+  GemmInfoT info{};
+  info.setShape(m, n, launch_options.k());
+  info.setLeadingDims(launch_options.lda(), launch_options.ldb(), launch_options.ldc());
+  info.setBatch(batch_size,
+                launch_options.strideA(),
+                launch_options.strideB(),
+                launch_options.strideC());
+  info.setScales(zisc::bit_cast<uint32b>(alpha), zisc::bit_cast<uint32b>(beta));
+
+  const std::size_t tile_size = ::calcGemmTileSize(*device);
+  if (tile_size == 0) {
+    ::setGemmBlockSize<Type>(*device, std::addressof(info));
+    auto* kernel = ::getCachedKernel(
+        storage,
+        is_f32 ? KernelType::kBlockF32 : KernelType::kBlockF16,
+        [device]() {return ::makeGemmBlockKernel<Type>(device);});
+    return ::runGemmKernel(kernel, a, b, c, info, info.numOfTiles(), launch_options, is_async);
+  }
+
+  // The work-groups iterate over the tiles if the tiles exceed the limit
+  info.setTileSize(tile_size, tile_size);
+  const DeviceInfo& device_info = device->deviceInfo();
+  const std::size_t group_size = device_info.workGroupSize();
+  const std::size_t num_of_groups = (std::min)(info.numOfTiles(),
+      zisc::cast<std::size_t>(device_info.maxWorkGroupCount()[0]));
+  const std::size_t work_size = num_of_groups * group_size;
+  if (tile_size == 16) {
+    auto* kernel = ::getCachedKernel(
+        storage,
+        is_f32 ? KernelType::kTile16F32 : KernelType::kTile16F16,
+        [device]() {return ::makeGemmTileKernel<Type, 16>(device);});
+    return ::runGemmKernel(kernel, a, b, c, info, work_size, launch_options, is_async);
+  }
+  else {
+    auto* kernel = ::getCachedKernel(
+        storage,
+        is_f32 ? KernelType::kTile32F32 : KernelType::kTile32F16,
+        [device]() {return ::makeGemmTileKernel<Type, 32>(device);});
+    return ::runGemmKernel(kernel, a, b, c, info, work_size, launch_options, is_async);
+  }
+}
+
+/*!
+  \details The element i of the dest is the number (offset + i) of
+  the stream of the seed. The numbers are the Box-Muller transform of
+  the uniform numbers, so the results are same for the same seed and offset
+  regardless of the size of the launch
+
+  \param [out] dest No description.
+  \param [in] seed No description.
+  \param [in] offset No description.
+  \param [in] launch_options No description.
+  \param [in,out] storage No description.
+  \return No description
+  */
+LaunchResult generateNormal(Buffer<float>* dest,
+                            const uint64b seed,
+                            const uint64b offset,
+                            const BufferLaunchOptions<float>& launch_options,
+                            PrimitiveStorage* storage)
+{
+  return ::generateRandom<float, true>(dest, seed, offset, launch_options, storage);
+}
+
+/*!
+  \details The element i of the dest is the number (offset + i) of
+  the stream of the seed. The uint32b numbers are the raw bits of
+  the Philox4x32-10 and the float numbers are in [0, 1) with 24bit resolution
+
+  \tparam Type No description.
+  \param [out] dest No description.
+  \param [in] seed No description.
+  \param [in] offset No description.
+  \param [in] launch_options No description.
+  \param [in,out] storage No description.
+  \return No description
+  */
+template <RandomArg Type>
+LaunchResult generateUniform(Buffer<Type>* dest,
+                             const uint64b seed,
+                             const uint64b offset,
+                             const BufferLaunchOptions<Type>& launch_options,
+                             PrimitiveStorage* storage)
+{
+  return ::generateRandom<Type, false>(dest, seed, offset, launch_options, storage);
+}
+
+/*!
+  \details The range [lower, upper) is divided into the bins evenly,
+  the number of bins is the size of the bins buffer minus the dest offset.
+  Elements out of the range aren't counted.
+  The counts are accumulated into the bins, so the bins should be
+  initialized by the caller
+
+  \tparam Type No description.
+  \param [in] source No description.
+  \param [in,out] bins No description.
+  \param [in] lower No description.
+  \param [in] upper No description.
+  \param [in] launch_options No description.
+  \param [in,out] storage No description.
+  \return No description
+  \exception SystemError The dest offset exceeds the bins.
+  */
+template <PrimitiveArg Type>
+LaunchResult histogram(const Buffer<Type>& source,
+                       Buffer<uint32b>* bins,
+                       const Type lower,
+                       const Type upper,
+                       const BufferLaunchOptions<Type>& launch_options,
+                       PrimitiveStorage* storage)
+{
+  using KernelType = PrimitiveStorage::KernelType;
+
+  if (bins->size() < launch_options.destOffset()) {
+    const char* message = "The dest offset exceeds the bins.";
+    throw SystemError{ErrorCode::kInvalidArgument, message};
+  }
+  const std::size_t size = launch_options.size();
+  const std::size_t num_of_bins = bins->size() - launch_options.destOffset();
+  if ((size == 0) || (num_of_bins == 0) || !(lower < upper))
+    return LaunchResult{};
+
+  auto* device = zisc::cast<Device*>(bins->getParent());
+  const bool is_async = (storage != nullptr) && (device->type() != SubPlatformType::kCpu);
+  PrimitiveStorage local_storage;
+  if (storage == nullptr)
+    storage = std::addressof(local_storage);
+  storage->setDevice(device);
+
+  PrimitiveInfoT info{};
+  info.setSourceOffset(launch_options.sourceOffset());
+  info.setDestOffset(launch_options.destOffset());
+  info.setSize(size);
+  info.setTileSize(::calcTileSize(*device, size));
+  info.setHistogramRange(zisc::cast<uint32b>(num_of_bins),
+                         zisc::bit_cast<uint32b>(lower),
+                         zisc::bit_cast<uint32b>(upper));
+  const std::size_t num_of_tiles = info.numOfTiles();
+
+  auto* kernel = ::getCachedKernel(
+      storage,
+      ::toKernelType<Type>(KernelType::kHistogramI32),
+      [device]() {return ::makeHistogramKernel<Type>(device);});
+  const std::size_t work_size = ::calcWorkSize(*device, num_of_tiles);
+  auto options = ::makeKernelOptions(kernel, work_size, launch_options);
+  if (is_async)
+    options.setExternalSyncMode(launch_options.isExternalSyncMode());
+  return ::finishLaunch(*device, kernel->run(source, *bins, info, options), is_async);
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Type No description.
+  \param [in] source No description.
+  \param [out] dest No description.
+  \param [in] op No description.
+  \param [in] launch_options No description.
+  \param [in,out] storage No description.
+  \return No description
+  */
+template <PrimitiveArg Type>
+LaunchResult inclusiveScan(const Buffer<Type>& source,
+                           Buffer<Type>* dest,
+                           const PrimitiveOp op,
+                           const BufferLaunchOptions<Type>& launch_options,
+                           PrimitiveStorage* storage)
+{
+  return ::scan(source, dest, op, false, launch_options, storage);
+}
+
+/*!
+  \details The result is written into the dest at the dest offset.
+  The identity of the operation is written if the source is empty
+
+  \tparam Type No description.
+  \param [in] source No description.
+  \param [out] dest No description.
+  \param [in] op No description.
+  \param [in] launch_options No description.
+  \param [in,out] storage No description.
+  \return No description
+  */
+template <PrimitiveArg Type>
+LaunchResult reduce(const Buffer<Type>& source,
+                    Buffer<Type>* dest,
+                    const PrimitiveOp op,
+                    const BufferLaunchOptions<Type>& launch_options,
+                    PrimitiveStorage* storage)
+{
+  using KernelType = PrimitiveStorage::KernelType;
+
+  const std::size_t size = launch_options.size();
+  auto* device = zisc::cast<Device*>(dest->getParent());
+  const bool is_async = (storage != nullptr) && (device->type() != SubPlatformType::kCpu);
+  if (size == 0) {
+    auto options = dest->makeOptions();
+    options.setDestOffset(launch_options.destOffset());
+    options.setSize(1);
+    options.setQueueIndex(launch_options.queueIndex());
+    options.setQueuePriority(launch_options.queuePriority());
+    options.setExternalSyncMode(!is_async || launch_options.isExternalSyncMode());
+    return ::finishLaunch(*device, dest->fill(::identity<Type>(op), options), is_async);
+  }
+
+  PrimitiveStorage local_storage;
+  if (storage == nullptr)
+    storage = std::addressof(local_storage);
+  storage->setDevice(device);
+
+  PrimitiveInfoT info{};
+  info.setSourceOffset(launch_options.sourceOffset());
+  info.setDestOffset(launch_options.destOffset());
+  info.setSize(size);
+  info.setTileSize(::calcTileSize(*device, size));
+  info.setOperation(zisc::cast<uint32b>(op), false);
+  const std::size_t num_of_tiles = info.numOfTiles();
+
+  auto* status = storage->statusBuffer(PrimitiveInfoT::statusSize(num_of_tiles));
+  ::clearStatus(status, num_of_tiles, launch_options);
+  auto* kernel = ::getCachedKernel(
+      storage,
+      ::toKernelType<Type>(KernelType::kReduceI32),
+      [device]() {return ::makeReduceKernel<Type>(device);});
+  const std::size_t work_size = ::calcWorkSize(*device, num_of_tiles);
+  auto options = ::makeKernelOptions(kernel, work_size, launch_options);
+  if (is_async)
+    options.setExternalSyncMode(launch_options.isExternalSyncMode());
+  return ::finishLaunch(*device,
+                        kernel->run(source, *dest, *status, info, options),
+                        is_async);
+}
+
+/*!
+  \details No detailed description
+
+  \param [in,out] keys No description.
+  \param [in,out] values No description.
+  \param [in] num_of_value_words No description.
+  \param [in] segment_offsets No description.
+  \param [in] num_of_segments No description.
+  \param [in] kind No description.
+  \param [in] launch_options No description.
+  \param [in,out] storage No description.
+  \return No description
+  */
+LaunchResult radixSort(Buffer<uint32b>* keys,
+                       Buffer<uint32b>* values,
+                       const std::size_t num_of_value_words,
+                       const Buffer<uint32b>* segment_offsets,
+                       const std::size_t num_of_segments,
+                       const SortKeyKind kind,
+                       const BufferLaunchOptions<uint32b>& launch_options,
+                       SortStorage* storage)
+{
+  ::radixSortImpl(keys, values, num_of_value_words, segment_offsets,
+                  num_of_segments, kind, launch_options, storage);
+  return LaunchResult{};
+}
+
+/*!
+  \details No detailed description
+
+  \param [in,out] keys No description.
+  \param [in,out] values No description.
+  \param [in] num_of_value_words No description.
+  \param [in] segment_offsets No description.
+  \param [in] num_of_segments No description.
+  \param [in] kind No description.
+  \param [in] launch_options No description.
+  \param [in,out] storage No description.
+  \return No description
+  */
+LaunchResult radixSort(Buffer<uint64b>* keys,
+                       Buffer<uint32b>* values,
+                       const std::size_t num_of_value_words,
+                       const Buffer<uint32b>* segment_offsets,
+                       const std::size_t num_of_segments,
+                       const SortKeyKind kind,
+                       const BufferLaunchOptions<uint64b>& launch_options,
+                       SortStorage* storage)
+{
+  ::radixSortImpl(keys, values, num_of_value_words, segment_offsets,
+                  num_of_segments, kind, launch_options, storage);
+  return LaunchResult{};
+}
+
+// Explicit instantiations
+
+#define ZIVC_INSTANTIATE_PRIMITIVES(type) \
+  template LaunchResult compact< type >(const Buffer< type >&, \
+                                        const Buffer<uint32b>&, \
+                                        Buffer< type >*, \
+                                        Buffer<uint32b>*, \
+                                        const BufferLaunchOptions< type >&, \
+                                        PrimitiveStorage*); \
+  template LaunchResult exclusiveScan< type >(const Buffer< type >&, \
+                                              Buffer< type >*, \
+                                              const PrimitiveOp, \
+                                              const BufferLaunchOptions< type >&, \
+                                              PrimitiveStorage*); \
+  template LaunchResult histogram< type >(const Buffer< type >&, \
+                                          Buffer<uint32b>*, \
+                                          const type, \
+                                          const type, \
+                                          const BufferLaunchOptions< type >&, \
+                                          PrimitiveStorage*); \
+  template LaunchResult inclusiveScan< type >(const Buffer< type >&, \
+                                              Buffer< type >*, \
+                                              const PrimitiveOp, \
+                                              const BufferLaunchOptions< type >&, \
+                                              PrimitiveStorage*); \
+  template LaunchResult reduce< type >(const Buffer< type >&, \
+                                       Buffer< type >*, \
+                                       const PrimitiveOp, \
+                                       const BufferLaunchOptions< type >&, \
+                                       PrimitiveStorage*)
+
+ZIVC_INSTANTIATE_PRIMITIVES(int32b);
+ZIVC_INSTANTIATE_PRIMITIVES(uint32b);
+ZIVC_INSTANTIATE_PRIMITIVES(float);
+
+#undef ZIVC_INSTANTIATE_PRIMITIVES
+
+#define ZIVC_INSTANTIATE_GEMM(type) \
+  template LaunchResult gemm< type >(const Buffer< type >&, \
+                                     const Buffer< type >&, \
+                                     Buffer< type >*, \
+                                     const float, \
+                                     const float, \
+                                     const GemmLaunchOptions&, \
+                                     GemmStorage*)
+
+ZIVC_INSTANTIATE_GEMM(float);
+ZIVC_INSTANTIATE_GEMM(uint16b);
+
+#undef ZIVC_INSTANTIATE_GEMM
+
+#define ZIVC_INSTANTIATE_RANDOM(type) \
+  template LaunchResult generateUniform< type >(Buffer< type >*, \
+                                                const uint64b, \
+                                                const uint64b, \
+                                                const BufferLaunchOptions< type >&, \
+                                                PrimitiveStorage*)
+
+ZIVC_INSTANTIATE_RANDOM(uint32b);
+ZIVC_INSTANTIATE_RANDOM(float);
+
+#undef ZIVC_INSTANTIATE_RANDOM
+
+} // namespace zivc
@@ -0,0 +1,247 @@
+/*!
+  \file primitives.hpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2021 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZIVC_PRIMITIVES_HPP
+#define ZIVC_PRIMITIVES_HPP
+
+// Standard C++ library
+#include <cstddef>
+#include <type_traits>
+// Zivc
+#include "buffer.hpp"
+#include "utility/buffer_launch_options.hpp"
+#include "utility/gemm_launch_options.hpp"
+#include "utility/gemm_storage.hpp"
+#include "utility/launch_result.hpp"
+#include "utility/primitive_storage.hpp"
+#include "utility/sort_storage.hpp"
+#include "zivc/zivc_config.hpp"
+
+namespace zivc {
+
+/*!
+  \brief Binary operations of reduce and scan
+
+  No detailed description.
+  */
+enum class PrimitiveOp : uint32b
+{
+  kAdd = 0,
+  kMin,
+  kMax
+};
+
+//! An element type supported by the device-wide primitives
+template <typename Type>
+concept PrimitiveArg = std::is_same_v<int32b, Type> ||
+                       std::is_same_v<uint32b, Type> ||
+                       std::is_same_v<float, Type>;
+
+//! A key type supported by the radix sort
+template <typename Type>
+concept SortKey = PrimitiveArg<Type> ||
+                  std::is_same_v<int64b, Type> ||
+                  std::is_same_v<uint64b, Type> ||
+                  std::is_same_v<double, Type>;
+
+//! A value type supported by the radix sort
+template <typename Type>
+concept SortValue = KernelArg<Type> && ((sizeof(Type) % sizeof(uint32b)) == 0);
+
+//! An element type supported by the matrix multiplication. uint16b holds the bits of half
+template <typename Type>
+concept GemmArg = std::is_same_v<float, Type> || std::is_same_v<uint16b, Type>;
+
+//! An element type supported by the random number generation
+template <typename Type>
+concept RandomArg = std::is_same_v<uint32b, Type> || std::is_same_v<float, Type>;
+
+/*!
+  \brief Kinds of sort keys
+
+  No detailed description.
+  */
+enum class SortKeyKind : uint32b
+{
+  kUnsigned = 0,
+  kSigned,
+  kFloat
+};
+
+// Device-wide primitives.
+// Reduce, scan and compact are single-pass. A work-group processes a tile
+// with the work-group collectives and the partial results of tiles are
+// propagated with the decoupled look-back, so every element is read
+// from the device memory at most twice.
+// Sort is a stable LSD radix sort with 8bit digits. A work-group counts and
+// scatters a tile, and the passes are chained on one queue.
+// Gemm stages tiles of the matrices in the local memory on Vulkan devices,
+// and a work-item accumulates a block of a tile in registers.
+// It computes cache-sized blocks per work-item on CPU devices.
+// Convert reads and writes vectors of four elements with grid-stride loops.
+// The random numbers are generated with the counter-based Philox4x32-10,
+// so the numbers of a (seed, offset) pair are reproducible on any device.
+// The primitives are synchronous. They return after the device completes
+// the operation, so the returned results don't have fences and
+// the temporary buffers and kernels are released on return.
+// The exceptions are gemm, reduce, scan, compact, histogram, convert and
+// the random number generation with a storage on a Vulkan device. They return the fence of the launch if
+// the external sync mode is on, and the storage must outlive the fence.
+
+//! Compact the elements whose flags are non-zero into the dest preserving their order
+template <PrimitiveArg Type>
+LaunchResult compact(const Buffer<Type>& source,
+                     const Buffer<uint32b>& flags,
+                     Buffer<Type>* dest,
+                     Buffer<uint32b>* num_of_selected,
+                     const BufferLaunchOptions<Type>& launch_options,
+                     PrimitiveStorage* storage = nullptr);
+
+//! Convert the float elements of the source into half
+LaunchResult convert(const Buffer<float>& source,
+                     Buffer<half>* dest,
+                     const BufferLaunchOptions<float>& launch_options,
+                     PrimitiveStorage* storage = nullptr);
+
+//! Convert the half elements of the source into float
+LaunchResult convert(const Buffer<half>& source,
+                     Buffer<float>* dest,
+                     const BufferLaunchOptions<half>& launch_options,
+                     PrimitiveStorage* storage = nullptr);
+
+//! Convert the bfloat16 elements of the source into float. uint16b holds the bits of bfloat16
+LaunchResult convertFromBfloat16(const Buffer<uint16b>& source,
+                                 Buffer<float>* dest,
+                                 const BufferLaunchOptions<uint16b>& launch_options,
+                                 PrimitiveStorage* storage = nullptr);
+
+//! Convert the float elements of the source into bfloat16. uint16b holds the bits of bfloat16
+LaunchResult convertToBfloat16(const Buffer<float>& source,
+                               Buffer<uint16b>* dest,
+                               const BufferLaunchOptions<float>& launch_options,
+                               PrimitiveStorage* storage = nullptr);
+
+//! Compute C = alpha * A * B + beta * C for each matrix in the batch
+template <GemmArg Type>
+LaunchResult gemm(const Buffer<Type>& a,
+                  const Buffer<Type>& b,
+                  Buffer<Type>* c,
+                  const float alpha,
+                  const float beta,
+                  const GemmLaunchOptions& launch_options,
+                  GemmStorage* storage = nullptr);
+
+//! Fill the dest with standard normal random numbers of the stream of the seed
+LaunchResult generateNormal(Buffer<float>* dest,
+                            const uint64b seed,
+                            const uint64b offset,
+                            const BufferLaunchOptions<float>& launch_options,
+                            PrimitiveStorage* storage = nullptr);
+
+//! Fill the dest with uniform random numbers of the stream of the seed
+template <RandomArg Type>
+LaunchResult generateUniform(Buffer<Type>* dest,
+                             const uint64b seed,
+                             const uint64b offset,
+                             const BufferLaunchOptions<Type>& launch_options,
+                             PrimitiveStorage* storage = nullptr);
+
+//! Compute the exclusive prefix scan of the source
+template <PrimitiveArg Type>
+LaunchResult exclusiveScan(const Buffer<Type>& source,
+                           Buffer<Type>* dest,
+                           const PrimitiveOp op,
+                           const BufferLaunchOptions<Type>& launch_options,
+                           PrimitiveStorage* storage = nullptr);
+
+//! Count the elements of the source into evenly divided bins
+template <PrimitiveArg Type>
+LaunchResult histogram(const Buffer<Type>& source,
+                       Buffer<uint32b>* bins,
+                       const Type lower,
+                       const Type upper,
+                       const BufferLaunchOptions<Type>& launch_options,
+                       PrimitiveStorage* storage = nullptr);
+
+//! Compute the inclusive prefix scan of the source
+template <PrimitiveArg Type>
+LaunchResult inclusiveScan(const Buffer<Type>& source,
+                           Buffer<Type>* dest,
+                           const PrimitiveOp op,
+                           const BufferLaunchOptions<Type>& launch_options,
+                           PrimitiveStorage* storage = nullptr);
+
+//! Reduce the elements of the source into a value
+template <PrimitiveArg Type>
+LaunchResult reduce(const Buffer<Type>& source,
+                    Buffer<Type>* dest,
+                    const PrimitiveOp op,
+                    const BufferLaunchOptions<Type>& launch_options,
+                    PrimitiveStorage* storage = nullptr);
+
+//! Sort the keys and the values within each segment in ascending order of the keys
+template <SortKey Key, SortValue Value>
+LaunchResult segmentedSort(Buffer<Key>* keys,
+                           Buffer<Value>* values,
+                           const Buffer<uint32b>& segment_offsets,
+                           const std::size_t num_of_segments,
+                           const BufferLaunchOptions<Key>& launch_options,
+                           SortStorage* storage = nullptr);
+
+//! Sort the keys within each segment in ascending order
+template <SortKey Key>
+LaunchResult segmentedSort(Buffer<Key>* keys,
+                           const Buffer<uint32b>& segment_offsets,
+                           const std::size_t num_of_segments,
+                           const BufferLaunchOptions<Key>& launch_options,
+                           SortStorage* storage = nullptr);
+
+//! Sort the keys and the values in ascending order of the keys
+template <SortKey Key, SortValue Value>
+LaunchResult sort(Buffer<Key>* keys,
+                  Buffer<Value>* values,
+                  const BufferLaunchOptions<Key>& launch_options,
+                  SortStorage* storage = nullptr);
+
+//! Sort the keys in ascending order
+template <SortKey Key>
+LaunchResult sort(Buffer<Key>* keys,
+                  const BufferLaunchOptions<Key>& launch_options,
+                  SortStorage* storage = nullptr);
+
+//! Sort 32bit keys. It's the implementation of sort and segmentedSort
+LaunchResult radixSort(Buffer<uint32b>* keys,
+                       Buffer<uint32b>* values,
+                       const std::size_t num_of_value_words,
+                       const Buffer<uint32b>* segment_offsets,
+                       const std::size_t num_of_segments,
+                       const SortKeyKind kind,
+                       const BufferLaunchOptions<uint32b>& launch_options,
+                       SortStorage* storage);
+
+//! Sort 64bit keys. It's the implementation of sort and segmentedSort
+LaunchResult radixSort(Buffer<uint64b>* keys,
+                       Buffer<uint32b>* values,
+                       const std::size_t num_of_value_words,
+                       const Buffer<uint32b>* segment_offsets,
+                       const std::size_t num_of_segments,
+                       const SortKeyKind kind,
+                       const BufferLaunchOptions<uint64b>& launch_options,
+                       SortStorage* storage);
+
+} // namespace zivc
+
+#include "primitives-inl.hpp"
+
+#endif // ZIVC_PRIMITIVES_HPP
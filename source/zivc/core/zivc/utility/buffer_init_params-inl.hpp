@@ -16,8 +16,10 @@
 #define ZIVC_BUFFER_INIT_PARAMS_INL_HPP
 
 #include "buffer_init_params.hpp"
-// Zivc
-#include "zivc/zivc_config.hpp"
+// Standard C++ library
+#include <cstddef>
+// Zisc
+#include "zisc/utility.hpp"
 // Zivc
 #include "zivc/zivc_config.hpp"
 
@@ -42,6 +44,17 @@ BufferInitParams::BufferInitParams(const BufferUsage flag) noexcept :
 {
 }
 
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+std::size_t BufferInitParams::alignment() const noexcept
+{
+  return alignment_;
+}
+
 /*!
   \details No detailed description
 
@@ -53,6 +66,17 @@ BufferUsage BufferInitParams::bufferUsage() const noexcept
   return flag_;
 }
 
+/*!
+  \details A cache line size, which is also enough for 512-bit SIMD loads
+
+  \return No description
+  */
+inline
+constexpr std::size_t BufferInitParams::defaultAlignment() noexcept
+{
+  return 64;
+}
+
 /*!
   \details No detailed description
 
@@ -64,6 +88,17 @@ auto BufferInitParams::descriptorType() const noexcept -> DescriptorType
   return descriptor_type_;
 }
 
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+auto BufferInitParams::hugePageMode() const noexcept -> HugePageMode
+{
+  return huge_page_mode_;
+}
+
 /*!
   \details No detailed description
 
@@ -76,6 +111,18 @@ bool BufferInitParams::internalBufferFlag() const noexcept
   return result;
 }
 
+/*!
+  \details The alignment must be a power of 2.
+  Smaller values than the default alignment are raised to it
+
+  \param [in] alignment No description.
+  */
+inline
+void BufferInitParams::setAlignment(const std::size_t alignment) noexcept
+{
+  alignment_ = alignment;
+}
+
 /*!
   \details No detailed description
 
@@ -98,6 +145,16 @@ void BufferInitParams::setDescriptorType(const DescriptorType type) noexcept
   descriptor_type_ = type;
 }
 
+/*!
+  \details No detailed description
+
+  \param [in] mode No description.
+  */
+inline
+void BufferInitParams::setHugePageMode(const HugePageMode mode) noexcept
+{
+  huge_page_mode_ = mode;
+}
 
 /*!
   \details No detailed description
@@ -16,7 +16,10 @@
 #ifndef ZIVC_BUFFER_INIT_PARAMS_HPP
 #define ZIVC_BUFFER_INIT_PARAMS_HPP
 
+// Standard C++ library
+#include <cstddef>
 // Zisc
+#include "zisc/utility.hpp"
 #include "zisc/zisc_config.hpp"
 // Zivc
 #include "zivc/zivc_config.hpp"
@@ -42,6 +45,18 @@ class BufferInitParams
     kStorage
   };
 
+  /*!
+    \brief Specify whether huge pages back a host (CPU) buffer
+
+    No detailed description.
+    */
+  enum class HugePageMode : uint8b
+  {
+    kNone,        //!< Use the memory resource of the platform
+    kTransparent, //!< Advise the kernel to use transparent huge pages
+    kExplicit     //!< Request explicit huge pages, fallback to transparent
+  };
+
 
   //! Initialize parameters
   BufferInitParams() noexcept;
@@ -50,21 +65,36 @@ class BufferInitParams
   BufferInitParams(const BufferUsage flag) noexcept;
 
 
+  //! Return the alignment of a host (CPU) buffer memory in bytes
+  std::size_t alignment() const noexcept;
+
   //! Return the buffer usage flag
   BufferUsage bufferUsage() const noexcept;
 
+  //! Return the default alignment of a host (CPU) buffer memory in bytes
+  static constexpr std::size_t defaultAlignment() noexcept;
+
   //! Return the descriptor type for Vulkan
   DescriptorType descriptorType() const noexcept;
 
+  //! Return the huge page mode of a host (CPU) buffer
+  HugePageMode hugePageMode() const noexcept;
+
   //! Check if the buffer has internal flag
   bool internalBufferFlag() const noexcept;
 
+  //! Set the alignment of a host (CPU) buffer memory in bytes
+  void setAlignment(const std::size_t alignment) noexcept;
+
   //! Set the buffer usage
   void setBufferUsage(const BufferUsage flag) noexcept;
 
   //! Set descriptor type for Vulkan
   void setDescriptorType(const DescriptorType type) noexcept;
 
+  //! Set the huge page mode of a host (CPU) buffer
+  void setHugePageMode(const HugePageMode mode) noexcept;
+
   //! Set internal buffer flag
   void setInternalBufferFlag(const bool flag) noexcept;
 
@@ -75,8 +105,10 @@ class BufferInitParams
 
   BufferUsage flag_ = BufferUsage::kDeviceOnly;
   DescriptorType descriptor_type_ = DescriptorType::kStorage;
+  std::size_t alignment_ = defaultAlignment();
+  HugePageMode huge_page_mode_ = HugePageMode::kNone;
   int8b is_internal_buffer_ = zisc::kFalse;
-  [[maybe_unused]] Padding<3> pad_;
+  [[maybe_unused]] Padding<6> pad_;
 };
 
 } // namespace zivc
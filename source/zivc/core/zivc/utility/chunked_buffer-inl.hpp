@@ -0,0 +1,376 @@
+/*!
+  \file chunked_buffer-inl.hpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2021 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZIVC_CHUNKED_BUFFER_INL_HPP
+#define ZIVC_CHUNKED_BUFFER_INL_HPP
+
+#include "chunked_buffer.hpp"
+// Standard C++ library
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+// Zisc
+#include "zisc/error.hpp"
+#include "zisc/utility.hpp"
+#include "zisc/memory/std_memory_resource.hpp"
+// Zivc
+#include "buffer_init_params.hpp"
+#include "buffer_launch_options.hpp"
+#include "chunked_mapped_memory.hpp"
+#include "launch_result.hpp"
+#include "mapped_memory.hpp"
+#include "zivc/buffer.hpp"
+#include "zivc/device.hpp"
+#include "zivc/device_info.hpp"
+#include "zivc/zivc_config.hpp"
+#include "zivc/utility/error.hpp"
+
+namespace zivc {
+
+/*!
+  \details No detailed description
+
+  \param [in] device No description.
+  \param [in] params No description.
+  */
+template <KernelArg T> inline
+ChunkedBuffer<T>::ChunkedBuffer(Device* device, const BufferInitParams& params) :
+    ChunkedBuffer(device,
+                  params,
+                  (std::max)(device->deviceInfo().maxAllocationSize() / sizeof(Type),
+                             std::size_t{1}))
+{
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] device No description.
+  \param [in] params No description.
+  \param [in] chunk_capacity No description.
+  */
+template <KernelArg T> inline
+ChunkedBuffer<T>::ChunkedBuffer(Device* device,
+                                const BufferInitParams& params,
+                                const std::size_t chunk_capacity) :
+    chunk_list_{typename decltype(chunk_list_)::allocator_type{device->memoryResource()}},
+    device_{device},
+    params_{params},
+    chunk_capacity_{chunk_capacity}
+{
+  ZISC_ASSERT(0 < chunk_capacity_, "The chunk capacity is zero.");
+}
+
+/*!
+  \details No detailed description
+  */
+template <KernelArg T> inline
+ChunkedBuffer<T>::~ChunkedBuffer() noexcept
+{
+  clear();
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] index No description.
+  \return No description
+  */
+template <KernelArg T> inline
+Buffer<typename ChunkedBuffer<T>::Type>& ChunkedBuffer<T>::chunk(const std::size_t index) noexcept
+{
+  return *chunk_list_[index];
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] index No description.
+  \return No description
+  */
+template <KernelArg T> inline
+const Buffer<typename ChunkedBuffer<T>::Type>& ChunkedBuffer<T>::chunk(const std::size_t index) const noexcept
+{
+  return *chunk_list_[index];
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+template <KernelArg T> inline
+std::size_t ChunkedBuffer<T>::chunkCapacity() const noexcept
+{
+  return chunk_capacity_;
+}
+
+/*!
+  \details No detailed description
+  */
+template <KernelArg T> inline
+void ChunkedBuffer<T>::clear() noexcept
+{
+  chunk_list_.clear();
+  size_ = 0;
+}
+
+/*!
+  \details The range is split where either the source or the dest
+  crosses a chunk boundary
+
+  \param [in] source No description.
+  \param [in] launch_options No description.
+  \return No description
+  \exception SystemError The range exceeds the source or the dest.
+  */
+template <KernelArg T> inline
+LaunchResult ChunkedBuffer<T>::copyFrom(const ChunkedBuffer& source,
+                                        const LaunchOptions& launch_options)
+{
+  const std::size_t n = launch_options.size();
+  if (source.size() < (launch_options.sourceOffset() + n)) {
+    const char* message = "The copy range exceeds the source chunked buffer.";
+    throw SystemError{ErrorCode::kInvalidArgument, message};
+  }
+  validateRange(launch_options);
+  const std::size_t src_cap = source.chunkCapacity();
+  const std::size_t dst_cap = chunkCapacity();
+  LaunchResult result{};
+  for (std::size_t i = 0; i < n;) {
+    const std::size_t src = launch_options.sourceOffset() + i;
+    const std::size_t dst = launch_options.destOffset() + i;
+    const std::size_t src_offset = src % src_cap;
+    const std::size_t dst_offset = dst % dst_cap;
+    const std::size_t s = (std::min)({n - i,
+                                      src_cap - src_offset,
+                                      dst_cap - dst_offset});
+    const LaunchOptions options = makePieceOptions(launch_options,
+                                                   src_offset,
+                                                   dst_offset,
+                                                   s,
+                                                   n <= (i + s));
+    result = zivc::copy(source.chunk(src / src_cap),
+                        std::addressof(chunk(dst / dst_cap)),
+                        options);
+    i += s;
+  }
+  return result;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+template <KernelArg T> inline
+Device* ChunkedBuffer<T>::device() noexcept
+{
+  return device_;
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] value No description.
+  \param [in] launch_options No description.
+  \return No description
+  */
+template <KernelArg T> inline
+LaunchResult ChunkedBuffer<T>::fill(ConstReference value,
+                                    const LaunchOptions& launch_options)
+{
+  auto fill_chunk = [&value](Buffer<Type>& dest,
+                             [[maybe_unused]] const std::size_t offset,
+                             const LaunchOptions& options)
+  {
+    return zivc::fill(value, std::addressof(dest), options);
+  };
+  return forEachChunk(fill_chunk, launch_options);
+}
+
+/*!
+  \details The function is called as func(chunk, offset, options).
+  The offset is the index into the whole buffer of the first element of the piece,
+  and the dest offset and the size of the options specify the piece in the chunk.
+  The pieces are submitted to the queue of the given options in order.
+  Only the last piece takes the external sync mode of the given options,
+  so the function should return the result of the launch with the given options
+
+  \tparam Function No description.
+  \param [in] func No description.
+  \param [in] launch_options No description.
+  \return The result of the last piece
+  \exception SystemError The range exceeds the buffer.
+  */
+template <KernelArg T> template <typename Function> inline
+LaunchResult ChunkedBuffer<T>::forEachChunk(Function&& func,
+                                            const LaunchOptions& launch_options)
+{
+  const std::size_t n = launch_options.size();
+  validateRange(launch_options);
+  const std::size_t cap = chunkCapacity();
+  LaunchResult result{};
+  for (std::size_t i = 0; i < n;) {
+    const std::size_t dst = launch_options.destOffset() + i;
+    const std::size_t dst_offset = dst % cap;
+    const std::size_t s = (std::min)(n - i, cap - dst_offset);
+    const LaunchOptions options = makePieceOptions(launch_options,
+                                                   0,
+                                                   dst_offset,
+                                                   s,
+                                                   n <= (i + s));
+    result = func(chunk(dst / cap), dst, options);
+    i += s;
+  }
+  return result;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+template <KernelArg T> inline
+auto ChunkedBuffer<T>::makeOptions() const noexcept -> LaunchOptions
+{
+  LaunchOptions options{size()};
+  return options;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+template <KernelArg T> inline
+auto ChunkedBuffer<T>::mapMemory() -> ChunkedMappedMemory<Type>
+{
+  using MappedMemoryList = typename ChunkedMappedMemory<Type>::MappedMemoryList;
+  MappedMemoryList memory_list{typename MappedMemoryList::allocator_type{device_->memoryResource()}};
+  memory_list.reserve(numOfChunks());
+  for (std::size_t i = 0; i < numOfChunks(); ++i)
+    memory_list.emplace_back(chunk(i).mapMemory());
+  return ChunkedMappedMemory<Type>{std::move(memory_list), chunkCapacity()};
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+template <KernelArg T> inline
+auto ChunkedBuffer<T>::mapMemory() const -> ChunkedMappedMemory<ConstType>
+{
+  using MappedMemoryList = typename ChunkedMappedMemory<ConstType>::MappedMemoryList;
+  MappedMemoryList memory_list{typename MappedMemoryList::allocator_type{device_->memoryResource()}};
+  memory_list.reserve(numOfChunks());
+  for (std::size_t i = 0; i < numOfChunks(); ++i)
+    memory_list.emplace_back(chunk(i).mapMemory());
+  return ChunkedMappedMemory<ConstType>{std::move(memory_list), chunkCapacity()};
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+template <KernelArg T> inline
+std::size_t ChunkedBuffer<T>::numOfChunks() const noexcept
+{
+  return chunk_list_.size();
+}
+
+/*!
+  \details A chunk is reserved with the exact size instead of growing
+  geometrically, so that it doesn't exceed the chunk capacity
+
+  \param [in] s No description.
+  */
+template <KernelArg T> inline
+void ChunkedBuffer<T>::setSize(const std::size_t s)
+{
+  const std::size_t cap = chunkCapacity();
+  const std::size_t n = (s + cap - 1) / cap;
+  chunk_list_.resize(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    SharedBuffer<Type>& c = chunk_list_[i];
+    if (!c)
+      c = device_->makeBuffer<Type>(params_);
+    const std::size_t chunk_size = (i + 1 < n) ? cap : s - i * cap;
+    if (c->capacity() < chunk_size)
+      c->reserve(chunk_size);
+    c->setSize(chunk_size);
+  }
+  size_ = s;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+template <KernelArg T> inline
+std::size_t ChunkedBuffer<T>::size() const noexcept
+{
+  return size_;
+}
+
+/*!
+  \details The pieces are submitted to the fixed queue so that
+  the fence of the last piece covers the earlier pieces
+
+  \param [in] launch_options No description.
+  \param [in] source_offset No description.
+  \param [in] dest_offset No description.
+  \param [in] s No description.
+  \param [in] is_last No description.
+  \return No description
+  */
+template <KernelArg T> inline
+auto ChunkedBuffer<T>::makePieceOptions(const LaunchOptions& launch_options,
+                                        const std::size_t source_offset,
+                                        const std::size_t dest_offset,
+                                        const std::size_t s,
+                                        const bool is_last) noexcept
+    -> LaunchOptions
+{
+  LaunchOptions options = launch_options;
+  options.setSourceOffset(source_offset);
+  options.setDestOffset(dest_offset);
+  options.setSize(s);
+  options.setQueueSelection(QueueSelection::kFixed);
+  if (!is_last)
+    options.setExternalSyncMode(false);
+  return options;
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] launch_options No description.
+  \exception SystemError The dest range exceeds the buffer.
+  */
+template <KernelArg T> inline
+void ChunkedBuffer<T>::validateRange(const LaunchOptions& launch_options) const
+{
+  if (size() < (launch_options.destOffset() + launch_options.size())) {
+    const char* message = "The range exceeds the chunked buffer.";
+    throw SystemError{ErrorCode::kInvalidArgument, message};
+  }
+}
+
+} // namespace zivc
+
+#endif // ZIVC_CHUNKED_BUFFER_INL_HPP
@@ -0,0 +1,145 @@
+/*!
+  \file chunked_buffer.hpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2021 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZIVC_CHUNKED_BUFFER_HPP
+#define ZIVC_CHUNKED_BUFFER_HPP
+
+// Standard C++ library
+#include <cstddef>
+#include <type_traits>
+// Zisc
+#include "zisc/non_copyable.hpp"
+#include "zisc/memory/std_memory_resource.hpp"
+// Zivc
+#include "buffer_init_params.hpp"
+#include "buffer_launch_options.hpp"
+#include "chunked_mapped_memory.hpp"
+#include "launch_result.hpp"
+#include "zivc/buffer.hpp"
+#include "zivc/zivc_config.hpp"
+
+namespace zivc {
+
+// Forward declaration
+class Device;
+
+/*!
+  \brief A virtual buffer which is made of multiple device buffers
+
+  A single allocation is limited by maxAllocationSize of the device.
+  The chunked buffer splits the elements into chunks which are within
+  the limit, so the buffer can be larger than the limit.
+  Copy and fill operations are split at the chunk boundaries and
+  are submitted to the same queue in order.
+  A range which exceeds the buffer is rejected with SystemError.
+  The result of the last piece is returned, its fence covers the earlier pieces.
+
+  \tparam T No description.
+  */
+template <KernelArg T>
+class ChunkedBuffer : private zisc::NonCopyable<ChunkedBuffer<T>>
+{
+ public:
+  // Type aliases
+  using Type = std::remove_cv_t<std::remove_reference_t<T>>;
+  using ConstType = std::add_const_t<Type>;
+  using ConstReference = std::add_lvalue_reference_t<ConstType>;
+  using LaunchOptions = BufferLaunchOptions<Type>;
+
+
+  //! Initialize the buffer with the chunk capacity of the device limit
+  ChunkedBuffer(Device* device, const BufferInitParams& params);
+
+  //! Initialize the buffer with the given chunk capacity
+  ChunkedBuffer(Device* device,
+                const BufferInitParams& params,
+                const std::size_t chunk_capacity);
+
+  //! Finalize the buffer
+  ~ChunkedBuffer() noexcept;
+
+
+  //! Return the chunk by index
+  Buffer<Type>& chunk(const std::size_t index) noexcept;
+
+  //! Return the chunk by index
+  const Buffer<Type>& chunk(const std::size_t index) const noexcept;
+
+  //! Return the max number of elements of a chunk
+  std::size_t chunkCapacity() const noexcept;
+
+  //! Release all chunks
+  void clear() noexcept;
+
+  //! Copy from the given buffer
+  [[nodiscard("The result can have a fence when external sync mode is on.")]]
+  LaunchResult copyFrom(const ChunkedBuffer& source,
+                        const LaunchOptions& launch_options);
+
+  //! Return the device which the buffer is made on
+  Device* device() noexcept;
+
+  //! Fill the buffer with specified value
+  [[nodiscard("The result can have a fence when external sync mode is on.")]]
+  LaunchResult fill(ConstReference value, const LaunchOptions& launch_options);
+
+  //! Call the given function for each piece of the range split at the chunk boundaries
+  template <typename Function>
+  [[nodiscard("The result can have a fence when external sync mode is on.")]]
+  LaunchResult forEachChunk(Function&& func, const LaunchOptions& launch_options);
+
+  //! Make launch options
+  LaunchOptions makeOptions() const noexcept;
+
+  //! Map all chunks to a host
+  [[nodiscard]]
+  ChunkedMappedMemory<Type> mapMemory();
+
+  //! Map all chunks to a host
+  [[nodiscard]]
+  ChunkedMappedMemory<ConstType> mapMemory() const;
+
+  //! Return the number of chunks
+  std::size_t numOfChunks() const noexcept;
+
+  //! Set the number of elements preserving the contents
+  void setSize(const std::size_t s);
+
+  //! Return the number of elements of the buffer
+  std::size_t size() const noexcept;
+
+ private:
+  //! Make the launch options of a piece of the range
+  static LaunchOptions makePieceOptions(const LaunchOptions& launch_options,
+                                        const std::size_t source_offset,
+                                        const std::size_t dest_offset,
+                                        const std::size_t s,
+                                        const bool is_last) noexcept;
+
+  //! Check if the dest range of the given options is in the buffer
+  void validateRange(const LaunchOptions& launch_options) const;
+
+
+  zisc::pmr::vector<SharedBuffer<Type>> chunk_list_;
+  Device* device_ = nullptr;
+  BufferInitParams params_;
+  std::size_t chunk_capacity_ = 0;
+  std::size_t size_ = 0;
+};
+
+} // namespace zivc
+
+#include "chunked_buffer-inl.hpp"
+
+#endif // ZIVC_CHUNKED_BUFFER_HPP
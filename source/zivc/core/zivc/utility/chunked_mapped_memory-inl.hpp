@@ -0,0 +1,212 @@
+/*!
+  \file chunked_mapped_memory-inl.hpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2021 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZIVC_CHUNKED_MAPPED_MEMORY_INL_HPP
+#define ZIVC_CHUNKED_MAPPED_MEMORY_INL_HPP
+
+#include "chunked_mapped_memory.hpp"
+// Standard C++ library
+#include <cstddef>
+#include <utility>
+// Zivc
+#include "mapped_memory.hpp"
+#include "zivc/zivc_config.hpp"
+
+namespace zivc {
+
+/*!
+  \details The size is computed once since the chunks aren't changed
+
+  \param [in] memory_list No description.
+  \param [in] chunk_capacity No description.
+  */
+template <KernelArg T> inline
+ChunkedMappedMemory<T>::ChunkedMappedMemory(MappedMemoryList&& memory_list,
+                                            const std::size_t chunk_capacity) noexcept :
+    memory_list_{std::move(memory_list)},
+    chunk_capacity_{chunk_capacity}
+{
+  for (const MappedMemory<T>& memory : memory_list_)
+    size_ += memory.size();
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] other No description.
+  */
+template <KernelArg T> inline
+ChunkedMappedMemory<T>::ChunkedMappedMemory(ChunkedMappedMemory&& other) noexcept :
+    memory_list_{std::move(other.memory_list_)},
+    chunk_capacity_{other.chunk_capacity_},
+    size_{other.size_}
+{
+  other.size_ = 0;
+}
+
+/*!
+  \details No detailed description
+  */
+template <KernelArg T> inline
+ChunkedMappedMemory<T>::~ChunkedMappedMemory() noexcept
+{
+  unmap();
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] other No description.
+  \return No description
+  */
+template <KernelArg T> inline
+auto ChunkedMappedMemory<T>::operator=(ChunkedMappedMemory&& other) noexcept
+    -> ChunkedMappedMemory&
+{
+  unmap();
+  memory_list_ = std::move(other.memory_list_);
+  chunk_capacity_ = other.chunk_capacity_;
+  size_ = other.size_;
+  other.size_ = 0;
+  return *this;
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] index No description.
+  \return No description
+  */
+template <KernelArg T> inline
+auto ChunkedMappedMemory<T>::operator[](const std::size_t index) noexcept
+    -> Reference
+{
+  return get(index);
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] index No description.
+  \return No description
+  */
+template <KernelArg T> inline
+auto ChunkedMappedMemory<T>::operator[](const std::size_t index) const noexcept
+    -> ConstReference
+{
+  return get(index);
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] index No description.
+  \return No description
+  */
+template <KernelArg T> inline
+MappedMemory<T>& ChunkedMappedMemory<T>::chunk(const std::size_t index) noexcept
+{
+  return memory_list_[index];
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] index No description.
+  \return No description
+  */
+template <KernelArg T> inline
+const MappedMemory<T>& ChunkedMappedMemory<T>::chunk(const std::size_t index) const noexcept
+{
+  return memory_list_[index];
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] index No description.
+  \return No description
+  */
+template <KernelArg T> inline
+auto ChunkedMappedMemory<T>::get(const std::size_t index) noexcept -> Reference
+{
+  const std::size_t chunk_index = index / chunk_capacity_;
+  const std::size_t offset = index % chunk_capacity_;
+  return memory_list_[chunk_index][offset];
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] index No description.
+  \return No description
+  */
+template <KernelArg T> inline
+auto ChunkedMappedMemory<T>::get(const std::size_t index) const noexcept
+    -> ConstReference
+{
+  const std::size_t chunk_index = index / chunk_capacity_;
+  const std::size_t offset = index % chunk_capacity_;
+  return memory_list_[chunk_index][offset];
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+template <KernelArg T> inline
+std::size_t ChunkedMappedMemory<T>::numOfChunks() const noexcept
+{
+  return memory_list_.size();
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] index No description.
+  \param [in] value No description.
+  */
+template <KernelArg T> inline
+void ChunkedMappedMemory<T>::set(const std::size_t index, ConstReference value) noexcept
+{
+  get(index) = value;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+template <KernelArg T> inline
+std::size_t ChunkedMappedMemory<T>::size() const noexcept
+{
+  return size_;
+}
+
+/*!
+  \details No detailed description
+  */
+template <KernelArg T> inline
+void ChunkedMappedMemory<T>::unmap() noexcept
+{
+  for (MappedMemory<T>& memory : memory_list_)
+    memory.unmap();
+  memory_list_.clear();
+  size_ = 0;
+}
+
+} // namespace zivc
+
+#endif // ZIVC_CHUNKED_MAPPED_MEMORY_INL_HPP
@@ -0,0 +1,104 @@
+/*!
+  \file chunked_mapped_memory.hpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2021 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZIVC_CHUNKED_MAPPED_MEMORY_HPP
+#define ZIVC_CHUNKED_MAPPED_MEMORY_HPP
+
+// Standard C++ library
+#include <cstddef>
+#include <type_traits>
+// Zisc
+#include "zisc/non_copyable.hpp"
+#include "zisc/memory/std_memory_resource.hpp"
+// Zivc
+#include "mapped_memory.hpp"
+#include "zivc/zivc_config.hpp"
+
+namespace zivc {
+
+/*!
+  \brief The host mapping of all chunks of a chunked buffer
+
+  The chunks are separate allocations, so they are mapped one by one.
+  An element is accessed with the index into the whole buffer.
+
+  \tparam T No description.
+  */
+template <KernelArg T>
+class ChunkedMappedMemory : private zisc::NonCopyable<ChunkedMappedMemory<T>>
+{
+ public:
+  using Type = std::remove_volatile_t<T>;
+  using ConstType = std::add_const_t<Type>;
+  using Reference = std::add_lvalue_reference_t<Type>;
+  using ConstReference = std::add_lvalue_reference_t<ConstType>;
+  using MappedMemoryList = zisc::pmr::vector<MappedMemory<T>>;
+
+
+  //! Create a mapped memory
+  ChunkedMappedMemory(MappedMemoryList&& memory_list,
+                      const std::size_t chunk_capacity) noexcept;
+
+  //! Move data
+  ChunkedMappedMemory(ChunkedMappedMemory&& other) noexcept;
+
+  //! Destruct the managed memory
+  ~ChunkedMappedMemory() noexcept;
+
+
+  //! Move data
+  ChunkedMappedMemory& operator=(ChunkedMappedMemory&& other) noexcept;
+
+  //! Return the reference of the element by index
+  Reference operator[](const std::size_t index) noexcept;
+
+  //! Return the reference of the element by index
+  ConstReference operator[](const std::size_t index) const noexcept;
+
+
+  //! Return the mapped memory of the chunk by index
+  MappedMemory<T>& chunk(const std::size_t index) noexcept;
+
+  //! Return the mapped memory of the chunk by index
+  const MappedMemory<T>& chunk(const std::size_t index) const noexcept;
+
+  //! Return the reference of the element by index
+  Reference get(const std::size_t index) noexcept;
+
+  //! Return the reference of the element by index
+  ConstReference get(const std::size_t index) const noexcept;
+
+  //! Return the number of the mapped chunks
+  std::size_t numOfChunks() const noexcept;
+
+  //! Set a value to the managed memory at index
+  void set(const std::size_t index, ConstReference value) noexcept;
+
+  //! Return the size of the memory array
+  std::size_t size() const noexcept;
+
+  //! Unmap the managed memory
+  void unmap() noexcept;
+
+ private:
+  MappedMemoryList memory_list_;
+  std::size_t chunk_capacity_ = 0;
+  std::size_t size_ = 0;
+};
+
+} // namespace zivc
+
+#include "chunked_mapped_memory-inl.hpp"
+
+#endif // ZIVC_CHUNKED_MAPPED_MEMORY_HPP
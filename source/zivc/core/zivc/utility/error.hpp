@@ -33,6 +33,8 @@ enum class ErrorCode : int
   kInitializationFailed,
   kAvailableFenceNotFound,
   kNumOfParametersLimitExceeded,
+  kFileIoFailed,
+  kInvalidArgument,
   kVulkanInitializationFailed,
   kVulkanLibraryNotFound,
   kVulkanWindowSurfaceNotFound,
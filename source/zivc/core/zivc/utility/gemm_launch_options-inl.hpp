@@ -0,0 +1,267 @@
+/*!
+  \file gemm_launch_options-inl.hpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2021 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZIVC_GEMM_LAUNCH_OPTIONS_INL_HPP
+#define ZIVC_GEMM_LAUNCH_OPTIONS_INL_HPP
+
+#include "gemm_launch_options.hpp"
+// Standard C++ library
+#include <cstddef>
+// Zivc
+#include "launch_options.hpp"
+#include "zivc/zivc_config.hpp"
+
+namespace zivc {
+
+/*!
+  \details No detailed description
+  */
+inline
+GemmLaunchOptions::GemmLaunchOptions() noexcept
+{
+  initialize();
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] m No description.
+  \param [in] n No description.
+  \param [in] k No description.
+  */
+inline
+GemmLaunchOptions::GemmLaunchOptions(const std::size_t m,
+                                     const std::size_t n,
+                                     const std::size_t k) noexcept :
+    m_{m},
+    n_{n},
+    k_{k}
+{
+  initialize();
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] m No description.
+  \param [in] n No description.
+  \param [in] k No description.
+  \param [in] queue_index No description.
+  */
+inline
+GemmLaunchOptions::GemmLaunchOptions(const std::size_t m,
+                                     const std::size_t n,
+                                     const std::size_t k,
+                                     const uint32b queue_index) noexcept :
+    LaunchOptions(queue_index),
+    m_{m},
+    n_{n},
+    k_{k}
+{
+  initialize();
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+std::size_t GemmLaunchOptions::batchSize() const noexcept
+{
+  return batch_size_;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+std::size_t GemmLaunchOptions::k() const noexcept
+{
+  return k_;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+std::size_t GemmLaunchOptions::lda() const noexcept
+{
+  const std::size_t ld = (lda_ != 0) ? lda_ : k();
+  return ld;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+std::size_t GemmLaunchOptions::ldb() const noexcept
+{
+  const std::size_t ld = (ldb_ != 0) ? ldb_ : n();
+  return ld;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+std::size_t GemmLaunchOptions::ldc() const noexcept
+{
+  const std::size_t ld = (ldc_ != 0) ? ldc_ : n();
+  return ld;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+std::size_t GemmLaunchOptions::m() const noexcept
+{
+  return m_;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+std::size_t GemmLaunchOptions::n() const noexcept
+{
+  return n_;
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] batch_size No description.
+  */
+inline
+void GemmLaunchOptions::setBatchSize(const std::size_t batch_size) noexcept
+{
+  setBatch(batch_size, kPackedStride, kPackedStride, kPackedStride);
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] batch_size No description.
+  \param [in] stride_a No description.
+  \param [in] stride_b No description.
+  \param [in] stride_c No description.
+  */
+inline
+void GemmLaunchOptions::setBatch(const std::size_t batch_size,
+                                 const std::size_t stride_a,
+                                 const std::size_t stride_b,
+                                 const std::size_t stride_c) noexcept
+{
+  batch_size_ = batch_size;
+  stride_a_ = stride_a;
+  stride_b_ = stride_b;
+  stride_c_ = stride_c;
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] lda No description.
+  \param [in] ldb No description.
+  \param [in] ldc No description.
+  */
+inline
+void GemmLaunchOptions::setLeadingDims(const std::size_t lda,
+                                       const std::size_t ldb,
+                                       const std::size_t ldc) noexcept
+{
+  lda_ = lda;
+  ldb_ = ldb;
+  ldc_ = ldc;
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] m No description.
+  \param [in] n No description.
+  \param [in] k No description.
+  */
+inline
+void GemmLaunchOptions::setShape(const std::size_t m,
+                                 const std::size_t n,
+                                 const std::size_t k) noexcept
+{
+  m_ = m;
+  n_ = n;
+  k_ = k;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+std::size_t GemmLaunchOptions::strideA() const noexcept
+{
+  const std::size_t s = (stride_a_ != kPackedStride) ? stride_a_ : m() * lda();
+  return s;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+std::size_t GemmLaunchOptions::strideB() const noexcept
+{
+  const std::size_t s = (stride_b_ != kPackedStride) ? stride_b_ : k() * ldb();
+  return s;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+std::size_t GemmLaunchOptions::strideC() const noexcept
+{
+  const std::size_t s = (stride_c_ != kPackedStride) ? stride_c_ : m() * ldc();
+  return s;
+}
+
+/*!
+  \details No detailed description
+  */
+inline
+void GemmLaunchOptions::initialize() noexcept
+{
+  setLabel("Gemm");
+}
+
+} // namespace zivc
+
+#endif // ZIVC_GEMM_LAUNCH_OPTIONS_INL_HPP
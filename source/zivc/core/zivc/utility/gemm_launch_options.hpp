@@ -0,0 +1,126 @@
+/*!
+  \file gemm_launch_options.hpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2021 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZIVC_GEMM_LAUNCH_OPTIONS_HPP
+#define ZIVC_GEMM_LAUNCH_OPTIONS_HPP
+
+// Standard C++ library
+#include <cstddef>
+#include <limits>
+// Zivc
+#include "launch_options.hpp"
+#include "zivc/zivc_config.hpp"
+
+namespace zivc {
+
+/*!
+  \brief The shape of a general matrix multiplication C = alpha * A * B + beta * C
+
+  A is m x k, B is k x n and C is m x n. The matrices are row-major and
+  the leading dimension is the offset between the rows.
+  The batch is a sequence of matrices at a constant offset (stride) in
+  the buffer. A stride may be zero to share a matrix in the batch.
+  */
+class GemmLaunchOptions : public LaunchOptions
+{
+ public:
+  //! Initialize the launch info
+  GemmLaunchOptions() noexcept;
+
+  //! Initialize the launch info
+  GemmLaunchOptions(const std::size_t m,
+                    const std::size_t n,
+                    const std::size_t k) noexcept;
+
+  //! Initialize the launch info
+  GemmLaunchOptions(const std::size_t m,
+                    const std::size_t n,
+                    const std::size_t k,
+                    const uint32b queue_index) noexcept;
+
+
+  //! Return the number of matrices in the batch
+  std::size_t batchSize() const noexcept;
+
+  //! Return the number of columns of A and rows of B
+  std::size_t k() const noexcept;
+
+  //! Return the leading dimension of A
+  std::size_t lda() const noexcept;
+
+  //! Return the leading dimension of B
+  std::size_t ldb() const noexcept;
+
+  //! Return the leading dimension of C
+  std::size_t ldc() const noexcept;
+
+  //! Return the number of rows of A and C
+  std::size_t m() const noexcept;
+
+  //! Return the number of columns of B and C
+  std::size_t n() const noexcept;
+
+  //! Set the number of matrices in the batch. The matrices are packed
+  void setBatchSize(const std::size_t batch_size) noexcept;
+
+  //! Set the number of matrices in the batch and the offsets between them
+  void setBatch(const std::size_t batch_size,
+                const std::size_t stride_a,
+                const std::size_t stride_b,
+                const std::size_t stride_c) noexcept;
+
+  //! Set the leading dimensions. Zero means that the rows are packed
+  void setLeadingDims(const std::size_t lda,
+                      const std::size_t ldb,
+                      const std::size_t ldc) noexcept;
+
+  //! Set the shape of the multiplication
+  void setShape(const std::size_t m,
+                const std::size_t n,
+                const std::size_t k) noexcept;
+
+  //! Return the offset between the matrices A in the batch
+  std::size_t strideA() const noexcept;
+
+  //! Return the offset between the matrices B in the batch
+  std::size_t strideB() const noexcept;
+
+  //! Return the offset between the matrices C in the batch
+  std::size_t strideC() const noexcept;
+
+ private:
+  static constexpr std::size_t kPackedStride = (std::numeric_limits<std::size_t>::max)();
+
+
+  //! Initialize the options
+  void initialize() noexcept;
+
+
+  std::size_t m_ = 0;
+  std::size_t n_ = 0;
+  std::size_t k_ = 0;
+  std::size_t lda_ = 0;
+  std::size_t ldb_ = 0;
+  std::size_t ldc_ = 0;
+  std::size_t batch_size_ = 1;
+  std::size_t stride_a_ = kPackedStride;
+  std::size_t stride_b_ = kPackedStride;
+  std::size_t stride_c_ = kPackedStride;
+};
+
+} // namespace zivc
+
+#include "gemm_launch_options-inl.hpp"
+
+#endif // ZIVC_GEMM_LAUNCH_OPTIONS_HPP
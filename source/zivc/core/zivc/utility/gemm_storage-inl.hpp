@@ -0,0 +1,98 @@
+/*!
+  \file gemm_storage-inl.hpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2021 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZIVC_GEMM_STORAGE_INL_HPP
+#define ZIVC_GEMM_STORAGE_INL_HPP
+
+#include "gemm_storage.hpp"
+// Standard C++ library
+#include <cstddef>
+#include <memory>
+// Zisc
+#include "zisc/utility.hpp"
+// Zivc
+#include "zivc/kernel_common.hpp"
+#include "zivc/zivc_config.hpp"
+
+namespace zivc {
+
+/*!
+  \details No detailed description
+  */
+inline
+GemmStorage::GemmStorage() noexcept
+{
+}
+
+/*!
+  \details No detailed description
+  */
+inline
+GemmStorage::~GemmStorage() noexcept
+{
+  clear();
+}
+
+/*!
+  \details No detailed description
+  */
+inline
+void GemmStorage::clear() noexcept
+{
+  for (auto& kernel : kernel_list_)
+    kernel.reset();
+  device_ = nullptr;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+Device* GemmStorage::device() noexcept
+{
+  return device_;
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] type No description.
+  \return No description
+  */
+inline
+std::shared_ptr<KernelCommon>& GemmStorage::kernel(const KernelType type) noexcept
+{
+  const auto index = zisc::cast<std::size_t>(type);
+  return kernel_list_[index];
+}
+
+/*!
+  \details The cached kernels are released if they were made for another device
+
+  \param [in] device No description.
+  */
+inline
+void GemmStorage::setDevice(Device* device) noexcept
+{
+  if (device_ != device) {
+    clear();
+    device_ = device;
+  }
+}
+
+} // namespace zivc
+
+#endif // ZIVC_GEMM_STORAGE_INL_HPP
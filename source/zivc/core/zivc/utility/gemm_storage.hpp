@@ -0,0 +1,87 @@
+/*!
+  \file gemm_storage.hpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2021 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZIVC_GEMM_STORAGE_HPP
+#define ZIVC_GEMM_STORAGE_HPP
+
+// Standard C++ library
+#include <array>
+#include <cstddef>
+#include <memory>
+// Zisc
+#include "zisc/non_copyable.hpp"
+// Zivc
+#include "zivc/kernel_common.hpp"
+#include "zivc/zivc_config.hpp"
+
+namespace zivc {
+
+// Forward declaration
+class Device;
+
+/*!
+  \brief Kernel cache of the matrix multiplication
+
+  The kernels are kept across gemm calls and are reused
+  as long as the storage is used with the same device.
+  A gemm launch with the storage can be in flight on return,
+  so the storage must outlive the fence of the launch.
+  */
+class GemmStorage : private zisc::NonCopyable<GemmStorage>
+{
+ public:
+  //! Kernels used by the matrix multiplication
+  enum class KernelType : uint32b
+  {
+    kTile16F32 = 0,
+    kTile32F32,
+    kBlockF32,
+    kTile16F16,
+    kTile32F16,
+    kBlockF16
+  };
+
+
+  //! Initialize the storage
+  GemmStorage() noexcept;
+
+  //! Finalize the storage
+  ~GemmStorage() noexcept;
+
+
+  //! Release the kernels
+  void clear() noexcept;
+
+  //! Return the device which the storage is bound to
+  Device* device() noexcept;
+
+  //! Return the cached kernel of the given type
+  std::shared_ptr<KernelCommon>& kernel(const KernelType type) noexcept;
+
+  //! Bind the storage to the device
+  void setDevice(Device* device) noexcept;
+
+ private:
+  static constexpr std::size_t kNumOfKernels = 6;
+
+
+  std::array<std::shared_ptr<KernelCommon>, kNumOfKernels> kernel_list_;
+  Device* device_ = nullptr;
+};
+
+} // namespace zivc
+
+#include "gemm_storage-inl.hpp"
+
+#endif // ZIVC_GEMM_STORAGE_HPP
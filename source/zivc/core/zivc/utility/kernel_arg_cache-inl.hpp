@@ -517,8 +517,8 @@ constexpr std::size_t KernelArgCache<Type>::tailPaddingSize() noexcept
   \tparam kIndex No description.
   \return No description
   */
-template <KernelArg Type, typename ...Types> template <std::size_t kIndex> inline
-auto KernelArgCache<Buffer<Type>&, Types...>::get() noexcept -> CacheType<kIndex>&
+template <typename BufferT, typename ...Types> template <std::size_t kIndex> inline
+auto KernelArgCache<BufferT&, Types...>::get() noexcept -> CacheType<kIndex>&
 {
   if constexpr (kIndex == (size() - 1))
     return value_;
@@ -532,8 +532,8 @@ auto KernelArgCache<Buffer<Type>&, Types...>::get() noexcept -> CacheType<kIndex
   \tparam kIndex No description.
   \return No description
   */
-template <KernelArg Type, typename ...Types> template <std::size_t kIndex> inline
-auto KernelArgCache<Buffer<Type>&, Types...>::get() const noexcept -> const CacheType<kIndex>&
+template <typename BufferT, typename ...Types> template <std::size_t kIndex> inline
+auto KernelArgCache<BufferT&, Types...>::get() const noexcept -> const CacheType<kIndex>&
 {
   if constexpr (kIndex == (size() - 1))
     return value_;
@@ -547,8 +547,8 @@ auto KernelArgCache<Buffer<Type>&, Types...>::get() const noexcept -> const Cach
   \param [in] other No description.
   \return No description
   */
-template <KernelArg Type, typename ...Types> inline
-bool KernelArgCache<Buffer<Type>&, Types...>::isEqual(const KernelArgCache& other) const noexcept
+template <typename BufferT, typename ...Types> inline
+bool KernelArgCache<BufferT&, Types...>::isEqual(const KernelArgCache& other) const noexcept
 {
   const bool result1 = value_ == other.value_;
   const bool result2 = precedence_ == other.precedence_;
@@ -560,8 +560,8 @@ bool KernelArgCache<Buffer<Type>&, Types...>::isEqual(const KernelArgCache& othe
 
   \return No description
   */
-template <KernelArg Type, typename ...Types> inline
-constexpr bool KernelArgCache<Buffer<Type>&, Types...>::isValid() noexcept
+template <typename BufferT, typename ...Types> inline
+constexpr bool KernelArgCache<BufferT&, Types...>::isValid() noexcept
 {
   return PrecedenceCacheT::isValid();
 }
@@ -573,8 +573,8 @@ constexpr bool KernelArgCache<Buffer<Type>&, Types...>::isValid() noexcept
   \param [in] indent No description.
   \param [out] output No description.
   */
-template <KernelArg Type, typename ...Types> inline
-void KernelArgCache<Buffer<Type>&, Types...>::printTree(
+template <typename BufferT, typename ...Types> inline
+void KernelArgCache<BufferT&, Types...>::printTree(
     const std::size_t indent,
     std::ostream* output) noexcept
 {
@@ -590,8 +590,8 @@ void KernelArgCache<Buffer<Type>&, Types...>::printTree(
 
   \return No description
   */
-template <KernelArg Type, typename ...Types> inline
-constexpr std::size_t KernelArgCache<Buffer<Type>&, Types...>::size() noexcept
+template <typename BufferT, typename ...Types> inline
+constexpr std::size_t KernelArgCache<BufferT&, Types...>::size() noexcept
 {
   return kSize;
 }
@@ -602,8 +602,8 @@ constexpr std::size_t KernelArgCache<Buffer<Type>&, Types...>::size() noexcept
   \tparam kIndex No description.
   \param [in] value No description.
   */
-template <KernelArg Type, typename ...Types> template <std::size_t kIndex> inline
-void KernelArgCache<Buffer<Type>&, Types...>::set(CacheType<kIndex> value) noexcept
+template <typename BufferT, typename ...Types> template <std::size_t kIndex> inline
+void KernelArgCache<BufferT&, Types...>::set(CacheType<kIndex> value) noexcept
 {
   if constexpr (kIndex == (size() - 1))
     value_ = value;
@@ -616,8 +616,8 @@ void KernelArgCache<Buffer<Type>&, Types...>::set(CacheType<kIndex> value) noexc
 
   \return No description
   */
-template <KernelArg Type, typename ...Types> inline
-constexpr std::size_t KernelArgCache<Buffer<Type>&, Types...>::tailPaddingSize() noexcept
+template <typename BufferT, typename ...Types> inline
+constexpr std::size_t KernelArgCache<BufferT&, Types...>::tailPaddingSize() noexcept
 {
   const bool has_tail_padding = (std::alignment_of_v<BufferP> <
                                  std::alignment_of_v<PrecedenceCacheT>);
@@ -633,8 +633,8 @@ constexpr std::size_t KernelArgCache<Buffer<Type>&, Types...>::tailPaddingSize()
   \tparam kIndex No description.
   \return No description
   */
-template <KernelArg Type> template <std::size_t kIndex> inline
-auto KernelArgCache<Buffer<Type>&>::get() noexcept -> CacheType<kIndex>&
+template <typename BufferT> template <std::size_t kIndex> inline
+auto KernelArgCache<BufferT&>::get() noexcept -> CacheType<kIndex>&
 {
   if constexpr (kIndex == 0)
     return value_;
@@ -648,8 +648,8 @@ auto KernelArgCache<Buffer<Type>&>::get() noexcept -> CacheType<kIndex>&
   \tparam kIndex No description.
   \return No description
   */
-template <KernelArg Type> template <std::size_t kIndex> inline
-auto KernelArgCache<Buffer<Type>&>::get() const noexcept -> const CacheType<kIndex>&
+template <typename BufferT> template <std::size_t kIndex> inline
+auto KernelArgCache<BufferT&>::get() const noexcept -> const CacheType<kIndex>&
 {
   if constexpr (kIndex == 0)
     return value_;
@@ -663,8 +663,8 @@ auto KernelArgCache<Buffer<Type>&>::get() const noexcept -> const CacheType<kInd
   \param [in] other No description.
   \return No description
   */
-template <KernelArg Type> inline
-bool KernelArgCache<Buffer<Type>&>::isEqual(const KernelArgCache& other) const noexcept
+template <typename BufferT> inline
+bool KernelArgCache<BufferT&>::isEqual(const KernelArgCache& other) const noexcept
 {
   const bool result = value_ == other.value_;
   return result;
@@ -675,8 +675,8 @@ bool KernelArgCache<Buffer<Type>&>::isEqual(const KernelArgCache& other) const n
 
   \return No description
   */
-template <KernelArg Type> inline
-constexpr bool KernelArgCache<Buffer<Type>&>::isValid() noexcept
+template <typename BufferT> inline
+constexpr bool KernelArgCache<BufferT&>::isValid() noexcept
 {
   return true;
 }
@@ -688,8 +688,8 @@ constexpr bool KernelArgCache<Buffer<Type>&>::isValid() noexcept
   \param [in] indent No description.
   \param [out] output No description.
   */
-template <KernelArg Type> inline
-void KernelArgCache<Buffer<Type>&>::printTree(
+template <typename BufferT> inline
+void KernelArgCache<BufferT&>::printTree(
     const std::size_t indent,
     std::ostream* output) noexcept
 {
@@ -704,8 +704,8 @@ void KernelArgCache<Buffer<Type>&>::printTree(
 
   \return No description
   */
-template <KernelArg Type> inline
-constexpr std::size_t KernelArgCache<Buffer<Type>&>::size() noexcept
+template <typename BufferT> inline
+constexpr std::size_t KernelArgCache<BufferT&>::size() noexcept
 {
   return kSize;
 }
@@ -716,8 +716,8 @@ constexpr std::size_t KernelArgCache<Buffer<Type>&>::size() noexcept
   \tparam kIndex No description.
   \param [in] value No description.
   */
-template <KernelArg Type> template <std::size_t kIndex> inline
-void KernelArgCache<Buffer<Type>&>::set(CacheType<kIndex> value) noexcept
+template <typename BufferT> template <std::size_t kIndex> inline
+void KernelArgCache<BufferT&>::set(CacheType<kIndex> value) noexcept
 {
   if constexpr (kIndex == 0)
     value_ = value;
@@ -730,8 +730,8 @@ void KernelArgCache<Buffer<Type>&>::set(CacheType<kIndex> value) noexcept
 
   \return No description
   */
-template <KernelArg Type> inline
-constexpr std::size_t KernelArgCache<Buffer<Type>&>::tailPaddingSize() noexcept
+template <typename BufferT> inline
+constexpr std::size_t KernelArgCache<BufferT&>::tailPaddingSize() noexcept
 {
   return 0;
 }
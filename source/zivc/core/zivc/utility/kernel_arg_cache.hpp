@@ -371,14 +371,14 @@ class KernelArgCache<Type>
 
   No detailed description.
 
-  \tparam Type No description.
+  \tparam BufferT The buffer type, which is const qualified for a read only buffer.
   \tparam Types No description.
   */
-template <KernelArg Type, typename ...Types>
-class KernelArgCache<Buffer<Type>&, Types...>
+template <typename BufferT, typename ...Types>
+class KernelArgCache<BufferT&, Types...>
 {
   // Type aliases
-  using BufferP = std::add_pointer_t<Buffer<Type>>;
+  using BufferP = std::add_pointer_t<BufferT>;
   using PrecedenceCacheT = KernelArgCache<Types...>;
 
 
@@ -433,13 +433,13 @@ class KernelArgCache<Buffer<Type>&, Types...>
 
   No detailed description.
 
-  \tparam Type No description.
+  \tparam BufferT The buffer type, which is const qualified for a read only buffer.
   */
-template <KernelArg Type>
-class KernelArgCache<Buffer<Type>&>
+template <typename BufferT>
+class KernelArgCache<BufferT&>
 {
   // Type aliases
-  using BufferP = std::add_pointer_t<Buffer<Type>>;
+  using BufferP = std::add_pointer_t<BufferT>;
 
 
  public:
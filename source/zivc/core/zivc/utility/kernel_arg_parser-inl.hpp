@@ -137,10 +137,14 @@ class KernelArgParserImpl<Arg, RestArgs...>
       return pack;
     }
     else {
+      // A buffer of a pointer to const is taken by const reference
       using ElementT = typename ArgTypeInfo::ElementType;
+      using BufferT = std::conditional_t<ArgTypeInfo::kIsReadOnly,
+          std::add_const_t<Buffer<ElementT>>,
+          Buffer<ElementT>>;
       using ArgT = std::conditional_t<ArgTypeInfo::kIsPod,
           std::add_const_t<ElementT>,
-          std::add_lvalue_reference_t<Buffer<ElementT>>>;
+          std::add_lvalue_reference_t<BufferT>>;
       return TypePack<ArgT, Args...>{};
     }
   }
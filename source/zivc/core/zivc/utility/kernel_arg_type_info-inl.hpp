@@ -50,6 +50,7 @@ class KernelArgTypeInfo<cl::AddressSpacePointer<kASpaceType, Type>>
   static constexpr bool kIsConstant = kASpaceType == cl::AddressSpaceType::kConstant;
   static constexpr bool kIsPod = false;
   static constexpr bool kIsBuffer = kIsGlobal || kIsConstant;
+  static constexpr bool kIsReadOnly = kIsBuffer && std::is_const_v<Type>;
 
  private:
   static_assert(!std::is_pointer_v<ElementType>, "The element type is pointer.");
@@ -77,6 +78,7 @@ class KernelArgTypeInfo<Buffer<Type>>
   static constexpr bool kIsConstant = false;
   static constexpr bool kIsPod = false;
   static constexpr bool kIsBuffer = kIsGlobal || kIsConstant;
+  static constexpr bool kIsReadOnly = false;
 
  private:
   static_assert(!std::is_pointer_v<ElementType>, "The element type is pointer.");
@@ -47,6 +47,7 @@ class KernelArgTypeInfo
   static constexpr bool kIsConstant = false;
   static constexpr bool kIsPod = true;
   static constexpr bool kIsBuffer = false;
+  static constexpr bool kIsReadOnly = false;
 
  private:
   static_assert(!std::is_pointer_v<ElementType>, "The Type is pointer.");
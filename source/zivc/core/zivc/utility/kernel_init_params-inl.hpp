@@ -26,6 +26,7 @@
 // Zivc
 #include "id_data.hpp"
 #include "zivc/kernel_set.hpp"
+#include "zivc/zivc_config.hpp"
 
 namespace zivc {
 
@@ -53,6 +54,23 @@ constexpr std::size_t KernelInitParams<kDim, KSet, Args...>::dimension() noexcep
   return kDim;
 }
 
+/*!
+  \details The kernel is launched with the candidate work-group sizes on
+  the first launch and the fastest one is used. The result is saved per
+  kernel and device, so the tuning runs only once.
+  The kernel must give the same result when it's launched repeatedly
+  with the same arguments. The tuning isn't applied if the work-group size
+  is set explicitly. It has no effect on CPU
+
+  \param [in] tuning_enabled No description.
+  */
+template <std::size_t kDim, DerivedKSet KSet, typename ...Args> inline
+void KernelInitParams<kDim, KSet, Args...>::enableWorkGroupSizeTuning(
+    const bool tuning_enabled) noexcept
+{
+  work_group_size_tuning_enabled_ = tuning_enabled;
+}
+
 /*!
   \details No detailed description
 
@@ -64,6 +82,18 @@ auto KernelInitParams<kDim, KSet, Args...>::func() const noexcept -> Function
   return function_;
 }
 
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+template <std::size_t kDim, DerivedKSet KSet, typename ...Args> inline
+bool KernelInitParams<kDim, KSet, Args...>::isWorkGroupSizeTuningEnabled()
+    const noexcept
+{
+  return work_group_size_tuning_enabled_;
+}
+
 /*!
   \details No detailed description
 
@@ -127,6 +157,20 @@ void KernelInitParams<kDim, KSet, Args...>::setVulkanCommandBufferPtr(
   command_buffer_ptr_ = command_buffer_ptr;
 }
 
+/*!
+  \details The product of the size should be a multiple of the sub-group size
+  and be less than or equal to the limit of the device.
+  A CPU work-group is always a work-item, so it has no effect on CPU
+
+  \param [in] work_group_size No description.
+  */
+template <std::size_t kDim, DerivedKSet KSet, typename ...Args> inline
+void KernelInitParams<kDim, KSet, Args...>::setWorkGroupSize(
+    const std::array<uint32b, kDim>& work_group_size) noexcept
+{
+  work_group_size_ = work_group_size;
+}
+
 /*!
   \details No detailed description
 
@@ -139,6 +183,18 @@ const void* KernelInitParams<kDim, KSet, Args...>::vulkanCommandBufferPtr()
   return command_buffer_ptr_;
 }
 
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+template <std::size_t kDim, DerivedKSet KSet, typename ...Args> inline
+auto KernelInitParams<kDim, KSet, Args...>::workGroupSize() const noexcept
+    -> const std::array<uint32b, kDim>&
+{
+  return work_group_size_;
+}
+
 /*!
   \details No detailed description
   */
@@ -147,6 +203,7 @@ void KernelInitParams<kDim, KSet, Args...>::initialize(
     std::string_view kernel_name) noexcept
 {
   kernel_name_.fill('\0');
+  work_group_size_.fill(0);
   setKernelName(kernel_name);
 }
 
@@ -22,6 +22,7 @@
 // Zivc
 #include "id_data.hpp"
 #include "zivc/kernel_set.hpp"
+#include "zivc/zivc_config.hpp"
 
 namespace zivc {
 
@@ -50,9 +51,15 @@ class KernelInitParams
   //! Return the dimension of the kernel
   static constexpr std::size_t dimension() noexcept;
 
+  //! Enable the work-group size tuning on the first launch
+  void enableWorkGroupSizeTuning(const bool tuning_enabled) noexcept;
+
   //! Return the underlying function
   Function func() const noexcept;
 
+  //! Check if the work-group size tuning is enabled
+  bool isWorkGroupSizeTuningEnabled() const noexcept;
+
   //! Return the kernel name
   std::string_view kernelName() const noexcept;
 
@@ -68,9 +75,15 @@ class KernelInitParams
   //! Set a ptr to a VkCommandBuffer object
   void setVulkanCommandBufferPtr(const void* command_buffer_ptr) noexcept;
 
+  //! Set the work-group size of the kernel
+  void setWorkGroupSize(const std::array<uint32b, kDim>& work_group_size) noexcept;
+
   //! Return a ptr to a VkCommandBuffer object
   const void* vulkanCommandBufferPtr() const noexcept;
 
+  //! Return the work-group size of the kernel. Zero means the device default
+  const std::array<uint32b, kDim>& workGroupSize() const noexcept;
+
  private:
   //! Initialize parameters
   void initialize(std::string_view kernel_name) noexcept;
@@ -79,6 +92,8 @@ class KernelInitParams
   Function function_;
   IdData::NameType kernel_name_;
   const void* command_buffer_ptr_ = nullptr;
+  std::array<uint32b, kDim> work_group_size_;
+  bool work_group_size_tuning_enabled_ = false;
 };
 
 } // namespace zivc
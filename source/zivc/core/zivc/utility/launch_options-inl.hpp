@@ -97,6 +97,28 @@ uint32b LaunchOptions::queueIndex() const noexcept
   return queue_index_;
 }
 
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+QueuePriority LaunchOptions::queuePriority() const noexcept
+{
+  return zisc::cast<QueuePriority>(queue_priority_);
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+QueueSelection LaunchOptions::queueSelection() const noexcept
+{
+  return zisc::cast<QueueSelection>(queue_selection_);
+}
+
 /*!
   \details No detailed description
 
@@ -141,6 +163,28 @@ void LaunchOptions::setQueueIndex(const uint32b queue_index) noexcept
   queue_index_ = queue_index;
 }
 
+/*!
+  \details The queue index is taken from the queues of the priority
+
+  \param [in] priority No description.
+  */
+inline
+void LaunchOptions::setQueuePriority(const QueuePriority priority) noexcept
+{
+  queue_priority_ = zisc::cast<uint8b>(priority);
+}
+
+/*!
+  \details The queue index is ignored unless the selection is kFixed
+
+  \param [in] selection No description.
+  */
+inline
+void LaunchOptions::setQueueSelection(const QueueSelection selection) noexcept
+{
+  queue_selection_ = zisc::cast<uint8b>(selection);
+}
+
 /*!
   \details No detailed description
   */
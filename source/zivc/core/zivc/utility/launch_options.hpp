@@ -21,6 +21,7 @@
 #include <string_view>
 #include <type_traits>
 // Zisc
+#include "zisc/utility.hpp"
 #include "zisc/zisc_config.hpp"
 // Zivc
 #include "id_data.hpp"
@@ -55,12 +56,24 @@ class LaunchOptions
   //! Return the queue index
   uint32b queueIndex() const noexcept;
 
+  //! Return the priority of the queue
+  QueuePriority queuePriority() const noexcept;
+
+  //! Return how the queue is selected
+  QueueSelection queueSelection() const noexcept;
+
   //! Set external sync mode
   void setExternalSyncMode(const bool is_active) noexcept;
 
   //! Set the queue index which is used for a kernel execution
   void setQueueIndex(const uint32b queue_index) noexcept;
 
+  //! Set the priority of the queue which is used for a kernel execution
+  void setQueuePriority(const QueuePriority priority) noexcept;
+
+  //! Set how the queue is selected
+  void setQueueSelection(const QueueSelection selection) noexcept;
+
   //! Set the label of the launching
   void setLabel(const std::string_view launch_label) noexcept;
 
@@ -76,7 +89,9 @@ class LaunchOptions
   std::array<float, 4> label_color_{1.0f, 1.0f, 1.0f, 1.0f};
   uint32b queue_index_ = 0;
   uint8b is_external_sync_mode_ = zisc::kFalse;
-  [[maybe_unused]] Padding<3> pad_;
+  uint8b queue_selection_ = zisc::cast<uint8b>(QueueSelection::kFixed);
+  uint8b queue_priority_ = zisc::cast<uint8b>(QueuePriority::kNormal);
+  [[maybe_unused]] Padding<1> pad_;
 };
 
 } // namespace zivc
@@ -33,6 +33,7 @@ namespace zivc {
   */
 inline
 LaunchResult::LaunchResult() noexcept :
+    queue_index_{0},
     is_async_{zisc::kFalse}
 {
 }
@@ -45,6 +46,7 @@ LaunchResult::LaunchResult() noexcept :
 inline
 LaunchResult::LaunchResult(LaunchResult&& other) noexcept :
     fence_{std::move(other.fence_)},
+    queue_index_{other.queue_index_},
     is_async_{other.is_async_}
 {
 }
@@ -67,6 +69,7 @@ inline
 LaunchResult& LaunchResult::operator=(LaunchResult&& other) noexcept
 {
   fence_ = std::move(other.fence_);
+  queue_index_ = other.queue_index_;
   is_async_ = other.is_async_;
   return *this;
 }
@@ -105,6 +108,17 @@ bool LaunchResult::isAsync() const noexcept
   return result;
 }
 
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+uint32b LaunchResult::queueIndex() const noexcept
+{
+  return queue_index_;
+}
+
 /*!
   \details No detailed description
 
@@ -116,6 +130,17 @@ void LaunchResult::setAsync(const bool is_async) noexcept
   is_async_ = is_async ? zisc::kTrue : zisc::kFalse;
 }
 
+/*!
+  \details No detailed description
+
+  \param [in] queue_index No description.
+  */
+inline
+void LaunchResult::setQueueIndex(const uint32b queue_index) noexcept
+{
+  queue_index_ = queue_index;
+}
+
 } // namespace zivc
 
 #endif // ZIVC_LAUNCH_RESULT_INL_HPP
@@ -60,13 +60,20 @@ class LaunchResult : private zisc::NonCopyable<LaunchResult>
   //! Check whether the execution is asyncronous
   bool isAsync() const noexcept;
 
+  //! Return the index of the queue which the execution is submitted to
+  uint32b queueIndex() const noexcept;
+
   //! Set async mode
   void setAsync(const bool is_async) noexcept;
 
+  //! Set the index of the queue which the execution is submitted to
+  void setQueueIndex(const uint32b queue_index) noexcept;
+
  private:
   Fence fence_;
+  uint32b queue_index_;
   uint8b is_async_;
-  [[maybe_unused]] std::array<uint8b, std::alignment_of_v<Fence> - 1> padding_;
+  [[maybe_unused]] std::array<uint8b, 3> padding_;
 };
 
 } // namespace zivc
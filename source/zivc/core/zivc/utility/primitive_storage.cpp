@@ -0,0 +1,53 @@
+/*!
+  \file primitive_storage.cpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2021 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#include "primitive_storage.hpp"
+// Standard C++ library
+#include <cstddef>
+// Zisc
+#include "zisc/error.hpp"
+// Zivc
+#include "buffer_init_params.hpp"
+#include "zivc/buffer.hpp"
+#include "zivc/device.hpp"
+#include "zivc/zivc.hpp"
+#include "zivc/zivc_config.hpp"
+
+namespace zivc {
+
+/*!
+  \details The storage must be bound to a device before.
+  The buffer only grows. The launches in flight are waited for
+  before the buffer grows since the old memory is released
+
+  \param [in] size No description.
+  \return No description
+  */
+Buffer<uint32b>* PrimitiveStorage::statusBuffer(const std::size_t size)
+{
+  ZISC_ASSERT(device_ != nullptr, "The storage isn't bound to a device.");
+  if (!status_) {
+    const BufferInitParams params{BufferUsage::kDeviceOnly};
+    status_ = makeBuffer<uint32b>(device_, params);
+    status_->setName("PrimitiveStorage");
+  }
+  if (status_->size() < size) {
+    if (0 < status_->size())
+      device_->waitForCompletion();
+    status_->setSize(size);
+  }
+  return status_.get();
+}
+
+} // namespace zivc
@@ -0,0 +1,107 @@
+/*!
+  \file primitive_storage.hpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2021 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZIVC_PRIMITIVE_STORAGE_HPP
+#define ZIVC_PRIMITIVE_STORAGE_HPP
+
+// Standard C++ library
+#include <array>
+#include <cstddef>
+#include <memory>
+// Zisc
+#include "zisc/non_copyable.hpp"
+// Zivc
+#include "zivc/buffer.hpp"
+#include "zivc/kernel_common.hpp"
+#include "zivc/zivc_config.hpp"
+
+namespace zivc {
+
+// Forward declaration
+class Device;
+
+/*!
+  \brief Kernel cache and look-back status of the device-wide primitives
+
+  The kernels and the status buffer are kept across primitive calls and
+  are reused as long as the storage is used with the same device.
+  A launch with the storage can be in flight on return,
+  so the storage must outlive the fence of the launch.
+  The launches with the storage are ordered only if
+  they are submitted to the same queue.
+  */
+class PrimitiveStorage : private zisc::NonCopyable<PrimitiveStorage>
+{
+ public:
+  //! Kernels used by the primitives. The element types are in the order I32, U32 and F32
+  enum class KernelType : uint32b
+  {
+    kCompactI32 = 0,
+    kCompactU32,
+    kCompactF32,
+    kConvertF32ToF16,
+    kConvertF16ToF32,
+    kConvertF32ToBf16,
+    kConvertBf16ToF32,
+    kHistogramI32,
+    kHistogramU32,
+    kHistogramF32,
+    kRandomU32,
+    kRandomUniformF32,
+    kRandomNormalF32,
+    kReduceI32,
+    kReduceU32,
+    kReduceF32,
+    kScanI32,
+    kScanU32,
+    kScanF32
+  };
+
+
+  //! Initialize the storage
+  PrimitiveStorage() noexcept;
+
+  //! Finalize the storage
+  ~PrimitiveStorage() noexcept;
+
+
+  //! Release the status buffer and kernels
+  void clear() noexcept;
+
+  //! Return the device which the storage is bound to
+  Device* device() noexcept;
+
+  //! Return the cached kernel of the given type
+  std::shared_ptr<KernelCommon>& kernel(const KernelType type) noexcept;
+
+  //! Bind the storage to the device
+  void setDevice(Device* device) noexcept;
+
+  //! Return the status buffer of the look-back which has the given number of elements at least
+  Buffer<uint32b>* statusBuffer(const std::size_t size);
+
+ private:
+  static constexpr std::size_t kNumOfKernels = 19;
+
+
+  std::array<std::shared_ptr<KernelCommon>, kNumOfKernels> kernel_list_;
+  SharedBuffer<uint32b> status_;
+  Device* device_ = nullptr;
+};
+
+} // namespace zivc
+
+#include "primitive_storage-inl.hpp"
+
+#endif // ZIVC_PRIMITIVE_STORAGE_HPP
@@ -135,6 +135,18 @@ std::size_t ReinterpBuffer<Derived, T>::capacityInBytes() const noexcept
   return b->capacityInBytes();
 }
 
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+template <DerivedBuffer Derived, KernelArg T> inline
+uint64b ReinterpBuffer<Derived, T>::deviceAddress() const noexcept
+{
+  auto b = internalBuffer();
+  return b->deviceAddress();
+}
+
 /*!
   \details No detailed description
 
@@ -282,6 +294,27 @@ const void* ReinterpBuffer<Derived, T>::rawBufferData() const noexcept
   return b->rawBufferData();
 }
 
+/*!
+  \details No detailed description
+
+  \param [in] s No description.
+  \param [in] launch_options No description.
+  */
+template <DerivedBuffer Derived, KernelArg T> inline
+void ReinterpBuffer<Derived, T>::reserve(const std::size_t s,
+                                         const zivc::LaunchOptions& launch_options)
+{
+  if constexpr (std::is_const_v<BufferT>) {
+    ZISC_ASSERT(false, "'reserve' cannot be called with const qualified buffer.");
+  }
+  else {
+    auto b = internalBuffer();
+    const std::size_t type_size = b->typeSize();
+    const std::size_t new_cap = (sizeof(Type) * s + type_size - 1) / type_size;
+    b->reserve(new_cap, launch_options);
+  }
+}
+
 /*!
   \details No detailed description
   */
@@ -69,6 +69,9 @@ class ReinterpBuffer : public Buffer<T>
   //! Return the capacity of the buffer in bytes
   std::size_t capacityInBytes() const noexcept override;
 
+  //! Return the device address of the buffer memory
+  uint64b deviceAddress() const noexcept override;
+
   //! Return the parent pointer
   ZivcObject* getParent() noexcept override;
 
@@ -115,6 +118,10 @@ class ReinterpBuffer : public Buffer<T>
   //! Return the underlying buffer data
   const void* rawBufferData() const noexcept override;
 
+  //! Reserve the memory for the given number of elements preserving the contents
+  void reserve(const std::size_t s,
+               const zivc::LaunchOptions& launch_options) override;
+
   //! Change the number of elements
   void setSize(const std::size_t s) override;
 
@@ -0,0 +1,101 @@
+/*!
+  \file sort_storage-inl.hpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2021 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZIVC_SORT_STORAGE_INL_HPP
+#define ZIVC_SORT_STORAGE_INL_HPP
+
+#include "sort_storage.hpp"
+// Standard C++ library
+#include <cstddef>
+#include <memory>
+// Zisc
+#include "zisc/utility.hpp"
+// Zivc
+#include "zivc/kernel_common.hpp"
+#include "zivc/zivc_config.hpp"
+
+namespace zivc {
+
+/*!
+  \details No detailed description
+  */
+inline
+SortStorage::SortStorage() noexcept
+{
+}
+
+/*!
+  \details No detailed description
+  */
+inline
+SortStorage::~SortStorage() noexcept
+{
+  clear();
+}
+
+/*!
+  \details No detailed description
+  */
+inline
+void SortStorage::clear() noexcept
+{
+  for (auto& kernel : kernel_list_)
+    kernel.reset();
+  for (auto& buffer : buffer_list_)
+    buffer.reset();
+  device_ = nullptr;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+Device* SortStorage::device() noexcept
+{
+  return device_;
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] type No description.
+  \return No description
+  */
+inline
+std::shared_ptr<KernelCommon>& SortStorage::kernel(const KernelType type) noexcept
+{
+  const auto index = zisc::cast<std::size_t>(type);
+  return kernel_list_[index];
+}
+
+/*!
+  \details The cached buffers and kernels are released if they were made
+  for another device
+
+  \param [in] device No description.
+  */
+inline
+void SortStorage::setDevice(Device* device) noexcept
+{
+  if (device_ != device) {
+    clear();
+    device_ = device;
+  }
+}
+
+} // namespace zivc
+
+#endif // ZIVC_SORT_STORAGE_INL_HPP
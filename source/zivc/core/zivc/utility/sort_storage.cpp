@@ -0,0 +1,67 @@
+/*!
+  \file sort_storage.cpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2021 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#include "sort_storage.hpp"
+// Standard C++ library
+#include <cstddef>
+// Zisc
+#include "zisc/error.hpp"
+#include "zisc/utility.hpp"
+// Zivc
+#include "buffer_init_params.hpp"
+#include "zivc/buffer.hpp"
+#include "zivc/device.hpp"
+#include "zivc/zivc.hpp"
+#include "zivc/zivc_config.hpp"
+
+namespace zivc {
+
+/*!
+  \details The storage must be bound to a device before
+
+  \param [in] type No description.
+  \param [in] size No description.
+  \return No description
+  */
+Buffer<uint32b>* SortStorage::buffer(const BufferType type, const std::size_t size)
+{
+  ZISC_ASSERT(device_ != nullptr, "The storage isn't bound to a device.");
+  const auto index = zisc::cast<std::size_t>(type);
+  SharedBuffer<uint32b>& buffer = buffer_list_[index];
+  if (!buffer) {
+    const BufferInitParams params{BufferUsage::kDeviceOnly};
+    buffer = makeBuffer<uint32b>(device_, params);
+    buffer->setName("SortStorage");
+  }
+  if (buffer->size() < size)
+    buffer->setSize(size);
+  return buffer.get();
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+std::size_t SortStorage::sizeInBytes() const noexcept
+{
+  std::size_t s = 0;
+  for (const auto& buffer : buffer_list_) {
+    if (buffer)
+      s += sizeof(uint32b) * buffer->size();
+  }
+  return s;
+}
+
+} // namespace zivc
@@ -0,0 +1,106 @@
+/*!
+  \file sort_storage.hpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2021 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZIVC_SORT_STORAGE_HPP
+#define ZIVC_SORT_STORAGE_HPP
+
+// Standard C++ library
+#include <array>
+#include <cstddef>
+#include <memory>
+// Zisc
+#include "zisc/non_copyable.hpp"
+// Zivc
+#include "zivc/buffer.hpp"
+#include "zivc/kernel_common.hpp"
+#include "zivc/zivc_config.hpp"
+
+namespace zivc {
+
+// Forward declaration
+class Device;
+
+/*!
+  \brief Temporary storage of the radix sort
+
+  The buffers and the kernels are kept across sort calls and are reused
+  as long as the storage is used with the same device.
+  The buffers only grow.
+  */
+class SortStorage : private zisc::NonCopyable<SortStorage>
+{
+ public:
+  //! Temporary buffers used by the sort
+  enum class BufferType : uint32b
+  {
+    kKey = 0,
+    kValue,
+    kSegment0,
+    kSegment1,
+    kHistogram,
+    kStatus
+  };
+
+  //! Kernels used by the sort
+  enum class KernelType : uint32b
+  {
+    kHistogram32 = 0,
+    kHistogram64,
+    kScatter32,
+    kScatter64,
+    kSegment,
+    kScan
+  };
+
+
+  //! Initialize the storage
+  SortStorage() noexcept;
+
+  //! Finalize the storage
+  ~SortStorage() noexcept;
+
+
+  //! Return the temporary buffer which has the given number of elements at least
+  Buffer<uint32b>* buffer(const BufferType type, const std::size_t size);
+
+  //! Release the temporary buffers and kernels
+  void clear() noexcept;
+
+  //! Return the device which the storage is bound to
+  Device* device() noexcept;
+
+  //! Return the cached kernel of the given type
+  std::shared_ptr<KernelCommon>& kernel(const KernelType type) noexcept;
+
+  //! Bind the storage to the device
+  void setDevice(Device* device) noexcept;
+
+  //! Return the total size of the temporary buffers in bytes
+  std::size_t sizeInBytes() const noexcept;
+
+ private:
+  static constexpr std::size_t kNumOfBuffers = 6;
+  static constexpr std::size_t kNumOfKernels = 6;
+
+
+  std::array<SharedBuffer<uint32b>, kNumOfBuffers> buffer_list_;
+  std::array<std::shared_ptr<KernelCommon>, kNumOfKernels> kernel_list_;
+  Device* device_ = nullptr;
+};
+
+} // namespace zivc
+
+#include "sort_storage-inl.hpp"
+
+#endif // ZIVC_SORT_STORAGE_HPP
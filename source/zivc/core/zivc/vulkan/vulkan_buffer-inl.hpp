@@ -47,6 +47,7 @@
 #include "zivc/utility/id_data.hpp"
 #include "zivc/utility/error.hpp"
 #include "zivc/utility/fence.hpp"
+#include "zivc/utility/launch_options.hpp"
 #include "zivc/utility/launch_result.hpp"
 #include "zivc/utility/mapped_memory.hpp"
 #include "zivc/utility/zivc_object.hpp"
@@ -138,28 +139,6 @@ std::size_t VulkanBuffer<T>::capacityInBytes() const noexcept
   return c;
 }
 
-/*!
-  \details No detailed description
-
-  \return No description
-  */
-template <KernelArg T> inline
-VkCommandBuffer& VulkanBuffer<T>::commandBuffer() noexcept
-{
-  return rawBuffer().command_buffer_;
-}
-
-/*!
-  \details No detailed description
-
-  \return No description
-  */
-template <KernelArg T> inline
-const VkCommandBuffer& VulkanBuffer<T>::commandBuffer() const noexcept
-{
-  return rawBuffer().command_buffer_;
-}
-
 /*!
   \details No detailed description
 
@@ -193,6 +172,19 @@ VkBufferUsageFlagBits VulkanBuffer<T>::descriptorTypeVk() const noexcept
   return flag;
 }
 
+/*!
+  \details Zero is returned if the device doesn't enable buffer device address.
+  The address is queried when the memory is allocated,
+  so a launch doesn't query it
+
+  \return No description
+  */
+template <KernelArg T> inline
+uint64b VulkanBuffer<T>::deviceAddress() const noexcept
+{
+  return rawBuffer().device_address_;
+}
+
 /*!
   \details No detailed description
 
@@ -315,6 +307,75 @@ const void* VulkanBuffer<T>::rawBufferData() const noexcept
   return std::addressof(rawBuffer());
 }
 
+/*!
+  \details The contents are copied into the new memory on the device,
+  so no host round trip is needed. The copy is submitted to the queue of
+  the launch options, so it's ordered after the commands on the queue
+  which write the buffer. The buffer must not be used by the commands
+  in flight on the other queues since the old memory is released.
+  Only the copy is waited for regardless of the external sync mode.
+  The new memory is released if the copy fails
+
+  \param [in] s No description.
+  \param [in] launch_options No description.
+  */
+template <KernelArg T> inline
+void VulkanBuffer<T>::reserve(const std::size_t s,
+                              const zivc::LaunchOptions& launch_options)
+{
+  if (s <= Buffer<T>::capacity())
+    return;
+
+  VulkanDevice& device = parentImpl();
+  const VulkanBufferImpl impl{std::addressof(device)};
+  BufferData new_data{};
+  impl.allocateMemory(sizeof(Type) * s,
+                      Buffer<T>::usage(),
+                      descriptorTypeVk(),
+                      std::addressof(Buffer<T>::id()),
+                      std::addressof(new_data.buffer_),
+                      std::addressof(new_data.vm_allocation_),
+                      std::addressof(new_data.vm_alloc_info_));
+  // Copy the contents into the new memory
+  if (0 < size_) {
+    try {
+      const uint32b queue_index = device.selectQueueIndex(launch_options);
+      VkCommandBuffer command = device.acquireCommandBuffer();
+      {
+        constexpr auto flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+        auto record_region = device.makeCmdRecord(command, flags);
+        auto debug_region = device.makeCmdDebugLabel(command, launch_options);
+        const VkBufferCopy copy_region{0, 0, sizeInBytes()};
+        impl.copyCmd(command, buffer(), new_data.buffer_, copy_region);
+      }
+      constexpr VulkanDeviceCapability cap = VulkanDeviceCapability::kCompute;
+      uint64b timeline_value = 0;
+      {
+        auto queue_lock = device.lockQueue(queue_index);
+        timeline_value = device.submit(command, cap, queue_index, Fence{});
+      }
+      device.releaseCommandBuffer(command, queue_index, timeline_value);
+      device.waitForTimeline(queue_index, timeline_value);
+    }
+    catch (...) {
+      impl.deallocateMemory(std::addressof(new_data.buffer_),
+                            std::addressof(new_data.vm_allocation_),
+                            std::addressof(new_data.vm_alloc_info_));
+      throw;
+    }
+  }
+  impl.deallocateMemory(std::addressof(buffer()),
+                        std::addressof(allocation()),
+                        std::addressof(rawBuffer().vm_alloc_info_));
+  rawBuffer().buffer_ = new_data.buffer_;
+  rawBuffer().vm_allocation_ = new_data.vm_allocation_;
+  rawBuffer().vm_alloc_info_ = new_data.vm_alloc_info_;
+  updateAllocationData();
+  if (!isInternal())
+    initFillKernel();
+  ZivcObject::updateDebugInfo();
+}
+
 /*!
   \details No detailed description
 
@@ -335,10 +396,9 @@ void VulkanBuffer<T>::setSize(const std::size_t s)
                         std::addressof(buffer()),
                         std::addressof(allocation()),
                         std::addressof(rawBuffer().vm_alloc_info_));
-    if (!isInternal()) {
-      initCommandBuffer();
+    updateAllocationData();
+    if (!isInternal())
       initFillKernel();
-    }
     ZivcObject::updateDebugInfo();
   }
   size_ = s;
@@ -356,6 +416,19 @@ std::size_t VulkanBuffer<T>::sizeInBytes() const noexcept
   return s;
 }
 
+/*!
+  \details The device address and the allocation id are updated.
+  The allocation id identifies the memory even if the handle is reused,
+  so kernels can check if their descriptors refer to the current memory
+  */
+template <KernelArg T> inline
+void VulkanBuffer<T>::updateAllocationData() noexcept
+{
+  auto& device = parentImpl();
+  rawBuffer().device_address_ = device.getBufferDeviceAddress(buffer());
+  rawBuffer().allocation_id_ = device.issueBufferAllocationId();
+}
+
 /*!
   \details No detailed description
   */
@@ -383,6 +456,8 @@ void VulkanBuffer<T>::destroyData() noexcept
                           std::addressof(rawBuffer().vm_alloc_info_));
     rawBuffer().buffer_ = ZIVC_VK_NULL_HANDLE;
     rawBuffer().vm_allocation_ = ZIVC_VK_NULL_HANDLE;
+    rawBuffer().device_address_ = 0;
+    rawBuffer().allocation_id_ = 0;
     size_ = 0;
   }
 }
@@ -420,14 +495,6 @@ void VulkanBuffer<T>::updateDebugInfoImpl() noexcept
   if (buffer() != ZIVC_VK_NULL_HANDLE) {
     device.setDebugInfo(VK_OBJECT_TYPE_BUFFER, buffer(), buffer_name, this);
   }
-  if (rawBuffer().command_buffer_ != ZIVC_VK_NULL_HANDLE) {
-    IdData::NameType obj_name{""};
-    const std::string_view suffix{"_commandbuffer"};
-    copyStr(buffer_name, obj_name.data());
-    concatStr(suffix, obj_name.data());
-    const std::string name = obj_name.data();
-    device.setDebugInfo(VK_OBJECT_TYPE_COMMAND_BUFFER, rawBuffer().command_buffer_, name, this);
-  }
   if (rawBuffer().fill_kernel_) {
     IdData::NameType obj_name{""};
     const std::string_view suffix{"_fillkernel"};
@@ -485,8 +552,7 @@ LaunchResult VulkanBuffer<T>::copyOnDevice(
   const auto& src_data = *zisc::cast<const BufferData*>(source.rawBufferData());
   auto& dst_data = *zisc::cast<BufferData*>(dest->rawBufferData());
 
-  VkCommandBuffer command = dest->isDeviceLocal() ? dst_data.command_buffer_
-                                                  : src_data.command_buffer_;
+  VkCommandBuffer command = device.acquireCommandBuffer();
   {
     constexpr auto flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
     auto record_region = device.makeCmdRecord(command, flags);
@@ -504,11 +570,18 @@ LaunchResult VulkanBuffer<T>::copyOnDevice(
   // Submit the recorded commands
   {
     constexpr VulkanDeviceCapability cap = VulkanDeviceCapability::kCompute;
-    VkQueue q = device.getQueue(cap, launch_options.queueIndex());
+    const uint32b queue_index = device.selectQueueIndex(launch_options);
+    VkQueue q = device.getQueue(cap, queue_index);
     Fence& fence = result.fence();
     fence.setDevice(launch_options.isExternalSyncMode() ? &device : nullptr);
-    auto debug_region = device.makeQueueDebugLabel(q, launch_options);
-    device.submit(command, q, fence);
+    uint64b timeline_value = 0;
+    {
+      auto queue_lock = device.lockQueue(queue_index);
+      auto debug_region = device.makeQueueDebugLabel(q, launch_options);
+      timeline_value = device.submit(command, cap, queue_index, fence);
+    }
+    device.releaseCommandBuffer(command, queue_index, timeline_value);
+    result.setQueueIndex(queue_index);
   }
   result.setAsync(true);
   return result;
@@ -559,7 +632,7 @@ LaunchResult VulkanBuffer<T>::fillFastOnDevice(
   // Create a data for fill
   const uint32b data = makeDataForFillFast(value);
   auto& dst_data = *zisc::cast<BufferData*>(dest->rawBufferData());
-  VkCommandBuffer command = dst_data.command_buffer_;
+  VkCommandBuffer command = device.acquireCommandBuffer();
   // Record commands
   {
     constexpr auto flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
@@ -577,11 +650,18 @@ LaunchResult VulkanBuffer<T>::fillFastOnDevice(
   // Submit the recorded commands
   {
     constexpr VulkanDeviceCapability cap = VulkanDeviceCapability::kCompute;
-    VkQueue q = device.getQueue(cap, launch_options.queueIndex());
+    const uint32b queue_index = device.selectQueueIndex(launch_options);
+    VkQueue q = device.getQueue(cap, queue_index);
     Fence& fence = result.fence();
     fence.setDevice(launch_options.isExternalSyncMode() ? &device : nullptr);
-    auto debug_region = device.makeQueueDebugLabel(q, launch_options);
-    device.submit(command, q, fence);
+    uint64b timeline_value = 0;
+    {
+      auto queue_lock = device.lockQueue(queue_index);
+      auto debug_region = device.makeQueueDebugLabel(q, launch_options);
+      timeline_value = device.submit(command, cap, queue_index, fence);
+    }
+    device.releaseCommandBuffer(command, queue_index, timeline_value);
+    result.setQueueIndex(queue_index);
   }
   result.setAsync(true);
   return result;
@@ -689,18 +769,6 @@ bool VulkanBuffer<T>::hasMemoryProperty(const VkMemoryPropertyFlagBits flag) con
   return has_property;
 }
 
-/*!
-  \details No detailed description
-  */
-template <KernelArg T> inline
-void VulkanBuffer<T>::initCommandBuffer()
-{
-  if ((commandBuffer() == ZIVC_VK_NULL_HANDLE) && isDeviceLocal()) {
-    auto& device = parentImpl();
-    rawBuffer().command_buffer_ = device.makeCommandBuffer();
-  }
-}
-
 /*!
   \details No detailed description
   */
@@ -709,9 +777,8 @@ void VulkanBuffer<T>::initFillKernel()
 {
   VulkanDevice& device = parentImpl();
   if (!rawBuffer().fill_kernel_ && isDeviceLocal()) {
-    ZISC_ASSERT(commandBuffer() != ZIVC_VK_NULL_HANDLE, "Command buffer is null.");
     VulkanBufferImpl impl{std::addressof(device)};
-    rawBuffer().fill_kernel_ = impl.makeFillKernel<T>(commandBuffer());
+    rawBuffer().fill_kernel_ = impl.makeFillKernel<T>();
   }
   if (!rawBuffer().fill_data_ && isDeviceLocal()) {
     BufferInitParams params{BufferUsage::kDeviceToHost};
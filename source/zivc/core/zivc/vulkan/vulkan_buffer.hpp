@@ -63,7 +63,8 @@ class VulkanBuffer : public Buffer<T>
     VkBuffer buffer_ = ZIVC_VK_NULL_HANDLE;
     VmaAllocation vm_allocation_ = ZIVC_VK_NULL_HANDLE;
     VmaAllocationInfo vm_alloc_info_;
-    VkCommandBuffer command_buffer_ = ZIVC_VK_NULL_HANDLE;
+    uint64b device_address_ = 0;
+    uint64b allocation_id_ = 0;
     SharedKernelCommon fill_kernel_;
     SharedBuffer<uint8b> fill_data_;
     DescriptorType desc_type_ = DescriptorType::kStorage;
@@ -96,18 +97,15 @@ class VulkanBuffer : public Buffer<T>
   //! Return the capacity of the buffer in bytes
   std::size_t capacityInBytes() const noexcept override;
 
-  //! Return the command buffer reference
-  VkCommandBuffer& commandBuffer() noexcept;
-
-  //! Return the command buffer reference
-  const VkCommandBuffer& commandBuffer() const noexcept;
-
   //! Return the underlying descriptor type
   DescriptorType descriptorType() const noexcept;
 
   //! Return the underlying descriptor type
   VkBufferUsageFlagBits descriptorTypeVk() const noexcept;
 
+  //! Return the device address of the buffer memory
+  uint64b deviceAddress() const noexcept override;
+
   //! Return the index of used heap
   std::size_t heapIndex() const noexcept override;
 
@@ -139,6 +137,10 @@ class VulkanBuffer : public Buffer<T>
   //! Return the underlying buffer data
   const void* rawBufferData() const noexcept override;
 
+  //! Reserve the memory for the given number of elements preserving the contents
+  void reserve(const std::size_t s,
+               const zivc::LaunchOptions& launch_options) override;
+
   //! Set the descriptor type
   void setDescriptorType(const DescriptorType type) noexcept;
 
@@ -215,9 +217,6 @@ class VulkanBuffer : public Buffer<T>
   //! Check if the buffer has the given memory property flag
   bool hasMemoryProperty(const VkMemoryPropertyFlagBits flag) const noexcept;
 
-  //! Initialize the command buffer
-  void initCommandBuffer();
-
   //! Initialize the fill kernel
   void initFillKernel();
 
@@ -236,6 +235,9 @@ class VulkanBuffer : public Buffer<T>
   //! Return the device
   const VulkanDevice& parentImpl() const noexcept;
 
+  //! Update the cached data of the underlying memory allocation
+  void updateAllocationData() noexcept;
+
 
   BufferData buffer_data_;
   std::size_t size_ = 0;
@@ -97,31 +97,29 @@ LaunchResult VulkanBufferImpl::fill(KernelCommon* fill_kernel,
   \details No detailed description
 
   \tparam Type No description.
-  \param [in] command_buffer No description.
   \return No description
   */
 template <KernelArg Type> inline
-std::shared_ptr<KernelCommon> VulkanBufferImpl::makeFillKernel(
-    const VkCommandBuffer& command_buffer)
+std::shared_ptr<KernelCommon> VulkanBufferImpl::makeFillKernel()
 {
   constexpr std::size_t data_size = sizeof(Type);
   constexpr FillUnitSize unit_size = getFillUnitSize(data_size);
   std::shared_ptr<KernelCommon> kernel;
   switch (unit_size) {
    case FillUnitSize::k8:
-    kernel = makeFillU8Kernel(command_buffer);
+    kernel = makeFillU8Kernel();
     break;
    case FillUnitSize::k16:
-    kernel = makeFillU16Kernel(command_buffer);
+    kernel = makeFillU16Kernel();
     break;
    case FillUnitSize::k32:
-    kernel = makeFillU32Kernel(command_buffer);
+    kernel = makeFillU32Kernel();
     break;
    case FillUnitSize::k64:
-    kernel = makeFillU64Kernel(command_buffer);
+    kernel = makeFillU64Kernel();
     break;
    case FillUnitSize::k128:
-    kernel = makeFillU128Kernel(command_buffer);
+    kernel = makeFillU128Kernel();
     break;
    default:
     ZISC_ASSERT(false, "Unsupported fill size is specified: ", data_size);
@@ -131,7 +129,12 @@ std::shared_ptr<KernelCommon> VulkanBufferImpl::makeFillKernel(
 }
 
 /*!
-  \details No detailed description
+  \details The unit is the largest of 16, 8, 4, 2 and 1 bytes which
+  divides the size of the value type, so the value is written in whole units.
+  The u8 and u16 kernels are used not only for 1-byte and 2-byte types
+  but also for any type whose size isn't a multiple of 4,
+  e.g. a 3-byte type is filled with the u8 kernel and
+  a 6-byte type is filled with the u16 kernel
 
   \param [in] size No description.
   \return No description
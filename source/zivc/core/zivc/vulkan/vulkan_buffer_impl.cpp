@@ -41,17 +41,13 @@ namespace {
 
   \tparam Params No description.
   \param [in] device No description.
-  \param [in] command_buffer No description.
   \param [in] params No description.
   \return No description
   */
 template <typename Params>
 [[nodiscard]]
-auto makeFillKernelImpl(zivc::VulkanDevice* device,
-                        const VkCommandBuffer& command_buffer,
-                        Params& params)
+auto makeFillKernelImpl(zivc::VulkanDevice* device, Params& params)
 {
-  params.setVulkanCommandBufferPtr(std::addressof(command_buffer));
   auto kernel = device->makeKernel(params);
   return kernel;
 }
@@ -60,15 +56,13 @@ auto makeFillKernelImpl(zivc::VulkanDevice* device,
   \details No detailed description
 
   \param [in] device No description.
-  \param [in] command_buffer No description.
   \return No description
   */
 [[nodiscard]]
-auto makeFillU8KernelImpl(zivc::VulkanDevice* device,
-                          const VkCommandBuffer& command_buffer)
+auto makeFillU8KernelImpl(zivc::VulkanDevice* device)
 {
   auto p = ZIVC_MAKE_KERNEL_INIT_PARAMS(zivc_internal_kernel, Zivc_fillU8Kernel, 1);
-  auto kernel = makeFillKernelImpl(device, command_buffer, p);
+  auto kernel = makeFillKernelImpl(device, p);
   return kernel;
 }
 
@@ -76,15 +70,13 @@ auto makeFillU8KernelImpl(zivc::VulkanDevice* device,
   \details No detailed description
 
   \param [in] device No description.
-  \param [in] command_buffer No description.
   \return No description
   */
 [[nodiscard]]
-auto makeFillU16KernelImpl(zivc::VulkanDevice* device,
-                           const VkCommandBuffer& command_buffer)
+auto makeFillU16KernelImpl(zivc::VulkanDevice* device)
 {
   auto p = ZIVC_MAKE_KERNEL_INIT_PARAMS(zivc_internal_kernel, Zivc_fillU16Kernel, 1);
-  auto kernel = makeFillKernelImpl(device, command_buffer, p);
+  auto kernel = makeFillKernelImpl(device, p);
   return kernel;
 }
 
@@ -92,15 +84,13 @@ auto makeFillU16KernelImpl(zivc::VulkanDevice* device,
   \details No detailed description
 
   \param [in] device No description.
-  \param [in] command_buffer No description.
   \return No description
   */
 [[nodiscard]]
-auto makeFillU32KernelImpl(zivc::VulkanDevice* device,
-                           const VkCommandBuffer& command_buffer)
+auto makeFillU32KernelImpl(zivc::VulkanDevice* device)
 {
   auto p = ZIVC_MAKE_KERNEL_INIT_PARAMS(zivc_internal_kernel, Zivc_fillU32Kernel, 1);
-  auto kernel = makeFillKernelImpl(device, command_buffer, p);
+  auto kernel = makeFillKernelImpl(device, p);
   return kernel;
 }
 
@@ -108,15 +98,13 @@ auto makeFillU32KernelImpl(zivc::VulkanDevice* device,
   \details No detailed description
 
   \param [in] device No description.
-  \param [in] command_buffer No description.
   \return No description
   */
 [[nodiscard]]
-auto makeFillU64KernelImpl(zivc::VulkanDevice* device,
-                           const VkCommandBuffer& command_buffer)
+auto makeFillU64KernelImpl(zivc::VulkanDevice* device)
 {
   auto p = ZIVC_MAKE_KERNEL_INIT_PARAMS(zivc_internal_kernel, Zivc_fillU64Kernel, 1);
-  auto kernel = makeFillKernelImpl(device, command_buffer, p);
+  auto kernel = makeFillKernelImpl(device, p);
   return kernel;
 }
 
@@ -124,15 +112,13 @@ auto makeFillU64KernelImpl(zivc::VulkanDevice* device,
   \details No detailed description
 
   \param [in] device No description.
-  \param [in] command_buffer No description.
   \return No description
   */
 [[nodiscard]]
-auto makeFillU128KernelImpl(zivc::VulkanDevice* device,
-                            const VkCommandBuffer& command_buffer)
+auto makeFillU128KernelImpl(zivc::VulkanDevice* device)
 {
   auto p = ZIVC_MAKE_KERNEL_INIT_PARAMS(zivc_internal_kernel, Zivc_fillU128Kernel, 1);
-  auto kernel = makeFillKernelImpl(device, command_buffer, p);
+  auto kernel = makeFillKernelImpl(device, p);
   return kernel;
 }
 
@@ -213,6 +199,7 @@ void VulkanBufferImpl::copyCmd(const VkCommandBuffer& command_buffer,
   ZISC_ASSERT(source, "The given source buffer is null.");
   const zivcvk::Buffer dest{dest_buffer};
   ZISC_ASSERT(dest, "The given dest buffer is null.");
+  addTransferBarrierCmd(command_buffer);
   const zivcvk::BufferCopy copy_region{region};
   command.copyBuffer(source, dest, copy_region, device().dispatcher().loader());
 }
@@ -264,23 +251,26 @@ LaunchResult VulkanBufferImpl::fillImpl(KernelCommon* fill_kernel,
   using FillInfoT = zivc::cl::zivc_internal_kernel::zivc::FillInfo;
   auto* kernel = zisc::cast<FillKernelP>(fill_kernel);
 
-  auto kernel_launch_options = kernel->makeOptions();
-  const std::size_t work_size = (size + FillInfoT::batchSize() - 1) /
+  // The kernel processes the buffer in units of the Type.
+  // A work-item fills batch size units on average in the grid-stride loop
+  const std::size_t data_size = data_buffer->size();
+  const std::size_t num_of_units = data_size * size;
+  const std::size_t work_size = (num_of_units + FillInfoT::batchSize() - 1) /
                                 FillInfoT::batchSize();
 
-  constexpr std::size_t type_size = sizeof(Type);
-  const std::size_t adjustment = (type_size <= 2) ? data_buffer->size() : 1;
-
-  kernel_launch_options.setWorkSize({zisc::cast<uint32b>(work_size * adjustment)});
+  auto kernel_launch_options = kernel->makeOptions();
+  kernel_launch_options.setWorkSize({zisc::cast<uint32b>(work_size)});
   kernel_launch_options.setQueueIndex(launch_options.queueIndex());
+  kernel_launch_options.setQueuePriority(launch_options.queuePriority());
+  kernel_launch_options.setQueueSelection(launch_options.queueSelection());
   kernel_launch_options.setExternalSyncMode(launch_options.isExternalSyncMode());
   kernel_launch_options.setLabel(launch_options.label());
   kernel_launch_options.setLabelColor(launch_options.labelColor());
 
   FillInfoT info{};
-  info.setElementOffset(offset * adjustment);
-  info.setElementSize(size * adjustment);
-  info.setDataSize(data_buffer->size());
+  info.setElementOffset(data_size * offset);
+  info.setElementSize(num_of_units);
+  info.setDataSize(data_size);
 
   auto result = kernel->run(*data_buffer, *buffer, info, kernel_launch_options);
   return result;
@@ -305,7 +295,7 @@ LaunchResult VulkanBufferImpl::fillU8(KernelCommon* fill_kernel,
                                       const std::size_t size) const
 {
   using FillKernelT =
-      std::remove_cvref_t<decltype(*::makeFillU8KernelImpl(nullptr, nullptr))>;
+      std::remove_cvref_t<decltype(*::makeFillU8KernelImpl(nullptr))>;
   auto result = fillImpl<uint8b, FillKernelT>(fill_kernel, data_buffer, buffer,
                                               launch_options, offset, size);
   return result;
@@ -330,7 +320,7 @@ LaunchResult VulkanBufferImpl::fillU16(KernelCommon* fill_kernel,
                                        const std::size_t size) const
 {
   using FillKernelT =
-      std::remove_cvref_t<decltype(*::makeFillU16KernelImpl(nullptr, nullptr))>;
+      std::remove_cvref_t<decltype(*::makeFillU16KernelImpl(nullptr))>;
   auto result = fillImpl<uint16b, FillKernelT>(fill_kernel, data_buffer, buffer,
                                                launch_options, offset, size);
   return result;
@@ -355,7 +345,7 @@ LaunchResult VulkanBufferImpl::fillU32(KernelCommon* fill_kernel,
                                        const std::size_t size) const
 {
   using FillKernelT =
-      std::remove_cvref_t<decltype(*::makeFillU32KernelImpl(nullptr, nullptr))>;
+      std::remove_cvref_t<decltype(*::makeFillU32KernelImpl(nullptr))>;
   auto result = fillImpl<uint32b, FillKernelT>(fill_kernel, data_buffer, buffer,
                                                launch_options, offset, size);
   return result;
@@ -380,7 +370,7 @@ LaunchResult VulkanBufferImpl::fillU64(KernelCommon* fill_kernel,
                                        const std::size_t size) const
 {
   using FillKernelT =
-      std::remove_cvref_t<decltype(*::makeFillU64KernelImpl(nullptr, nullptr))>;
+      std::remove_cvref_t<decltype(*::makeFillU64KernelImpl(nullptr))>;
   auto result = fillImpl<cl::uint2, FillKernelT>(fill_kernel, data_buffer, buffer,
                                                  launch_options, offset, size);
   return result;
@@ -405,7 +395,7 @@ LaunchResult VulkanBufferImpl::fillU128(KernelCommon* fill_kernel,
                                        const std::size_t size) const
 {
   using FillKernelT =
-      std::remove_cvref_t<decltype(*::makeFillU128KernelImpl(nullptr, nullptr))>;
+      std::remove_cvref_t<decltype(*::makeFillU128KernelImpl(nullptr))>;
   auto result = fillImpl<cl::uint4, FillKernelT>(fill_kernel, data_buffer, buffer,
                                                  launch_options, offset, size);
   return result;
@@ -430,6 +420,7 @@ void VulkanBufferImpl::fillFastCmd(const VkCommandBuffer& command_buffer,
   ZISC_ASSERT(command, "The given command buffer is null.");
   const zivcvk::Buffer buf{buffer};
   ZISC_ASSERT(buf, "The given buffer is null.");
+  addTransferBarrierCmd(command_buffer);
   command.fillBuffer(buf, dest_offset, size, data, device().dispatcher().loader());
 }
 
@@ -480,6 +471,30 @@ void VulkanBufferImpl::throwResultException(const VkResult result, const char* m
   zivcvk::throwResultException(r, message);
 }
 
+/*!
+  \details The transfer is ordered after the preceding dispatches and
+  transfers on the queue, so that it doesn't overwrite the data which
+  they still read or write
+
+  \param [in] command_buffer No description.
+  */
+void VulkanBufferImpl::addTransferBarrierCmd(const VkCommandBuffer& command_buffer) const
+{
+  const auto& zdevice = device();
+  const zivcvk::MemoryBarrier barrier{
+      zivcvk::AccessFlagBits::eShaderWrite | zivcvk::AccessFlagBits::eTransferWrite,
+      zivcvk::AccessFlagBits::eTransferRead | zivcvk::AccessFlagBits::eTransferWrite};
+  const zivcvk::CommandBuffer command{command_buffer};
+  command.pipelineBarrier(zivcvk::PipelineStageFlagBits::eComputeShader |
+                              zivcvk::PipelineStageFlagBits::eTransfer,
+                          zivcvk::PipelineStageFlagBits::eTransfer,
+                          zivcvk::DependencyFlags{},
+                          barrier,
+                          nullptr,
+                          nullptr,
+                          zdevice.dispatcher().loader());
+}
+
 /*!
   \details No detailed description
 
@@ -537,7 +552,7 @@ VmaAllocationCreateInfo VulkanBufferImpl::makeAllocCreateInfo(
   */
 VkBufferCreateInfo VulkanBufferImpl::makeBufferCreateInfo(
     const std::size_t size,
-    const VkBufferUsageFlagBits desc_type) noexcept
+    const VkBufferUsageFlagBits desc_type) const noexcept
 {
   // Buffer create info
   zivcvk::BufferCreateInfo buffer_create_info;
@@ -546,6 +561,11 @@ VkBufferCreateInfo VulkanBufferImpl::makeBufferCreateInfo(
   buffer_create_info.usage = zivcvk::BufferUsageFlagBits::eTransferSrc |
                              zivcvk::BufferUsageFlagBits::eTransferDst |
                              descriptor_type;
+  // Any buffer can hold the dispatch size of an indirect launch
+  buffer_create_info.usage |= zivcvk::BufferUsageFlagBits::eIndirectBuffer;
+  // Kernels can access any buffer through the device address
+  if (device().isBufferDeviceAddressEnabled())
+    buffer_create_info.usage |= zivcvk::BufferUsageFlagBits::eShaderDeviceAddress;
   buffer_create_info.sharingMode = zivcvk::SharingMode::eExclusive;
   buffer_create_info.queueFamilyIndexCount = 0;
   buffer_create_info.pQueueFamilyIndices = nullptr;
@@ -556,65 +576,55 @@ VkBufferCreateInfo VulkanBufferImpl::makeBufferCreateInfo(
 /*!
   \details No detailed description
 
-  \param [in] command_buffer No description.
   \return No description
   */
-std::shared_ptr<KernelCommon> VulkanBufferImpl::makeFillU8Kernel(
-    const VkCommandBuffer& command_buffer)
+std::shared_ptr<KernelCommon> VulkanBufferImpl::makeFillU8Kernel()
 {
-  auto kernel = ::makeFillU8KernelImpl(std::addressof(device()), command_buffer);
+  auto kernel = ::makeFillU8KernelImpl(std::addressof(device()));
   return std::move(kernel);
 }
 
 /*!
   \details No detailed description
 
-  \param [in] command_buffer No description.
   \return No description
   */
-std::shared_ptr<KernelCommon> VulkanBufferImpl::makeFillU16Kernel(
-    const VkCommandBuffer& command_buffer)
+std::shared_ptr<KernelCommon> VulkanBufferImpl::makeFillU16Kernel()
 {
-  auto kernel = ::makeFillU16KernelImpl(std::addressof(device()), command_buffer);
+  auto kernel = ::makeFillU16KernelImpl(std::addressof(device()));
   return std::move(kernel);
 }
 
 /*!
   \details No detailed description
 
-  \param [in] command_buffer No description.
   \return No description
   */
-std::shared_ptr<KernelCommon> VulkanBufferImpl::makeFillU32Kernel(
-    const VkCommandBuffer& command_buffer)
+std::shared_ptr<KernelCommon> VulkanBufferImpl::makeFillU32Kernel()
 {
-  auto kernel = ::makeFillU32KernelImpl(std::addressof(device()), command_buffer);
+  auto kernel = ::makeFillU32KernelImpl(std::addressof(device()));
   return std::move(kernel);
 }
 
 /*!
   \details No detailed description
 
-  \param [in] command_buffer No description.
   \return No description
   */
-std::shared_ptr<KernelCommon> VulkanBufferImpl::makeFillU64Kernel(
-    const VkCommandBuffer& command_buffer)
+std::shared_ptr<KernelCommon> VulkanBufferImpl::makeFillU64Kernel()
 {
-  auto kernel = ::makeFillU64KernelImpl(std::addressof(device()), command_buffer);
+  auto kernel = ::makeFillU64KernelImpl(std::addressof(device()));
   return std::move(kernel);
 }
 
 /*!
   \details No detailed description
 
-  \param [in] command_buffer No description.
   \return No description
   */
-std::shared_ptr<KernelCommon> VulkanBufferImpl::makeFillU128Kernel(
-    const VkCommandBuffer& command_buffer)
+std::shared_ptr<KernelCommon> VulkanBufferImpl::makeFillU128Kernel()
 {
-  auto kernel = ::makeFillU128KernelImpl(std::addressof(device()), command_buffer);
+  auto kernel = ::makeFillU128KernelImpl(std::addressof(device()));
   return std::move(kernel);
 }
 
@@ -94,7 +94,7 @@ class VulkanBufferImpl : private zisc::NonCopyable<VulkanBufferImpl>
   //! Make a fill8 kernel instance
   template <KernelArg Type>
   [[nodiscard("The result will have a vulkan kernel.")]]
-  std::shared_ptr<KernelCommon> makeFillKernel(const VkCommandBuffer& command_buffer);
+  std::shared_ptr<KernelCommon> makeFillKernel();
 
   //!
   [[noreturn]] static void throwResultException(const VkResult result,
@@ -112,6 +112,9 @@ class VulkanBufferImpl : private zisc::NonCopyable<VulkanBufferImpl>
   };
 
 
+  //! Add a barrier which makes the preceding writes on the queue visible to a transfer
+  void addTransferBarrierCmd(const VkCommandBuffer& command_buffer) const;
+
   //! Return the underlying device object
   VulkanDevice& device() noexcept;
 
@@ -182,29 +185,29 @@ class VulkanBufferImpl : private zisc::NonCopyable<VulkanBufferImpl>
       void* user_data) noexcept;
 
   //! Create a buffer create info
-  static VkBufferCreateInfo makeBufferCreateInfo(
+  VkBufferCreateInfo makeBufferCreateInfo(
       const std::size_t size,
-      const VkBufferUsageFlagBits desc_type) noexcept;
+      const VkBufferUsageFlagBits desc_type) const noexcept;
 
   //! Make a fill8 kernel instance
   [[nodiscard("The result will have a vulkan kernel.")]]
-  std::shared_ptr<KernelCommon> makeFillU8Kernel(const VkCommandBuffer& command_buffer);
+  std::shared_ptr<KernelCommon> makeFillU8Kernel();
 
   //! Make a fill16 kernel instance
   [[nodiscard("The result will have a vulkan kernel.")]]
-  std::shared_ptr<KernelCommon> makeFillU16Kernel(const VkCommandBuffer& command_buffer);
+  std::shared_ptr<KernelCommon> makeFillU16Kernel();
 
   //! Make a fill32 kernel instance
   [[nodiscard("The result will have a vulkan kernel.")]]
-  std::shared_ptr<KernelCommon> makeFillU32Kernel(const VkCommandBuffer& command_buffer);
+  std::shared_ptr<KernelCommon> makeFillU32Kernel();
 
   //! Make a fill64 kernel instance
   [[nodiscard("The result will have a vulkan kernel.")]]
-  std::shared_ptr<KernelCommon> makeFillU64Kernel(const VkCommandBuffer& command_buffer);
+  std::shared_ptr<KernelCommon> makeFillU64Kernel();
 
   //! Make a fill128 kernel instance
   [[nodiscard("The result will have a vulkan kernel.")]]
-  std::shared_ptr<KernelCommon> makeFillU128Kernel(const VkCommandBuffer& command_buffer);
+  std::shared_ptr<KernelCommon> makeFillU128Kernel();
 
   //! Convert to VMA usage flags
   static constexpr VmaMemoryUsage toVmaUsage(const BufferUsage usage) noexcept;
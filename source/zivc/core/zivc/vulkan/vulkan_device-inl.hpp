@@ -65,28 +65,6 @@ auto VulkanDevice::addShaderModule(const KernelSet<SetType>& kernel_set)
   return addShaderModule(id, spirv_code, module_name);
 }
 
-/*!
-  \details No detailed description
-
-  \return No description
-  */
-inline
-VkCommandPool& VulkanDevice::commandPool() noexcept
-{
-  return command_pool_;
-}
-
-/*!
-  \details No detailed description
-
-  \return No description
-  */
-inline
-const VkCommandPool& VulkanDevice::commandPool() const noexcept
-{
-  return command_pool_;
-}
-
 /*!
   \details No detailed description
 
@@ -270,6 +248,43 @@ constexpr uint32b VulkanDevice::invalidQueueIndex() noexcept
   return index;
 }
 
+/*!
+  \details The buffer memory of the device is allocated with the device address
+  usage when the device supports bufferDeviceAddress feature
+
+  \return No description
+  */
+inline
+bool VulkanDevice::isBufferDeviceAddressEnabled() const noexcept
+{
+  return buffer_device_address_enabled_;
+}
+
+/*!
+  \details Buffers are bound in command buffers directly without descriptor sets
+  when the device supports VK_KHR_push_descriptor
+
+  \return No description
+  */
+inline
+bool VulkanDevice::isPushDescriptorEnabled() const noexcept
+{
+  return push_descriptor_enabled_;
+}
+
+/*!
+  \details The id is unique on the device even if the driver reuses
+  the handle of a released buffer. Zero is never issued
+
+  \return No description
+  */
+inline
+uint64b VulkanDevice::issueBufferAllocationId() noexcept
+{
+  const uint64b id = buffer_allocation_counter_.fetch_add(1, std::memory_order::relaxed) + 1;
+  return id;
+}
+
 /*!
   \details No detailed description
 
@@ -16,17 +16,24 @@
 // Standard C++ library
 #include <array>
 #include <algorithm>
+#include <atomic>
 #include <charconv>
 #include <cstddef>
 #include <cstdio>
 #include <cstring>
+#include <filesystem>
+#include <fstream>
 #include <iterator>
 #include <limits>
 #include <memory>
 #include <mutex>
 #include <numeric>
+#include <random>
 #include <shared_mutex>
+#include <string>
 #include <string_view>
+#include <system_error>
+#include <thread>
 #include <tuple>
 #include <utility>
 #include <vector>
@@ -70,6 +77,7 @@ auto getDefaultFeatures(const zivc::VulkanDeviceInfo& info,
     zivcvk::PhysicalDevice16BitStorageFeatures b16bit_storage_;
     zivcvk::PhysicalDevice8BitStorageFeatures b8bit_storage_;
     zivcvk::PhysicalDeviceAccelerationStructureFeaturesKHR acceleration_structure_;
+    zivcvk::PhysicalDeviceBufferDeviceAddressFeatures buffer_device_address_;
     zivcvk::PhysicalDeviceMaintenance4FeaturesKHR maintenance4_;
     zivcvk::PhysicalDeviceRayQueryFeaturesKHR ray_query_;
     zivcvk::PhysicalDeviceRayTracingPipelineFeaturesKHR ray_tracing_pipeline_;
@@ -77,6 +85,7 @@ auto getDefaultFeatures(const zivc::VulkanDeviceInfo& info,
     zivcvk::PhysicalDeviceShaderAtomicInt64Features shader_atomic_int64_;
     zivcvk::PhysicalDeviceShaderClockFeaturesKHR shader_clock_;
     zivcvk::PhysicalDeviceShaderFloat16Int8Features shader_float16_int8_;
+    zivcvk::PhysicalDeviceTimelineSemaphoreFeatures timeline_semaphore_;
     zivcvk::PhysicalDeviceVariablePointersFeatures variable_pointers_;
     zivcvk::PhysicalDeviceVulkanMemoryModelFeatures vulkan_memory_model_;
   };
@@ -96,6 +105,9 @@ auto getDefaultFeatures(const zivc::VulkanDeviceInfo& info,
   f->b16bit_storage_ = inputs.b16bit_storage_;
   f->b8bit_storage_ = inputs.b8bit_storage_;
   f->acceleration_structure_ = inputs.acceleration_structure_;
+  f->buffer_device_address_ = inputs.buffer_device_address_;
+  // Capture replay is only for tools
+  f->buffer_device_address_.bufferDeviceAddressCaptureReplay = VK_FALSE;
   f->maintenance4_ = inputs.maintenance4_;
   f->ray_query_ = inputs.ray_query_;
   f->ray_tracing_pipeline_ = inputs.ray_tracing_pipeline_features_;
@@ -103,6 +115,7 @@ auto getDefaultFeatures(const zivc::VulkanDeviceInfo& info,
   f->shader_atomic_int64_ = inputs.shader_atomic_int64_;
   f->shader_clock_ = inputs.shader_clock_;
   f->shader_float16_int8_ = inputs.shader_float16_int8_;
+  f->timeline_semaphore_ = inputs.timeline_semaphore_;
   f->variable_pointers_ = inputs.variable_pointers_;
   f->vulkan_memory_model_ = inputs.vulkan_memory_model_;
 
@@ -110,6 +123,7 @@ auto getDefaultFeatures(const zivc::VulkanDeviceInfo& info,
                                f->b16bit_storage_,
                                f->b8bit_storage_,
 //                               f->acceleration_structure_,
+                               f->buffer_device_address_,
 //                               f->maintenance4_,
 //                               f->ray_query_,
 //                               f->ray_tracing_pipeline_,
@@ -117,12 +131,67 @@ auto getDefaultFeatures(const zivc::VulkanDeviceInfo& info,
                                f->shader_atomic_int64_,
                                f->shader_clock_,
                                f->shader_float16_int8_,
+                               f->timeline_semaphore_,
                                f->variable_pointers_,
                                f->vulkan_memory_model_);
 
   return std::make_tuple(features, std::move(f));
 }
 
+/*!
+  \details The token is destroyed when the calling thread exits,
+  so the owner of a per-thread resource can be checked with the weak pointer
+
+  \return No description
+  */
+std::weak_ptr<const void> getThreadToken() noexcept
+{
+  thread_local const std::shared_ptr<const void> token = std::make_shared<int>(0);
+  return token;
+}
+
+//! The tokens of an entry of the tuning cache: UUID, kernel ID and work-group size
+using CacheEntry = std::array<std::string_view, 5>;
+
+/*!
+  \details The tokens are separated by spaces.
+  The tokens beyond the entry are ignored
+
+  \param [in] line No description.
+  \param [out] entry No description.
+  \return The number of tokens
+  */
+std::size_t splitCacheEntry(const std::string_view line, CacheEntry* entry) noexcept
+{
+  std::size_t n = 0;
+  for (std::size_t pos = 0; n < entry->size(); ++n) {
+    pos = line.find_first_not_of(' ', pos);
+    if (pos == std::string_view::npos)
+      break;
+    const std::size_t last = (std::min)(line.find(' ', pos), line.size());
+    (*entry)[n] = line.substr(pos, last - pos);
+    pos = last;
+  }
+  return n;
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Integer No description.
+  \param [in] token No description.
+  \param [in] base No description.
+  \param [out] value No description.
+  \return True if the whole token is a number
+  */
+template <typename Integer>
+bool toInteger(const std::string_view token, const int base, Integer* value) noexcept
+{
+  const char* last = token.data() + token.size();
+  const auto [ptr, error] = std::from_chars(token.data(), last, *value, base);
+  return (error == std::errc{}) && (ptr == last);
+}
+
 } // namespace
 
 namespace zivc {
@@ -148,12 +217,41 @@ VulkanDevice::~VulkanDevice() noexcept
   destroy();
 }
 
+/*!
+  \details The command buffers which the device completed are reused.
+  The command buffer must be released by the same thread
+  with releaseCommandBuffer()
+
+  \return No description
+  */
+VkCommandBuffer VulkanDevice::acquireCommandBuffer()
+{
+  CommandPoolData& pool_data = getThreadCommandPool();
+  recycleCommandBuffers(std::addressof(pool_data));
+  if (!pool_data.free_list_.empty()) {
+    const VkCommandBuffer command = pool_data.free_list_.back();
+    pool_data.free_list_.pop_back();
+    return command;
+  }
+
+  const zivcvk::Device d{device()};
+  const zivcvk::CommandBufferAllocateInfo alloc_info{
+      pool_data.pool_,
+      zivcvk::CommandBufferLevel::ePrimary,
+      1};
+  zisc::pmr::vector<zivcvk::CommandBuffer>::allocator_type alloc{memoryResource()};
+  auto commands = d.allocateCommandBuffers(alloc_info, alloc, dispatcher().loader());
+  ZISC_ASSERT(commands.size() == 1, "The size of command buffers isn't 1.");
+  return zisc::cast<VkCommandBuffer>(commands[0]);
+}
+
 /*!
   \details No detailed description
 
   \param [in] module No description.
   \param [in] kernel_name No description.
   \param [in] work_dimension No description.
+  \param [in] work_group_size No description.
   \param [in] num_of_storage_buffers No description.
   \param [in] num_of_uniform_buffers No description.
   \param [in] num_of_local_args No description.
@@ -162,12 +260,14 @@ VulkanDevice::~VulkanDevice() noexcept
 auto VulkanDevice::addShaderKernel(const ModuleData& module,
                                    const std::string_view kernel_name,
                                    const std::size_t work_dimension,
+                                   const std::array<uint32b, 3>& work_group_size,
                                    const std::size_t num_of_storage_buffers,
                                    const std::size_t num_of_uniform_buffers,
                                    const std::size_t num_of_local_args)
     -> const KernelData&
 {
-  const uint64b id = getKernelId(module.name_, kernel_name);
+  // Pipelines are specialized with the work-group size
+  const uint64b id = getKernelId(module.name_, kernel_name, work_group_size);
   if (hasShaderKernel(id))
     return getShaderKernel(id);
 
@@ -176,6 +276,12 @@ auto VulkanDevice::addShaderKernel(const ModuleData& module,
   auto* mem_resource = memoryResource();
   zivcvk::AllocationCallbacks alloc{makeAllocator()};
 
+  // Buffers are pushed directly if the number of them doesn't exceed the limit
+  constexpr std::size_t max_push_descriptors = 32; // The minimum limit of the spec
+  const bool push_descriptor =
+      isPushDescriptorEnabled() &&
+      ((num_of_storage_buffers + num_of_uniform_buffers) <= max_push_descriptors);
+
   // Initialize descriptor set layout
   zivcvk::DescriptorSetLayout desc_set_layout;
   {
@@ -200,8 +306,11 @@ auto VulkanDevice::addShaderKernel(const ModuleData& module,
           1,
           zivcvk::ShaderStageFlagBits::eCompute};
     }
+    zivcvk::DescriptorSetLayoutCreateFlags layout_flags;
+    if (push_descriptor)
+      layout_flags |= zivcvk::DescriptorSetLayoutCreateFlagBits::ePushDescriptorKHR;
     const zivcvk::DescriptorSetLayoutCreateInfo create_info{
-        zivcvk::DescriptorSetLayoutCreateFlags{},
+        layout_flags,
         zisc::cast<uint32b>(layout_bindings.size()),
         layout_bindings.data()};
     desc_set_layout = d.createDescriptorSetLayout(create_info, alloc, loader);
@@ -223,7 +332,6 @@ auto VulkanDevice::addShaderKernel(const ModuleData& module,
     pline_layout = d.createPipelineLayout(create_info, alloc, loader);
   }
   // Specialization constants
-  const auto& work_group_size = workGroupSizeDim(work_dimension);
   zisc::pmr::vector<uint32b>::allocator_type spec_alloc{mem_resource};
   zisc::pmr::vector<uint32b> spec_constants{spec_alloc};
   {
@@ -311,6 +419,8 @@ auto VulkanDevice::addShaderKernel(const ModuleData& module,
         zisc::cast<VkDescriptorSetLayout>(desc_set_layout);
     kernel_data->pipeline_layout_ = zisc::cast<VkPipelineLayout>(pline_layout);
     kernel_data->pipeline_ = zisc::cast<VkPipeline>(pline);
+    kernel_data->work_group_size_ = work_group_size;
+    kernel_data->push_descriptor_ = push_descriptor;
 
     std::unique_lock<std::shared_mutex> lock{shader_mutex_};
     kernel_data_list_->emplace(id, std::move(kernel_data));
@@ -319,6 +429,107 @@ auto VulkanDevice::addShaderKernel(const ModuleData& module,
   return *data;
 }
 
+/*!
+  \details Descriptor sets of all kernels are allocated from the pools of
+  the device. A new larger pool is added when the existing pools run out
+
+  \param [in] kernel No description.
+  \param [out] descriptor_pool No description.
+  \param [out] descriptor_set No description.
+  */
+void VulkanDevice::allocateDescriptorSet(const KernelData& kernel,
+                                         VkDescriptorPool* descriptor_pool,
+                                         VkDescriptorSet* descriptor_set)
+{
+  ZISC_ASSERT(!kernel.push_descriptor_, "The kernel uses push descriptors.");
+  const auto& loader = dispatcher().loader();
+  VkDescriptorSetAllocateInfo alloc_info{};
+  alloc_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+  alloc_info.descriptorSetCount = 1;
+  alloc_info.pSetLayouts = std::addressof(kernel.desc_set_layout_);
+
+  const auto throw_if_failed = [](const VkResult result)
+  {
+    if (result != VK_SUCCESS) {
+      const char* message = "Descriptor set allocation failed.";
+      zivcvk::throwResultException(zisc::cast<zivcvk::Result>(result), message);
+    }
+  };
+
+  std::unique_lock<std::mutex> lock{desc_pool_mutex_};
+  // Try the latest pool first since older pools are likely to be full
+  auto& pool_list = *desc_pool_list_;
+  for (auto ite = pool_list.rbegin(); ite != pool_list.rend(); ++ite) {
+    alloc_info.descriptorPool = *ite;
+    const VkResult result = loader.vkAllocateDescriptorSets(device(),
+                                                            &alloc_info,
+                                                            descriptor_set);
+    if (result == VK_SUCCESS) {
+      *descriptor_pool = *ite;
+      return;
+    }
+    if ((result != VK_ERROR_OUT_OF_POOL_MEMORY) && (result != VK_ERROR_FRAGMENTED_POOL))
+      throw_if_failed(result);
+  }
+  alloc_info.descriptorPool = addDescriptorPool();
+  throw_if_failed(loader.vkAllocateDescriptorSets(device(), &alloc_info, descriptor_set));
+  *descriptor_pool = alloc_info.descriptorPool;
+}
+
+/*!
+  \details No detailed description
+
+  \param [in,out] descriptor_pool No description.
+  \param [in,out] descriptor_set No description.
+  */
+void VulkanDevice::freeDescriptorSet(VkDescriptorPool* descriptor_pool,
+                                     VkDescriptorSet* descriptor_set) noexcept
+{
+  if ((*descriptor_pool != ZIVC_VK_NULL_HANDLE) && (device() != ZIVC_VK_NULL_HANDLE)) {
+    const auto& loader = dispatcher().loader();
+    std::unique_lock<std::mutex> lock{desc_pool_mutex_};
+    loader.vkFreeDescriptorSets(device(), *descriptor_pool, 1, descriptor_set);
+  }
+  *descriptor_pool = ZIVC_VK_NULL_HANDLE;
+  *descriptor_set = ZIVC_VK_NULL_HANDLE;
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] id No description.
+  \param [out] work_group_size No description.
+  \return No description
+  */
+bool VulkanDevice::findTunedWorkGroupSize(
+    const uint64b id,
+    std::array<uint32b, 3>* work_group_size) const noexcept
+{
+  std::unique_lock<std::mutex> lock{tuning_mutex_};
+  const auto ite = tuned_work_group_size_list_->find(id);
+  const bool result = ite != tuned_work_group_size_list_->end();
+  if (result)
+    *work_group_size = ite->second;
+  return result;
+}
+
+/*!
+  \details Zero is returned if buffer device address isn't enabled
+
+  \param [in] buffer No description.
+  \return No description
+  */
+uint64b VulkanDevice::getBufferDeviceAddress(const VkBuffer& buffer) const noexcept
+{
+  uint64b address = 0;
+  if (isBufferDeviceAddressEnabled() && (buffer != ZIVC_VK_NULL_HANDLE)) {
+    const zivcvk::Device d{device()};
+    const zivcvk::BufferDeviceAddressInfo info{zivcvk::Buffer{buffer}};
+    address = d.getBufferAddress(info, dispatcher().loader());
+  }
+  return address;
+}
+
 /*!
   \details No detailed description
 
@@ -362,6 +573,125 @@ uint64b VulkanDevice::getKernelId(const std::string_view module_name,
   return kernel_id;
 }
 
+/*!
+  \details No detailed description
+
+  \param [in] module_name No description.
+  \param [in] kernel_name No description.
+  \param [in] work_group_size No description.
+  \return No description
+  */
+uint64b VulkanDevice::getKernelId(const std::string_view module_name,
+                                  const std::string_view kernel_name,
+                                  const std::array<uint32b, 3>& work_group_size) noexcept
+{
+  IdData::NameType kernel_id_name{""};
+  copyStr(module_name, kernel_id_name.data());
+  concatStr(kernel_name, kernel_id_name.data());
+  for (const uint32b s : work_group_size) {
+    std::array<char, 16> size_str{{'_'}};
+    std::to_chars(size_str.data() + 1, size_str.data() + size_str.size() - 1, s);
+    concatStr(size_str.data(), kernel_id_name.data());
+  }
+  const uint64b kernel_id = zisc::Fnv1aHash64::hash(kernel_id_name.data());
+  return kernel_id;
+}
+
+/*!
+  \details The candidates are power of 2 shapes which the device supports.
+  The default shape of the dimension is always included
+
+  \param [in] dim No description.
+  \param [out] candidate_list No description.
+  */
+void VulkanDevice::getWorkGroupSizeCandidates(
+    const std::size_t dim,
+    zisc::pmr::vector<std::array<uint32b, 3>>* candidate_list) const
+{
+  const auto add_candidate = [this, candidate_list](const std::array<uint32b, 3>& s)
+  {
+    auto ite = std::find(candidate_list->begin(), candidate_list->end(), s);
+    if ((ite == candidate_list->end()) && isValidWorkGroupSize(s))
+      candidate_list->emplace_back(s);
+  };
+
+  add_candidate(workGroupSizeDim(dim));
+  constexpr std::array<uint32b, 3> products{{64, 128, 256}};
+  constexpr uint32b min_x = 8;
+  if (dim == 1) {
+    for (uint32b x = 32; x <= 1024; x *= 2)
+      add_candidate({{x, 1, 1}});
+  }
+  else {
+    const uint32b max_z = (dim == 3) ? 2 : 1;
+    for (const uint32b p : products) {
+      for (uint32b z = 1; z <= max_z; z *= 2) {
+        for (uint32b x = min_x; (x * z) <= p; x *= 2)
+          add_candidate({{x, p / (x * z), z}});
+      }
+    }
+  }
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] work_group_size No description.
+  \return No description
+  */
+bool VulkanDevice::isValidWorkGroupSize(
+    const std::array<uint32b, 3>& work_group_size) const noexcept
+{
+  const auto& limits = deviceInfoImpl().properties().properties1_.limits;
+  uint64b product = 1;
+  bool result = true;
+  for (std::size_t i = 0; i < work_group_size.size(); ++i) {
+    const uint32b s = work_group_size[i];
+    result = result && (0 < s) && (s <= limits.maxComputeWorkGroupSize[i]);
+    product *= s;
+  }
+  result = result && (product <= limits.maxComputeWorkGroupInvocations);
+  return result;
+}
+
+/*!
+  \details The timeline value 0 is always completed.
+  If the device doesn't support timeline semaphores, false is returned
+  for the other values since the completion can't be checked
+
+  \param [in] queue_index No description.
+  \param [in] timeline_value No description.
+  \return No description
+  */
+bool VulkanDevice::isCompleted(const uint32b queue_index,
+                               const uint64b timeline_value) const
+{
+  if (timeline_value == 0)
+    return true;
+  if (!timeline_semaphore_enabled_)
+    return false;
+  const std::size_t index = queue_index % numOfQueues(Capability::kCompute);
+  const zivcvk::Device d{device()};
+  const auto semaphore = zisc::cast<zivcvk::Semaphore>((*queue_timeline_list_)[index]);
+  const uint64b completed = d.getSemaphoreCounterValue(semaphore, dispatcher().loader());
+  return timeline_value <= completed;
+}
+
+/*!
+  \details A queue must be externally synchronized for vkQueueSubmit() and
+  the queue debug labels. The queues share a fixed number of locks,
+  so different queues can use the same lock
+
+  \param [in] queue_index No description.
+  \return No description
+  */
+std::unique_lock<std::mutex> VulkanDevice::lockQueue(const uint32b queue_index) const
+{
+  const std::size_t index = queue_index % numOfQueues(Capability::kCompute);
+  std::mutex& m = queue_mutex_list_[index % queue_mutex_list_.size()];
+  return std::unique_lock<std::mutex>{m};
+}
+
 /*!
   \details No detailed description
 
@@ -421,24 +751,6 @@ QueueDebugLabelRegion VulkanDevice::makeQueueDebugLabel(
   return QueueDebugLabelRegion{que, dispatcher(), label_name, color};
 }
 
-/*!
-  \details No detailed description
-  */
-VkCommandBuffer VulkanDevice::makeCommandBuffer()
-{
-  zivcvk::Device d{device()};
-  auto* mem_resource = memoryResource();
-
-  const zivcvk::CommandBufferAllocateInfo alloc_info{
-      commandPool(),
-      zivcvk::CommandBufferLevel::ePrimary,
-      1};
-  zisc::pmr::vector<zivcvk::CommandBuffer>::allocator_type alloc{mem_resource};
-  auto commands = d.allocateCommandBuffers(alloc_info, alloc, dispatcher().loader());
-  ZISC_ASSERT(commands.size() == 1, "The size of command buffers isn't 1.");
-  return zisc::cast<VkCommandBuffer>(commands[0]);
-}
-
 /*!
   \details No detailed description
 
@@ -474,6 +786,26 @@ std::size_t VulkanDevice::numOfFences() const noexcept
   return s;
 }
 
+/*!
+  \details The number is tracked with a timeline semaphore of the queue.
+  If the device doesn't support timeline semaphores, 0 is returned
+
+  \param [in] queue_index No description.
+  \return No description
+  */
+uint64b VulkanDevice::numOfInFlightCommands(const uint32b queue_index) const
+{
+  if (!timeline_semaphore_enabled_)
+    return 0;
+  const std::size_t index = queue_index % numOfQueues(Capability::kCompute);
+  const zivcvk::Device d{device()};
+  const auto semaphore = zisc::cast<zivcvk::Semaphore>((*queue_timeline_list_)[index]);
+  const uint64b completed = d.getSemaphoreCounterValue(semaphore, dispatcher().loader());
+  const std::atomic_ref<uint64b> submitted_ref{(*queue_submission_list_)[index]};
+  const uint64b submitted = submitted_ref.load(std::memory_order::acquire);
+  return (completed < submitted) ? submitted - completed : 0;
+}
+
 /*!
   \details No detailed description
 
@@ -485,6 +817,62 @@ std::size_t VulkanDevice::numOfQueues() const noexcept
   return n;
 }
 
+/*!
+  \details The high priority queues are at the head of the compute queues and
+  the low priority queues are at the tail. If the given priority doesn't have
+  any queue, all compute queues are used
+
+  \param [in] priority No description.
+  \return No description
+  */
+std::array<uint32b, 2> VulkanDevice::queueRange(const QueuePriority priority) const noexcept
+{
+  const auto n = zisc::cast<uint32b>(numOfQueues(Capability::kCompute));
+  const uint32b num_of_high = num_of_high_priority_queues_;
+  const uint32b num_of_low = num_of_low_priority_queues_;
+  std::array<uint32b, 2> range{{0, n}};
+  switch (priority) {
+   case QueuePriority::kHigh: {
+    range = {{0, num_of_high}};
+    break;
+   }
+   case QueuePriority::kLow: {
+    range = {{n - num_of_low, num_of_low}};
+    break;
+   }
+   case QueuePriority::kNormal:
+   default: {
+    range = {{num_of_high, n - (num_of_high + num_of_low)}};
+    break;
+   }
+  }
+  if (range[1] == 0)
+    range = {{0, n}};
+  return range;
+}
+
+/*!
+  \details The command buffer is reused after the device completes
+  the given timeline value of the queue.
+  The timeline value 0 means that the command buffer isn't in flight.
+  This must be called by the thread which acquired the command buffer
+
+  \param [in] command_buffer No description.
+  \param [in] queue_index No description.
+  \param [in] timeline_value No description.
+  */
+void VulkanDevice::releaseCommandBuffer(const VkCommandBuffer& command_buffer,
+                                        const uint32b queue_index,
+                                        const uint64b timeline_value)
+{
+  CommandPoolData& pool_data = getThreadCommandPool();
+  InFlightCommand command{};
+  command.command_ = command_buffer;
+  command.timeline_value_ = timeline_value;
+  command.queue_index_ = zisc::cast<uint32b>(queue_index % numOfQueues(Capability::kCompute));
+  pool_data.in_flight_list_.push_back(command);
+}
+
 /*!
   \details No detailed description
 
@@ -513,25 +901,154 @@ void VulkanDevice::returnFence(Fence* fence) noexcept
 }
 
 /*!
-  \details No detailed description
+  \details The queue is selected from the compute queues of the priority
+  of the options. With kLeastLoaded, the queue which has the fewest commands
+  in flight is selected. It falls back to kRoundRobin when the device doesn't
+  support timeline semaphores
+
+  \param [in] launch_options No description.
+  \return No description
+  */
+uint32b VulkanDevice::selectQueueIndex(const LaunchOptions& launch_options)
+{
+  const std::array<uint32b, 2> range = queueRange(launch_options.queuePriority());
+  uint32b index = launch_options.queueIndex();
+  switch (launch_options.queueSelection()) {
+   case QueueSelection::kRoundRobin: {
+    index = queue_counter_.fetch_add(1, std::memory_order::relaxed);
+    break;
+   }
+   case QueueSelection::kLeastLoaded: {
+    index = findLeastLoadedQueue(range);
+    break;
+   }
+   case QueueSelection::kFixed:
+   default: {
+    break;
+   }
+  }
+  return range[0] + (index % range[1]);
+}
+
+/*!
+  \details The size is written into the cache file of the sub-platform
+  with the device UUID. The entries are written into a temporary file
+  which replaces the cache, so the cache isn't broken if the writing fails.
+  IO errors are ignored since the cache is optional
+
+  \param [in] id No description.
+  \param [in] work_group_size No description.
+  */
+void VulkanDevice::saveTunedWorkGroupSize(const uint64b id,
+                                          const std::array<uint32b, 3>& work_group_size)
+{
+  std::unique_lock<std::mutex> lock{tuning_mutex_};
+  (*tuned_work_group_size_list_)[id] = work_group_size;
+
+  const std::string_view path = parentImpl().workGroupSizeCachePath();
+  if (path.empty())
+    return;
+
+  const IdData::NameType uuid = makeDeviceUuidString();
+  std::array<char, 17> id_str{};
+  std::to_chars(id_str.data(), id_str.data() + id_str.size() - 1, id, 16);
+  zisc::pmr::string::allocator_type alloc{memoryResource()};
+  const zisc::pmr::string path_str{path, alloc};
+
+  // Keep the entries of the other kernels and devices
+  zisc::pmr::vector<zisc::pmr::string>::allocator_type list_alloc{memoryResource()};
+  zisc::pmr::vector<zisc::pmr::string> line_list{list_alloc};
+  {
+    std::ifstream file{path_str.c_str()};
+    for (zisc::pmr::string line{alloc}; std::getline(file, line);) {
+      CacheEntry entry{};
+      const std::size_t n = ::splitCacheEntry(line, std::addressof(entry));
+      const bool is_same = (2 <= n) &&
+                           (entry[0] == uuid.data()) &&
+                           (entry[1] == id_str.data());
+      if ((0 < n) && !is_same)
+        line_list.emplace_back(std::move(line));
+    }
+  }
+
+  // The name of the temporary file is unique among the processes
+  // which write the cache at the same time
+  std::array<char, 9> suffix{};
+  std::to_chars(suffix.data(), suffix.data() + suffix.size() - 1, std::random_device{}(), 16);
+  zisc::pmr::string tmp_path{path_str, alloc};
+  tmp_path += '.';
+  tmp_path += suffix.data();
+  tmp_path += ".tmp";
+  {
+    std::ofstream file{tmp_path.c_str(), std::ios_base::trunc};
+    if (!file)
+      return;
+    for (const zisc::pmr::string& line : line_list)
+      file << line << '\n';
+    file << uuid.data() << ' ' << id_str.data() << ' ' << work_group_size[0]
+         << ' ' << work_group_size[1] << ' ' << work_group_size[2] << '\n';
+    file.close();
+    if (!file) {
+      std::remove(tmp_path.c_str());
+      return;
+    }
+  }
+  std::error_code error{};
+  std::filesystem::rename(tmp_path.c_str(), path_str.c_str(), error);
+  if (error)
+    std::remove(tmp_path.c_str());
+}
+
+/*!
+  \details The queue must be locked with lockQueue() since the timeline values
+  of the queue have to be signaled in the order of the submissions
 
   \param [in] command_buffer No description.
-  \param [in] q No description.
+  \param [in] cap No description.
+  \param [in] queue_index No description.
   \param [in] fence No description.
+  \return The timeline value which is signaled when the device completes the command.
+          0 if the device doesn't support timeline semaphores
   */
-void VulkanDevice::submit(const VkCommandBuffer& command_buffer,
-                          const VkQueue& q,
-                          const Fence& fence) const
+uint64b VulkanDevice::submit(const VkCommandBuffer& command_buffer,
+                             const Capability cap,
+                             const uint32b queue_index,
+                             const Fence& fence) const
 {
   const zivcvk::CommandBuffer command{command_buffer};
-  const zivcvk::Queue que{q};
+  const zivcvk::Queue que{getQueue(cap, queue_index)};
   zivcvk::Fence fen = fence.isActive()
       ? *zisc::reinterp<const zivcvk::Fence*>(std::addressof(fence.data()))
       : zivcvk::Fence{};
   zivcvk::SubmitInfo info{};
   info.setCommandBufferCount(1);
   info.setPCommandBuffers(std::addressof(command));
+
+  // Signal the timeline of the queue to track the commands in flight
+  zivcvk::TimelineSemaphoreSubmitInfo timeline_info{};
+  zivcvk::Semaphore semaphore{};
+  uint64b value = 0;
+  if (timeline_semaphore_enabled_ && (cap == Capability::kCompute)) {
+    const std::size_t index = queue_index % numOfQueues(cap);
+    semaphore = zisc::cast<zivcvk::Semaphore>((*queue_timeline_list_)[index]);
+    const std::atomic_ref<uint64b> submitted_ref{(*queue_submission_list_)[index]};
+    value = submitted_ref.load(std::memory_order::relaxed) + 1;
+    timeline_info.setSignalSemaphoreValueCount(1);
+    timeline_info.setPSignalSemaphoreValues(std::addressof(value));
+    info.setSignalSemaphoreCount(1);
+    info.setPSignalSemaphores(std::addressof(semaphore));
+    info.setPNext(std::addressof(timeline_info));
+  }
+
   que.submit(info, fen, dispatcher().loader());
+  // The count is updated after the submission, so that a wait never sees
+  // a value which isn't signaled when the submission fails
+  if (value != 0) {
+    const std::size_t index = queue_index % numOfQueues(cap);
+    std::atomic_ref<uint64b> submitted_ref{(*queue_submission_list_)[index]};
+    submitted_ref.store(value, std::memory_order::release);
+  }
+  return value;
 }
 
 /*!
@@ -640,6 +1157,10 @@ void VulkanDevice::takeFence(Fence* fence)
   */
 void VulkanDevice::waitForCompletion() const
 {
+  // All queues must be externally synchronized
+  std::array<std::unique_lock<std::mutex>, kNumOfQueueLocks> lock_list;
+  for (std::size_t i = 0; i < lock_list.size(); ++i)
+    lock_list[i] = std::unique_lock<std::mutex>{queue_mutex_list_[i]};
   const zivcvk::Device d{device()};
   d.waitIdle(dispatcher().loader());
 }
@@ -655,7 +1176,11 @@ void VulkanDevice::waitForCompletion(const uint32b queue_index) const
 }
 
 /*!
-  \details No detailed description
+  \details A compute queue is waited with the timeline semaphore of the queue
+  up to the last submission, so the queue isn't locked during the wait
+  and other threads can submit to the queue.
+  If the device doesn't support timeline semaphores,
+  the queue is locked and waited to be idle
 
   \param [in] cap No description.
   \param [in] queue_index No description.
@@ -664,10 +1189,50 @@ void VulkanDevice::waitForCompletion(const Capability cap,
                                      const uint32b queue_index) const
 {
   ZISC_ASSERT(hasCapability(cap), "Unsupported capability is specified in wait.");
+  if (timeline_semaphore_enabled_ && (cap == Capability::kCompute)) {
+    const std::size_t index = queue_index % numOfQueues(cap);
+    const std::atomic_ref<uint64b> submitted_ref{(*queue_submission_list_)[index]};
+    const uint64b submitted = submitted_ref.load(std::memory_order::acquire);
+    waitForTimeline(queue_index, submitted);
+    return;
+  }
   const auto q = zisc::cast<zivcvk::Queue>(getQueue(cap, queue_index));
+  auto lock = (cap == Capability::kCompute) ? lockQueue(queue_index)
+                                            : std::unique_lock<std::mutex>{};
   q.waitIdle(dispatcher().loader());
 }
 
+/*!
+  \details The queue isn't locked during the wait.
+  If the device doesn't support timeline semaphores,
+  the queue is waited to be idle instead
+
+  \param [in] queue_index No description.
+  \param [in] timeline_value No description.
+  */
+void VulkanDevice::waitForTimeline(const uint32b queue_index,
+                                   const uint64b timeline_value) const
+{
+  if (!timeline_semaphore_enabled_) {
+    waitForCompletion(Capability::kCompute, queue_index);
+    return;
+  }
+  if (isCompleted(queue_index, timeline_value))
+    return;
+  const std::size_t index = queue_index % numOfQueues(Capability::kCompute);
+  const zivcvk::Device d{device()};
+  const auto semaphore = zisc::cast<zivcvk::Semaphore>((*queue_timeline_list_)[index]);
+  const zivcvk::SemaphoreWaitInfo wait_info{zivcvk::SemaphoreWaitFlags{},
+                                            1,
+                                            std::addressof(semaphore),
+                                            std::addressof(timeline_value)};
+  constexpr uint64b timeout = (std::numeric_limits<uint64b>::max)();
+  [[maybe_unused]] const auto result = d.waitSemaphores(wait_info,
+                                                        timeout,
+                                                        dispatcher().loader());
+  ZISC_ASSERT(result == zivcvk::Result::eSuccess, "Waiting for a timeline failed.");
+}
+
 /*!
   \details No detailed description
 
@@ -712,6 +1277,22 @@ void VulkanDevice::destroyData() noexcept
 
     setFenceSize(0); // Destroy all fences
 
+    // Queue timelines
+    if (queue_timeline_list_) {
+      for (VkSemaphore& semaphore : *queue_timeline_list_) {
+        zivcvk::Semaphore s{semaphore};
+        d.destroySemaphore(s, alloc, loader);
+        semaphore = ZIVC_VK_NULL_HANDLE;
+      }
+    }
+
+    // Descriptor pools
+    for (VkDescriptorPool& pool : *desc_pool_list_) {
+      zivcvk::DescriptorPool desc_pool{pool};
+      d.destroyDescriptorPool(desc_pool, alloc, loader);
+      pool = ZIVC_VK_NULL_HANDLE;
+    }
+
     // Kernel data
     for (auto& kernel : *kernel_data_list_)
       destroyShaderKernel(kernel.second.get());
@@ -720,22 +1301,29 @@ void VulkanDevice::destroyData() noexcept
     for (auto& module : *module_data_list_)
       destroyShaderModule(module.second.get());
 
-    // Command pool
-    zivcvk::CommandPool command_pool{command_pool_};
-    if (command_pool) {
-      //! \todo Fix me. AMD gpu won't work with custom allocator
-      d.destroyCommandPool(command_pool, nullptr /* alloc */, loader);
-      command_pool = nullptr;
+    // Command pools
+    if (command_pool_list_) {
+      for (auto& pool_data : *command_pool_list_) {
+        zivcvk::CommandPool command_pool{pool_data.second->pool_};
+        //! \todo Fix me. AMD gpu won't work with custom allocator
+        d.destroyCommandPool(command_pool, nullptr /* alloc */, loader);
+        pool_data.second->pool_ = ZIVC_VK_NULL_HANDLE;
+      }
     }
 
     d.destroy(alloc, loader);
     device_ = ZIVC_VK_NULL_HANDLE;
   }
 
+  tuned_work_group_size_list_.reset();
+  command_pool_list_.reset();
+  desc_pool_list_.reset();
   kernel_data_list_.reset();
   module_data_list_.reset();
   dispatcher_.reset();
   heap_usage_list_.reset();
+  queue_submission_list_.reset();
+  queue_timeline_list_.reset();
   queue_list_.reset();
   fence_list_.reset();
   fence_index_queue_.reset();
@@ -788,15 +1376,31 @@ void VulkanDevice::initData()
     zisc::pmr::polymorphic_allocator<KernelDataList> alloc{mem_resource};
     kernel_data_list_ = zisc::pmr::allocateUnique(alloc, std::move(module_list));
   }
+  {
+    using TunedSizeList = decltype(tuned_work_group_size_list_)::element_type;
+    TunedSizeList::allocator_type allocs{mem_resource};
+    TunedSizeList size_list{allocs};
+    zisc::pmr::polymorphic_allocator<TunedSizeList> alloc{mem_resource};
+    tuned_work_group_size_list_ = zisc::pmr::allocateUnique(alloc, std::move(size_list));
+  }
+  {
+    using PoolList = decltype(desc_pool_list_)::element_type;
+    PoolList::allocator_type allocs{mem_resource};
+    PoolList pool_list{allocs};
+    zisc::pmr::polymorphic_allocator<PoolList> alloc{mem_resource};
+    desc_pool_list_ = zisc::pmr::allocateUnique(alloc, std::move(pool_list));
+  }
 
   initCapability();
   initDispatcher();
   initWorkGroupSizeDim();
+  initTunedWorkGroupSizeList();
   initQueueFamilyIndexList();
   initDevice();
   initQueueList();
+  initQueueTimelineList();
   initMemoryAllocator();
-  initCommandPool();
+  initCommandPoolList();
   setFenceSize(1);
 }
 
@@ -815,17 +1419,11 @@ void VulkanDevice::updateDebugInfoImpl()
       setDebugInfo(zisc::cast<VkObjectType>(d.objectType), handle, name, this);
     }
   }
-  // Command pool
-  {
-    const VkCommandPool handle = commandPool();
-    const zivcvk::CommandPool p{handle};
-    if (p) {
-      IdData::NameType obj_name{""};
-      copyStr(id_data.name(), obj_name.data());
-      concatStr("_pool", obj_name.data());
-      const std::string_view name = obj_name.data();
-      setDebugInfo(zisc::cast<VkObjectType>(p.objectType), handle, name, this);
-    }
+  // Command pools
+  if (command_pool_list_) {
+    std::shared_lock<std::shared_mutex> lock{command_pool_mutex_};
+    for (const auto& pool_data : *command_pool_list_)
+      updateCommandPoolDebugInfo(pool_data.second->pool_);
   }
   // Queue
   const std::array<std::string_view, numOfCapabilities()> cap_name_list{{"_compute",
@@ -932,6 +1530,38 @@ void VulkanDevice::Callbacks::notifyOfDeviceMemoryDeallocation(
   sub_platform.notifyOfDeviceMemoryDeallocation(device_index, heap_index, size);
 }
 
+/*!
+  \details Each pool is twice as large as the previous one
+
+  \return No description
+  */
+VkDescriptorPool VulkanDevice::addDescriptorPool()
+{
+  // The number of sets in the first pool
+  constexpr uint32b base_pool_size = 64;
+  // The average number of storage buffers of a set
+  constexpr uint32b num_of_storage_buffers_per_set = 8;
+
+  auto& pool_list = *desc_pool_list_;
+  const std::size_t scale = (std::min)(pool_list.size(), std::size_t{10});
+  const uint32b num_of_sets = base_pool_size << scale;
+  const std::array<zivcvk::DescriptorPoolSize, 2> pool_size_list{{
+      {zivcvk::DescriptorType::eStorageBuffer, num_of_sets * num_of_storage_buffers_per_set},
+      {zivcvk::DescriptorType::eUniformBuffer, num_of_sets}}};
+  const zivcvk::DescriptorPoolCreateInfo create_info{
+      zivcvk::DescriptorPoolCreateFlagBits::eFreeDescriptorSet,
+      num_of_sets,
+      zisc::cast<uint32b>(pool_size_list.size()),
+      pool_size_list.data()};
+
+  zivcvk::Device d{device()};
+  zivcvk::AllocationCallbacks alloc{makeAllocator()};
+  const auto& loader = dispatcher().loader();
+  zivcvk::DescriptorPool desc_pool = d.createDescriptorPool(create_info, alloc, loader);
+  pool_list.emplace_back(zisc::cast<VkDescriptorPool>(desc_pool));
+  return pool_list.back();
+}
+
 /*!
   \details No detailed description
 
@@ -1044,6 +1674,34 @@ void VulkanDevice::destroyShaderModule(ModuleData* module) noexcept
   }
 }
 
+/*!
+  \details The search starts from a rotating queue, so the launches are
+  spread across the queues which have the same number of commands.
+  The returned index is relative to the offset of the range
+
+  \param [in] range No description.
+  \return No description
+  */
+uint32b VulkanDevice::findLeastLoadedQueue(const std::array<uint32b, 2>& range)
+{
+  const uint32b start = queue_counter_.fetch_add(1, std::memory_order::relaxed);
+  if (!timeline_semaphore_enabled_)
+    return start;
+
+  const uint32b n = range[1];
+  uint32b index = start;
+  uint64b min_commands = (std::numeric_limits<uint64b>::max)();
+  for (uint32b i = 0; (i < n) && (0 < min_commands); ++i) {
+    const uint32b q = (start + i) % n;
+    const uint64b num_of_commands = numOfInFlightCommands(range[0] + q);
+    if (num_of_commands < min_commands) {
+      index = q;
+      min_commands = num_of_commands;
+    }
+  }
+  return index;
+}
+
 /*!
   \details No detailed description
 
@@ -1127,6 +1785,39 @@ uint32b VulkanDevice::findQueueFamily(const Capability cap,
   return index;
 }
 
+/*!
+  \details A command pool is made when a thread uses the device first time.
+  The pool has a weak reference to a thread local token,
+  so the pool of an exited thread is detected.
+  When a new pool is made, the pools of the exited threads are reclaimed.
+  The id of an exited thread can be reused by a new thread,
+  in that case the pool of the id is taken over by the new thread
+
+  \return No description
+  */
+auto VulkanDevice::getThreadCommandPool() -> CommandPoolData&
+{
+  const std::thread::id id = std::this_thread::get_id();
+  {
+    std::shared_lock<std::shared_mutex> lock{command_pool_mutex_};
+    const auto it = command_pool_list_->find(id);
+    if ((it != command_pool_list_->end()) && !it->second->owner_.expired())
+      return *it->second;
+  }
+
+  std::unique_lock<std::shared_mutex> lock{command_pool_mutex_};
+  reclaimCommandPools(id);
+  const auto it = command_pool_list_->find(id);
+  if (it != command_pool_list_->end()) {
+    it->second->owner_ = getThreadToken();
+    return *it->second;
+  }
+  UniqueCommandPoolData pool_data = makeCommandPoolData();
+  CommandPoolData& data = *pool_data;
+  command_pool_list_->emplace(id, std::move(pool_data));
+  return data;
+}
+
 /*!
   \details No detailed description
 
@@ -1196,19 +1887,14 @@ void VulkanDevice::initCapability() noexcept
 /*!
   \details No detailed description
   */
-void VulkanDevice::initCommandPool()
+void VulkanDevice::initCommandPoolList()
 {
-  zivcvk::Device d{device()};
-  const auto& loader = dispatcher().loader();
-  zivcvk::AllocationCallbacks alloc{makeAllocator()};
-
-  const zivcvk::CommandPoolCreateInfo create_info{
-      zivcvk::CommandPoolCreateFlagBits::eResetCommandBuffer,
-      queueFamilyIndex(Capability::kCompute)};
-
-  //! \todo Fix me. AMD gpu won't work with custom allocator
-  auto command_pool = d.createCommandPool(create_info, nullptr /* alloc */, loader);
-  command_pool_ = zisc::cast<VkCommandPool>(command_pool);
+  auto* mem_resource = memoryResource();
+  using PoolList = decltype(command_pool_list_)::element_type;
+  PoolList::allocator_type allocs{mem_resource};
+  PoolList pool_list{allocs};
+  zisc::pmr::polymorphic_allocator<PoolList> alloc{mem_resource};
+  command_pool_list_ = zisc::pmr::allocateUnique(alloc, std::move(pool_list));
 }
 
 /*!
@@ -1235,6 +1921,20 @@ void VulkanDevice::initDevice()
     zisc::reinterp<zisc::pmr::vector<VkDeviceQueueCreateInfo>*>(&q_create_info_list),
     &priority_list);
 
+  // Global priority of the compute queues
+  const zivcvk::DeviceQueueGlobalPriorityCreateInfoEXT global_priority_info{
+      (0 < num_of_high_priority_queues_) ? zivcvk::QueueGlobalPriorityEXT::eHigh
+                                         : zivcvk::QueueGlobalPriorityEXT::eLow};
+  zivcvk::DeviceQueueCreateInfo* compute_create_info = nullptr;
+  if (global_priority_enabled_) {
+    const uint32b family_index = queueFamilyIndex(Capability::kCompute);
+    for (auto& create_info : q_create_info_list) {
+      if (create_info.queueFamilyIndex == family_index)
+        compute_create_info = &create_info;
+    }
+    compute_create_info->setPNext(std::addressof(global_priority_info));
+  }
+
   // Device features
   auto [device_features, f] = ::getDefaultFeatures(info, memoryResource());
 
@@ -1251,7 +1951,19 @@ void VulkanDevice::initDevice()
 
   zivcvk::AllocationCallbacks alloc{sub_platform.makeAllocator()};
   const auto pdevice = zisc::cast<zivcvk::PhysicalDevice>(info.device());
-  auto d = pdevice.createDevice(device_create_info, alloc, dispatcher().loader());
+  zivcvk::Device d{};
+  try {
+    d = pdevice.createDevice(device_create_info, alloc, dispatcher().loader());
+  }
+  catch (const zivcvk::SystemError& error) {
+    // The system can deny raising the global priority
+    if ((compute_create_info == nullptr) ||
+        (error.code() != zivcvk::Result::eErrorNotPermittedEXT))
+      throw;
+    compute_create_info->setPNext(nullptr);
+    global_priority_enabled_ = false;
+    d = pdevice.createDevice(device_create_info, alloc, dispatcher().loader());
+  }
   device_ = zisc::cast<VkDevice>(d);
   dispatcher_->set(device());
 }
@@ -1287,8 +1999,29 @@ void VulkanDevice::initProperties(zisc::pmr::vector<const char*>* extensions,
                  VK_KHR_PORTABILITY_SUBSET_EXTENSION_NAME};
 #endif // Z_MAC
 
+  const auto& info = deviceInfoImpl();
   if (hasCapability(Capability::kCompute)) {
     extensions->emplace_back(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME);
+    // Push descriptors are optional
+    push_descriptor_enabled_ = info.isExtensionSupported(VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME);
+    if (push_descriptor_enabled_)
+      extensions->emplace_back(VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME);
+    // Buffer device address is core in Vulkan 1.2 and optional in 1.1
+    // Timeline semaphores track the commands in flight of the queues
+    timeline_semaphore_enabled_ =
+        info.features().timeline_semaphore_.timelineSemaphore == VK_TRUE;
+    buffer_device_address_enabled_ = info.isBufferDeviceAddressSupported();
+    // Global priority is applied to the whole queue family,
+    // so it's used only when the declared queues have one priority
+    const bool has_high = 0 < num_of_high_priority_queues_;
+    const bool has_low = 0 < num_of_low_priority_queues_;
+    global_priority_enabled_ = (has_high != has_low) &&
+        info.isExtensionSupported(VK_EXT_GLOBAL_PRIORITY_EXTENSION_NAME);
+    if (global_priority_enabled_)
+      extensions->emplace_back(VK_EXT_GLOBAL_PRIORITY_EXTENSION_NAME);
+    if (buffer_device_address_enabled_ &&
+        info.isExtensionSupported(VK_KHR_BUFFER_DEVICE_ADDRESS_EXTENSION_NAME))
+      extensions->emplace_back(VK_KHR_BUFFER_DEVICE_ADDRESS_EXTENSION_NAME);
                             //VK_EXT_EXTERNAL_MEMORY_HOST_EXTENSION_NAME,
     // extensions->emplace_back(VK_KHR_MAINTENANCE_4_EXTENSION_NAME);
   }
@@ -1311,7 +2044,6 @@ void VulkanDevice::initProperties(zisc::pmr::vector<const char*>* extensions,
                  name);
     throw SystemError{ErrorCode::kVulkanInitializationFailed, message.data()};
   };
-  const auto& info = deviceInfoImpl();
   for (const char* prop : *extensions) {
     if (!info.isExtensionSupported(prop))
       throw_exception("Extension", prop);
@@ -1345,6 +2077,35 @@ void VulkanDevice::initWorkGroupSizeDim() noexcept
   }
 }
 
+/*!
+  \details Only the entries of the device are loaded. Invalid entries are skipped
+  */
+void VulkanDevice::initTunedWorkGroupSizeList()
+{
+  const std::string_view path = parentImpl().workGroupSizeCachePath();
+  if (path.empty())
+    return;
+
+  const IdData::NameType uuid = makeDeviceUuidString();
+  zisc::pmr::string::allocator_type alloc{memoryResource()};
+  const zisc::pmr::string path_str{path, alloc};
+  std::ifstream file{path_str.c_str()};
+  for (zisc::pmr::string line{alloc}; std::getline(file, line);) {
+    CacheEntry entry{};
+    const std::size_t n = ::splitCacheEntry(line, std::addressof(entry));
+    if ((n != entry.size()) || (entry[0] != uuid.data()))
+      continue;
+    uint64b id = 0;
+    std::array<uint32b, 3> work_group_size{{0, 0, 0}};
+    const bool is_valid = ::toInteger(entry[1], 16, std::addressof(id)) &&
+                          ::toInteger(entry[2], 10, std::addressof(work_group_size[0])) &&
+                          ::toInteger(entry[3], 10, std::addressof(work_group_size[1])) &&
+                          ::toInteger(entry[4], 10, std::addressof(work_group_size[2]));
+    if (is_valid && isValidWorkGroupSize(work_group_size))
+      (*tuned_work_group_size_list_)[id] = work_group_size;
+  }
+}
+
 /*!
   \details No detailed description
 
@@ -1398,6 +2159,20 @@ void VulkanDevice::initQueueCreateInfoList(
     offset += create_info.queueCount;
   }
 
+  // Set the priorities of compute queues
+  if (hasCapability(Capability::kCompute)) {
+    const uint32b family_index = queueFamilyIndex(Capability::kCompute);
+    zivcvk::DeviceQueueCreateInfo* create_info = find_create_info(family_index);
+    ZISC_ASSERT(create_info != nullptr, "Setting priority for compute failed.");
+    auto* p = const_cast<float*>(create_info->pQueuePriorities);
+    const auto n = zisc::cast<uint32b>(numOfQueues(Capability::kCompute));
+    for (uint32b i = 0; i < n; ++i) {
+      p[i] = (i < num_of_high_priority_queues_)     ? 1.0f :
+             (n - num_of_low_priority_queues_ <= i) ? 0.0f
+                                                    : 0.5f;
+    }
+  }
+
   // Set the priority for GUI to high
   if (hasCapability(Capability::kGui)) {
     const uint32b family_index = queueFamilyIndex(Capability::kGui);
@@ -1460,6 +2235,15 @@ void VulkanDevice::initQueueFamilyIndexList()
     queue_offset_list_[i] = offset;
     offset += queue_count_list_[i];
   }
+
+  // Split the compute queues by priority
+  {
+    const auto& sub_platform = parentImpl();
+    const auto n = zisc::cast<uint32b>(numOfQueues(Capability::kCompute));
+    num_of_high_priority_queues_ = (std::min)(sub_platform.numOfHighPriorityQueues(), n);
+    num_of_low_priority_queues_ = (std::min)(sub_platform.numOfLowPriorityQueues(),
+                                             n - num_of_high_priority_queues_);
+  }
 }
 
 /*!
@@ -1499,6 +2283,40 @@ void VulkanDevice::initQueueList()
   }
 }
 
+/*!
+  \details No detailed description
+  */
+void VulkanDevice::initQueueTimelineList()
+{
+  auto* mem_resource = memoryResource();
+  const std::size_t n = timeline_semaphore_enabled_ ? numOfQueues(Capability::kCompute) : 0;
+  {
+    using TimelineList = decltype(queue_timeline_list_)::element_type;
+    TimelineList::allocator_type allocs{mem_resource};
+    TimelineList timeline_list{allocs};
+    zisc::pmr::polymorphic_allocator<TimelineList> alloc{mem_resource};
+    queue_timeline_list_ = zisc::pmr::allocateUnique(alloc, std::move(timeline_list));
+  }
+  {
+    using SubmissionList = decltype(queue_submission_list_)::element_type;
+    SubmissionList::allocator_type allocs{mem_resource};
+    SubmissionList submission_list(n, 0, allocs);
+    zisc::pmr::polymorphic_allocator<SubmissionList> alloc{mem_resource};
+    queue_submission_list_ = zisc::pmr::allocateUnique(alloc, std::move(submission_list));
+  }
+
+  const zivcvk::Device d{device()};
+  zivcvk::AllocationCallbacks alloc{makeAllocator()};
+  queue_timeline_list_->reserve(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    const zivcvk::SemaphoreTypeCreateInfo type_info{zivcvk::SemaphoreType::eTimeline, 0};
+    zivcvk::SemaphoreCreateInfo info{};
+    info.setPNext(std::addressof(type_info));
+    zivcvk::Semaphore semaphore = d.createSemaphore(info, alloc, dispatcher().loader());
+    queue_timeline_list_->emplace_back(zisc::cast<VkSemaphore>(semaphore));
+  }
+}
+
 /*!
   \details No detailed description
   */
@@ -1513,6 +2331,8 @@ void VulkanDevice::initMemoryAllocator()
 
   VmaAllocatorCreateInfo create_info;
   create_info.flags = 0;
+  if (isBufferDeviceAddressEnabled())
+    create_info.flags |= VMA_ALLOCATOR_CREATE_BUFFER_DEVICE_ADDRESS_BIT;
   create_info.physicalDevice = info.device();
   create_info.device = device();
   create_info.preferredLargeHeapBlockSize = 0;
@@ -1547,6 +2367,138 @@ VmaDeviceMemoryCallbacks VulkanDevice::makeAllocationNotifier() noexcept
   return notifier;
 }
 
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+auto VulkanDevice::makeCommandPoolData() -> UniqueCommandPoolData
+{
+  const zivcvk::Device d{device()};
+  const zivcvk::CommandPoolCreateInfo create_info{
+      zivcvk::CommandPoolCreateFlagBits::eResetCommandBuffer,
+      queueFamilyIndex(Capability::kCompute)};
+  //! \todo Fix me. AMD gpu won't work with custom allocator
+  auto command_pool = d.createCommandPool(create_info,
+                                          nullptr /* alloc */,
+                                          dispatcher().loader());
+
+  auto* mem_resource = memoryResource();
+  using CommandList = decltype(CommandPoolData::free_list_);
+  using InFlightList = decltype(CommandPoolData::in_flight_list_);
+  CommandList::allocator_type command_alloc{mem_resource};
+  InFlightList::allocator_type in_flight_alloc{mem_resource};
+  CommandPoolData data{zisc::cast<VkCommandPool>(command_pool),
+                       CommandList{command_alloc},
+                       InFlightList{in_flight_alloc},
+                       getThreadToken()};
+  zisc::pmr::polymorphic_allocator<CommandPoolData> alloc{mem_resource};
+  UniqueCommandPoolData pool_data = zisc::pmr::allocateUnique(alloc, std::move(data));
+  updateCommandPoolDebugInfo(pool_data->pool_);
+  return pool_data;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+IdData::NameType VulkanDevice::makeDeviceUuidString() const noexcept
+{
+  const auto& uuid = deviceInfoImpl().properties().id_.deviceUUID;
+  constexpr char digits[] = "0123456789abcdef";
+  IdData::NameType uuid_str{""};
+  for (std::size_t i = 0; i < VK_UUID_SIZE; ++i) {
+    const auto byte = zisc::cast<uint32b>(uuid[i]);
+    uuid_str[2 * i] = digits[(byte >> 4u) & 0xfu];
+    uuid_str[2 * i + 1] = digits[byte & 0xfu];
+  }
+  return uuid_str;
+}
+
+/*!
+  \details The pool of an exited thread is destroyed once the device completed
+  all its command buffers. The pool list must be locked exclusively
+
+  \param [in] id The id of the calling thread. Its pool is kept.
+  */
+void VulkanDevice::reclaimCommandPools(const std::thread::id id)
+{
+  const zivcvk::Device d{device()};
+  for (auto it = command_pool_list_->begin(); it != command_pool_list_->end();) {
+    CommandPoolData& pool_data = *it->second;
+    auto is_completed = [this](const InFlightCommand& command)
+    {
+      return isCompleted(command.queue_index_, command.timeline_value_);
+    };
+    const bool is_reclaimable = (it->first != id) &&
+                                pool_data.owner_.expired() &&
+                                std::all_of(pool_data.in_flight_list_.begin(),
+                                            pool_data.in_flight_list_.end(),
+                                            is_completed);
+    if (!is_reclaimable) {
+      ++it;
+      continue;
+    }
+    zivcvk::CommandPool command_pool{pool_data.pool_};
+    //! \todo Fix me. AMD gpu won't work with custom allocator
+    d.destroyCommandPool(command_pool, nullptr /* alloc */, dispatcher().loader());
+    it = command_pool_list_->erase(it);
+  }
+}
+
+/*!
+  \details The in-flight command buffers are tracked with the timeline semaphores
+  of the queues. If the device doesn't support timeline semaphores,
+  the queue of the oldest command buffer is waited when the number of
+  the in-flight command buffers reaches the limit
+
+  \param [in,out] pool_data No description.
+  */
+void VulkanDevice::recycleCommandBuffers(CommandPoolData* pool_data)
+{
+  auto& in_flight_list = pool_data->in_flight_list_;
+  const auto end = in_flight_list.end();
+  auto completed = end;
+  if (timeline_semaphore_enabled_) {
+    auto is_in_flight = [this](const InFlightCommand& command)
+    {
+      return !isCompleted(command.queue_index_, command.timeline_value_);
+    };
+    completed = std::stable_partition(in_flight_list.begin(), end, is_in_flight);
+  }
+  else if (kMaxNumOfInFlightCommands <= in_flight_list.size()) {
+    const uint32b queue_index = in_flight_list.front().queue_index_;
+    waitForCompletion(Capability::kCompute, queue_index);
+    auto is_in_flight = [queue_index](const InFlightCommand& command) noexcept
+    {
+      return command.queue_index_ != queue_index;
+    };
+    completed = std::stable_partition(in_flight_list.begin(), end, is_in_flight);
+  }
+  for (auto it = completed; it != end; ++it)
+    pool_data->free_list_.push_back(it->command_);
+  in_flight_list.erase(completed, end);
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] pool No description.
+  */
+void VulkanDevice::updateCommandPoolDebugInfo(const VkCommandPool& pool)
+{
+  const zivcvk::CommandPool p{pool};
+  if (p) {
+    const IdData& id_data = id();
+    IdData::NameType obj_name{""};
+    copyStr(id_data.name(), obj_name.data());
+    concatStr("_pool", obj_name.data());
+    const std::string_view name = obj_name.data();
+    setDebugInfo(zisc::cast<VkObjectType>(p.objectType), pool, name, this);
+  }
+}
+
 /*!
   \details No detailed description
 
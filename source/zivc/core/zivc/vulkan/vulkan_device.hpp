@@ -17,11 +17,14 @@
 
 // Standard C++ library
 #include <array>
+#include <atomic>
 #include <cstddef>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <shared_mutex>
 #include <string_view>
+#include <thread>
 // Zisc
 #include "zisc/concepts.hpp"
 #include "zisc/data_structure/bounded_queue.hpp"
@@ -39,6 +42,7 @@
 #include "zivc/kernel_set.hpp"
 #include "zivc/zivc_config.hpp"
 #include "zivc/utility/id_data.hpp"
+#include "zivc/utility/launch_options.hpp"
 
 namespace zivc {
 
@@ -85,6 +89,8 @@ class VulkanDevice : public Device
     VkDescriptorSetLayout desc_set_layout_ = ZIVC_VK_NULL_HANDLE;
     VkPipelineLayout pipeline_layout_ = ZIVC_VK_NULL_HANDLE;
     VkPipeline pipeline_ = ZIVC_VK_NULL_HANDLE;
+    std::array<uint32b, 3> work_group_size_;
+    bool push_descriptor_ = false;
   };
 
   // Type aliases
@@ -99,10 +105,15 @@ class VulkanDevice : public Device
   ~VulkanDevice() noexcept override;
 
 
+  //! Take a command buffer from the command pool of the calling thread
+  [[nodiscard]]
+  VkCommandBuffer acquireCommandBuffer();
+
   //! Add a kernel of the give kernel name
   const KernelData& addShaderKernel(const ModuleData& module,
                                     const std::string_view kernel_name,
                                     const std::size_t work_dimension,
+                                    const std::array<uint32b, 3>& work_group_size,
                                     const std::size_t num_of_storage_buffers,
                                     const std::size_t num_of_uniform_buffers,
                                     const std::size_t num_of_local_args);
@@ -111,11 +122,10 @@ class VulkanDevice : public Device
   template <typename SetType>
   const ModuleData& addShaderModule(const KernelSet<SetType>& kernel_set);
 
-  //! Return the command pool for compute
-  VkCommandPool& commandPool() noexcept;
-
-  //! Return the command pool for compute
-  const VkCommandPool& commandPool() const noexcept;
+  //! Allocate a descriptor set of the given kernel from the shared pools
+  void allocateDescriptorSet(const KernelData& kernel,
+                             VkDescriptorPool* descriptor_pool,
+                             VkDescriptorSet* descriptor_set);
 
   //! Return the underlying vulkan device
   VkDevice& device() noexcept;
@@ -138,10 +148,31 @@ class VulkanDevice : public Device
   //! Return the queue family index list
   std::array<uint32b, kNumOfCapabilities> getQueueFamilyIndexList(uint32b* size) const noexcept;
 
+  //! Add the candidate work-group sizes of the given dimension into the list
+  void getWorkGroupSizeCandidates(
+      const std::size_t dim,
+      zisc::pmr::vector<std::array<uint32b, 3>>* candidate_list) const;
+
+  //! Return the descriptor set to the pool which it was allocated from
+  void freeDescriptorSet(VkDescriptorPool* descriptor_pool,
+                         VkDescriptorSet* descriptor_set) noexcept;
+
+  //! Find the tuned work-group size of the given kernel id
+  bool findTunedWorkGroupSize(const uint64b id,
+                              std::array<uint32b, 3>* work_group_size) const noexcept;
+
+  //! Return the device address of the given buffer
+  uint64b getBufferDeviceAddress(const VkBuffer& buffer) const noexcept;
+
   //! Return the kernel id of the given kernel name
   static uint64b getKernelId(const std::string_view module_name,
                              const std::string_view kernel_name) noexcept;
 
+  //! Return the kernel id of the given kernel name and work-group size
+  static uint64b getKernelId(const std::string_view module_name,
+                             const std::string_view kernel_name,
+                             const std::array<uint32b, 3>& work_group_size) noexcept;
+
   //! Return the shader module by the the given kernel set ID
   const KernelData& getShaderKernel(const uint64b id) const noexcept;
 
@@ -160,6 +191,18 @@ class VulkanDevice : public Device
   //! Return the invalid queue index in queue families
   static constexpr uint32b invalidQueueIndex() noexcept;
 
+  //! Check if buffers can be passed to kernels as device addresses
+  bool isBufferDeviceAddressEnabled() const noexcept;
+
+  //! Check if kernel buffers are bound with push descriptors
+  bool isPushDescriptorEnabled() const noexcept;
+
+  //! Issue an id which identifies a buffer memory allocation on the device
+  uint64b issueBufferAllocationId() noexcept;
+
+  //! Check if the given work-group size is supported by the device
+  bool isValidWorkGroupSize(const std::array<uint32b, 3>& work_group_size) const noexcept;
+
   //! Make a host memory allocator for Vulkan object
   VkAllocationCallbacks makeAllocator() noexcept;
 
@@ -180,9 +223,9 @@ class VulkanDevice : public Device
   CmdRecordRegion makeCmdRecord(const VkCommandBuffer& command_buffer,
                                 const VkCommandBufferUsageFlags flags) const;
 
-  //! Make a command buffer
+  //! Lock the given compute queue for a submission
   [[nodiscard]]
-  VkCommandBuffer makeCommandBuffer();
+  std::unique_lock<std::mutex> lockQueue(const uint32b queue_index) const;
 
   //! Make a debug label for a queue
   template <LabelOptions Options>
@@ -202,6 +245,9 @@ class VulkanDevice : public Device
   //! Return the memory allocator of the device
   const VmaAllocator& memoryAllocator() const noexcept;
 
+  //! Check if the device completed the given timeline value of the compute queue
+  bool isCompleted(const uint32b queue_index, const uint64b timeline_value) const;
+
   //! Return the memory usage by the given heap index
   zisc::Memory::Usage& memoryUsage(const std::size_t heap_index) noexcept override;
 
@@ -211,6 +257,9 @@ class VulkanDevice : public Device
   //! Return the number of available fences
   std::size_t numOfFences() const noexcept override;
 
+  //! Return the number of the commands in flight on the given compute queue
+  uint64b numOfInFlightCommands(const uint32b queue_index) const;
+
   //! Return the number of underlying command queues for compute
   std::size_t numOfQueues() const noexcept override;
 
@@ -220,9 +269,24 @@ class VulkanDevice : public Device
   //! Return an index of a queue family
   uint32b queueFamilyIndex(const Capability cap) const noexcept;
 
+  //! Return the offset and the number of the compute queues of the given priority
+  std::array<uint32b, 2> queueRange(const QueuePriority priority) const noexcept;
+
+  //! Return the given command buffer to the command pool of the calling thread
+  void releaseCommandBuffer(const VkCommandBuffer& command_buffer,
+                            const uint32b queue_index,
+                            const uint64b timeline_value);
+
   //! Return the use of the given fence to the device
   void returnFence(Fence* fence) noexcept override;
 
+  //! Select a compute queue for a launch with the given options
+  uint32b selectQueueIndex(const LaunchOptions& launch_options);
+
+  //! Save the tuned work-group size of the given kernel id
+  void saveTunedWorkGroupSize(const uint64b id,
+                              const std::array<uint32b, 3>& work_group_size);
+
   //! Set debug info of the given object
   void setDebugInfo(const VkObjectType vk_object_type,
                     const void* vk_handle,
@@ -233,9 +297,10 @@ class VulkanDevice : public Device
   void setFenceSize(const std::size_t s) override;
 
   //! Submit the given command
-  void submit(const VkCommandBuffer& command_buffer,
-              const VkQueue& q,
-              const Fence& fence) const;
+  uint64b submit(const VkCommandBuffer& command_buffer,
+                 const Capability cap,
+                 const uint32b queue_index,
+                 const Fence& fence) const;
 
   //! Take a use of a fence from the device
   void takeFence(Fence* fence) override;
@@ -252,6 +317,9 @@ class VulkanDevice : public Device
   //! Wait for a fence to be signaled
   void waitForCompletion(const Fence& fence) const override;
 
+  //! Wait for the given timeline value of the compute queue to be signaled
+  void waitForTimeline(const uint32b queue_index, const uint64b timeline_value) const;
+
   //! Return the work group size of the given dimension
   const std::array<uint32b, 3>& workGroupSizeDim(const std::size_t dim) const noexcept;
 
@@ -295,10 +363,42 @@ class VulkanDevice : public Device
         void* user_data);
   };
 
+  /*!
+    \brief A command buffer which is submitted to a compute queue
+
+    No detailed description.
+    */
+  struct InFlightCommand
+  {
+    VkCommandBuffer command_ = ZIVC_VK_NULL_HANDLE;
+    uint64b timeline_value_ = 0;
+    uint32b queue_index_ = 0;
+    [[maybe_unused]] Padding<4> pad_;
+  };
+
+  /*!
+    \brief The command pool of a thread and its command buffers
+
+    The command buffers are accessed only by the thread which owns the pool.
+    The owner expires when the thread exits.
+    */
+  struct CommandPoolData
+  {
+    VkCommandPool pool_ = ZIVC_VK_NULL_HANDLE;
+    zisc::pmr::vector<VkCommandBuffer> free_list_;
+    zisc::pmr::vector<InFlightCommand> in_flight_list_;
+    std::weak_ptr<const void> owner_;
+  };
+
   using IndexQueueImpl = zisc::ScalableCircularQueue<std::size_t>;
   using IndexQueue = zisc::BoundedQueue<IndexQueueImpl, std::size_t>;
   using UniqueModuleData = zisc::pmr::unique_ptr<ModuleData>;
   using UniqueKernelData = zisc::pmr::unique_ptr<KernelData>;
+  using UniqueCommandPoolData = zisc::pmr::unique_ptr<CommandPoolData>;
+  //! The number of the locks which are shared by the compute queues
+  static constexpr std::size_t kNumOfQueueLocks = 16;
+  //! The number of the in-flight command buffers of a thread which makes a wait
+  static constexpr std::size_t kMaxNumOfInFlightCommands = 64;
 
 
   //! Add a shader module of the given kernel set
@@ -330,17 +430,23 @@ class VulkanDevice : public Device
   //! Return the underlying fence index queue
   const IndexQueue& fenceIndexQueue() const noexcept;
 
+  //! Find the index of the compute queue which has the fewest commands in flight
+  uint32b findLeastLoadedQueue(const std::array<uint32b, 2>& range);
+
   //! Find the index of the optimal queue familty
   uint32b findQueueFamily(const Capability cap, uint32b* queue_count) const noexcept;
 
+  //! Return the command pool of the calling thread
+  CommandPoolData& getThreadCommandPool();
+
   //! Get Vulkan function pointers used in VMA
   VmaVulkanFunctions getVmaVulkanFunctions() const noexcept;
 
   //! Initialize capabilities
   void initCapability() noexcept;
 
-  //! Initialize a command pool
-  void initCommandPool();
+  //! Initialize the command pool list
+  void initCommandPoolList();
 
   //! Initialize a device
   void initDevice();
@@ -355,6 +461,12 @@ class VulkanDevice : public Device
   //! Initialize work group size of dimensions
   void initWorkGroupSizeDim() noexcept;
 
+  //! Add a new descriptor pool which is larger than the last one
+  VkDescriptorPool addDescriptorPool();
+
+  //! Load the tuned work-group sizes of the device from the cache file
+  void initTunedWorkGroupSizeList();
+
   //! Initialize queue create info list
   void initQueueCreateInfoList(
       zisc::pmr::vector<VkDeviceQueueCreateInfo>* create_info_list,
@@ -366,12 +478,21 @@ class VulkanDevice : public Device
   //! Initialize a queue list
   void initQueueList();
 
+  //! Initialize the timeline semaphores which track the commands of compute queues
+  void initQueueTimelineList();
+
   //! Initialize a vulkan memory allocator
   void initMemoryAllocator();
 
+  //! Make a command pool for the calling thread
+  UniqueCommandPoolData makeCommandPoolData();
+
   //! Make a device memory allocation notifier
   VmaDeviceMemoryCallbacks makeAllocationNotifier() noexcept;
 
+  //! Make the hex string of the device UUID
+  IdData::NameType makeDeviceUuidString() const noexcept;
+
   //! Return the number of supported capabilities
   static constexpr std::size_t numOfCapabilities() noexcept;
 
@@ -384,6 +505,15 @@ class VulkanDevice : public Device
   //! Return the offset of queue list for the given capability
   std::size_t queueOffset(const Capability cap) const noexcept;
 
+  //! Destroy the command pools of the exited threads
+  void reclaimCommandPools(const std::thread::id id);
+
+  //! Move the command buffers which the device completed into the free list
+  void recycleCommandBuffers(CommandPoolData* pool_data);
+
+  //! Update the debug info of the given command pool
+  void updateCommandPoolDebugInfo(const VkCommandPool& pool);
+
   //! Update the debug info of the fence by the given index
   void updateFenceDebugInfo(const std::size_t index);
 
@@ -395,21 +525,37 @@ class VulkanDevice : public Device
 
 
   mutable std::shared_mutex shader_mutex_;
+  mutable std::mutex tuning_mutex_;
+  std::mutex desc_pool_mutex_;
+  mutable std::shared_mutex command_pool_mutex_;
+  mutable std::array<std::mutex, kNumOfQueueLocks> queue_mutex_list_;
   VkDevice device_ = ZIVC_VK_NULL_HANDLE;
   VmaAllocator vm_allocator_ = ZIVC_VK_NULL_HANDLE;
-  VkCommandPool command_pool_ = ZIVC_VK_NULL_HANDLE;
+  zisc::pmr::unique_ptr<zisc::pmr::map<std::thread::id, UniqueCommandPoolData>> command_pool_list_;
   zisc::pmr::unique_ptr<IndexQueueImpl> fence_index_queue_;
   zisc::pmr::unique_ptr<zisc::pmr::vector<VkFence>> fence_list_;
   zisc::pmr::unique_ptr<zisc::pmr::vector<VkQueue>> queue_list_;
+  zisc::pmr::unique_ptr<zisc::pmr::vector<VkSemaphore>> queue_timeline_list_;
+  zisc::pmr::unique_ptr<zisc::pmr::vector<uint64b>> queue_submission_list_;
   zisc::pmr::unique_ptr<zisc::pmr::vector<zisc::Memory::Usage>> heap_usage_list_;
   zisc::pmr::unique_ptr<VulkanDispatchLoader> dispatcher_;
   zisc::pmr::unique_ptr<zisc::pmr::map<uint64b, UniqueModuleData>> module_data_list_;
   zisc::pmr::unique_ptr<zisc::pmr::map<uint64b, UniqueKernelData>> kernel_data_list_;
+  zisc::pmr::unique_ptr<zisc::pmr::map<uint64b, std::array<uint32b, 3>>> tuned_work_group_size_list_;
+  zisc::pmr::unique_ptr<zisc::pmr::vector<VkDescriptorPool>> desc_pool_list_;
   std::array<uint32b, kNumOfCapabilities> queue_family_index_list_;
   std::array<uint32b, kNumOfCapabilities> queue_count_list_;
   std::array<uint32b, kNumOfCapabilities> queue_offset_list_;
   uint32b capabilities_;
   std::array<std::array<uint32b, 3>, 3> work_group_size_list_;
+  std::atomic<uint32b> queue_counter_{0};
+  std::atomic<uint64b> buffer_allocation_counter_{0};
+  uint32b num_of_high_priority_queues_ = 0;
+  uint32b num_of_low_priority_queues_ = 0;
+  bool buffer_device_address_enabled_ = false;
+  bool global_priority_enabled_ = false;
+  bool push_descriptor_enabled_ = false;
+  bool timeline_semaphore_enabled_ = false;
 };
 
 } // namespace zivc
@@ -169,6 +169,30 @@ bool VulkanDeviceInfo::isLayerSupported(const std::string_view name) const noexc
   return result;
 }
 
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+bool VulkanDeviceInfo::isBufferDeviceAddressSupported() const noexcept
+{
+  const Features& f = features();
+  const bool result = f.buffer_device_address_.bufferDeviceAddress == VK_TRUE;
+  return result;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+bool VulkanDeviceInfo::isFloat64Supported() const noexcept
+{
+  const Features& f = features();
+  const bool result = f.features1_.shaderFloat64 == VK_TRUE;
+  return result;
+}
+
 /*!
   \details No detailed description
 
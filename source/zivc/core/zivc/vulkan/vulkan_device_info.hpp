@@ -258,6 +258,12 @@ class VulkanDeviceInfo : public DeviceInfo
   template <typename Type1, typename Type2, typename ...Types>
   static void link(Type1&& value1, Type2&& value2, Types&&... values) noexcept;
 
+  //! Check if buffers can be passed to kernels as device addresses
+  bool isBufferDeviceAddressSupported() const noexcept override;
+
+  //! Check if kernels can use double precision floating point
+  bool isFloat64Supported() const noexcept override;
+
   //! Return the possible maximum size of an allocation
   std::size_t maxAllocationSize() const noexcept override;
 
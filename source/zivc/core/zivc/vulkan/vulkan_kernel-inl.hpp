@@ -17,11 +17,14 @@
 
 #include "vulkan_kernel.hpp"
 // Standard C++ library
+#include <algorithm>
 #include <array>
+#include <chrono>
 #include <cstddef>
 #include <cstdio>
 #include <cstring>
 #include <memory>
+#include <mutex>
 #include <string_view>
 #include <tuple>
 #include <type_traits>
@@ -56,7 +59,12 @@
 namespace zivc {
 
 /*!
-  \details No detailed description
+  \details Each launch records the commands into a command buffer which is
+  taken from the command pool of the calling thread,
+  so the launches from different threads don't share the command buffer.
+  The descriptor set and the POD cache of the kernel are shared by the launches,
+  so they are updated after the device completes the last launch.
+  The launch doesn't wait if they aren't changed
 
   \tparam VKernel No description.
   \tparam Type No description.
@@ -73,6 +81,14 @@ LaunchResult VulkanKernelHelper::run(VKernel* kernel,
 {
   VulkanDevice& device = kernel->parentImpl();
 
+  if (kernel->work_group_size_tuning_pending_) {
+    kernel->work_group_size_tuning_pending_ = false;
+    tuneWorkGroupSize(kernel, launch_options, args...);
+  }
+
+  // The queue is selected first, since the last launch on another queue
+  // must be completed before the descriptor set and the POD buffer are reused
+  const uint32b queue_index = kernel->selectQueueIndex(launch_options);
   kernel->updateDescriptorSet(args...);
   // Prepare command buffer
   kernel->prepareCommandBuffer();
@@ -99,15 +115,165 @@ LaunchResult VulkanKernelHelper::run(VKernel* kernel,
   // Command submission
   {
     constexpr VulkanDeviceCapability cap = VulkanDeviceCapability::kCompute;
-    const VkQueue q = device.getQueue(cap, launch_options.queueIndex());
+    const VkQueue q = device.getQueue(cap, queue_index);
+    result.fence().setDevice(launch_options.isExternalSyncMode() ? &device : nullptr);
+    uint64b timeline_value = 0;
+    {
+      auto queue_lock = device.lockQueue(queue_index);
+      auto debug_region = device.makeQueueDebugLabel(q, launch_options);
+      timeline_value = device.submit(command, cap, queue_index, result.fence());
+    }
+    kernel->releaseCommandBuffer(queue_index, timeline_value);
+    kernel->setLastLaunch(queue_index, timeline_value);
+    result.setQueueIndex(queue_index);
+  }
+  result.setAsync(true);
+  return result;
+}
+
+/*!
+  \details The dims are converted into the work-group counts by a kernel
+  on the device, and the kernel is dispatched with vkCmdDispatchIndirect,
+  so no host synchronization is needed between the kernel which computes
+  the work size and this kernel.
+  The work size of the launch options is the upper bound of the dims.
+  The module scope push constants (global size and the number of work-groups)
+  are made from the bound since they can't be written on the device,
+  so the kernel should check the ID with the actual work size
+
+  \tparam VKernel No description.
+  \tparam Type No description.
+  \tparam Types No description.
+  \param [in] kernel No description.
+  \param [in] dims No description.
+  \param [in] launch_options No description.
+  \param [in,out] args No description.
+  \return No description
+  */
+template <typename VKernel, typename Type, typename ...Types> inline
+LaunchResult VulkanKernelHelper::runIndirect(VKernel* kernel,
+                                             Buffer<uint32b>& dims,
+                                             const Type& launch_options,
+                                             Types&& ...args)
+{
+  using KernelT = std::remove_cvref_t<VKernel>;
+  VulkanDevice& device = kernel->parentImpl();
+
+  // The dispatch size must be calculated on the same queue
+  const uint32b queue_index = kernel->selectQueueIndex(launch_options);
+  kernel->updateDescriptorSet(args...);
+  // Prepare command buffer
+  kernel->prepareCommandBuffer();
+  kernel->prepareDispatchSize();
+  VkCommandBuffer command = kernel->commandBuffer();
+  // Calculate the dispatch size on the device
+  {
+    // The dispatch size buffer can be still read by the last launch
+    kernel->waitForLastLaunch();
+    const auto bound = KernelT::expandWorkSize(launch_options.workSize(), 1);
+    VulkanKernelImpl impl{std::addressof(device)};
+    [[maybe_unused]] const LaunchResult r = impl.calcDispatchSize(
+        kernel->dispatch_size_kernel_.get(),
+        dims,
+        kernel->dispatch_size_.get(),
+        KernelT::dimension(),
+        bound,
+        kernel->workGroupSize(),
+        queue_index,
+        launch_options.queuePriority());
+  }
+  // Command recording
+  {
+    const bool have_new_pod = kernel->updatePodCacheIfNeeded(args...);
+    const auto work_size = kernel->calcDispatchWorkSize(launch_options.workSize());
+
+    const auto flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+    auto record_region = device.makeCmdRecord(command, flags);
+    {
+      auto debug_region = device.makeCmdDebugLabel(command, launch_options);
+      // Update global and region offsets with the bound
+      kernel->updateModuleScopePushConstantsCmd(work_size, launch_options);
+      // Update POD buffer
+      if (have_new_pod)
+        kernel->updatePodBufferCmd();
+      // Dispatch the kernel
+      kernel->dispatchIndirectCmd();
+    }
+  }
+  LaunchResult result{};
+  // Command submission
+  {
+    constexpr VulkanDeviceCapability cap = VulkanDeviceCapability::kCompute;
+    const VkQueue q = device.getQueue(cap, queue_index);
     result.fence().setDevice(launch_options.isExternalSyncMode() ? &device : nullptr);
-    auto debug_region = device.makeQueueDebugLabel(q, launch_options);
-    device.submit(command, q, result.fence());
+    uint64b timeline_value = 0;
+    {
+      auto queue_lock = device.lockQueue(queue_index);
+      auto debug_region = device.makeQueueDebugLabel(q, launch_options);
+      timeline_value = device.submit(command, cap, queue_index, result.fence());
+    }
+    kernel->releaseCommandBuffer(queue_index, timeline_value);
+    kernel->setLastLaunch(queue_index, timeline_value);
+    result.setQueueIndex(queue_index);
   }
   result.setAsync(true);
   return result;
 }
 
+/*!
+  \details Each candidate is launched several times and the fastest one is
+  kept and saved into the tuning cache of the device.
+  The kernel is run with the same arguments, so it must be idempotent
+
+  \tparam VKernel No description.
+  \tparam Type No description.
+  \tparam Types No description.
+  \param [in] kernel No description.
+  \param [in] launch_options No description.
+  \param [in,out] args No description.
+  */
+template <typename VKernel, typename Type, typename ...Types> inline
+void VulkanKernelHelper::tuneWorkGroupSize(VKernel* kernel,
+                                           const Type& launch_options,
+                                           Types&& ...args)
+{
+  using KernelT = std::remove_cvref_t<VKernel>;
+  using KernelData = VulkanDevice::KernelData;
+  VulkanDevice& device = kernel->parentImpl();
+  const auto* kernel_data = zisc::cast<const KernelData*>(kernel->kernel_data_);
+  const std::string_view module_name = kernel_data->module_->name_;
+  const std::string_view kernel_name{kernel_data->kernel_name_.data()};
+
+  zisc::pmr::vector<std::array<uint32b, 3>>::allocator_type alloc{device.memoryResource()};
+  zisc::pmr::vector<std::array<uint32b, 3>> candidate_list{alloc};
+  device.getWorkGroupSizeCandidates(KernelT::dimension(), &candidate_list);
+
+  // The first launch of each candidate is a warm-up
+  constexpr std::size_t num_of_trials = 4;
+  using Clock = std::chrono::steady_clock;
+  constexpr VulkanDeviceCapability cap = VulkanDeviceCapability::kCompute;
+  Clock::duration best_time = (Clock::duration::max)();
+  std::array<uint32b, 3> best_size = kernel->workGroupSize();
+  for (const std::array<uint32b, 3>& work_group_size : candidate_list) {
+    kernel->initKernelData(kernel_name, work_group_size);
+    Clock::duration time = (Clock::duration::max)();
+    for (std::size_t trial = 0; trial < num_of_trials; ++trial) {
+      const auto start = Clock::now();
+      const LaunchResult result = run(kernel, launch_options, args...);
+      device.waitForCompletion(cap, result.queueIndex());
+      if (0 < trial)
+        time = (std::min)(time, Clock::now() - start);
+    }
+    if (time < best_time) {
+      best_time = time;
+      best_size = work_group_size;
+    }
+  }
+  kernel->initKernelData(kernel_name, best_size);
+  const uint64b id = VulkanDevice::getKernelId(module_name, kernel_name);
+  device.saveTunedWorkGroupSize(id, best_size);
+}
+
 /*!
   \details No detailed description
 
@@ -127,8 +293,7 @@ void VulkanKernelHelper::updateModuleScopePushConstantsCmd(
   std::array<uint32b, 23> constans;
   constans.fill(0);
 
-  const VulkanDevice& device = kernel->parentImpl();
-  const auto& group_size = device.workGroupSizeDim(KernelT::dimension());
+  const auto& group_size = kernel->workGroupSize();
   // Global offset
   {
     const auto global_offset =
@@ -211,6 +376,18 @@ setCommandBufferRef(const VkCommandBuffer* command_ref) noexcept
   command_buffer_ref_ = command_ref;
 }
 
+/*!
+  \details No detailed description
+  \return No description
+  */
+template <std::size_t kDim, DerivedKSet KSet, typename ...FuncArgs, typename ...Args>
+inline
+constexpr bool VulkanKernel<KernelInitParams<kDim, KSet, FuncArgs...>, Args...>::
+usesBufferDeviceAddress() noexcept
+{
+  return kUsesDeviceAddress;
+}
+
 /*!
   \details No detailed description
   \return No description
@@ -250,6 +427,21 @@ hasPodArg() noexcept
   return result;
 }
 
+/*!
+  \details The POD buffer has the device addresses of buffer arguments
+  in addition to POD arguments if the buffer device address is used
+
+  \return No description
+  */
+template <std::size_t kDim, DerivedKSet KSet, typename ...FuncArgs, typename ...Args>
+inline
+constexpr bool VulkanKernel<KernelInitParams<kDim, KSet, FuncArgs...>, Args...>::
+hasPodBuffer() noexcept
+{
+  const bool result = hasPodArg() || usesBufferDeviceAddress();
+  return result;
+}
+
 /*!
   \details No detailed description
   */
@@ -261,11 +453,19 @@ destroyData() noexcept
   command_buffer_ = ZIVC_VK_NULL_HANDLE;
   pod_cache_.reset();
   pod_buffer_.reset();
+  dispatch_size_.reset();
+  dispatch_size_kernel_.reset();
   if (desc_pool_ != ZIVC_VK_NULL_HANDLE) {
     VulkanKernelImpl impl{std::addressof(parentImpl())};
-    impl.destroyDescriptorSet(std::addressof(desc_pool_));
+    impl.destroyDescriptorSet(std::addressof(desc_pool_), std::addressof(desc_set_));
   }
+  bound_buffer_list_.fill(ZIVC_VK_NULL_HANDLE);
+  bound_allocation_list_.fill(0);
   kernel_data_ = nullptr;
+  last_timeline_value_ = 0;
+  last_queue_index_ = 0;
+  has_last_launch_ = false;
+  work_group_size_tuning_pending_ = false;
 }
 
 /*!
@@ -280,12 +480,32 @@ dispatchCmd(const std::array<uint32b, 3>& work_size)
 {
   VulkanKernelImpl impl{std::addressof(parentImpl())};
   VkCommandBuffer command = commandBuffer();
+  if (desc_set_ == ZIVC_VK_NULL_HANDLE)
+    impl.pushDescriptorSetCmd(command, kernel_data_, bound_buffer_list_, descriptorTypeList());
   impl.dispatchCmd(command,
                    kernel_data_,
                    desc_set_,
                    work_size);
 }
 
+/*!
+  \details No detailed description
+  */
+template <std::size_t kDim, DerivedKSet KSet, typename ...FuncArgs, typename ...Args>
+inline
+void VulkanKernel<KernelInitParams<kDim, KSet, FuncArgs...>, Args...>::
+dispatchIndirectCmd()
+{
+  VulkanKernelImpl impl{std::addressof(parentImpl())};
+  VkCommandBuffer command = commandBuffer();
+  if (desc_set_ == ZIVC_VK_NULL_HANDLE)
+    impl.pushDescriptorSetCmd(command, kernel_data_, bound_buffer_list_, descriptorTypeList());
+  impl.dispatchIndirectCmd(command,
+                           kernel_data_,
+                           desc_set_,
+                           getBufferHandle(*dispatch_size_));
+}
+
 /*!
   \details No detailed description
 
@@ -306,23 +526,28 @@ initData(const Params& params)
   setCommandBufferRef(command_buffer_ref);
   // Add a shader module
   const auto& module_data = device.addShaderModule(KSet{});
+  // Select the work-group size
+  std::array<uint32b, 3> work_group_size = device.workGroupSizeDim(kDim);
+  const auto& explicit_size = params.workGroupSize();
+  if (explicit_size[0] != 0) {
+    work_group_size = BaseKernel::expandWorkSize(explicit_size, 1);
+    if (!device.isValidWorkGroupSize(work_group_size)) {
+      const char* message = "The work-group size isn't supported by the device.";
+      throw SystemError{ErrorCode::kInitializationFailed, message};
+    }
+  }
+  else if (params.isWorkGroupSizeTuningEnabled() && (command_buffer_ref == nullptr)) {
+    const uint64b id = VulkanDevice::getKernelId(module_data.name_, params.kernelName());
+    work_group_size_tuning_pending_ = !device.findTunedWorkGroupSize(id, &work_group_size);
+  }
   // Add a kernel data
-  const std::size_t num_of_storage_buffers = BaseKernel::ArgParser::kNumOfBufferArgs;
-  const std::size_t num_of_uniform_buffers = hasPodArg() ? 1 : 0;
-  const std::size_t num_of_local_args = BaseKernel::ArgParser::kNumOfLocalArgs;
-  const auto& kernel_data = device.addShaderKernel(module_data,
-                                                   params.kernelName(),
-                                                   BaseKernel::dimension(),
-                                                   num_of_storage_buffers,
-                                                   num_of_uniform_buffers,
-                                                   num_of_local_args);
-  kernel_data_ = std::addressof(kernel_data);
+  initKernelData(params.kernelName(), work_group_size);
   VulkanKernelImpl impl{std::addressof(device)};
-  impl.initDescriptorSet(num_of_storage_buffers,
-                         num_of_uniform_buffers,
-                         kernel_data_,
+  impl.initDescriptorSet(kernel_data_,
                          std::addressof(desc_pool_),
                          std::addressof(desc_set_));
+  bound_buffer_list_.fill(ZIVC_VK_NULL_HANDLE);
+  bound_allocation_list_.fill(0);
   initPodBuffer();
 }
 
@@ -349,9 +574,6 @@ updateDebugInfoImpl()
     }
   };
 
-  set_debug_info(VK_OBJECT_TYPE_DESCRIPTOR_POOL,
-                 desc_pool_,
-                 "_descpool");
   set_debug_info(VK_OBJECT_TYPE_DESCRIPTOR_SET,
                  desc_set_,
                  "_descset");
@@ -386,10 +608,28 @@ auto VulkanKernel<KernelInitParams<kDim, KSet, FuncArgs...>, Args...>::
 makePodCacheType(const KernelArgCache<PodTypes...>& cache) noexcept
 {
   using ArgParser = typename BaseKernel::ArgParser;
-  if constexpr (kIndex < ArgParser::kNumOfPodArgs) {
+  using ArgTuple = std::tuple<FuncArgs...>;
+  if constexpr (kUsesDeviceAddress) {
+    // Buffer arguments are replaced with 64bit addresses in the argument order
+    if constexpr (kIndex < ArgParser::kNumOfArgs) {
+      constexpr auto arg_info = ArgParser::getArgInfoList()[kIndex];
+      if constexpr (arg_info.isLocal()) {
+        return makePodCacheType<kIndex + 1>(cache);
+      }
+      else {
+        using ArgType = std::tuple_element_t<kIndex, ArgTuple>;
+        using PodType = std::conditional_t<arg_info.isPod(), ArgType, uint64b>;
+        auto precedence = concatArgCache<PodType>(cache);
+        return makePodCacheType<kIndex + 1>(precedence);
+      }
+    }
+    else {
+      return cache;
+    }
+  }
+  else if constexpr (kIndex < ArgParser::kNumOfPodArgs) {
     constexpr auto pod_arg_info = ArgParser::getPodArgInfoList();
     constexpr std::size_t pod_index = pod_arg_info[kIndex].index();
-    using ArgTuple = std::tuple<FuncArgs...>;
     using PodType = std::tuple_element_t<pod_index, ArgTuple>;
     auto precedence = concatArgCache<PodType>(cache);
     return makePodCacheType<kIndex + 1>(precedence);
@@ -411,8 +651,7 @@ inline
 std::array<uint32b, 3> VulkanKernel<KernelInitParams<kDim, KSet, FuncArgs...>, Args...>::
 calcDispatchWorkSize(const std::array<uint32b, kDim>& work_size) const noexcept
 {
-  const VulkanDevice& device = parentImpl();
-  const auto& group_size = device.workGroupSizeDim(BaseKernel::dimension());
+  const auto& group_size = workGroupSize();
   std::array<uint32b, 3> dispatch_size{{1, 1, 1}};
   for (std::size_t i = 0; i < BaseKernel::dimension(); ++i) {
     const uint32b s = (work_size[i] + group_size[i] - 1) / group_size[i];
@@ -421,6 +660,44 @@ calcDispatchWorkSize(const std::array<uint32b, kDim>& work_size) const noexcept
   return dispatch_size;
 }
 
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+template <std::size_t kDim, DerivedKSet KSet, typename ...FuncArgs, typename ...Args>
+inline
+constexpr auto VulkanKernel<KernelInitParams<kDim, KSet, FuncArgs...>, Args...>::
+descriptorTypeList() noexcept -> std::array<VkDescriptorType, kNumOfAllBuffers>
+{
+  std::array<VkDescriptorType, kNumOfAllBuffers> desc_type_list{};
+  for (VkDescriptorType& desc_type : desc_type_list)
+    desc_type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+  if constexpr (hasPodBuffer())
+    desc_type_list[kNumOfAllBuffers - 1] = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+  return desc_type_list;
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Type No description.
+  \param [in] buffer No description.
+  \return No description
+  */
+template <std::size_t kDim, DerivedKSet KSet, typename ...FuncArgs, typename ...Args>
+template <KernelArg Type>
+inline
+uint64b VulkanKernel<KernelInitParams<kDim, KSet, FuncArgs...>, Args...>::
+getBufferAllocationId(const Buffer<Type>& buffer) noexcept
+{
+  ZISC_ASSERT(buffer.type() == SubPlatformType::kVulkan, "The buffer isn't vulkan.");
+  using BufferT = VulkanBuffer<Type>;
+  using BufferData = typename BufferT::BufferData;
+  auto data = zisc::cast<const BufferData*>(buffer.rawBufferData());
+  return data->allocation_id_;
+}
+
 /*!
   \details No detailed description
 
@@ -441,6 +718,35 @@ getBufferHandle(const Buffer<Type>& buffer) noexcept
   return data->buffer_;
 }
 
+/*!
+  \details No detailed description
+
+  \param [in] kernel_name No description.
+  \param [in] work_group_size No description.
+  */
+template <std::size_t kDim, DerivedKSet KSet, typename ...FuncArgs, typename ...Args>
+inline
+void VulkanKernel<KernelInitParams<kDim, KSet, FuncArgs...>, Args...>::
+initKernelData(const std::string_view kernel_name,
+               const std::array<uint32b, 3>& work_group_size)
+{
+  VulkanDevice& device = parentImpl();
+  const auto& module_data = device.addShaderModule(KSet{});
+  const std::size_t num_of_storage_buffers = kUsesDeviceAddress
+      ? 0
+      : BaseKernel::ArgParser::kNumOfBufferArgs;
+  const std::size_t num_of_uniform_buffers = hasPodBuffer() ? 1 : 0;
+  const std::size_t num_of_local_args = BaseKernel::ArgParser::kNumOfLocalArgs;
+  const auto& kernel_data = device.addShaderKernel(module_data,
+                                                   kernel_name,
+                                                   BaseKernel::dimension(),
+                                                   work_group_size,
+                                                   num_of_storage_buffers,
+                                                   num_of_uniform_buffers,
+                                                   num_of_local_args);
+  kernel_data_ = std::addressof(kernel_data);
+}
+
 /*!
   \details No detailed description
 
@@ -448,6 +754,7 @@ getBufferHandle(const Buffer<Type>& buffer) noexcept
   \tparam Type No description.
   \tparam Types No description.
   \param [out] buffer_list No description.
+  \param [out] allocation_list No description.
   \param [in] value No description.
   \param [in] rest No description.
   */
@@ -455,15 +762,22 @@ template <std::size_t kDim, DerivedKSet KSet, typename ...FuncArgs, typename ...
 template <std::size_t kIndex, typename Type, typename ...Types>
 inline
 void VulkanKernel<KernelInitParams<kDim, KSet, FuncArgs...>, Args...>::
-initBufferList(VkBuffer* buffer_list, Type&& value, Types&&... rest) noexcept
+initBufferList(VkBuffer* buffer_list,
+               uint64b* allocation_list,
+               Type&& value,
+               Types&&... rest) noexcept
 {
   using T = std::remove_cvref_t<Type>;
   using ArgTypeInfo = KernelArgTypeInfo<T>;
-  if constexpr (!ArgTypeInfo::kIsPod)
+  if constexpr (!ArgTypeInfo::kIsPod) {
     buffer_list[kIndex] = getBufferHandle(value);
+    allocation_list[kIndex] = getBufferAllocationId(value);
+  }
   if constexpr (0 < sizeof...(Types)) {
     constexpr std::size_t next_index = !ArgTypeInfo::kIsPod ? kIndex + 1 : kIndex;
-    initBufferList<next_index>(buffer_list, std::forward<Types>(rest)...);
+    initBufferList<next_index>(buffer_list,
+                               allocation_list,
+                               std::forward<Types>(rest)...);
   }
 }
 
@@ -475,7 +789,7 @@ inline
 void VulkanKernel<KernelInitParams<kDim, KSet, FuncArgs...>, Args...>::
 initPodBuffer()
 {
-  if constexpr (hasPodArg()) {
+  if constexpr (hasPodBuffer()) {
     auto& device = parentImpl();
     using BuffType = VulkanBuffer<PodCacheT>;
     {
@@ -523,9 +837,12 @@ initPodCache(PodCacheT* cache, Type&& value, Types&&... rest) noexcept
   using ArgTypeInfo = KernelArgTypeInfo<T>;
   if constexpr (ArgTypeInfo::kIsPod)
     cache->template set<kIndex>(std::forward<Type>(value));
+  else if constexpr (kUsesDeviceAddress)
+    cache->template set<kIndex>(value.deviceAddress());
   constexpr bool has_rest = 0 < sizeof...(Types);
   if constexpr (has_rest) {
-    constexpr std::size_t next_index = ArgTypeInfo::kIsPod ? kIndex + 1 : kIndex;
+    constexpr bool is_cached = ArgTypeInfo::kIsPod || kUsesDeviceAddress;
+    constexpr std::size_t next_index = is_cached ? kIndex + 1 : kIndex;
     initPodCache<next_index>(cache, std::forward<Types>(rest)...);
   }
 }
@@ -542,7 +859,7 @@ auto VulkanKernel<KernelInitParams<kDim, KSet, FuncArgs...>, Args...>::
 makePodCache(Args... args) noexcept -> PodCacheT
 {
   PodCacheT cache{};
-  if constexpr (hasPodArg())
+  if constexpr (hasPodBuffer())
     initPodCache<0>(std::addressof(cache), args...);
   return cache;
 }
@@ -557,9 +874,7 @@ inline
 constexpr std::size_t VulkanKernel<KernelInitParams<kDim, KSet, FuncArgs...>, Args...>::
 numOfAllBuffers() noexcept
 {
-  std::size_t n = BaseKernel::ArgParser::kNumOfBufferArgs;
-  n += hasPodArg() ? 1 : 0;
-  return n;
+  return kNumOfAllBuffers;
 }
 
 /*!
@@ -598,14 +913,105 @@ inline
 void VulkanKernel<KernelInitParams<kDim, KSet, FuncArgs...>, Args...>::
 prepareCommandBuffer()
 {
-  VkCommandBuffer command = commandBuffer();
-  if (command == ZIVC_VK_NULL_HANDLE) {
+  if (command_buffer_ref_ == nullptr) {
     VulkanDevice& device = parentImpl();
-    command_buffer_ = device.makeCommandBuffer();
+    command_buffer_ = device.acquireCommandBuffer();
     updateCommandBufferDebugInfo();
   }
 }
 
+/*!
+  \details The dispatch size is calculated by an internal kernel
+  which has its own command buffer
+  */
+template <std::size_t kDim, DerivedKSet KSet, typename ...FuncArgs, typename ...Args>
+inline
+void VulkanKernel<KernelInitParams<kDim, KSet, FuncArgs...>, Args...>::
+prepareDispatchSize()
+{
+  if (dispatch_size_kernel_)
+    return;
+  VulkanDevice& device = parentImpl();
+  {
+    VulkanKernelImpl impl{std::addressof(device)};
+    dispatch_size_kernel_ = impl.makeDispatchSizeKernel();
+  }
+  {
+    BufferInitParams params{BufferUsage::kDeviceOnly};
+    params.setInternalBufferFlag(true);
+    dispatch_size_ = device.template makeBuffer<uint32b>(params);
+    dispatch_size_->setSize(3);
+  }
+}
+
+/*!
+  \details The command buffer reference isn't returned since it's owned by the user
+
+  \param [in] queue_index No description.
+  \param [in] timeline_value No description.
+  */
+template <std::size_t kDim, DerivedKSet KSet, typename ...FuncArgs, typename ...Args>
+inline
+void VulkanKernel<KernelInitParams<kDim, KSet, FuncArgs...>, Args...>::
+releaseCommandBuffer(const uint32b queue_index, const uint64b timeline_value)
+{
+  if (command_buffer_ != ZIVC_VK_NULL_HANDLE) {
+    VulkanDevice& device = parentImpl();
+    device.releaseCommandBuffer(command_buffer_, queue_index, timeline_value);
+    command_buffer_ = ZIVC_VK_NULL_HANDLE;
+  }
+}
+
+/*!
+  \details While the last launch of the kernel is in flight, the launches
+  with kRoundRobin or kLeastLoaded are submitted to the queue of the last launch,
+  so the launches of the kernel object are executed in order on one queue
+  and they don't wait for each other on a different queue.
+  The last queue is taken only if it's one of the queues of the priority
+  of the options. The queue of kFixed is respected.
+  The last launch is waited for if another queue is selected,
+  so the launches in flight are always on one queue and waiting for
+  the last launch waits for all of them before the POD buffer and
+  the descriptor set are reused
+
+  \param [in] launch_options No description.
+  \return No description
+  */
+template <std::size_t kDim, DerivedKSet KSet, typename ...FuncArgs, typename ...Args>
+inline
+uint32b VulkanKernel<KernelInitParams<kDim, KSet, FuncArgs...>, Args...>::
+selectQueueIndex(const LaunchOptions& launch_options)
+{
+  VulkanDevice& device = parentImpl();
+  const std::array<uint32b, 2> range = device.queueRange(launch_options.queuePriority());
+  const bool is_in_range = (range[0] <= last_queue_index_) &&
+                           (last_queue_index_ < range[0] + range[1]);
+  const bool is_pinned = has_last_launch_ && is_in_range &&
+      (launch_options.queueSelection() != QueueSelection::kFixed) &&
+      !device.isCompleted(last_queue_index_, last_timeline_value_);
+  const uint32b queue_index = is_pinned ? last_queue_index_
+                                        : device.selectQueueIndex(launch_options);
+  if (has_last_launch_ && (queue_index != last_queue_index_))
+    waitForLastLaunch();
+  return queue_index;
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] queue_index No description.
+  \param [in] timeline_value No description.
+  */
+template <std::size_t kDim, DerivedKSet KSet, typename ...FuncArgs, typename ...Args>
+inline
+void VulkanKernel<KernelInitParams<kDim, KSet, FuncArgs...>, Args...>::
+setLastLaunch(const uint32b queue_index, const uint64b timeline_value) noexcept
+{
+  last_queue_index_ = queue_index;
+  last_timeline_value_ = timeline_value;
+  has_last_launch_ = true;
+}
+
 /*!
   \details No detailed description
   */
@@ -635,7 +1041,9 @@ updateCommandBufferDebugInfo()
 }
 
 /*!
-  \details No detailed description
+  \details The buffers are identified by the handles and the allocation ids,
+  since a handle of a released memory can be reused by the driver
+  for another memory
 
   \param [in] args No description.
   */
@@ -645,16 +1053,27 @@ void VulkanKernel<KernelInitParams<kDim, KSet, FuncArgs...>, Args...>::
 updateDescriptorSet(Args... args)
 {
   constexpr std::size_t n = numOfAllBuffers();
-  std::array<VkBuffer, n> buffer_list{};
-  std::array<VkDescriptorType, n> desc_type_list{};
-  initBufferList<0>(buffer_list.data(), args...);
-  desc_type_list.fill(VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
-  if constexpr (hasPodArg()) {
+  BufferList buffer_list{};
+  AllocationIdList allocation_list{};
+  if constexpr (!kUsesDeviceAddress)
+    initBufferList<0>(buffer_list.data(), allocation_list.data(), args...);
+  if constexpr (hasPodBuffer()) {
     buffer_list[n - 1] = getBufferHandle(*pod_buffer_);
-    desc_type_list[n - 1] = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+    allocation_list[n - 1] = getBufferAllocationId(*pod_buffer_);
   }
-  VulkanKernelImpl impl{std::addressof(parentImpl())};
-  impl.updateDescriptorSet(desc_set_, buffer_list, desc_type_list);
+  // Skip the update if the kernel is launched with the same buffers as the last time
+  const bool is_updated = (desc_set_ != ZIVC_VK_NULL_HANDLE) &&
+                          ((buffer_list != bound_buffer_list_) ||
+                           (allocation_list != bound_allocation_list_));
+  if (is_updated) {
+    // The descriptor set can't be updated while the last launch uses it
+    waitForLastLaunch();
+    VulkanKernelImpl impl{std::addressof(parentImpl())};
+    impl.updateDescriptorSet(desc_set_, buffer_list, descriptorTypeList());
+  }
+  // Buffers of push descriptors are recorded on dispatch
+  bound_buffer_list_ = buffer_list;
+  bound_allocation_list_ = allocation_list;
 }
 
 /*!
@@ -687,16 +1106,19 @@ updatePodBufferCmd()
 template <std::size_t kDim, DerivedKSet KSet, typename ...FuncArgs, typename ...Args>
 inline
 bool VulkanKernel<KernelInitParams<kDim, KSet, FuncArgs...>, Args...>::
-updatePodCacheIfNeeded(Args... args) const noexcept
+updatePodCacheIfNeeded(Args... args)
 {
   bool have_new_pod = false;
-  if constexpr (hasPodArg()) {
+  if constexpr (hasPodBuffer()) {
     const PodCacheT data = makePodCache(args...);
     ZISC_ASSERT(pod_cache_->isHostVisible(), "The cache isn't host visible.");
     auto cache = pod_cache_->mapMemory();
     have_new_pod = cache[0] != data;
-    if (have_new_pod)
+    if (have_new_pod) {
+      // The last launch can be still copying the cache into the POD buffer
+      waitForLastLaunch();
       cache[0] = data;
+    }
   }
   return have_new_pod;
 }
@@ -711,7 +1133,14 @@ validateData()
 {
   const VulkanDevice& device = parentImpl();
   const DeviceInfo& info = device.deviceInfo();
-  if (info.maxNumOfBuffersPerKernel() < BaseKernel::numOfBuffers()) {
+  if constexpr (kUsesDeviceAddress) {
+    // Buffers aren't bound to descriptors, so the number of them isn't limited
+    if (!device.isBufferDeviceAddressEnabled()) {
+      const char* message = "The device doesn't support buffer device address.";
+      throw SystemError{ErrorCode::kInitializationFailed, message};
+    }
+  }
+  else if (info.maxNumOfBuffersPerKernel() < BaseKernel::numOfBuffers()) {
     char message[256] = "";
     std::sprintf(message,
         "The number of buffer arguments in the kernel exceeded the limit. limit=%d, buffers=%d",
@@ -721,6 +1150,37 @@ validateData()
   }
 }
 
+/*!
+  \details The timeline value of the last submission is waited,
+  so the other submissions of the queue aren't waited.
+  If the device doesn't support timeline semaphores, the queue is waited to be idle
+  */
+template <std::size_t kDim, DerivedKSet KSet, typename ...FuncArgs, typename ...Args>
+inline
+void VulkanKernel<KernelInitParams<kDim, KSet, FuncArgs...>, Args...>::
+waitForLastLaunch()
+{
+  if (has_last_launch_) {
+    const VulkanDevice& device = parentImpl();
+    device.waitForTimeline(last_queue_index_, last_timeline_value_);
+    has_last_launch_ = false;
+  }
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+template <std::size_t kDim, DerivedKSet KSet, typename ...FuncArgs, typename ...Args>
+inline
+const std::array<uint32b, 3>& VulkanKernel<KernelInitParams<kDim, KSet, FuncArgs...>, Args...>::
+workGroupSize() const noexcept
+{
+  const auto* kernel_data = zisc::cast<const VulkanDevice::KernelData*>(kernel_data_);
+  return kernel_data->work_group_size_;
+}
+
 } // namespace zivc
 
 #endif // ZIVC_VULKAN_KERNEL_INL_HPP
@@ -18,6 +18,8 @@
 // Standard C++ library
 #include <array>
 #include <cstddef>
+#include <mutex>
+#include <string_view>
 #include <type_traits>
 #include <utility>
 // Zisc
@@ -53,6 +55,19 @@ class VulkanKernelHelper
                           const Type& launch_options,
                           Types&& ...args);
 
+  //! Run the kernel with the work size which is computed on the device
+  template <typename VKernel, typename Type, typename ...Types>
+  static LaunchResult runIndirect(VKernel* kernel,
+                                  Buffer<uint32b>& dims,
+                                  const Type& launch_options,
+                                  Types&& ...args);
+
+  //! Select the fastest work-group size of the kernel by running candidates
+  template <typename VKernel, typename Type, typename ...Types>
+  static void tuneWorkGroupSize(VKernel* kernel,
+                                const Type& launch_options,
+                                Types&& ...args);
+
   //!
   template <typename VKernel, typename Type>
   static void updateModuleScopePushConstantsCmd(VKernel* kernel,
@@ -100,17 +115,38 @@ class VulkanKernel<KernelInitParams<kDim, KSet, FuncArgs...>, Args...> :
   //! Check if the kernel has pod arg
   static constexpr bool hasPodArg() noexcept;
 
+  //! Check if the kernel has the POD buffer
+  static constexpr bool hasPodBuffer() noexcept;
+
   //! Execute a kernel
   [[nodiscard("The result can have a fence when external sync mode is on.")]]
   LaunchResult run(Args... args, const LaunchOptions& launch_options) override
   {
     //! \note Separate declaration and definition cause a build error on visual studio
+    std::unique_lock<std::mutex> lock{launch_mutex_};
     return VulkanKernelHelper::run(this, launch_options, std::forward<Args>(args)...);
   }
 
+  //! Execute a kernel with the work size which is read from the given buffer on the device
+  [[nodiscard("The result can have a fence when external sync mode is on.")]]
+  LaunchResult runIndirect(Buffer<uint32b>& dims,
+                           Args... args,
+                           const LaunchOptions& launch_options) override
+  {
+    //! \note Separate declaration and definition cause a build error on visual studio
+    std::unique_lock<std::mutex> lock{launch_mutex_};
+    return VulkanKernelHelper::runIndirect(this,
+                                           dims,
+                                           launch_options,
+                                           std::forward<Args>(args)...);
+  }
+
   //! Set a command buffer reference
   void setCommandBufferRef(const VkCommandBuffer* command_ref) noexcept;
 
+  //! Check if buffer arguments are passed as device addresses
+  static constexpr bool usesBufferDeviceAddress() noexcept;
+
  protected:
   //! Clear the contents of the kernel
   void destroyData() noexcept override;
@@ -118,6 +154,9 @@ class VulkanKernel<KernelInitParams<kDim, KSet, FuncArgs...>, Args...> :
   //! Record dispatching the kernel to the parent device
   void dispatchCmd(const std::array<uint32b, 3>& work_size);
 
+  //! Record dispatching the kernel with the dispatch size on the device
+  void dispatchIndirectCmd();
+
   //! Initialize the kernel
   void initData(const Params& params) override;
 
@@ -133,6 +172,13 @@ class VulkanKernel<KernelInitParams<kDim, KSet, FuncArgs...>, Args...> :
   static auto makePodCacheType(const KernelArgCache<PodTypes...>& cache) noexcept;
 
 
+  static constexpr bool kUsesDeviceAddress = KSet::usesBufferDeviceAddress();
+  static constexpr std::size_t kNumOfAllBuffers = kUsesDeviceAddress
+      ? 1 // Only the POD buffer which has the buffer addresses
+      : BaseKernel::ArgParser::kNumOfBufferArgs +
+        ((0 < BaseKernel::ArgParser::kNumOfPodArgs) ? 1 : 0);
+  using BufferList = std::array<VkBuffer, kNumOfAllBuffers>;
+  using AllocationIdList = std::array<uint64b, kNumOfAllBuffers>;
   using PodCacheT = decltype(makePodCacheType<0>(KernelArgCache<void>{}));
   static_assert(std::is_trivially_copyable_v<PodCacheT>,
                 "The POD values aren't trivially copyable.");
@@ -143,13 +189,25 @@ class VulkanKernel<KernelInitParams<kDim, KSet, FuncArgs...>, Args...> :
   //! Calculate the dispatch work size
   std::array<uint32b, 3> calcDispatchWorkSize(const std::array<uint32b, kDim>& work_size) const noexcept;
 
+  //! Return the descriptor types of the buffers
+  static constexpr std::array<VkDescriptorType, kNumOfAllBuffers> descriptorTypeList() noexcept;
+
+  //! Get the allocation id of the underlying memory from the given buffer
+  template <KernelArg Type>
+  static uint64b getBufferAllocationId(const Buffer<Type>& buffer) noexcept;
+
   //! Get the underlying VkBuffer from the given buffer
   template <KernelArg Type>
   static const VkBuffer& getBufferHandle(const Buffer<Type>& buffer) noexcept;
 
+  //! Initialize the kernel data with the given work-group size
+  void initKernelData(const std::string_view kernel_name,
+                      const std::array<uint32b, 3>& work_group_size);
+
   //! Initialize the buffer list
   template <std::size_t kIndex, typename Type, typename ...Types>
   static void initBufferList(VkBuffer* buffer_list,
+                             uint64b* allocation_list,
                              Type&& value,
                              Types&&... rest) noexcept;
 
@@ -172,9 +230,21 @@ class VulkanKernel<KernelInitParams<kDim, KSet, FuncArgs...>, Args...> :
   //! Return the device
   const VulkanDevice& parentImpl() const noexcept;
 
-  //! Prepare command buffer
+  //! Take a command buffer for a launch from the device
   void prepareCommandBuffer();
 
+  //! Prepare the kernel and the buffer which calculate the dispatch size on the device
+  void prepareDispatchSize();
+
+  //! Return the command buffer of the launch to the device
+  void releaseCommandBuffer(const uint32b queue_index, const uint64b timeline_value);
+
+  //! Select the queue of a launch
+  uint32b selectQueueIndex(const LaunchOptions& launch_options);
+
+  //! Record the submission of the last launch
+  void setLastLaunch(const uint32b queue_index, const uint64b timeline_value) noexcept;
+
   //! Update debug info of the underlying command buffer
   void updateCommandBufferDebugInfo();
 
@@ -192,7 +262,7 @@ class VulkanKernel<KernelInitParams<kDim, KSet, FuncArgs...>, Args...> :
   }
 
   //! Update pod cache with the given args if needed
-  bool updatePodCacheIfNeeded(Args... args) const noexcept;
+  bool updatePodCacheIfNeeded(Args... args);
 
   //! Update POD buffer
   void updatePodBufferCmd();
@@ -200,14 +270,29 @@ class VulkanKernel<KernelInitParams<kDim, KSet, FuncArgs...>, Args...> :
   //! Validate kernel data
   void validateData();
 
+  //! Wait for the device to complete the last launch of the kernel
+  void waitForLastLaunch();
+
+  //! Return the work-group size of the kernel
+  const std::array<uint32b, 3>& workGroupSize() const noexcept;
+
 
+  std::mutex launch_mutex_;
   const void* kernel_data_ = nullptr;
   VkDescriptorPool desc_pool_ = ZIVC_VK_NULL_HANDLE;
   VkDescriptorSet desc_set_ = ZIVC_VK_NULL_HANDLE;
+  BufferList bound_buffer_list_;
+  AllocationIdList bound_allocation_list_;
   const VkCommandBuffer* command_buffer_ref_ = nullptr;
   VkCommandBuffer command_buffer_ = ZIVC_VK_NULL_HANDLE;
   SharedBuffer<PodCacheT> pod_buffer_;
   SharedBuffer<PodCacheT> pod_cache_;
+  SharedKernelCommon dispatch_size_kernel_;
+  SharedBuffer<uint32b> dispatch_size_;
+  uint64b last_timeline_value_ = 0;
+  uint32b last_queue_index_ = 0;
+  bool has_last_launch_ = false;
+  bool work_group_size_tuning_pending_ = false;
 };
 
 } // namespace zivc
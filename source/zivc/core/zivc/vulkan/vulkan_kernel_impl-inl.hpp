@@ -44,6 +44,33 @@ void VulkanKernelImpl::pushConstantCmd(const VkCommandBuffer& command_buffer,
   pushConstantCmd(command_buffer, kernel_data, offset, size, std::addressof(data));
 }
 
+/*!
+  \details No detailed description
+
+  \tparam kN No description.
+  \param [in] command_buffer No description.
+  \param [in] kernel_data No description.
+  \param [in] buffer_list No description.
+  \param [in] desc_type_list No description.
+  */
+template <std::size_t kN> inline
+void VulkanKernelImpl::pushDescriptorSetCmd(
+    const VkCommandBuffer& command_buffer,
+    const void* kernel_data,
+    const std::array<VkBuffer, kN>& buffer_list,
+    const std::array<VkDescriptorType, kN>& desc_type_list)
+{
+  std::array<VkDescriptorBufferInfo, kN> desc_info_list{};
+  std::array<VkWriteDescriptorSet, kN> write_desc_list{};
+  pushDescriptorSetCmd(command_buffer,
+                       kernel_data,
+                       kN,
+                       buffer_list.data(),
+                       desc_type_list.data(),
+                       desc_info_list.data(),
+                       write_desc_list.data());
+}
+
 /*!
   \details No detailed description
 
@@ -18,6 +18,7 @@
 #include <cstddef>
 #include <memory>
 #include <string_view>
+#include <type_traits>
 #include <utility>
 #include <vector>
 // Zisc
@@ -28,7 +29,28 @@
 #include "vulkan_device.hpp"
 #include "utility/vulkan_dispatch_loader.hpp"
 #include "utility/vulkan_hpp.hpp"
+#include "zivc/zivc.hpp"
 #include "zivc/zivc_config.hpp"
+#include "zivc/kernel_set/kernel_set-zivc_internal_kernel.hpp"
+#include "zivc/utility/launch_result.hpp"
+
+namespace {
+
+/*!
+  \details No detailed description
+
+  \param [in] device No description.
+  \return No description
+  */
+[[nodiscard]]
+auto makeDispatchSizeKernelImpl(zivc::VulkanDevice* device)
+{
+  auto p = ZIVC_MAKE_KERNEL_INIT_PARAMS(zivc_internal_kernel, Zivc_calcDispatchSizeKernel, 1);
+  auto kernel = device->makeKernel(p);
+  return kernel;
+}
+
+} // namespace
 
 namespace zivc {
 
@@ -76,24 +98,69 @@ void VulkanKernelImpl::addPodBarrierCmd(const VkCommandBuffer& command_buffer,
                           zdevice.dispatcher().loader());
 }
 
+/*!
+  \details The dispatch size kernel is launched on the given queue,
+  so it's executed before the kernel which is submitted after it.
+  The queue index is an index in all compute queues and
+  must be one of the queues of the priority
+
+  \param [in] dispatch_size_kernel No description.
+  \param [in] dims No description.
+  \param [out] dispatch_size No description.
+  \param [in] dimension No description.
+  \param [in] bound No description.
+  \param [in] work_group_size No description.
+  \param [in] queue_index No description.
+  \param [in] priority No description.
+  \return No description
+  */
+LaunchResult VulkanKernelImpl::calcDispatchSize(
+    KernelCommon* dispatch_size_kernel,
+    Buffer<uint32b>& dims,
+    Buffer<uint32b>* dispatch_size,
+    const std::size_t dimension,
+    const std::array<uint32b, 3>& bound,
+    const std::array<uint32b, 3>& work_group_size,
+    const uint32b queue_index,
+    const QueuePriority priority)
+{
+  using KernelT =
+      std::remove_cvref_t<decltype(*::makeDispatchSizeKernelImpl(nullptr))>;
+  using DispatchInfoT = zivc::cl::zivc_internal_kernel::zivc::DispatchInfo;
+  auto* kernel = zisc::cast<std::add_pointer_t<KernelT>>(dispatch_size_kernel);
+
+  auto launch_options = kernel->makeOptions();
+  launch_options.setWorkSize({3});
+  // The launch options take the index in the queues of the priority
+  const std::array<uint32b, 2> range = device().queueRange(priority);
+  ZISC_ASSERT((range[0] <= queue_index) && (queue_index < range[0] + range[1]),
+              "The queue isn't one of the queues of the priority.");
+  launch_options.setQueueIndex(queue_index - range[0]);
+  launch_options.setQueuePriority(priority);
+  launch_options.setExternalSyncMode(false);
+  launch_options.setLabel("DispatchSize");
+
+  DispatchInfoT info{};
+  info.setDimension(dimension);
+  for (std::size_t dim = 0; dim < bound.size(); ++dim) {
+    info.setBound(dim, bound[dim]);
+    info.setGroupSize(dim, work_group_size[dim]);
+  }
+
+  auto result = kernel->run(dims, *dispatch_size, info, launch_options);
+  return result;
+}
+
 /*!
   \details No detailed description
 
-  \param [out] descriptor_pool No description.
+  \param [in,out] descriptor_pool No description.
+  \param [in,out] descriptor_set No description.
   */
-void VulkanKernelImpl::destroyDescriptorSet(VkDescriptorPool* descriptor_pool) noexcept
+void VulkanKernelImpl::destroyDescriptorSet(VkDescriptorPool* descriptor_pool,
+                                            VkDescriptorSet* descriptor_set) noexcept
 {
-  auto& zdevice = device();
-  zivcvk::Device d{zdevice.device()};
-  if (d) {
-    zivcvk::AllocationCallbacks alloc{zdevice.makeAllocator()};
-    {
-      zivcvk::DescriptorPool desc_pool{*descriptor_pool};
-      if (desc_pool)
-        d.destroyDescriptorPool(desc_pool, alloc, zdevice.dispatcher().loader());
-      *descriptor_pool = ZIVC_VK_NULL_HANDLE;
-    }
-  }
+  device().freeDescriptorSet(descriptor_pool, descriptor_set);
 }
 
 /*!
@@ -115,10 +182,14 @@ void VulkanKernelImpl::dispatchCmd(const VkCommandBuffer& command_buffer,
   const zivcvk::CommandBuffer command{command_buffer};
   ZISC_ASSERT(command, "The given command buffer is null.");
 
+  addDispatchBarrierCmd(command_buffer);
+
   constexpr auto bind_point = zivcvk::PipelineBindPoint::eCompute;
   const zivcvk::PipelineLayout pline_layout{kdata->pipeline_layout_};
+  // The buffers of push descriptors are already recorded
   const zivcvk::DescriptorSet desc_set{descriptor_set};
-  command.bindDescriptorSets(bind_point, pline_layout, 0, desc_set, nullptr, loader);
+  if (desc_set)
+    command.bindDescriptorSets(bind_point, pline_layout, 0, desc_set, nullptr, loader);
 
   const zivcvk::Pipeline pline{kdata->pipeline_};
   command.bindPipeline(bind_point, pline, loader);
@@ -127,69 +198,112 @@ void VulkanKernelImpl::dispatchCmd(const VkCommandBuffer& command_buffer,
 }
 
 /*!
-  \details No detailed description
+  \details The dispatch size is written by a shader before the command,
+  so a barrier is recorded to make it visible to the indirect command read
 
-  \param [in] num_of_storage_buffers No description.
-  \param [in] num_of_uniform_buffers No description.
+  \param [in] command_buffer No description.
   \param [in] kernel_data No description.
-  \param [out] descriptor_pool No description.
-  \param [out] descriptor_set No description.
+  \param [in] descriptor_set No description.
+  \param [in] dispatch_size No description.
   */
-void VulkanKernelImpl::initDescriptorSet(
-    const std::size_t num_of_storage_buffers,
-    const std::size_t num_of_uniform_buffers,
-    const void* kernel_data,
-    VkDescriptorPool* descriptor_pool,
-    VkDescriptorSet* descriptor_set)
+void VulkanKernelImpl::dispatchIndirectCmd(const VkCommandBuffer& command_buffer,
+                                           const void* kernel_data,
+                                           const VkDescriptorSet& descriptor_set,
+                                           const VkBuffer& dispatch_size)
 {
+  const auto* kdata = zisc::cast<const VulkanDevice::KernelData*>(kernel_data);
   auto& zdevice = device();
-
-  zivcvk::Device d{zdevice.device()};
   const auto& loader = zdevice.dispatcher().loader();
-  auto* mem_resource = zdevice.memoryResource();
-  zivcvk::AllocationCallbacks alloc{zdevice.makeAllocator()};
 
-  // Initialize descriptor pool
-  zivcvk::DescriptorPool desc_pool;
-  {
-    using PoolSizeList = zisc::pmr::vector<zivcvk::DescriptorPoolSize>;
-    PoolSizeList::allocator_type pool_alloc{mem_resource};
-    PoolSizeList pool_size_list{pool_alloc};
-    pool_size_list.reserve(2);
-    // Storage buffers
-    if (0 < num_of_storage_buffers) {
-      pool_size_list.emplace_back(zivcvk::DescriptorType::eStorageBuffer,
-                                  zisc::cast<uint32b>(num_of_storage_buffers));
-    }
-    // Uniform buffer
-    if (0 < num_of_uniform_buffers) {
-      pool_size_list.emplace_back(zivcvk::DescriptorType::eUniformBuffer,
-                                  zisc::cast<uint32b>(num_of_uniform_buffers));
-    }
-    const zivcvk::DescriptorPoolCreateInfo create_info{
-        zivcvk::DescriptorPoolCreateFlags{},
-        1,
-        zisc::cast<uint32b>(pool_size_list.size()),
-        pool_size_list.data()};
-
-    desc_pool = d.createDescriptorPool(create_info, alloc, loader);
-  }
+  const zivcvk::CommandBuffer command{command_buffer};
+  ZISC_ASSERT(command, "The given command buffer is null.");
+  const zivcvk::Buffer dispatch_buffer{dispatch_size};
+  ZISC_ASSERT(dispatch_buffer, "The given dispatch size buffer is null.");
 
-  // Initialize descriptor set
+  addDispatchBarrierCmd(command_buffer);
   {
-    const auto* kdata = zisc::cast<const VulkanDevice::KernelData*>(kernel_data);
-    const zivcvk::DescriptorSetLayout desc_set_layout{kdata->desc_set_layout_};
-    const zivcvk::DescriptorSetAllocateInfo alloc_info{desc_pool,
-                                                       1,
-                                                       &desc_set_layout};
-    zisc::pmr::polymorphic_allocator<zivcvk::DescriptorSet> set_alloc{mem_resource};
-    auto desc_set = d.allocateDescriptorSets(alloc_info, set_alloc, loader);
-    ZISC_ASSERT(desc_set.size() == 1, "Multiple descriptor sets were created.");
-
-    // Output
-    *descriptor_pool = zisc::cast<VkDescriptorPool>(desc_pool);
-    *descriptor_set = zisc::cast<VkDescriptorSet>(desc_set[0]);
+    const zivcvk::BufferMemoryBarrier buff_barrier{
+        zivcvk::AccessFlagBits::eShaderWrite,
+        zivcvk::AccessFlagBits::eIndirectCommandRead,
+        zdevice.queueFamilyIndex(VulkanDeviceCapability::kCompute),
+        zdevice.queueFamilyIndex(VulkanDeviceCapability::kCompute),
+        dispatch_buffer,
+        0,
+        VK_WHOLE_SIZE};
+    command.pipelineBarrier(zivcvk::PipelineStageFlagBits::eComputeShader,
+                            zivcvk::PipelineStageFlagBits::eDrawIndirect,
+                            zivcvk::DependencyFlags{},
+                            nullptr,
+                            buff_barrier,
+                            nullptr,
+                            loader);
   }
+
+  constexpr auto bind_point = zivcvk::PipelineBindPoint::eCompute;
+  const zivcvk::PipelineLayout pline_layout{kdata->pipeline_layout_};
+  // The buffers of push descriptors are already recorded
+  const zivcvk::DescriptorSet desc_set{descriptor_set};
+  if (desc_set)
+    command.bindDescriptorSets(bind_point, pline_layout, 0, desc_set, nullptr, loader);
+
+  const zivcvk::Pipeline pline{kdata->pipeline_};
+  command.bindPipeline(bind_point, pline, loader);
+
+  command.dispatchIndirect(dispatch_buffer, 0, loader);
+}
+
+/*!
+  \details No descriptor set is allocated if the kernel uses push descriptors
+
+  \param [in] kernel_data No description.
+  \param [out] descriptor_pool No description.
+  \param [out] descriptor_set No description.
+  */
+void VulkanKernelImpl::initDescriptorSet(const void* kernel_data,
+                                         VkDescriptorPool* descriptor_pool,
+                                         VkDescriptorSet* descriptor_set)
+{
+  const auto* kdata = zisc::cast<const VulkanDevice::KernelData*>(kernel_data);
+  *descriptor_pool = ZIVC_VK_NULL_HANDLE;
+  *descriptor_set = ZIVC_VK_NULL_HANDLE;
+  if (!kdata->push_descriptor_)
+    device().allocateDescriptorSet(*kdata, descriptor_pool, descriptor_set);
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+SharedKernelCommon VulkanKernelImpl::makeDispatchSizeKernel()
+{
+  auto kernel = ::makeDispatchSizeKernelImpl(std::addressof(device()));
+  return std::move(kernel);
+}
+
+/*!
+  \details The commands on a queue can overlap without a barrier.
+  The barrier orders the dispatch after the preceding dispatches and
+  transfers on the queue, so dependent launches can be submitted to
+  the same queue without waiting on the host
+
+  \param [in] command_buffer No description.
+  */
+void VulkanKernelImpl::addDispatchBarrierCmd(const VkCommandBuffer& command_buffer)
+{
+  auto& zdevice = device();
+  const zivcvk::MemoryBarrier barrier{
+      zivcvk::AccessFlagBits::eShaderWrite | zivcvk::AccessFlagBits::eTransferWrite,
+      zivcvk::AccessFlagBits::eShaderRead | zivcvk::AccessFlagBits::eShaderWrite};
+  zivcvk::CommandBuffer command{command_buffer};
+  command.pipelineBarrier(zivcvk::PipelineStageFlagBits::eComputeShader |
+                              zivcvk::PipelineStageFlagBits::eTransfer,
+                          zivcvk::PipelineStageFlagBits::eComputeShader,
+                          zivcvk::DependencyFlags{},
+                          barrier,
+                          nullptr,
+                          nullptr,
+                          zdevice.dispatcher().loader());
 }
 
 /*!
@@ -214,6 +328,41 @@ const VulkanDevice& VulkanKernelImpl::device() const noexcept
   return *device_;
 }
 
+/*!
+  \details No detailed description
+
+  \param [in] descriptor_set No description.
+  \param [in] n No description.
+  \param [in] buffer_list No description.
+  \param [in] desc_type_list No description.
+  \param [out] desc_info_list No description.
+  \param [out] write_desc_list No description.
+  */
+void VulkanKernelImpl::initWriteDescriptorSetList(
+    const VkDescriptorSet& descriptor_set,
+    const std::size_t n,
+    const VkBuffer* buffer_list,
+    const VkDescriptorType* desc_type_list,
+    VkDescriptorBufferInfo* desc_info_list,
+    VkWriteDescriptorSet* write_desc_list) noexcept
+{
+  for (std::size_t i = 0; i < n; ++i) {
+    auto* desc_info = ::new (desc_info_list + i) zivcvk::DescriptorBufferInfo{};
+    desc_info->buffer= zisc::cast<const zivcvk::Buffer>(buffer_list[i]);
+    desc_info->offset = 0;
+    desc_info->range = VK_WHOLE_SIZE;
+
+    auto* write_desc = ::new (write_desc_list + i) zivcvk::WriteDescriptorSet{};
+    write_desc->dstSet = zisc::cast<const zivcvk::DescriptorSet>(descriptor_set);
+    write_desc->dstBinding = zisc::cast<uint32b>(i);
+    write_desc->dstArrayElement = 0;
+    write_desc->descriptorCount = 1;
+    const auto desc_type = zisc::cast<zivcvk::DescriptorType>(desc_type_list[i]);
+    write_desc->descriptorType = desc_type;
+    write_desc->pBufferInfo = desc_info;
+  }
+}
+
 /*!
   \details No detailed description
 
@@ -239,6 +388,44 @@ void VulkanKernelImpl::pushConstantCmd(const VkCommandBuffer& command_buffer,
   command.pushConstants(pline_l, stage_flag, o, s, data, loader);
 }
 
+/*!
+  \details No detailed description
+
+  \param [in] command_buffer No description.
+  \param [in] kernel_data No description.
+  \param [in] n No description.
+  \param [in] buffer_list No description.
+  \param [in] desc_type_list No description.
+  \param [out] desc_info_list No description.
+  \param [out] write_desc_list No description.
+  */
+void VulkanKernelImpl::pushDescriptorSetCmd(const VkCommandBuffer& command_buffer,
+                                            const void* kernel_data,
+                                            const std::size_t n,
+                                            const VkBuffer* buffer_list,
+                                            const VkDescriptorType* desc_type_list,
+                                            VkDescriptorBufferInfo* desc_info_list,
+                                            VkWriteDescriptorSet* write_desc_list)
+{
+  initWriteDescriptorSetList(ZIVC_VK_NULL_HANDLE,
+                             n,
+                             buffer_list,
+                             desc_type_list,
+                             desc_info_list,
+                             write_desc_list);
+  const auto* kdata = zisc::cast<const VulkanDevice::KernelData*>(kernel_data);
+  const auto& loader = device().dispatcher().loader();
+  const zivcvk::CommandBuffer command{command_buffer};
+  const zivcvk::PipelineLayout pline_layout{kdata->pipeline_layout_};
+  const auto* descs = zisc::reinterp<const zivcvk::WriteDescriptorSet*>(write_desc_list);
+  command.pushDescriptorSetKHR(zivcvk::PipelineBindPoint::eCompute,
+                               pline_layout,
+                               0,
+                               zisc::cast<uint32b>(n),
+                               descs,
+                               loader);
+}
+
 /*!
   \details No detailed description
 
@@ -256,22 +443,12 @@ void VulkanKernelImpl::updateDescriptorSet(const VkDescriptorSet& descriptor_set
                                            VkDescriptorBufferInfo* desc_info_list,
                                            VkWriteDescriptorSet* write_desc_list)
 {
-  for (std::size_t i = 0; i < n; ++i) {
-    auto* desc_info = ::new (desc_info_list + i) zivcvk::DescriptorBufferInfo{};
-    desc_info->buffer= zisc::cast<const zivcvk::Buffer>(buffer_list[i]);
-    desc_info->offset = 0;
-    desc_info->range = VK_WHOLE_SIZE;
-
-    auto* write_desc = ::new (write_desc_list + i) zivcvk::WriteDescriptorSet{};
-    write_desc->dstSet = zisc::cast<const zivcvk::DescriptorSet>(descriptor_set);
-    write_desc->dstBinding = zisc::cast<uint32b>(i);
-    write_desc->dstArrayElement = 0;
-    write_desc->descriptorCount = 1;
-    const auto desc_type = zisc::cast<zivcvk::DescriptorType>(desc_type_list[i]);
-    write_desc->descriptorType = desc_type;
-    write_desc->pBufferInfo = desc_info;
-  }
-
+  initWriteDescriptorSetList(descriptor_set,
+                             n,
+                             buffer_list,
+                             desc_type_list,
+                             desc_info_list,
+                             write_desc_list);
   zivcvk::Device d{device().device()};
   const auto& loader = device().dispatcher().loader();
   const auto* descs = zisc::reinterp<const zivcvk::WriteDescriptorSet*>(write_desc_list);
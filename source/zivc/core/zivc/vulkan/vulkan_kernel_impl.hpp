@@ -23,12 +23,15 @@
 #include "zisc/non_copyable.hpp"
 // Zivc
 #include "utility/vulkan.hpp"
+#include "zivc/kernel_common.hpp"
 #include "zivc/zivc_config.hpp"
+#include "zivc/utility/launch_result.hpp"
 
 namespace zivc {
 
 // Forward declaration
 class VulkanDevice;
+template <KernelArg> class Buffer;
 
 /*!
   \brief No brief description
@@ -49,8 +52,19 @@ class VulkanKernelImpl : private zisc::NonCopyable<VulkanKernelImpl>
   void addPodBarrierCmd(const VkCommandBuffer& command_buffer,
                         const VkBuffer& pod_buffer);
 
+  //! Convert the work size on the device into the dispatch size of an indirect dispatch
+  LaunchResult calcDispatchSize(KernelCommon* dispatch_size_kernel,
+                                Buffer<uint32b>& dims,
+                                Buffer<uint32b>* dispatch_size,
+                                const std::size_t dimension,
+                                const std::array<uint32b, 3>& bound,
+                                const std::array<uint32b, 3>& work_group_size,
+                                const uint32b queue_index,
+                                const QueuePriority priority);
+
   //! Destroy a descriptor set
-  void destroyDescriptorSet(VkDescriptorPool* descriptor_pool) noexcept;
+  void destroyDescriptorSet(VkDescriptorPool* descriptor_pool,
+                            VkDescriptorSet* descriptor_set) noexcept;
 
   //! Record dispatching the given kernel to the vulkan device
   void dispatchCmd(const VkCommandBuffer& command_buffer,
@@ -58,13 +72,28 @@ class VulkanKernelImpl : private zisc::NonCopyable<VulkanKernelImpl>
                    const VkDescriptorSet& descriptor_set,
                    const std::array<uint32b, 3>& dispatch_size);
 
+  //! Record dispatching the given kernel with the dispatch size on the device
+  void dispatchIndirectCmd(const VkCommandBuffer& command_buffer,
+                           const void* kernel_data,
+                           const VkDescriptorSet& descriptor_set,
+                           const VkBuffer& dispatch_size);
+
   //! Initialize a descriptor set of the kernel
-  void initDescriptorSet(const std::size_t num_of_storage_buffers,
-                         const std::size_t num_of_uniform_buffers,
-                         const void* kernel_data,
+  void initDescriptorSet(const void* kernel_data,
                          VkDescriptorPool* descriptor_pool,
                          VkDescriptorSet* descriptor_set);
 
+  //! Make a kernel which calculates the dispatch size of an indirect dispatch
+  [[nodiscard("The result will have a vulkan kernel.")]]
+  SharedKernelCommon makeDispatchSizeKernel();
+
+  //! Record pushing the given buffers to the kernel
+  template <std::size_t kN>
+  void pushDescriptorSetCmd(const VkCommandBuffer& command_buffer,
+                            const void* kernel_data,
+                            const std::array<VkBuffer, kN>& buffer_list,
+                            const std::array<VkDescriptorType, kN>& desc_type_list);
+
   //! Record push constant command
   template <typename Type>
   void pushConstantCmd(const VkCommandBuffer& command_buffer,
@@ -79,12 +108,32 @@ class VulkanKernelImpl : private zisc::NonCopyable<VulkanKernelImpl>
                            const std::array<VkDescriptorType, kN>& desc_type_list);
 
  private:
+  //! Add a barrier which makes the preceding writes on the queue visible to a dispatch
+  void addDispatchBarrierCmd(const VkCommandBuffer& command_buffer);
+
   //! Return the underlying device object
   VulkanDevice& device() noexcept;
 
   //! Return the underlying device object
   const VulkanDevice& device() const noexcept;
 
+  //! Initialize the descriptor writes of the given buffers
+  static void initWriteDescriptorSetList(const VkDescriptorSet& descriptor_set,
+                                         const std::size_t n,
+                                         const VkBuffer* buffer_list,
+                                         const VkDescriptorType* desc_type_list,
+                                         VkDescriptorBufferInfo* desc_info_list,
+                                         VkWriteDescriptorSet* write_desc_list) noexcept;
+
+  //! Record pushing the given buffers to the kernel
+  void pushDescriptorSetCmd(const VkCommandBuffer& command_buffer,
+                            const void* kernel_data,
+                            const std::size_t n,
+                            const VkBuffer* buffer_list,
+                            const VkDescriptorType* desc_type_list,
+                            VkDescriptorBufferInfo* desc_info_list,
+                            VkWriteDescriptorSet* write_desc_list);
+
   //! Record push constant command
   void pushConstantCmd(const VkCommandBuffer& command_buffer,
                        const void* kernel_data,
@@ -233,6 +233,28 @@ void VulkanSubPlatform::notifyOfDeviceMemoryDeallocation(
   usage.release(size);
 }
 
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+uint32b VulkanSubPlatform::numOfHighPriorityQueues() const noexcept
+{
+  return num_of_high_priority_queues_;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+uint32b VulkanSubPlatform::numOfLowPriorityQueues() const noexcept
+{
+  return num_of_low_priority_queues_;
+}
+
 /*!
   \details No detailed description
 
@@ -244,6 +266,18 @@ auto VulkanSubPlatform::windowSurfaceType() const noexcept -> WindowSurfaceType
   return window_surface_type_;
 }
 
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+std::string_view VulkanSubPlatform::workGroupSizeCachePath() const noexcept
+{
+  const std::string_view path{work_group_size_cache_path_.data()};
+  return path;
+}
+
 } // namespace zivc
 
 #endif // ZIVC_VULKAN_SUB_PLATFORM_INL_HPP
@@ -47,6 +47,7 @@
 #include "zivc/zivc_config.hpp"
 #include "zivc/utility/env_variable.hpp"
 #include "zivc/utility/error.hpp"
+#include "zivc/utility/id_data.hpp"
 
 namespace zivc {
 
@@ -190,6 +191,9 @@ void VulkanSubPlatform::updateDeviceInfoList()
 void VulkanSubPlatform::destroyData() noexcept
 {
   window_surface_type_ = WindowSurfaceType::kNone;
+  num_of_high_priority_queues_ = 0;
+  num_of_low_priority_queues_ = 0;
+  work_group_size_cache_path_.fill('\0');
   device_info_list_.reset();
   device_list_.reset();
   layer_properties_list_.reset();
@@ -213,6 +217,9 @@ void VulkanSubPlatform::destroyData() noexcept
   */
 void VulkanSubPlatform::initData(PlatformOptions& options)
 {
+  copyStr(options.workGroupSizeCachePath(), work_group_size_cache_path_.data());
+  num_of_high_priority_queues_ = options.numOfHighPriorityQueues();
+  num_of_low_priority_queues_ = options.numOfLowPriorityQueues();
   initDispatcher(options);
   initAllocator();
   initProperties();
@@ -36,6 +36,7 @@
 #include "zivc/device.hpp"
 #include "zivc/sub_platform.hpp"
 #include "zivc/zivc_config.hpp"
+#include "zivc/utility/id_data.hpp"
 
 namespace zivc {
 
@@ -128,6 +129,12 @@ class VulkanSubPlatform : public SubPlatform
   //! Return the number of available devices
   std::size_t numOfDevices() const noexcept override;
 
+  //! Return the number of the compute queues which have high priority
+  uint32b numOfHighPriorityQueues() const noexcept;
+
+  //! Return the number of the compute queues which have low priority
+  uint32b numOfLowPriorityQueues() const noexcept;
+
   //! Return the sub-platform type
   SubPlatformType type() const noexcept override;
 
@@ -137,6 +144,9 @@ class VulkanSubPlatform : public SubPlatform
   //! Return the window surface type activated
   WindowSurfaceType windowSurfaceType() const noexcept;
 
+  //! Return the path of the file which the tuned work-group sizes are saved into
+  std::string_view workGroupSizeCachePath() const noexcept;
+
  protected:
   //! Destroy the sub-platform
   void destroyData() noexcept override;
@@ -324,6 +334,9 @@ class VulkanSubPlatform : public SubPlatform
   zisc::pmr::unique_ptr<zisc::pmr::vector<VkPhysicalDevice>> device_list_;
   zisc::pmr::unique_ptr<zisc::pmr::vector<VulkanDeviceInfo>> device_info_list_;
   WindowSurfaceType window_surface_type_ = WindowSurfaceType::kNone;
+  uint32b num_of_high_priority_queues_ = 0;
+  uint32b num_of_low_priority_queues_ = 0;
+  IdData::NameType work_group_size_cache_path_;
   [[maybe_unused]] Padding<4> pad_;
   char engine_name_[32] = "Zivc";
 };
@@ -17,8 +17,15 @@
 
 #include "zivc.hpp"
 // Standard C++ library
+#include <algorithm>
+#include <array>
 #include <cstddef>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <ios>
 #include <string_view>
+#include <system_error>
 #include <utility>
 // Zisc
 #include "zisc/concepts.hpp"
@@ -34,6 +41,7 @@
 #include "cpu/cpu_kernel.hpp"
 #include "utility/buffer_init_params.hpp"
 #include "utility/buffer_launch_options.hpp"
+#include "utility/error.hpp"
 #include "utility/kernel_arg_parser.hpp"
 #include "utility/kernel_init_params.hpp"
 #include "utility/launch_result.hpp"
@@ -83,6 +91,89 @@ LaunchResult copy(const Buffer<SrcType>& source,
   return result;
 }
 
+/*!
+  \details The elements are read from the file at the given byte offset and
+  written into the dest range specified by the launch options.
+  A host visible buffer is read into directly. Otherwise the file is streamed
+  through two host-to-device staging buffers with copyFrom, so that reading
+  a chunk from the file overlaps the device copy of the previous chunk.
+  The function returns after all copies are completed
+
+  \tparam Type No description.
+  \param [in] file_path No description.
+  \param [in] file_offset_in_bytes No description.
+  \param [out] dest No description.
+  \param [in] launch_options No description.
+  \return No description
+  */
+template <KernelArg Type> inline
+LaunchResult copyFromFile(const std::filesystem::path& file_path,
+                          const std::size_t file_offset_in_bytes,
+                          Buffer<Type>* dest,
+                          const BufferLaunchOptions<Type>& launch_options)
+{
+  using T = typename Buffer<Type>::Type;
+  std::ifstream file{file_path, std::ios_base::binary};
+  file.seekg(zisc::cast<std::streamoff>(file_offset_in_bytes));
+  auto read_file = [&file, &file_path](T* data, const std::size_t n)
+  {
+    const auto s = zisc::cast<std::streamsize>(sizeof(T) * n);
+    file.read(zisc::reinterp<char*>(data), s);
+    if (!file) {
+      char message[512] = "";
+      std::snprintf(message, sizeof(message), "Reading a file failed: %s",
+                    file_path.string().c_str());
+      throw SystemError{ErrorCode::kFileIoFailed, message};
+    }
+  };
+
+  const std::size_t size = launch_options.size();
+  if (dest->isHostVisible()) {
+    auto mem = dest->mapMemory();
+    read_file(mem.data() + launch_options.destOffset(), size);
+    return LaunchResult{};
+  }
+
+  // Stream the file through staging buffers
+  constexpr std::size_t chunk_size_in_bytes = 16ull * 1024ull * 1024ull;
+  constexpr std::size_t max_chunk_size = (std::max)(chunk_size_in_bytes / sizeof(T),
+                                                    std::size_t{1});
+  const std::size_t chunk_size = (std::min)(size, max_chunk_size);
+  auto* device = zisc::cast<Device*>(dest->getParent());
+  std::array<SharedBuffer<Type>, 2> staging_list;
+  for (auto& staging : staging_list) {
+    staging = makeBuffer<Type>(device, BufferInitParams{BufferUsage::kHostToDevice});
+    staging->setSize(chunk_size);
+  }
+  std::array<LaunchResult, 2> result_list;
+  std::size_t index = 0;
+  for (std::size_t offset = 0; offset < size; offset += chunk_size, index ^= 1) {
+    // Wait for the previous copy from the staging buffer
+    if (result_list[index].isAsync())
+      device->waitForCompletion(result_list[index].fence());
+    const std::size_t n = (std::min)(chunk_size, size - offset);
+    {
+      auto mem = staging_list[index]->mapMemory();
+      read_file(mem.data(), n);
+    }
+    auto options = dest->makeOptions();
+    options.setDestOffset(launch_options.destOffset() + offset);
+    options.setSize(n);
+    options.setQueueIndex(launch_options.queueIndex());
+    options.setQueuePriority(launch_options.queuePriority());
+    options.setQueueSelection(launch_options.queueSelection());
+    options.setExternalSyncMode(true);
+    options.setLabel(launch_options.label());
+    options.setLabelColor(launch_options.labelColor());
+    result_list[index] = dest->copyFrom(*staging_list[index], options);
+  }
+  for (const LaunchResult& result : result_list) {
+    if (result.isAsync())
+      device->waitForCompletion(result.fence());
+  }
+  return LaunchResult{};
+}
+
 /*!
   \details No detailed description
 
@@ -152,6 +243,51 @@ SharedBuffer<Type> makeBuffer(Device* device, const BufferInitParams& params)
   return buffer;
 }
 
+/*!
+  \details On the cpu device the buffer is a zero-copy view of the memory-mapped
+  file (see CpuBuffer::mapFile), so the cost doesn't depend on the file size.
+  On the other devices the file contents are streamed into a new buffer
+  by copyFromFile
+
+  \tparam Type No description.
+  \param [in,out] device No description.
+  \param [in] params No description.
+  \param [in] file_path No description.
+  \param [in] offset_in_bytes No description.
+  \return No description
+  */
+template <KernelArg Type> inline
+SharedBuffer<Type> makeFileBuffer(Device* device,
+                                  const BufferInitParams& params,
+                                  const std::filesystem::path& file_path,
+                                  const std::size_t offset_in_bytes)
+{
+  SharedBuffer<Type> buffer = makeBuffer<Type>(device, params);
+  if (device->type() == SubPlatformType::kCpu) {
+    auto* b = zisc::cast<CpuBuffer<Type>*>(buffer.get());
+    b->mapFile(file_path, offset_in_bytes);
+    return buffer;
+  }
+
+  std::error_code error;
+  const std::size_t file_size = std::filesystem::file_size(file_path, error);
+  if (error || (file_size < offset_in_bytes)) {
+    char message[512] = "";
+    std::snprintf(message, sizeof(message),
+                  "The file range can't be read: %s, offset=%zu.",
+                  file_path.string().c_str(), offset_in_bytes);
+    throw SystemError{ErrorCode::kFileIoFailed, message};
+  }
+  buffer->setSize((file_size - offset_in_bytes) / sizeof(Type));
+  if (0 < buffer->size()) {
+    [[maybe_unused]] auto result = copyFromFile(file_path,
+                                                offset_in_bytes,
+                                                buffer.get(),
+                                                buffer->makeOptions());
+  }
+  return buffer;
+}
+
 /*!
   \details No detailed description
 
@@ -17,6 +17,7 @@
 
 // Standard C++ library
 #include <cstddef>
+#include <filesystem>
 #include <string_view>
 // Zisc
 #include "zisc/concepts.hpp"
@@ -27,10 +28,12 @@
 #include "kernel_set.hpp"
 #include "platform.hpp"
 #include "platform_options.hpp"
+#include "primitives.hpp"
 #include "cpu/cpu_buffer.hpp"
 #include "cpu/cpu_device.hpp"
 #include "cpu/cpu_kernel.hpp"
 #include "utility/buffer_init_params.hpp"
+#include "utility/chunked_buffer.hpp"
 #include "utility/error.hpp"
 #include "utility/kernel_init_params.hpp"
 #if defined(ZIVC_ENABLE_VULKAN_SUB_PLATFORM)
@@ -42,11 +45,26 @@
 
 namespace zivc {
 
+//! Copy the contents of the given file into the buffer
+template <KernelArg Type>
+LaunchResult copyFromFile(const std::filesystem::path& file_path,
+                          const std::size_t file_offset_in_bytes,
+                          Buffer<Type>* dest,
+                          const BufferLaunchOptions<Type>& launch_options);
+
 //! Make a buffer
 template <KernelArg Type>
 [[nodiscard]]
 SharedBuffer<Type> makeBuffer(Device* device, const BufferInitParams& params);
 
+//! Make a buffer which holds the contents of the given file
+template <KernelArg Type>
+[[nodiscard]]
+SharedBuffer<Type> makeFileBuffer(Device* device,
+                                  const BufferInitParams& params,
+                                  const std::filesystem::path& file_path,
+                                  const std::size_t offset_in_bytes = 0);
+
 //! Make a kernel
 template <std::size_t kDim, DerivedKSet KSet, typename ...Args>
 [[nodiscard]]
@@ -21,6 +21,7 @@
 #include <string_view>
 #include <type_traits>
 // Zisc
+#include "zisc/ieee_754_binary.hpp"
 #include "zisc/utility.hpp"
 #include "zisc/zisc_config.hpp"
 
@@ -38,6 +39,9 @@ using uint8b = zisc::uint8b;
 using uint16b = zisc::uint16b;
 using uint32b = zisc::uint32b;
 using uint64b = zisc::uint64b;
+// Floating point types
+//! IEEE 754 binary16 storage type, usable as a buffer element and a kernel arg
+using half = zisc::Binary16;
 
 //! Represent a padding for structure
 template <std::size_t kSize>
@@ -67,6 +71,73 @@ enum class VulkanDeviceCapability : uint32b
   kGui
 };
 
+/*!
+  \brief How a launch selects a queue of the device
+
+  kFixed uses the queue index of the launch options.
+  kRoundRobin and kLeastLoaded spread independent launches across the queues,
+  so they can overlap each other. The launches have no order between them.
+  */
+enum class QueueSelection : uint32b
+{
+  kFixed = 0,
+  kRoundRobin,
+  kLeastLoaded
+};
+
+/*!
+  \brief The priority of the queue which a launch is submitted to
+
+  The high and low priority queues are declared by the platform options.
+  A launch of a priority which doesn't have queues uses all queues.
+  The launches of different priorities have no order between them.
+  */
+enum class QueuePriority : uint32b
+{
+  kNormal = 0,
+  kHigh,
+  kLow
+};
+
+/*!
+  \brief A feature of the host CPU
+
+  No detailed description.
+  */
+enum class CpuFeature : uint32b
+{
+  kSse3 = 0,
+  kSsse3,
+  kSse41,
+  kSse42,
+  kPopcnt,
+  kAvx,
+  kAvx2,
+  kBmi1,
+  kBmi2,
+  kF16c,
+  kFma,
+  kMovbe,
+  kAvx512f,
+  kAvx512bw,
+  kAvx512cd,
+  kAvx512dq,
+  kAvx512vl
+};
+
+/*!
+  \brief An instruction set level which CPU kernels are compiled for
+
+  The x86-64 levels follow the x86-64 psABI micro-architecture levels.
+  */
+enum class CpuIsaLevel : uint32b
+{
+  kBaseline = 0,
+  kX86_64V2,
+  kX86_64V3,
+  kX86_64V4
+};
+
 // Buffer
 
 /*!
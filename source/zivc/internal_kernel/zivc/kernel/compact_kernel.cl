@@ -0,0 +1,158 @@
+/*!
+  \file compact_kernel.cl
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2021 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZIVC_COMPACT_KERNEL_CL
+#define ZIVC_COMPACT_KERNEL_CL
+
+// Zivc
+#include "zivc/cl/algorithm.cl"
+#include "zivc/cl/types.cl"
+#include "zivc/cl/utility.cl"
+#include "zivc/cl/work_group.cl"
+// Internal kernel
+#include "utility/look_back.cl"
+#include "utility/primitive_info.cl"
+
+using int32b = zivc::int32b;
+using uint32b = zivc::uint32b;
+
+namespace zivc {
+
+/*!
+  \details The elements whose flags are non-zero are copied into the dest
+  preserving their order. Each work-group counts the selected elements of
+  a tile and the output offset of the tile is computed with the decoupled
+  look-back. Then the tile is copied row by row, where a row has an element
+  per work-item and the offsets in the row are computed with the work-group
+  scan. The last tile writes the total number of selected elements
+
+  \tparam Type No description.
+  \param [in] source No description.
+  \param [in] flags No description.
+  \param [out] dest No description.
+  \param [out] num_of_selected No description.
+  \param [in,out] status No description.
+  \param [out] storage No description.
+  \param [in] info No description.
+  */
+template <typename Type> inline
+void compactImpl(ConstGlobalPtr<Type> source,
+                 ConstGlobalPtr<uint32b> flags,
+                 GlobalPtr<Type> dest,
+                 GlobalPtr<uint32b> num_of_selected,
+                 GlobalPtr<uint32b> status,
+                 LocalPtr<uint32b> storage,
+                 const PrimitiveInfo& info)
+{
+  constexpr uint32b op = PrimitiveInfo::kAdd;
+  const size_t num_of_tiles = info.numOfTiles();
+  const size_t group_size = getLocalSizeX();
+  const size_t local_id = getLocalIdX();
+  ConstGlobalPtr<Type> src = source + info.sourceOffset();
+  ConstGlobalPtr<uint32b> flg = flags + info.sourceOffset();
+  for (size_t tile_id = LookBack::issueTileId(status, storage);
+       tile_id < num_of_tiles;
+       tile_id = LookBack::issueTileId(status, storage)) {
+    const size_t begin = info.tileSize() * tile_id;
+    const size_t end = zivc::min(begin + info.tileSize(), info.size());
+    uint32b count = 0;
+    for (size_t i = begin + local_id; i < end; i += group_size)
+      count += (flg[i] != 0) ? 1u : 0u;
+    count = WorkGroup::reduceAdd(count, storage);
+
+    const uint32b prefix = LookBack::exchangePrefix(status, tile_id, count, op, storage);
+    GlobalPtr<Type> dst = dest + (info.destOffset() + prefix);
+    uint32b offset = 0;
+    for (size_t row = begin; row < end; row += group_size) {
+      const size_t i = row + local_id;
+      const uint32b is_selected = ((i < end) && (flg[i] != 0)) ? 1u : 0u;
+      const uint32b j = WorkGroup::scanExclusiveAdd(is_selected, storage);
+      if (is_selected != 0)
+        dst[offset + j] = src[i];
+      offset += WorkGroup::reduceAdd(is_selected, storage);
+    }
+    if ((tile_id == (num_of_tiles - 1)) && (local_id == 0))
+      num_of_selected[0] = prefix + count;
+  }
+}
+
+} // namespace zivc
+
+/*!
+  \details No detailed description
+
+  \param [in] source No description.
+  \param [in] flags No description.
+  \param [out] dest No description.
+  \param [out] num_of_selected No description.
+  \param [in,out] status No description.
+  \param [in] info No description.
+  */
+__kernel void Zivc_compactI32Kernel(zivc::ConstGlobalPtr<int32b> source,
+                                    zivc::ConstGlobalPtr<uint32b> flags,
+                                    zivc::GlobalPtr<int32b> dest,
+                                    zivc::GlobalPtr<uint32b> num_of_selected,
+                                    zivc::GlobalPtr<uint32b> status,
+                                    const zivc::PrimitiveInfo info)
+{
+  constexpr size_t n = zivc::PrimitiveInfo::maxNumOfSubGroups();
+  zivc::Local<uint32b> storage[n];
+  zivc::compactImpl<int32b>(source, flags, dest, num_of_selected, status, storage, info);
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] source No description.
+  \param [in] flags No description.
+  \param [out] dest No description.
+  \param [out] num_of_selected No description.
+  \param [in,out] status No description.
+  \param [in] info No description.
+  */
+__kernel void Zivc_compactU32Kernel(zivc::ConstGlobalPtr<uint32b> source,
+                                    zivc::ConstGlobalPtr<uint32b> flags,
+                                    zivc::GlobalPtr<uint32b> dest,
+                                    zivc::GlobalPtr<uint32b> num_of_selected,
+                                    zivc::GlobalPtr<uint32b> status,
+                                    const zivc::PrimitiveInfo info)
+{
+  constexpr size_t n = zivc::PrimitiveInfo::maxNumOfSubGroups();
+  zivc::Local<uint32b> storage[n];
+  zivc::compactImpl<uint32b>(source, flags, dest, num_of_selected, status, storage, info);
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] source No description.
+  \param [in] flags No description.
+  \param [out] dest No description.
+  \param [out] num_of_selected No description.
+  \param [in,out] status No description.
+  \param [in] info No description.
+  */
+__kernel void Zivc_compactF32Kernel(zivc::ConstGlobalPtr<float> source,
+                                    zivc::ConstGlobalPtr<uint32b> flags,
+                                    zivc::GlobalPtr<float> dest,
+                                    zivc::GlobalPtr<uint32b> num_of_selected,
+                                    zivc::GlobalPtr<uint32b> status,
+                                    const zivc::PrimitiveInfo info)
+{
+  constexpr size_t n = zivc::PrimitiveInfo::maxNumOfSubGroups();
+  zivc::Local<uint32b> storage[n];
+  zivc::compactImpl<float>(source, flags, dest, num_of_selected, status, storage, info);
+}
+
+#endif // ZIVC_COMPACT_KERNEL_CL
@@ -0,0 +1,236 @@
+/*!
+  \file convert_kernel.cl
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2021 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZIVC_CONVERT_KERNEL_CL
+#define ZIVC_CONVERT_KERNEL_CL
+
+// Zivc
+#include "zivc/cl/types.cl"
+#include "zivc/cl/utility.cl"
+#include "zivc/cl/vector_data.cl"
+// Internal kernel
+#include "utility/primitive_info.cl"
+
+using uint16b = zivc::uint16b;
+using uint32b = zivc::uint32b;
+
+namespace zivc {
+
+//! The number of elements converted by a vector load
+constexpr size_t kConvertVectorSize = 4;
+
+/*!
+  \details The mantissa is rounded to nearest even.
+  A NaN is kept quiet, so it isn't rounded into infinity
+
+  \param [in] value No description.
+  \return No description
+  */
+inline
+uint16b toBfloat16(const float value) noexcept
+{
+  const uint32b bits = treatAs<uint32b>(value);
+  const bool is_nan = 0x7f80'0000u < (bits & 0x7fff'ffffu);
+  const uint32b lsb = (bits >> 16u) & 0b1u;
+  const uint32b result = is_nan ? ((bits >> 16u) | 0x40u)
+                                : ((bits + 0x7fffu + lsb) >> 16u);
+  return static_cast<uint16b>(result);
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] value No description.
+  \return No description
+  */
+inline
+float fromBfloat16(const uint16b value) noexcept
+{
+  const uint32b bits = static_cast<uint32b>(value) << 16u;
+  return treatAs<float>(bits);
+}
+
+/*!
+  \details Each work-item converts vectors of four elements with
+  a grid-stride loop, so adjacent work-items access adjacent vectors.
+  The remaining elements are converted by the first work-items
+
+  \param [in] source No description.
+  \param [out] dest No description.
+  \param [in] info No description.
+  */
+inline
+void convertF32ToF16Impl(ConstGlobalPtr<float> source,
+                         GlobalPtr<half> dest,
+                         const PrimitiveInfo& info) noexcept
+{
+  const size_t id = getGlobalIdX();
+  const size_t stride = getGlobalSizeX();
+  ConstGlobalPtr<float> src = source + info.sourceOffset();
+  GlobalPtr<half> dst = dest + info.destOffset();
+  const size_t n = info.size() / kConvertVectorSize;
+  for (size_t i = id; i < n; i += stride) {
+    const float4 data = VectorData::load<kConvertVectorSize>(i, src);
+    VectorData::storeHalf(data, i, dst);
+  }
+  const size_t index = n * kConvertVectorSize + id;
+  if (index < info.size()) {
+    const float data = VectorData::load<1>(index, src);
+    VectorData::storeHalf(data, index, dst);
+  }
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] source No description.
+  \param [out] dest No description.
+  \param [in] info No description.
+  */
+inline
+void convertF16ToF32Impl(ConstGlobalPtr<half> source,
+                         GlobalPtr<float> dest,
+                         const PrimitiveInfo& info) noexcept
+{
+  const size_t id = getGlobalIdX();
+  const size_t stride = getGlobalSizeX();
+  ConstGlobalPtr<half> src = source + info.sourceOffset();
+  GlobalPtr<float> dst = dest + info.destOffset();
+  const size_t n = info.size() / kConvertVectorSize;
+  for (size_t i = id; i < n; i += stride) {
+    const float4 data = VectorData::loadHalf<kConvertVectorSize>(i, src);
+    VectorData::store(data, i, dst);
+  }
+  const size_t index = n * kConvertVectorSize + id;
+  if (index < info.size()) {
+    const float data = VectorData::loadHalf<1>(index, src);
+    VectorData::store(data, index, dst);
+  }
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] source No description.
+  \param [out] dest No description.
+  \param [in] info No description.
+  */
+inline
+void convertF32ToBf16Impl(ConstGlobalPtr<float> source,
+                          GlobalPtr<uint16b> dest,
+                          const PrimitiveInfo& info) noexcept
+{
+  const size_t id = getGlobalIdX();
+  const size_t stride = getGlobalSizeX();
+  ConstGlobalPtr<float> src = source + info.sourceOffset();
+  GlobalPtr<uint16b> dst = dest + info.destOffset();
+  const size_t n = info.size() / kConvertVectorSize;
+  for (size_t i = id; i < n; i += stride) {
+    const float4 data = VectorData::load<kConvertVectorSize>(i, src);
+    const ushort4 result = makeUShort4(toBfloat16(data.x), toBfloat16(data.y),
+                                       toBfloat16(data.z), toBfloat16(data.w));
+    VectorData::store(result, i, dst);
+  }
+  const size_t index = n * kConvertVectorSize + id;
+  if (index < info.size())
+    dst[index] = toBfloat16(src[index]);
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] source No description.
+  \param [out] dest No description.
+  \param [in] info No description.
+  */
+inline
+void convertBf16ToF32Impl(ConstGlobalPtr<uint16b> source,
+                          GlobalPtr<float> dest,
+                          const PrimitiveInfo& info) noexcept
+{
+  const size_t id = getGlobalIdX();
+  const size_t stride = getGlobalSizeX();
+  ConstGlobalPtr<uint16b> src = source + info.sourceOffset();
+  GlobalPtr<float> dst = dest + info.destOffset();
+  const size_t n = info.size() / kConvertVectorSize;
+  for (size_t i = id; i < n; i += stride) {
+    const ushort4 data = VectorData::load<kConvertVectorSize>(i, src);
+    const float4 result = makeFloat4(fromBfloat16(data.x), fromBfloat16(data.y),
+                                     fromBfloat16(data.z), fromBfloat16(data.w));
+    VectorData::store(result, i, dst);
+  }
+  const size_t index = n * kConvertVectorSize + id;
+  if (index < info.size())
+    dst[index] = fromBfloat16(src[index]);
+}
+
+} // namespace zivc
+
+/*!
+  \details No detailed description
+
+  \param [in] source No description.
+  \param [out] dest No description.
+  \param [in] info No description.
+  */
+__kernel void Zivc_convertF32ToF16Kernel(zivc::ConstGlobalPtr<float> source,
+                                         zivc::GlobalPtr<half> dest,
+                                         const zivc::PrimitiveInfo info)
+{
+  zivc::convertF32ToF16Impl(source, dest, info);
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] source No description.
+  \param [out] dest No description.
+  \param [in] info No description.
+  */
+__kernel void Zivc_convertF16ToF32Kernel(zivc::ConstGlobalPtr<half> source,
+                                         zivc::GlobalPtr<float> dest,
+                                         const zivc::PrimitiveInfo info)
+{
+  zivc::convertF16ToF32Impl(source, dest, info);
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] source No description.
+  \param [out] dest No description.
+  \param [in] info No description.
+  */
+__kernel void Zivc_convertF32ToBf16Kernel(zivc::ConstGlobalPtr<float> source,
+                                          zivc::GlobalPtr<uint16b> dest,
+                                          const zivc::PrimitiveInfo info)
+{
+  zivc::convertF32ToBf16Impl(source, dest, info);
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] source No description.
+  \param [out] dest No description.
+  \param [in] info No description.
+  */
+__kernel void Zivc_convertBf16ToF32Kernel(zivc::ConstGlobalPtr<uint16b> source,
+                                          zivc::GlobalPtr<float> dest,
+                                          const zivc::PrimitiveInfo info)
+{
+  zivc::convertBf16ToF32Impl(source, dest, info);
+}
+
+#endif // ZIVC_CONVERT_KERNEL_CL
@@ -0,0 +1,55 @@
+/*!
+  \file dispatch_kernel.cl
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2021 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZIVC_DISPATCH_KERNEL_CL
+#define ZIVC_DISPATCH_KERNEL_CL
+
+// Zivc
+#include "zivc/cl/types.cl"
+#include "zivc/cl/utility.cl"
+// Internal kernel
+#include "utility/dispatch_info.cl"
+
+using uint32b = zivc::uint32b;
+
+/*!
+  \details Convert the work size which is computed on the device into
+  the number of work-groups of an indirect dispatch.
+  The work size is clamped to the bound, which the module scope
+  push constants of the dispatched kernel are made from.
+  The dimensions which the kernel doesn't have are dispatched as 1
+
+  \param [in] dims No description.
+  \param [out] dispatch_size No description.
+  \param [in] info No description.
+  */
+__kernel void Zivc_calcDispatchSizeKernel(zivc::ConstGlobalPtr<uint32b> dims,
+                                          zivc::GlobalPtr<uint32b> dispatch_size,
+                                          const zivc::DispatchInfo info)
+{
+  const size_t dim = zivc::getGlobalIdX();
+  if (3 <= dim)
+    return;
+
+  uint32b num_of_groups = 1;
+  if (dim < info.dimension()) {
+    const uint32b bound = info.bound(dim);
+    const uint32b work_size = (dims[dim] < bound) ? dims[dim] : bound;
+    const uint32b group_size = info.groupSize(dim);
+    num_of_groups = (work_size + group_size - 1) / group_size;
+  }
+  dispatch_size[dim] = num_of_groups;
+}
+
+#endif // ZIVC_DISPATCH_KERNEL_CL
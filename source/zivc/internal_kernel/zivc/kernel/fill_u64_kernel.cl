@@ -19,6 +19,7 @@
 #include "zivc/cl/types.cl"
 #include "zivc/cl/utility.cl"
 // Internal kernel
+#include "utility/fill.cl"
 #include "utility/fill_info.cl"
 
 /*!
@@ -32,17 +33,7 @@ __kernel void Zivc_fillU64Kernel(zivc::ConstGlobalPtr<uint2> data,
                                  zivc::GlobalPtr<uint2> buffer,
                                  const zivc::FillInfo info)
 {
-  const size_t id = zivc::getGlobalIdX();
-  for (size_t ite = 0; ite < info.batchSize(); ++ite) {
-    const size_t element_number = info.batchSize() * id + ite;
-    if (info.elementSize() <= element_number)
-      break;
-    const size_t element_index = info.elementOffset() + element_number;
-    const size_t buffer_index = info.dataSize() * element_index;
-    zivc::GlobalPtr<uint2> ptr = buffer + buffer_index;
-    for (size_t i = 0; i < info.dataSize(); ++i)
-      ptr[i] = data[i];
-  }
+  zivc::fillBuffer<uint2>(data, buffer, info);
 }
 
 #endif // ZIVC_FILL_U64_KERNEL_CL
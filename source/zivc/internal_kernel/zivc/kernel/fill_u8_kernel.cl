@@ -19,6 +19,7 @@
 #include "zivc/cl/types.cl"
 #include "zivc/cl/utility.cl"
 // Internal kernel
+#include "utility/fill.cl"
 #include "utility/fill_info.cl"
 
 using uint8b = zivc::uint8b;
@@ -34,15 +35,7 @@ __kernel void Zivc_fillU8Kernel(zivc::ConstGlobalPtr<uint8b> data,
                                 zivc::GlobalPtr<uint8b> buffer,
                                 const zivc::FillInfo info)
 {
-  const size_t id = zivc::getGlobalIdX();
-  for (size_t ite = 0; ite < info.batchSize(); ++ite) {
-    const size_t element_number = info.batchSize() * id + ite;
-    if (info.elementSize() <= element_number)
-      break;
-    const size_t buffer_index = info.elementOffset() + element_number;
-    const size_t data_index = buffer_index % info.dataSize();
-    buffer[buffer_index] = data[data_index];
-  }
+  zivc::fillBuffer<uint8b>(data, buffer, info);
 }
 
 #endif // ZIVC_FILL_U8_KERNEL_CL
@@ -0,0 +1,370 @@
+/*!
+  \file gemm_kernel.cl
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2021 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZIVC_GEMM_KERNEL_CL
+#define ZIVC_GEMM_KERNEL_CL
+
+// Zivc
+#include "zivc/cl/algorithm.cl"
+#include "zivc/cl/synchronization.cl"
+#include "zivc/cl/type_traits.cl"
+#include "zivc/cl/types.cl"
+#include "zivc/cl/utility.cl"
+#include "zivc/cl/vector_data.cl"
+// Internal kernel
+#include "utility/gemm_info.cl"
+
+using uint16b = zivc::uint16b;
+
+namespace zivc {
+
+/*!
+  \details The uint16b elements are the bits of half
+
+  \tparam Type No description.
+  \param [in] p No description.
+  \param [in] index No description.
+  \return No description
+  */
+template <typename Type> inline
+float loadGemmElement(ConstGlobalPtr<Type> p, const size_t index) noexcept
+{
+  if constexpr (kIsSame<uint16b, Type>) {
+    const float v = VectorData::loadHalf<1>(index, p);
+    return v;
+  }
+  else {
+    const float v = p[index];
+    return v;
+  }
+}
+
+/*!
+  \details The uint16b elements are the bits of half
+
+  \tparam Type No description.
+  \param [in] value No description.
+  \param [out] p No description.
+  \param [in] index No description.
+  */
+template <typename Type> inline
+void storeGemmElement(const float value, GlobalPtr<Type> p, const size_t index) noexcept
+{
+  if constexpr (kIsSame<uint16b, Type>)
+    VectorData::storeHalf(value, index, p);
+  else
+    p[index] = value;
+}
+
+/*!
+  \details Return alpha * ab + beta * c. C isn't read if beta is zero,
+  so C may be uninitialized
+
+  \tparam Type No description.
+  \param [in] ab No description.
+  \param [in] c No description.
+  \param [in] index No description.
+  \param [in] info No description.
+  \return No description
+  */
+template <typename Type> inline
+float scaleGemmResult(const float ab,
+                      ConstGlobalPtr<Type> c,
+                      const size_t index,
+                      const GemmInfo& info) noexcept
+{
+  float result = info.alpha() * ab;
+  if (info.beta() != 0.0f)
+    result += info.beta() * loadGemmElement<Type>(c, index);
+  return result;
+}
+
+/*!
+  \details A work-group computes a kTile x kTile tile of C.
+  The tiles of A and B are staged in the local memory, so an element of
+  A and B is read from the device memory once per work-group.
+  The A tile is stored transposed so that a row of work-items reads
+  consecutive words of the local memory.
+  Each work-item computes a block of the tile held in registers.
+  The block has regBlockCols() columns and (kTile^2 / group_size / regBlockCols())
+  rows, which are interleaved with the other work-items.
+  For each k, the values of A and B of the block are loaded into registers
+  once and each of them is reused for all columns or rows of the block.
+  The work-groups iterate over the tiles,
+  so the number of work-groups may be less than the number of tiles
+
+  \tparam Type No description.
+  \tparam kTile No description.
+  \param [in] a No description.
+  \param [in] b No description.
+  \param [in,out] c No description.
+  \param [out] a_tile No description.
+  \param [out] b_tile No description.
+  \param [in] info No description.
+  */
+template <typename Type, size_t kTile> inline
+void gemmTileImpl(ConstGlobalPtr<Type> a,
+                  ConstGlobalPtr<Type> b,
+                  GlobalPtr<Type> c,
+                  LocalPtr<float> a_tile,
+                  LocalPtr<float> b_tile,
+                  const GemmInfo& info)
+{
+  constexpr size_t kMaxElems = GemmInfo::maxElemsPerItem();
+  constexpr size_t kBlockCols = GemmInfo::regBlockCols();
+  constexpr size_t kMaxBlockRows = kMaxElems / kBlockCols;
+  constexpr size_t kItemCols = kTile / kBlockCols;
+  static_assert((kTile % kBlockCols) == 0, "The tile isn't divisible by the block.");
+  const size_t group_size = getLocalSizeX();
+  const size_t local_id = getLocalIdX();
+  const size_t num_of_elems = (kTile * kTile) / group_size;
+  const size_t item_rows = group_size / kItemCols;
+  const size_t block_rows = kTile / item_rows;
+  const size_t tx = local_id % kItemCols;
+  const size_t ty = local_id / kItemCols;
+  const size_t tiles_per_matrix = info.numOfTileRows() * info.numOfTileCols();
+  const size_t m = info.m();
+  const size_t n = info.n();
+  const size_t k = info.k();
+
+  for (size_t tile_id = getGroupIdX(); tile_id < info.numOfTiles(); tile_id += getNumGroupsX()) {
+    const size_t batch = tile_id / tiles_per_matrix;
+    const size_t t = tile_id % tiles_per_matrix;
+    const size_t row0 = (t / info.numOfTileCols()) * kTile;
+    const size_t col0 = (t % info.numOfTileCols()) * kTile;
+    ConstGlobalPtr<Type> a_mat = a + batch * info.strideA();
+    ConstGlobalPtr<Type> b_mat = b + batch * info.strideB();
+
+    float acc[kMaxElems];
+    for (size_t i = 0; i < kMaxElems; ++i)
+      acc[i] = 0.0f;
+
+    for (size_t k0 = 0; k0 < k; k0 += kTile) {
+      // Stage the tiles. Adjacent work-items load adjacent elements
+      for (size_t i = 0; i < kMaxElems; ++i) {
+        if (num_of_elems <= i)
+          break;
+        const size_t e = local_id + i * group_size;
+        const size_t r = e / kTile;
+        const size_t col = e % kTile;
+        const size_t ar = row0 + r;
+        const size_t ak = k0 + col;
+        a_tile[col * kTile + r] = ((ar < m) && (ak < k))
+            ? loadGemmElement<Type>(a_mat, ar * info.lda() + ak)
+            : 0.0f;
+        const size_t bk = k0 + r;
+        const size_t bc = col0 + col;
+        b_tile[e] = ((bk < k) && (bc < n)) ? loadGemmElement<Type>(b_mat, bk * info.ldb() + bc)
+                                           : 0.0f;
+      }
+      Synchronization::barrierLocal();
+
+      for (size_t kk = 0; kk < kTile; ++kk) {
+        float a_block[kMaxBlockRows];
+        for (size_t i = 0; i < kMaxBlockRows; ++i) {
+          if (block_rows <= i)
+            break;
+          a_block[i] = a_tile[kk * kTile + ty + i * item_rows];
+        }
+        float b_block[kBlockCols];
+        for (size_t j = 0; j < kBlockCols; ++j)
+          b_block[j] = b_tile[kk * kTile + tx + j * kItemCols];
+        for (size_t i = 0; i < kMaxBlockRows; ++i) {
+          if (block_rows <= i)
+            break;
+          for (size_t j = 0; j < kBlockCols; ++j)
+            acc[i * kBlockCols + j] += a_block[i] * b_block[j];
+        }
+      }
+      Synchronization::barrierLocal();
+    }
+
+    GlobalPtr<Type> c_mat = c + batch * info.strideC();
+    for (size_t i = 0; i < kMaxBlockRows; ++i) {
+      if (block_rows <= i)
+        break;
+      const size_t row = row0 + ty + i * item_rows;
+      for (size_t j = 0; j < kBlockCols; ++j) {
+        const size_t col = col0 + tx + j * kItemCols;
+        if ((row < m) && (col < n)) {
+          const size_t index = row * info.ldc() + col;
+          const float result = scaleGemmResult<Type>(acc[i * kBlockCols + j], c_mat, index, info);
+          storeGemmElement<Type>(result, c_mat, index);
+        }
+      }
+    }
+  }
+}
+
+/*!
+  \details A work-item computes a tile of C row by row.
+  A row of the tile is accumulated in registers while a row of A is
+  streamed, and the panel of B that the tile reads is reused by all rows
+  of the tile, so the tile size is chosen to keep the panel in the cache
+
+  \tparam Type No description.
+  \param [in] a No description.
+  \param [in] b No description.
+  \param [in,out] c No description.
+  \param [in] info No description.
+  */
+template <typename Type> inline
+void gemmBlockImpl(ConstGlobalPtr<Type> a,
+                   ConstGlobalPtr<Type> b,
+                   GlobalPtr<Type> c,
+                   const GemmInfo& info)
+{
+  constexpr size_t kMaxCols = GemmInfo::maxBlockCols();
+  const size_t tiles_per_matrix = info.numOfTileRows() * info.numOfTileCols();
+  const size_t m = info.m();
+  const size_t n = info.n();
+  const size_t k = info.k();
+
+  for (size_t tile_id = getGlobalIdX(); tile_id < info.numOfTiles(); tile_id += getGlobalSizeX()) {
+    const size_t batch = tile_id / tiles_per_matrix;
+    const size_t t = tile_id % tiles_per_matrix;
+    const size_t row0 = (t / info.numOfTileCols()) * info.tileRows();
+    const size_t col0 = (t % info.numOfTileCols()) * info.tileCols();
+    const size_t row_end = zivc::min(row0 + info.tileRows(), m);
+    const size_t cols = zivc::min(info.tileCols(), n - col0);
+    ConstGlobalPtr<Type> a_mat = a + batch * info.strideA();
+    ConstGlobalPtr<Type> b_mat = b + batch * info.strideB();
+    GlobalPtr<Type> c_mat = c + batch * info.strideC();
+
+    for (size_t row = row0; row < row_end; ++row) {
+      float acc[kMaxCols];
+      for (size_t j = 0; j < kMaxCols; ++j)
+        acc[j] = 0.0f;
+      for (size_t kk = 0; kk < k; ++kk) {
+        const float av = loadGemmElement<Type>(a_mat, row * info.lda() + kk);
+        ConstGlobalPtr<Type> b_row = b_mat + (kk * info.ldb() + col0);
+        for (size_t j = 0; j < cols; ++j)
+          acc[j] += av * loadGemmElement<Type>(b_row, j);
+      }
+      for (size_t j = 0; j < cols; ++j) {
+        const size_t index = row * info.ldc() + col0 + j;
+        const float result = scaleGemmResult<Type>(acc[j], c_mat, index, info);
+        storeGemmElement<Type>(result, c_mat, index);
+      }
+    }
+  }
+}
+
+} // namespace zivc
+
+/*!
+  \details No detailed description
+
+  \param [in] a No description.
+  \param [in] b No description.
+  \param [in,out] c No description.
+  \param [in] info No description.
+  */
+__kernel void Zivc_gemmTile16F32Kernel(zivc::ConstGlobalPtr<float> a,
+                                       zivc::ConstGlobalPtr<float> b,
+                                       zivc::GlobalPtr<float> c,
+                                       const zivc::GemmInfo info)
+{
+  zivc::Local<float> a_tile[16 * 16];
+  zivc::Local<float> b_tile[16 * 16];
+  zivc::gemmTileImpl<float, 16>(a, b, c, a_tile, b_tile, info);
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] a No description.
+  \param [in] b No description.
+  \param [in,out] c No description.
+  \param [in] info No description.
+  */
+__kernel void Zivc_gemmTile32F32Kernel(zivc::ConstGlobalPtr<float> a,
+                                       zivc::ConstGlobalPtr<float> b,
+                                       zivc::GlobalPtr<float> c,
+                                       const zivc::GemmInfo info)
+{
+  zivc::Local<float> a_tile[32 * 32];
+  zivc::Local<float> b_tile[32 * 32];
+  zivc::gemmTileImpl<float, 32>(a, b, c, a_tile, b_tile, info);
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] a No description.
+  \param [in] b No description.
+  \param [in,out] c No description.
+  \param [in] info No description.
+  */
+__kernel void Zivc_gemmBlockF32Kernel(zivc::ConstGlobalPtr<float> a,
+                                      zivc::ConstGlobalPtr<float> b,
+                                      zivc::GlobalPtr<float> c,
+                                      const zivc::GemmInfo info)
+{
+  zivc::gemmBlockImpl<float>(a, b, c, info);
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] a No description.
+  \param [in] b No description.
+  \param [in,out] c No description.
+  \param [in] info No description.
+  */
+__kernel void Zivc_gemmTile16F16Kernel(zivc::ConstGlobalPtr<uint16b> a,
+                                       zivc::ConstGlobalPtr<uint16b> b,
+                                       zivc::GlobalPtr<uint16b> c,
+                                       const zivc::GemmInfo info)
+{
+  zivc::Local<float> a_tile[16 * 16];
+  zivc::Local<float> b_tile[16 * 16];
+  zivc::gemmTileImpl<uint16b, 16>(a, b, c, a_tile, b_tile, info);
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] a No description.
+  \param [in] b No description.
+  \param [in,out] c No description.
+  \param [in] info No description.
+  */
+__kernel void Zivc_gemmTile32F16Kernel(zivc::ConstGlobalPtr<uint16b> a,
+                                       zivc::ConstGlobalPtr<uint16b> b,
+                                       zivc::GlobalPtr<uint16b> c,
+                                       const zivc::GemmInfo info)
+{
+  zivc::Local<float> a_tile[32 * 32];
+  zivc::Local<float> b_tile[32 * 32];
+  zivc::gemmTileImpl<uint16b, 32>(a, b, c, a_tile, b_tile, info);
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] a No description.
+  \param [in] b No description.
+  \param [in,out] c No description.
+  \param [in] info No description.
+  */
+__kernel void Zivc_gemmBlockF16Kernel(zivc::ConstGlobalPtr<uint16b> a,
+                                      zivc::ConstGlobalPtr<uint16b> b,
+                                      zivc::GlobalPtr<uint16b> c,
+                                      const zivc::GemmInfo info)
+{
+  zivc::gemmBlockImpl<uint16b>(a, b, c, info);
+}
+
+#endif // ZIVC_GEMM_KERNEL_CL
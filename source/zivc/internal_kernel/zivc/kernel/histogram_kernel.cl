@@ -0,0 +1,143 @@
+/*!
+  \file histogram_kernel.cl
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2021 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZIVC_HISTOGRAM_KERNEL_CL
+#define ZIVC_HISTOGRAM_KERNEL_CL
+
+// Zivc
+#include "zivc/cl/algorithm.cl"
+#include "zivc/cl/atomic.cl"
+#include "zivc/cl/type_traits.cl"
+#include "zivc/cl/types.cl"
+#include "zivc/cl/utility.cl"
+// Internal kernel
+#include "utility/primitive_info.cl"
+
+using int32b = zivc::int32b;
+using uint32b = zivc::uint32b;
+
+namespace zivc {
+
+/*!
+  \details Return the bin index of the given value.
+  The range [lower, upper) is divided into bins evenly.
+  The number of bins is returned if the value is out of the range
+
+  \tparam Type No description.
+  \param [in] x No description.
+  \param [in] info No description.
+  \return No description
+  */
+template <typename Type> inline
+size_t histogramBin(const Type x, const PrimitiveInfo& info)
+{
+  const Type lower = info.lower<Type>();
+  const Type upper = info.upper<Type>();
+  const size_t n = info.numOfBins();
+  if (!((lower <= x) && (x < upper)))
+    return n;
+
+  size_t bin = 0;
+  if constexpr (kIsFloatingPoint<Type>) {
+    const Type t = (x - lower) / (upper - lower);
+    bin = static_cast<size_t>(t * static_cast<Type>(n));
+  }
+  else {
+    // The differences are computed in unsigned to avoid overflow
+    const uint64b d = static_cast<uint32b>(x) - static_cast<uint32b>(lower);
+    const uint64b range = static_cast<uint32b>(upper) - static_cast<uint32b>(lower);
+    bin = static_cast<size_t>((d * n) / range);
+  }
+  bin = zivc::min(bin, n - 1);
+  return bin;
+}
+
+/*!
+  \details Each work-group counts the values of a tile.
+  Adjacent work-items read adjacent elements. The work-groups iterate over
+  the tiles, so the number of work-groups may be less than the number of tiles.
+  The counts are accumulated into the bins, so the bins should be
+  initialized by the caller
+
+  \tparam Type No description.
+  \param [in] source No description.
+  \param [in,out] bins No description.
+  \param [in] info No description.
+  */
+template <typename Type> inline
+void histogramImpl(ConstGlobalPtr<Type> source,
+                   GlobalPtr<uint32b> bins,
+                   const PrimitiveInfo& info)
+{
+  const size_t group_size = getLocalSizeX();
+  const size_t local_id = getLocalIdX();
+  ConstGlobalPtr<Type> src = source + info.sourceOffset();
+  GlobalPtr<uint32b> dst = bins + info.destOffset();
+  const size_t n = info.numOfBins();
+  for (size_t tile_id = getGroupIdX(); tile_id < info.numOfTiles(); tile_id += getNumGroupsX()) {
+    const size_t begin = info.tileSize() * tile_id;
+    const size_t end = zivc::min(begin + info.tileSize(), info.size());
+    for (size_t i = begin + local_id; i < end; i += group_size) {
+      const size_t bin = histogramBin(src[i], info);
+      if (bin < n)
+        atomic_inc(dst + bin);
+    }
+  }
+}
+
+} // namespace zivc
+
+/*!
+  \details No detailed description
+
+  \param [in] source No description.
+  \param [in,out] bins No description.
+  \param [in] info No description.
+  */
+__kernel void Zivc_histogramI32Kernel(zivc::ConstGlobalPtr<int32b> source,
+                                      zivc::GlobalPtr<uint32b> bins,
+                                      const zivc::PrimitiveInfo info)
+{
+  zivc::histogramImpl<int32b>(source, bins, info);
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] source No description.
+  \param [in,out] bins No description.
+  \param [in] info No description.
+  */
+__kernel void Zivc_histogramU32Kernel(zivc::ConstGlobalPtr<uint32b> source,
+                                      zivc::GlobalPtr<uint32b> bins,
+                                      const zivc::PrimitiveInfo info)
+{
+  zivc::histogramImpl<uint32b>(source, bins, info);
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] source No description.
+  \param [in,out] bins No description.
+  \param [in] info No description.
+  */
+__kernel void Zivc_histogramF32Kernel(zivc::ConstGlobalPtr<float> source,
+                                      zivc::GlobalPtr<uint32b> bins,
+                                      const zivc::PrimitiveInfo info)
+{
+  zivc::histogramImpl<float>(source, bins, info);
+}
+
+#endif // ZIVC_HISTOGRAM_KERNEL_CL
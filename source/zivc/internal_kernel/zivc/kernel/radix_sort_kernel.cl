@@ -0,0 +1,406 @@
+/*!
+  \file radix_sort_kernel.cl
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2021 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZIVC_RADIX_SORT_KERNEL_CL
+#define ZIVC_RADIX_SORT_KERNEL_CL
+
+// Zivc
+#include "zivc/cl/algorithm.cl"
+#include "zivc/cl/atomic.cl"
+#include "zivc/cl/synchronization.cl"
+#include "zivc/cl/types.cl"
+#include "zivc/cl/utility.cl"
+#include "zivc/cl/work_group.cl"
+// Internal kernel
+#include "utility/sort_info.cl"
+
+using uint32b = zivc::uint32b;
+using uint64b = zivc::uint64b;
+
+namespace zivc {
+
+/*!
+  \details The bits of signed integers and floats are converted so that
+  the order of the keys is the unsigned order of the radix keys
+
+  \tparam KeyBits No description.
+  \param [in] bits No description.
+  \param [in] kind No description.
+  \return No description
+  */
+template <typename KeyBits> inline
+KeyBits toRadixKey(const KeyBits bits, const uint32b kind) noexcept
+{
+  constexpr KeyBits sign = static_cast<KeyBits>(1) << (8 * sizeof(KeyBits) - 1);
+  KeyBits key = bits;
+  if (kind == SortInfo::kSigned)
+    key = bits ^ sign;
+  else if (kind == SortInfo::kFloat)
+    key = ((bits & sign) == sign) ? ~bits : (bits ^ sign);
+  return key;
+}
+
+/*!
+  \details No detailed description
+
+  \tparam KeyBits No description.
+  \param [in] keys No description.
+  \param [in] segments No description.
+  \param [in] index No description.
+  \param [in] key_offset No description.
+  \param [in] pass No description.
+  \param [in] info No description.
+  \return No description
+  */
+template <typename KeyBits> inline
+size_t radixDigit(ConstGlobalPtr<KeyBits> keys,
+                  ConstGlobalPtr<uint32b> segments,
+                  const size_t index,
+                  const size_t key_offset,
+                  const size_t pass,
+                  const SortInfo& info) noexcept
+{
+  constexpr size_t mask = SortInfo::radixSize() - 1;
+  size_t d = 0;
+  if (info.isSegmentPass(pass)) {
+    d = static_cast<size_t>(segments[index] >> info.shift(pass));
+  }
+  else {
+    const KeyBits key = toRadixKey<KeyBits>(keys[key_offset + index], info.keyKind());
+    d = static_cast<size_t>(key >> info.shift(pass));
+  }
+  d = d & mask;
+  return d;
+}
+
+/*!
+  \details Every work-group of a launch increments the counter once.
+  The launches of the passes are executed in order on a queue,
+  so the pass of the launch is the count divided by the number of work-groups.
+  The pass is computed on the device, so that the arguments of the kernel
+  are the same in all passes and the passes are launched without waiting
+
+  \param [in,out] counter No description.
+  \param [out] storage No description.
+  \return No description
+  */
+inline
+size_t radixSortPass(GlobalPtr<uint32b> counter, LocalPtr<uint32b> storage) noexcept
+{
+  uint32b count = 0;
+  if (getLocalIdX() == 0)
+    count = atomic_inc(counter);
+  count = WorkGroup::broadcast(count, 0, storage);
+  const size_t pass = static_cast<size_t>(count) / getNumGroupsX();
+  return pass;
+}
+
+/*!
+  \details Each work-group counts the digits of a tile into local counters.
+  Adjacent work-items read adjacent elements.
+  The counts are stored digit-major, so that the exclusive scan of
+  the histogram gives the output offset of each digit of each tile.
+  The pass counter of the histogram follows the counts
+
+  \tparam KeyBits No description.
+  \param [in] keys0 No description.
+  \param [in] keys1 No description.
+  \param [in] segments0 No description.
+  \param [in] segments1 No description.
+  \param [out] histogram No description.
+  \param [out] counts No description.
+  \param [in] info No description.
+  */
+template <typename KeyBits> inline
+void radixSortHistogramImpl(ConstGlobalPtr<KeyBits> keys0,
+                            ConstGlobalPtr<KeyBits> keys1,
+                            ConstGlobalPtr<uint32b> segments0,
+                            ConstGlobalPtr<uint32b> segments1,
+                            GlobalPtr<uint32b> histogram,
+                            LocalPtr<uint32b> counts,
+                            const SortInfo& info)
+{
+  constexpr size_t radix_size = SortInfo::radixSize();
+  const size_t num_of_tiles = info.numOfTiles();
+  const size_t group_size = getLocalSizeX();
+  const size_t local_id = getLocalIdX();
+  const size_t pass = radixSortPass(histogram + radix_size * num_of_tiles, counts);
+  const size_t in = pass % 2;
+  ConstGlobalPtr<KeyBits> keys = (in == 0) ? keys0 : keys1;
+  ConstGlobalPtr<uint32b> segments = (in == 0) ? segments0 : segments1;
+  const size_t key_offset = info.offset(in);
+  for (size_t tile_id = getGroupIdX(); tile_id < num_of_tiles; tile_id += getNumGroupsX()) {
+    for (size_t d = local_id; d < radix_size; d += group_size)
+      counts[d] = 0;
+    Synchronization::barrierLocal();
+
+    const size_t begin = info.tileSize() * tile_id;
+    const size_t end = zivc::min(begin + info.tileSize(), info.size());
+    for (size_t i = begin + local_id; i < end; i += group_size) {
+      const size_t d = radixDigit<KeyBits>(keys, segments, i, key_offset, pass, info);
+      atomic_inc(counts + d);
+    }
+    Synchronization::barrierLocal();
+
+    for (size_t d = local_id; d < radix_size; d += group_size)
+      histogram[num_of_tiles * d + tile_id] = counts[d];
+    Synchronization::barrierLocal();
+  }
+}
+
+/*!
+  \details Each work-group moves the elements of a tile to the positions
+  given by the scanned histogram. The tile is processed row by row,
+  where a row has an element per work-item. An element is placed after
+  the elements of the preceding rows and the preceding work-items
+  which have the same digit, so the sort is stable.
+  The pass counter of the scatter follows the one of the histogram
+
+  \tparam KeyBits No description.
+  \param [in,out] keys0 No description.
+  \param [in,out] keys1 No description.
+  \param [in,out] values0 No description.
+  \param [in,out] values1 No description.
+  \param [in,out] segments0 No description.
+  \param [in,out] segments1 No description.
+  \param [in,out] offsets No description.
+  \param [out] tile_offsets No description.
+  \param [out] row_digits No description.
+  \param [in] info No description.
+  */
+template <typename KeyBits> inline
+void radixSortScatterImpl(GlobalPtr<KeyBits> keys0,
+                          GlobalPtr<KeyBits> keys1,
+                          GlobalPtr<uint32b> values0,
+                          GlobalPtr<uint32b> values1,
+                          GlobalPtr<uint32b> segments0,
+                          GlobalPtr<uint32b> segments1,
+                          GlobalPtr<uint32b> offsets,
+                          LocalPtr<uint32b> tile_offsets,
+                          LocalPtr<uint32b> row_digits,
+                          const SortInfo& info)
+{
+  constexpr size_t radix_size = SortInfo::radixSize();
+  const size_t num_of_tiles = info.numOfTiles();
+  const size_t group_size = getLocalSizeX();
+  const size_t local_id = getLocalIdX();
+  const size_t pass = radixSortPass(offsets + (radix_size * num_of_tiles + 1), tile_offsets);
+  const size_t in = pass % 2;
+  GlobalPtr<KeyBits> keys_in = (in == 0) ? keys0 : keys1;
+  GlobalPtr<KeyBits> keys_out = (in == 0) ? keys1 : keys0;
+  GlobalPtr<uint32b> values_in = (in == 0) ? values0 : values1;
+  GlobalPtr<uint32b> values_out = (in == 0) ? values1 : values0;
+  GlobalPtr<uint32b> segments_in = (in == 0) ? segments0 : segments1;
+  GlobalPtr<uint32b> segments_out = (in == 0) ? segments1 : segments0;
+  const size_t src_offset = info.offset(in);
+  const size_t dst_offset = info.offset(1 - in);
+  const size_t num_of_words = info.numOfValueWords();
+  for (size_t tile_id = getGroupIdX(); tile_id < num_of_tiles; tile_id += getNumGroupsX()) {
+    for (size_t d = local_id; d < radix_size; d += group_size)
+      tile_offsets[d] = offsets[num_of_tiles * d + tile_id];
+    Synchronization::barrierLocal();
+
+    const size_t begin = info.tileSize() * tile_id;
+    const size_t end = zivc::min(begin + info.tileSize(), info.size());
+    for (size_t row = begin; row < end; row += group_size) {
+      const size_t i = row + local_id;
+      const bool is_valid = i < end;
+      const size_t d = is_valid
+          ? radixDigit<KeyBits>(keys_in, segments_in, i, src_offset, pass, info)
+          : radix_size;
+      row_digits[local_id] = static_cast<uint32b>(d);
+      Synchronization::barrierLocal();
+
+      // Rank the element among the work-items which have the same digit
+      const size_t row_size = zivc::min(group_size, end - row);
+      size_t rank = 0;
+      bool is_last = true;
+      for (size_t j = 0; j < row_size; ++j) {
+        const bool is_same = static_cast<size_t>(row_digits[j]) == d;
+        rank += (is_same && (j < local_id)) ? 1 : 0;
+        is_last = is_last && !(is_same && (local_id < j));
+      }
+      const size_t pos = is_valid ? static_cast<size_t>(tile_offsets[d]) + rank : 0;
+      if (is_valid) {
+        const size_t src = src_offset + i;
+        const size_t dst = dst_offset + pos;
+        keys_out[dst] = keys_in[src];
+        for (size_t w = 0; w < num_of_words; ++w)
+          values_out[num_of_words * dst + w] = values_in[num_of_words * src + w];
+        if (info.hasSegments())
+          segments_out[pos] = segments_in[i];
+      }
+      Synchronization::barrierLocal();
+
+      // The last element of each digit advances the offset of the digit
+      if (is_valid && is_last)
+        tile_offsets[d] = static_cast<uint32b>(pos + 1);
+      Synchronization::barrierLocal();
+    }
+  }
+}
+
+/*!
+  \details Each element gets the index of the segment which contains it.
+  The segment offsets are ascending and relative to the source offset
+
+  \param [in] segment_offsets No description.
+  \param [out] segments No description.
+  \param [in] info No description.
+  */
+inline
+void radixSortSegmentImpl(ConstGlobalPtr<uint32b> segment_offsets,
+                          GlobalPtr<uint32b> segments,
+                          const SortInfo& info)
+{
+  const size_t group_size = getLocalSizeX();
+  const size_t local_id = getLocalIdX();
+  for (size_t tile_id = getGroupIdX(); tile_id < info.numOfTiles(); tile_id += getNumGroupsX()) {
+    const size_t begin = info.tileSize() * tile_id;
+    const size_t end = zivc::min(begin + info.tileSize(), info.size());
+    for (size_t i = begin + local_id; i < end; i += group_size) {
+      // Find the last segment which starts at or before the element
+      size_t first = 0;
+      size_t count = info.numOfSegments();
+      while (0 < count) {
+        const size_t step = count / 2;
+        const size_t middle = first + step;
+        if (static_cast<size_t>(segment_offsets[middle]) <= i) {
+          first = middle + 1;
+          count -= step + 1;
+        }
+        else {
+          count = step;
+        }
+      }
+      segments[i] = static_cast<uint32b>((0 < first) ? first - 1 : 0);
+    }
+  }
+}
+
+} // namespace zivc
+
+/*!
+  \details No detailed description
+
+  \param [in] keys0 No description.
+  \param [in] keys1 No description.
+  \param [in] segments0 No description.
+  \param [in] segments1 No description.
+  \param [out] histogram No description.
+  \param [in] info No description.
+  */
+__kernel void Zivc_radixSortHistogram32Kernel(zivc::ConstGlobalPtr<uint32b> keys0,
+                                              zivc::ConstGlobalPtr<uint32b> keys1,
+                                              zivc::ConstGlobalPtr<uint32b> segments0,
+                                              zivc::ConstGlobalPtr<uint32b> segments1,
+                                              zivc::GlobalPtr<uint32b> histogram,
+                                              const zivc::SortInfo info)
+{
+  zivc::Local<uint32b> counts[zivc::SortInfo::radixSize()];
+  zivc::radixSortHistogramImpl<uint32b>(keys0, keys1, segments0, segments1,
+                                        histogram, counts, info);
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] keys0 No description.
+  \param [in] keys1 No description.
+  \param [in] segments0 No description.
+  \param [in] segments1 No description.
+  \param [out] histogram No description.
+  \param [in] info No description.
+  */
+__kernel void Zivc_radixSortHistogram64Kernel(zivc::ConstGlobalPtr<uint64b> keys0,
+                                              zivc::ConstGlobalPtr<uint64b> keys1,
+                                              zivc::ConstGlobalPtr<uint32b> segments0,
+                                              zivc::ConstGlobalPtr<uint32b> segments1,
+                                              zivc::GlobalPtr<uint32b> histogram,
+                                              const zivc::SortInfo info)
+{
+  zivc::Local<uint32b> counts[zivc::SortInfo::radixSize()];
+  zivc::radixSortHistogramImpl<uint64b>(keys0, keys1, segments0, segments1,
+                                        histogram, counts, info);
+}
+
+/*!
+  \details No detailed description
+
+  \param [in,out] keys0 No description.
+  \param [in,out] keys1 No description.
+  \param [in,out] values0 No description.
+  \param [in,out] values1 No description.
+  \param [in,out] segments0 No description.
+  \param [in,out] segments1 No description.
+  \param [in,out] offsets No description.
+  \param [in] info No description.
+  */
+__kernel void Zivc_radixSortScatter32Kernel(zivc::GlobalPtr<uint32b> keys0,
+                                            zivc::GlobalPtr<uint32b> keys1,
+                                            zivc::GlobalPtr<uint32b> values0,
+                                            zivc::GlobalPtr<uint32b> values1,
+                                            zivc::GlobalPtr<uint32b> segments0,
+                                            zivc::GlobalPtr<uint32b> segments1,
+                                            zivc::GlobalPtr<uint32b> offsets,
+                                            const zivc::SortInfo info)
+{
+  zivc::Local<uint32b> tile_offsets[zivc::SortInfo::radixSize()];
+  zivc::Local<uint32b> row_digits[zivc::SortInfo::maxWorkGroupSize()];
+  zivc::radixSortScatterImpl<uint32b>(keys0, keys1, values0, values1, segments0, segments1,
+                                      offsets, tile_offsets, row_digits, info);
+}
+
+/*!
+  \details No detailed description
+
+  \param [in,out] keys0 No description.
+  \param [in,out] keys1 No description.
+  \param [in,out] values0 No description.
+  \param [in,out] values1 No description.
+  \param [in,out] segments0 No description.
+  \param [in,out] segments1 No description.
+  \param [in,out] offsets No description.
+  \param [in] info No description.
+  */
+__kernel void Zivc_radixSortScatter64Kernel(zivc::GlobalPtr<uint64b> keys0,
+                                            zivc::GlobalPtr<uint64b> keys1,
+                                            zivc::GlobalPtr<uint32b> values0,
+                                            zivc::GlobalPtr<uint32b> values1,
+                                            zivc::GlobalPtr<uint32b> segments0,
+                                            zivc::GlobalPtr<uint32b> segments1,
+                                            zivc::GlobalPtr<uint32b> offsets,
+                                            const zivc::SortInfo info)
+{
+  zivc::Local<uint32b> tile_offsets[zivc::SortInfo::radixSize()];
+  zivc::Local<uint32b> row_digits[zivc::SortInfo::maxWorkGroupSize()];
+  zivc::radixSortScatterImpl<uint64b>(keys0, keys1, values0, values1, segments0, segments1,
+                                      offsets, tile_offsets, row_digits, info);
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] segment_offsets No description.
+  \param [out] segments No description.
+  \param [in] info No description.
+  */
+__kernel void Zivc_radixSortSegmentKernel(zivc::ConstGlobalPtr<uint32b> segment_offsets,
+                                          zivc::GlobalPtr<uint32b> segments,
+                                          const zivc::SortInfo info)
+{
+  zivc::radixSortSegmentImpl(segment_offsets, segments, info);
+}
+
+#endif // ZIVC_RADIX_SORT_KERNEL_CL
@@ -0,0 +1,131 @@
+/*!
+  \file random_kernel.cl
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2021 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZIVC_RANDOM_KERNEL_CL
+#define ZIVC_RANDOM_KERNEL_CL
+
+// Zivc
+#include "zivc/cl/philox_engine.cl"
+#include "zivc/cl/types.cl"
+#include "zivc/cl/utility.cl"
+// Internal kernel
+#include "utility/random_info.cl"
+
+using uint32b = zivc::uint32b;
+
+namespace zivc {
+
+//! The distributions of the generated numbers
+enum class RandomDistribution : uint32b
+{
+  kBits = 0,
+  kUniform,
+  kNormal
+};
+
+/*!
+  \details Each work-item generates blocks of four numbers with
+  a grid-stride loop. The numbers of a block are written only if they are
+  in the range, so the results don't depend on the work size
+
+  \param [out] dest No description.
+  \param [in] info No description.
+  */
+template <RandomDistribution kDistribution, typename Type> inline
+void generateRandomImpl(GlobalPtr<Type> dest, const RandomInfo& info) noexcept
+{
+  constexpr size_t n = PhiloxEngine::numOfWords();
+  const size_t id = getGlobalIdX();
+  const size_t stride = getGlobalSizeX();
+  const uint2 key = PhiloxEngine::makeKey(info.seedLo(), info.seedHi());
+  GlobalPtr<Type> dst = dest + info.destOffset();
+  const size_t first = info.firstLane();
+  const size_t end = first + info.size();
+  for (size_t i = id; i < info.numOfBlocks(); i += stride) {
+    // Add the block index to the 64bit index of the first block
+    const uint32b lo = info.blockLo() + static_cast<uint32b>(i);
+    const uint32b hi = info.blockHi() + ((lo < info.blockLo()) ? 1u : 0u);
+    const uint4 counter = PhiloxEngine::makeCounter(lo, hi);
+    Type values[n];
+    if constexpr (kDistribution == RandomDistribution::kBits) {
+      const uint4 v = PhiloxEngine::generate(counter, key);
+      values[0] = v.x;
+      values[1] = v.y;
+      values[2] = v.z;
+      values[3] = v.w;
+    }
+    else if constexpr (kDistribution == RandomDistribution::kUniform) {
+      const float4 v = PhiloxEngine::generateUniform(counter, key);
+      values[0] = v.x;
+      values[1] = v.y;
+      values[2] = v.z;
+      values[3] = v.w;
+    }
+    else {
+      const float4 v = PhiloxEngine::generateNormal(counter, key);
+      values[0] = v.x;
+      values[1] = v.y;
+      values[2] = v.z;
+      values[3] = v.w;
+    }
+    for (size_t l = 0; l < n; ++l) {
+      const size_t index = n * i + l;
+      if ((first <= index) && (index < end))
+        dst[index - first] = values[l];
+    }
+  }
+}
+
+} // namespace zivc
+
+/*!
+  \details No detailed description
+
+  \param [out] dest No description.
+  \param [in] info No description.
+  */
+__kernel void Zivc_randomU32Kernel(zivc::GlobalPtr<uint32b> dest,
+                                   const zivc::RandomInfo info)
+{
+  using zivc::RandomDistribution;
+  zivc::generateRandomImpl<RandomDistribution::kBits>(dest, info);
+}
+
+/*!
+  \details No detailed description
+
+  \param [out] dest No description.
+  \param [in] info No description.
+  */
+__kernel void Zivc_randomUniformF32Kernel(zivc::GlobalPtr<float> dest,
+                                          const zivc::RandomInfo info)
+{
+  using zivc::RandomDistribution;
+  zivc::generateRandomImpl<RandomDistribution::kUniform>(dest, info);
+}
+
+/*!
+  \details No detailed description
+
+  \param [out] dest No description.
+  \param [in] info No description.
+  */
+__kernel void Zivc_randomNormalF32Kernel(zivc::GlobalPtr<float> dest,
+                                         const zivc::RandomInfo info)
+{
+  using zivc::RandomDistribution;
+  zivc::generateRandomImpl<RandomDistribution::kNormal>(dest, info);
+}
+
+#endif // ZIVC_RANDOM_KERNEL_CL
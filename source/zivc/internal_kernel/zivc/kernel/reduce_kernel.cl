@@ -0,0 +1,135 @@
+/*!
+  \file reduce_kernel.cl
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2021 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZIVC_REDUCE_KERNEL_CL
+#define ZIVC_REDUCE_KERNEL_CL
+
+// Zivc
+#include "zivc/cl/algorithm.cl"
+#include "zivc/cl/types.cl"
+#include "zivc/cl/utility.cl"
+#include "zivc/cl/work_group.cl"
+// Internal kernel
+#include "utility/look_back.cl"
+#include "utility/primitive_info.cl"
+
+using int32b = zivc::int32b;
+using uint32b = zivc::uint32b;
+
+namespace zivc {
+
+/*!
+  \details Each work-group reduces a tile of the source.
+  Adjacent work-items read adjacent elements and their partial results are
+  reduced with the work-group collectives.
+  The total is propagated through the tiles with the decoupled look-back,
+  and the last tile writes the result
+
+  \tparam Type No description.
+  \param [in] source No description.
+  \param [out] dest No description.
+  \param [in,out] status No description.
+  \param [out] storage No description.
+  \param [out] tile_storage No description.
+  \param [in] info No description.
+  */
+template <typename Type> inline
+void reduceImpl(ConstGlobalPtr<Type> source,
+                GlobalPtr<Type> dest,
+                GlobalPtr<uint32b> status,
+                LocalPtr<Type> storage,
+                LocalPtr<uint32b> tile_storage,
+                const PrimitiveInfo& info)
+{
+  const uint32b op = info.operation();
+  const size_t num_of_tiles = info.numOfTiles();
+  const size_t group_size = getLocalSizeX();
+  const size_t local_id = getLocalIdX();
+  ConstGlobalPtr<Type> src = source + info.sourceOffset();
+  for (size_t tile_id = LookBack::issueTileId(status, tile_storage);
+       tile_id < num_of_tiles;
+       tile_id = LookBack::issueTileId(status, tile_storage)) {
+    const size_t begin = info.tileSize() * tile_id;
+    const size_t end = zivc::min(begin + info.tileSize(), info.size());
+    Type aggregate = LookBack::identity<Type>(op);
+    for (size_t i = begin + local_id; i < end; i += group_size)
+      aggregate = LookBack::apply(op, aggregate, src[i]);
+    aggregate = LookBack::reduceGroup(op, aggregate, storage);
+
+    const Type prefix = LookBack::exchangePrefix(status, tile_id, aggregate, op, storage);
+    if ((tile_id == (num_of_tiles - 1)) && (local_id == 0))
+      dest[info.destOffset()] = LookBack::apply(op, prefix, aggregate);
+  }
+}
+
+} // namespace zivc
+
+/*!
+  \details No detailed description
+
+  \param [in] source No description.
+  \param [out] dest No description.
+  \param [in,out] status No description.
+  \param [in] info No description.
+  */
+__kernel void Zivc_reduceI32Kernel(zivc::ConstGlobalPtr<int32b> source,
+                                   zivc::GlobalPtr<int32b> dest,
+                                   zivc::GlobalPtr<uint32b> status,
+                                   const zivc::PrimitiveInfo info)
+{
+  constexpr size_t n = zivc::PrimitiveInfo::maxNumOfSubGroups();
+  zivc::Local<int32b> storage[n];
+  zivc::Local<uint32b> tile_storage[1];
+  zivc::reduceImpl<int32b>(source, dest, status, storage, tile_storage, info);
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] source No description.
+  \param [out] dest No description.
+  \param [in,out] status No description.
+  \param [in] info No description.
+  */
+__kernel void Zivc_reduceU32Kernel(zivc::ConstGlobalPtr<uint32b> source,
+                                   zivc::GlobalPtr<uint32b> dest,
+                                   zivc::GlobalPtr<uint32b> status,
+                                   const zivc::PrimitiveInfo info)
+{
+  constexpr size_t n = zivc::PrimitiveInfo::maxNumOfSubGroups();
+  zivc::Local<uint32b> storage[n];
+  zivc::Local<uint32b> tile_storage[1];
+  zivc::reduceImpl<uint32b>(source, dest, status, storage, tile_storage, info);
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] source No description.
+  \param [out] dest No description.
+  \param [in,out] status No description.
+  \param [in] info No description.
+  */
+__kernel void Zivc_reduceF32Kernel(zivc::ConstGlobalPtr<float> source,
+                                   zivc::GlobalPtr<float> dest,
+                                   zivc::GlobalPtr<uint32b> status,
+                                   const zivc::PrimitiveInfo info)
+{
+  constexpr size_t n = zivc::PrimitiveInfo::maxNumOfSubGroups();
+  zivc::Local<float> storage[n];
+  zivc::Local<uint32b> tile_storage[1];
+  zivc::reduceImpl<float>(source, dest, status, storage, tile_storage, info);
+}
+
+#endif // ZIVC_REDUCE_KERNEL_CL
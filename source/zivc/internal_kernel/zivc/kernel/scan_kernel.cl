@@ -0,0 +1,151 @@
+/*!
+  \file scan_kernel.cl
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2021 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZIVC_SCAN_KERNEL_CL
+#define ZIVC_SCAN_KERNEL_CL
+
+// Zivc
+#include "zivc/cl/algorithm.cl"
+#include "zivc/cl/types.cl"
+#include "zivc/cl/utility.cl"
+#include "zivc/cl/work_group.cl"
+// Internal kernel
+#include "utility/look_back.cl"
+#include "utility/primitive_info.cl"
+
+using int32b = zivc::int32b;
+using uint32b = zivc::uint32b;
+
+namespace zivc {
+
+/*!
+  \details Each work-group scans a tile of the source.
+  The tile is read twice: first to compute the aggregate of the tile,
+  which is exchanged for the exclusive prefix with the decoupled look-back,
+  then to write the scanned values row by row, where a row has an element
+  per work-item and is scanned with the work-group collectives.
+  Adjacent work-items read adjacent elements.
+  The work-groups iterate over the tiles, so the number of work-groups may be
+  less than the number of tiles.
+  The source and the dest can be the same buffer
+
+  \tparam Type No description.
+  \param [in] source No description.
+  \param [out] dest No description.
+  \param [in,out] status No description.
+  \param [out] storage No description.
+  \param [out] tile_storage No description.
+  \param [in] info No description.
+  */
+template <typename Type> inline
+void scanImpl(ConstGlobalPtr<Type> source,
+              GlobalPtr<Type> dest,
+              GlobalPtr<uint32b> status,
+              LocalPtr<Type> storage,
+              LocalPtr<uint32b> tile_storage,
+              const PrimitiveInfo& info)
+{
+  const uint32b op = info.operation();
+  const bool is_exclusive = info.isExclusive();
+  const size_t group_size = getLocalSizeX();
+  const size_t local_id = getLocalIdX();
+  const Type id = LookBack::identity<Type>(op);
+  ConstGlobalPtr<Type> src = source + info.sourceOffset();
+  GlobalPtr<Type> dst = dest + info.destOffset();
+  for (size_t tile_id = LookBack::issueTileId(status, tile_storage);
+       tile_id < info.numOfTiles();
+       tile_id = LookBack::issueTileId(status, tile_storage)) {
+    const size_t begin = info.tileSize() * tile_id;
+    const size_t end = zivc::min(begin + info.tileSize(), info.size());
+    Type aggregate = id;
+    for (size_t i = begin + local_id; i < end; i += group_size)
+      aggregate = LookBack::apply(op, aggregate, src[i]);
+    aggregate = LookBack::reduceGroup(op, aggregate, storage);
+
+    Type sum = LookBack::exchangePrefix(status, tile_id, aggregate, op, storage);
+    for (size_t row = begin; row < end; row += group_size) {
+      const size_t i = row + local_id;
+      const Type x = (i < end) ? src[i] : id;
+      const Type inclusive = LookBack::scanGroup<false>(op, x, storage);
+      const Type s = is_exclusive ? LookBack::scanGroup<true>(op, x, storage)
+                                  : inclusive;
+      if (i < end)
+        dst[i] = LookBack::apply(op, sum, s);
+      // The last work-item has the aggregate of the row
+      const Type total = WorkGroup::broadcast(inclusive, group_size - 1, storage);
+      sum = LookBack::apply(op, sum, total);
+    }
+  }
+}
+
+} // namespace zivc
+
+/*!
+  \details No detailed description
+
+  \param [in] source No description.
+  \param [out] dest No description.
+  \param [in,out] status No description.
+  \param [in] info No description.
+  */
+__kernel void Zivc_scanI32Kernel(zivc::ConstGlobalPtr<int32b> source,
+                                 zivc::GlobalPtr<int32b> dest,
+                                 zivc::GlobalPtr<uint32b> status,
+                                 const zivc::PrimitiveInfo info)
+{
+  constexpr size_t n = zivc::PrimitiveInfo::maxNumOfSubGroups();
+  zivc::Local<int32b> storage[n];
+  zivc::Local<uint32b> tile_storage[1];
+  zivc::scanImpl<int32b>(source, dest, status, storage, tile_storage, info);
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] source No description.
+  \param [out] dest No description.
+  \param [in,out] status No description.
+  \param [in] info No description.
+  */
+__kernel void Zivc_scanU32Kernel(zivc::ConstGlobalPtr<uint32b> source,
+                                 zivc::GlobalPtr<uint32b> dest,
+                                 zivc::GlobalPtr<uint32b> status,
+                                 const zivc::PrimitiveInfo info)
+{
+  constexpr size_t n = zivc::PrimitiveInfo::maxNumOfSubGroups();
+  zivc::Local<uint32b> storage[n];
+  zivc::Local<uint32b> tile_storage[1];
+  zivc::scanImpl<uint32b>(source, dest, status, storage, tile_storage, info);
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] source No description.
+  \param [out] dest No description.
+  \param [in,out] status No description.
+  \param [in] info No description.
+  */
+__kernel void Zivc_scanF32Kernel(zivc::ConstGlobalPtr<float> source,
+                                 zivc::GlobalPtr<float> dest,
+                                 zivc::GlobalPtr<uint32b> status,
+                                 const zivc::PrimitiveInfo info)
+{
+  constexpr size_t n = zivc::PrimitiveInfo::maxNumOfSubGroups();
+  zivc::Local<float> storage[n];
+  zivc::Local<uint32b> tile_storage[1];
+  zivc::scanImpl<float>(source, dest, status, storage, tile_storage, info);
+}
+
+#endif // ZIVC_SCAN_KERNEL_CL
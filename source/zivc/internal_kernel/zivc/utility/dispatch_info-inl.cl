@@ -0,0 +1,112 @@
+/*!
+  \file dispatch_info-inl.cl
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2021 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZIVC_DISPATCH_INFO_INL_CL
+#define ZIVC_DISPATCH_INFO_INL_CL
+
+#include "dispatch_info.cl"
+// Zivc
+#include "zivc/cl/types.cl"
+
+namespace zivc {
+
+/*!
+  \details No detailed description
+
+  \param [in] dim No description.
+  \return No description
+  */
+inline
+uint32b DispatchInfo::bound(const size_t dim) const noexcept
+{
+  const uint32b b = (dim == 0) ? bound_x_ :
+                    (dim == 1) ? bound_y_
+                               : bound_z_;
+  return b;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+size_t DispatchInfo::dimension() const noexcept
+{
+  return static_cast<size_t>(dimension_);
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] dim No description.
+  \return No description
+  */
+inline
+uint32b DispatchInfo::groupSize(const size_t dim) const noexcept
+{
+  const uint32b s = (dim == 0) ? group_size_x_ :
+                    (dim == 1) ? group_size_y_
+                               : group_size_z_;
+  return s;
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] dim No description.
+  \param [in] bound No description.
+  */
+inline
+void DispatchInfo::setBound(const size_t dim, const uint32b bound) noexcept
+{
+  if (dim == 0)
+    bound_x_ = bound;
+  else if (dim == 1)
+    bound_y_ = bound;
+  else
+    bound_z_ = bound;
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] dimension No description.
+  */
+inline
+void DispatchInfo::setDimension(const size_t dimension) noexcept
+{
+  dimension_ = static_cast<uint32b>(dimension);
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] dim No description.
+  \param [in] size No description.
+  */
+inline
+void DispatchInfo::setGroupSize(const size_t dim, const uint32b size) noexcept
+{
+  if (dim == 0)
+    group_size_x_ = size;
+  else if (dim == 1)
+    group_size_y_ = size;
+  else
+    group_size_z_ = size;
+}
+
+} // namespace zivc
+
+#endif // ZIVC_DISPATCH_INFO_INL_CL
@@ -0,0 +1,108 @@
+/*!
+  \file dispatch_info.cl
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2021 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZIVC_DISPATCH_INFO_CL
+#define ZIVC_DISPATCH_INFO_CL
+
+// Zivc
+#include "zivc/cl/types.cl"
+
+namespace zivc {
+
+// Forward declaration
+class DispatchInfo;
+
+//! Check if the two dispatch info are equal
+bool operator==(const DispatchInfo& lhs, const DispatchInfo& rhs) noexcept;
+
+//! Check if the two dispatch info are not equal
+bool operator!=(const DispatchInfo& lhs, const DispatchInfo& rhs) noexcept;
+
+/*!
+  \brief No brief description
+
+  No detailed description.
+  */
+class DispatchInfo
+{
+ public:
+  //! Return the upper bound of the work size of the given dimension
+  uint32b bound(const size_t dim) const noexcept;
+
+  //! Return the work dimension of the kernel
+  size_t dimension() const noexcept;
+
+  //! Return the work-group size of the given dimension
+  uint32b groupSize(const size_t dim) const noexcept;
+
+  //! Set the upper bound of the work size of the given dimension
+  void setBound(const size_t dim, const uint32b bound) noexcept;
+
+  //! Set the work dimension of the kernel
+  void setDimension(const size_t dimension) noexcept;
+
+  //! Set the work-group size of the given dimension
+  void setGroupSize(const size_t dim, const uint32b size) noexcept;
+
+ private:
+  using uint32b = zivc::uint32b;
+
+
+  uint32b bound_x_;
+  uint32b bound_y_;
+  uint32b bound_z_;
+  uint32b dimension_;
+  uint32b group_size_x_;
+  uint32b group_size_y_;
+  uint32b group_size_z_;
+  uint32b pad_;
+};
+
+ /*!
+  \details No detailed description
+
+  \param [in] lhs No description.
+  \param [in] rhs No description.
+  \return No description
+  */
+inline
+bool operator==(const DispatchInfo& lhs, const DispatchInfo& rhs) noexcept
+{
+  bool result = lhs.dimension() == rhs.dimension();
+  for (size_t dim = 0; dim < 3; ++dim) {
+    result = result && (lhs.bound(dim) == rhs.bound(dim)) &&
+                       (lhs.groupSize(dim) == rhs.groupSize(dim));
+  }
+  return result;
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] lhs No description.
+  \param [in] rhs No description.
+  \return No description
+  */
+inline
+bool operator!=(const DispatchInfo& lhs, const DispatchInfo& rhs) noexcept
+{
+  const bool result = !(lhs == rhs);
+  return result;
+}
+
+} // namespace zivc
+
+#include "dispatch_info-inl.cl"
+
+#endif // ZIVC_DISPATCH_INFO_CL
@@ -0,0 +1,67 @@
+/*!
+  \file fill.cl
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2021 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZIVC_FILL_CL
+#define ZIVC_FILL_CL
+
+// Zivc
+#include "zivc/cl/types.cl"
+#include "zivc/cl/utility.cl"
+// Internal kernel
+#include "fill_info.cl"
+
+namespace zivc {
+
+/*!
+  \details The buffer is filled with a grid-stride loop,
+  so adjacent work-items write adjacent units of the buffer.
+  The offset and the size of the info are in units and the data holds
+  the fill pattern of data size units.
+  The pattern is kept in a register if it's a single unit.
+  Otherwise the position in the pattern is advanced without division
+
+  \tparam Type No description.
+  \param [in] data No description.
+  \param [out] buffer No description.
+  \param [in] info No description.
+  */
+template <typename Type> inline
+void fillBuffer(ConstGlobalPtr<Type> data,
+                GlobalPtr<Type> buffer,
+                const FillInfo& info) noexcept
+{
+  const size_t id = getGlobalIdX();
+  const size_t stride = getGlobalSizeX();
+  const size_t size = info.elementSize();
+  const size_t data_size = info.dataSize();
+  GlobalPtr<Type> ptr = buffer + info.elementOffset();
+  if (data_size == 1) {
+    const Type value = data[0];
+    for (size_t i = id; i < size; i += stride)
+      ptr[i] = value;
+  }
+  else {
+    const size_t step = stride % data_size;
+    size_t k = (info.elementOffset() + id) % data_size;
+    for (size_t i = id; i < size; i += stride) {
+      ptr[i] = data[k];
+      k += step;
+      k = (data_size <= k) ? k - data_size : k;
+    }
+  }
+}
+
+} // namespace zivc
+
+#endif // ZIVC_FILL_CL
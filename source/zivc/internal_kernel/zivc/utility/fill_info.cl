@@ -37,7 +37,7 @@ bool operator!=(const FillInfo& lhs, const FillInfo& rhs) noexcept;
 class FillInfo
 {
  public:
-  //! Return the number of buffer elements filled in a work-item
+  //! Return the average number of units filled by a work-item
   static constexpr size_t batchSize() noexcept;
 
   //! Return the capacity of the data
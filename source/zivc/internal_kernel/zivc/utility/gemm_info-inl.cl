@@ -0,0 +1,337 @@
+/*!
+  \file gemm_info-inl.cl
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2021 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZIVC_GEMM_INFO_INL_CL
+#define ZIVC_GEMM_INFO_INL_CL
+
+#include "gemm_info.cl"
+// Zivc
+#include "zivc/cl/bit.cl"
+#include "zivc/cl/types.cl"
+
+namespace zivc {
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+float GemmInfo::alpha() const noexcept
+{
+  const float a = castBit<float>(alpha_bits_);
+  return a;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+size_t GemmInfo::batchSize() const noexcept
+{
+  return static_cast<size_t>(batch_size_);
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+float GemmInfo::beta() const noexcept
+{
+  const float b = castBit<float>(beta_bits_);
+  return b;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+size_t GemmInfo::k() const noexcept
+{
+  return static_cast<size_t>(k_);
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+size_t GemmInfo::lda() const noexcept
+{
+  return static_cast<size_t>(lda_);
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+size_t GemmInfo::ldb() const noexcept
+{
+  return static_cast<size_t>(ldb_);
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+size_t GemmInfo::ldc() const noexcept
+{
+  return static_cast<size_t>(ldc_);
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+size_t GemmInfo::m() const noexcept
+{
+  return static_cast<size_t>(m_);
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+constexpr size_t GemmInfo::maxBlockCols() noexcept
+{
+  const size_t s = 64;
+  return s;
+}
+
+/*!
+  \details The accumulators of a work-item are held in registers,
+  so the number of them is bounded
+
+  \return No description
+  */
+inline
+constexpr size_t GemmInfo::maxElemsPerItem() noexcept
+{
+  static_assert(sizeof(GemmInfo) == kInfoSize, "The size of GemmInfo is wrong.");
+  const size_t s = 32;
+  return s;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+size_t GemmInfo::n() const noexcept
+{
+  return static_cast<size_t>(n_);
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+size_t GemmInfo::numOfTileCols() const noexcept
+{
+  return static_cast<size_t>(num_of_tile_cols_);
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+size_t GemmInfo::numOfTileRows() const noexcept
+{
+  return static_cast<size_t>(num_of_tile_rows_);
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+size_t GemmInfo::numOfTiles() const noexcept
+{
+  const size_t n = numOfTileRows() * numOfTileCols() * batchSize();
+  return n;
+}
+
+/*!
+  \details A work-item of a work-group computes a block of rows and
+  columns of a tile, so that a value read from the local memory is
+  reused from a register for all rows or columns of the block
+
+  \return No description
+  */
+inline
+constexpr size_t GemmInfo::regBlockCols() noexcept
+{
+  const size_t s = 4;
+  return s;
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] batch_size No description.
+  \param [in] stride_a No description.
+  \param [in] stride_b No description.
+  \param [in] stride_c No description.
+  */
+inline
+void GemmInfo::setBatch(const size_t batch_size,
+                        const size_t stride_a,
+                        const size_t stride_b,
+                        const size_t stride_c) noexcept
+{
+  batch_size_ = static_cast<uint32b>(batch_size);
+  stride_a_ = static_cast<uint32b>(stride_a);
+  stride_b_ = static_cast<uint32b>(stride_b);
+  stride_c_ = static_cast<uint32b>(stride_c);
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] lda No description.
+  \param [in] ldb No description.
+  \param [in] ldc No description.
+  */
+inline
+void GemmInfo::setLeadingDims(const size_t lda,
+                              const size_t ldb,
+                              const size_t ldc) noexcept
+{
+  lda_ = static_cast<uint32b>(lda);
+  ldb_ = static_cast<uint32b>(ldb);
+  ldc_ = static_cast<uint32b>(ldc);
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] alpha_bits No description.
+  \param [in] beta_bits No description.
+  */
+inline
+void GemmInfo::setScales(const uint32b alpha_bits, const uint32b beta_bits) noexcept
+{
+  alpha_bits_ = alpha_bits;
+  beta_bits_ = beta_bits;
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] m No description.
+  \param [in] n No description.
+  \param [in] k No description.
+  */
+inline
+void GemmInfo::setShape(const size_t m, const size_t n, const size_t k) noexcept
+{
+  m_ = static_cast<uint32b>(m);
+  n_ = static_cast<uint32b>(n);
+  k_ = static_cast<uint32b>(k);
+}
+
+/*!
+  \details The shape should be set before the tile size
+
+  \param [in] rows No description.
+  \param [in] cols No description.
+  */
+inline
+void GemmInfo::setTileSize(const size_t rows, const size_t cols) noexcept
+{
+  tile_rows_ = static_cast<uint32b>(rows);
+  tile_cols_ = static_cast<uint32b>(cols);
+  num_of_tile_rows_ = static_cast<uint32b>((m() + rows - 1) / rows);
+  num_of_tile_cols_ = static_cast<uint32b>((n() + cols - 1) / cols);
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+size_t GemmInfo::strideA() const noexcept
+{
+  return static_cast<size_t>(stride_a_);
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+size_t GemmInfo::strideB() const noexcept
+{
+  return static_cast<size_t>(stride_b_);
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+size_t GemmInfo::strideC() const noexcept
+{
+  return static_cast<size_t>(stride_c_);
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+size_t GemmInfo::tileCols() const noexcept
+{
+  return static_cast<size_t>(tile_cols_);
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+size_t GemmInfo::tileRows() const noexcept
+{
+  return static_cast<size_t>(tile_rows_);
+}
+
+} // namespace zivc
+
+#endif // ZIVC_GEMM_INFO_INL_CL
@@ -0,0 +1,139 @@
+/*!
+  \file gemm_info.cl
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2021 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZIVC_GEMM_INFO_CL
+#define ZIVC_GEMM_INFO_CL
+
+// Zivc
+#include "zivc/cl/types.cl"
+
+namespace zivc {
+
+/*!
+  \brief Parameters of the general matrix multiplication
+
+  The matrices are row-major. The output matrix is divided into tiles and
+  a tile is computed by a work-group or a work-item.
+  */
+class GemmInfo
+{
+ public:
+  //! Return the scale of the product
+  float alpha() const noexcept;
+
+  //! Return the number of matrices in the batch
+  size_t batchSize() const noexcept;
+
+  //! Return the scale of the input C
+  float beta() const noexcept;
+
+  //! Return the number of columns of A and rows of B
+  size_t k() const noexcept;
+
+  //! Return the leading dimension of A
+  size_t lda() const noexcept;
+
+  //! Return the leading dimension of B
+  size_t ldb() const noexcept;
+
+  //! Return the leading dimension of C
+  size_t ldc() const noexcept;
+
+  //! Return the number of rows of A and C
+  size_t m() const noexcept;
+
+  //! Return the maximum number of columns of a tile computed by a work-item
+  static constexpr size_t maxBlockCols() noexcept;
+
+  //! Return the maximum number of elements of a tile computed by a work-item of a work-group
+  static constexpr size_t maxElemsPerItem() noexcept;
+
+  //! Return the number of columns of B and C
+  size_t n() const noexcept;
+
+  //! Return the number of tile columns of a matrix
+  size_t numOfTileCols() const noexcept;
+
+  //! Return the number of tile rows of a matrix
+  size_t numOfTileRows() const noexcept;
+
+  //! Return the number of tiles of all matrices in the batch
+  size_t numOfTiles() const noexcept;
+
+  //! Return the number of columns of the block of a tile held in registers by a work-item
+  static constexpr size_t regBlockCols() noexcept;
+
+  //! Set the batch
+  void setBatch(const size_t batch_size,
+                const size_t stride_a,
+                const size_t stride_b,
+                const size_t stride_c) noexcept;
+
+  //! Set the leading dimensions
+  void setLeadingDims(const size_t lda, const size_t ldb, const size_t ldc) noexcept;
+
+  //! Set the scales
+  void setScales(const uint32b alpha_bits, const uint32b beta_bits) noexcept;
+
+  //! Set the shape of the multiplication
+  void setShape(const size_t m, const size_t n, const size_t k) noexcept;
+
+  //! Set the size of a tile
+  void setTileSize(const size_t rows, const size_t cols) noexcept;
+
+  //! Return the offset between the matrices A in the batch
+  size_t strideA() const noexcept;
+
+  //! Return the offset between the matrices B in the batch
+  size_t strideB() const noexcept;
+
+  //! Return the offset between the matrices C in the batch
+  size_t strideC() const noexcept;
+
+  //! Return the number of columns of a tile
+  size_t tileCols() const noexcept;
+
+  //! Return the number of rows of a tile
+  size_t tileRows() const noexcept;
+
+ private:
+  using uint32b = zivc::uint32b;
+
+
+  static constexpr size_t kInfoSize = 64;
+
+
+  uint32b m_;
+  uint32b n_;
+  uint32b k_;
+  uint32b lda_;
+  uint32b ldb_;
+  uint32b ldc_;
+  uint32b stride_a_;
+  uint32b stride_b_;
+  uint32b stride_c_;
+  uint32b batch_size_;
+  uint32b tile_rows_;
+  uint32b tile_cols_;
+  uint32b alpha_bits_;
+  uint32b beta_bits_;
+  uint32b num_of_tile_rows_;
+  uint32b num_of_tile_cols_;
+};
+
+} // namespace zivc
+
+#include "gemm_info-inl.cl"
+
+#endif // ZIVC_GEMM_INFO_CL
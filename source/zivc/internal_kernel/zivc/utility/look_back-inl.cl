@@ -0,0 +1,273 @@
+/*!
+  \file look_back-inl.cl
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2021 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZIVC_LOOK_BACK_INL_CL
+#define ZIVC_LOOK_BACK_INL_CL
+
+#include "look_back.cl"
+// Zivc
+#include "zivc/cl/algorithm.cl"
+#include "zivc/cl/atomic.cl"
+#include "zivc/cl/bit.cl"
+#include "zivc/cl/limits.cl"
+#include "zivc/cl/type_traits.cl"
+#include "zivc/cl/types.cl"
+#include "zivc/cl/utility.cl"
+#include "zivc/cl/work_group.cl"
+// Internal kernel
+#include "primitive_info.cl"
+
+namespace zivc {
+
+/*!
+  \details No detailed description
+
+  \tparam Type No description.
+  \param [in] op No description.
+  \param [in] lhs No description.
+  \param [in] rhs No description.
+  \return No description
+  */
+template <typename Type> inline
+Type LookBack::apply(const uint32b op, const Type lhs, const Type rhs) noexcept
+{
+  Type result = lhs + rhs;
+  if (op == PrimitiveInfo::kMin)
+    result = zivc::min(lhs, rhs);
+  else if (op == PrimitiveInfo::kMax)
+    result = zivc::max(lhs, rhs);
+  return result;
+}
+
+/*!
+  \details The aggregate is the aggregate of the whole tile and
+  must be same on all work-items of the work-group.
+  All work-items of a work-group must call the function
+
+  \tparam Type No description.
+  \param [in,out] status No description.
+  \param [in] tile_id No description.
+  \param [in] aggregate No description.
+  \param [in] op No description.
+  \param [out] storage No description.
+  \return No description
+  */
+template <typename Type> inline
+Type LookBack::exchangePrefix(GlobalPtr<uint32b> status,
+                              const size_t tile_id,
+                              const Type aggregate,
+                              const uint32b op,
+                              LocalPtr<Type> storage) noexcept
+{
+  Type prefix = identity<Type>(op);
+  if (getLocalLinearId() == 0)
+    prefix = lookBack(status, tile_id, aggregate, op);
+  prefix = WorkGroup::broadcast(prefix, 0, storage);
+  return prefix;
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Type No description.
+  \param [in] op No description.
+  \return No description
+  */
+template <typename Type> inline
+Type LookBack::identity(const uint32b op) noexcept
+{
+  using Limits = NumericLimits<Type>;
+  Type result = static_cast<Type>(0);
+  if (op == PrimitiveInfo::kMin) {
+    result = Limits::infinity();
+  }
+  else if (op == PrimitiveInfo::kMax) {
+    if constexpr (kIsFloatingPoint<Type>)
+      result = -Limits::infinity();
+    else
+      result = Limits::lowest();
+  }
+  return result;
+}
+
+/*!
+  \details All work-items of a work-group must call the function
+
+  \param [in,out] status No description.
+  \param [out] storage No description.
+  \return No description
+  */
+inline
+size_t LookBack::issueTileId(GlobalPtr<uint32b> status,
+                             LocalPtr<uint32b> storage) noexcept
+{
+  uint32b id = 0;
+  if (getLocalLinearId() == 0)
+    id = atomic_inc(status);
+  id = WorkGroup::broadcast(id, 0, storage);
+  return static_cast<size_t>(id);
+}
+
+/*!
+  \details The operation must be same on all work-items of the work-group
+
+  \tparam Type No description.
+  \param [in] op No description.
+  \param [in] value No description.
+  \param [out] storage No description.
+  \return No description
+  */
+template <typename Type> inline
+Type LookBack::reduceGroup(const uint32b op,
+                           const Type value,
+                           LocalPtr<Type> storage) noexcept
+{
+  Type result = value;
+  if (op == PrimitiveInfo::kMin)
+    result = WorkGroup::reduceMin(value, storage);
+  else if (op == PrimitiveInfo::kMax)
+    result = WorkGroup::reduceMax(value, storage);
+  else
+    result = WorkGroup::reduceAdd(value, storage);
+  return result;
+}
+
+/*!
+  \details The operation must be same on all work-items of the work-group.
+  The exclusive scan of the first work-item is the identity of the operation
+
+  \tparam kIsExclusive No description.
+  \tparam Type No description.
+  \param [in] op No description.
+  \param [in] value No description.
+  \param [out] storage No description.
+  \return No description
+  */
+template <bool kIsExclusive, typename Type> inline
+Type LookBack::scanGroup(const uint32b op,
+                         const Type value,
+                         LocalPtr<Type> storage) noexcept
+{
+  Type result = value;
+  if constexpr (kIsExclusive) {
+    if (op == PrimitiveInfo::kMin)
+      result = WorkGroup::scanExclusiveMin(value, storage);
+    else if (op == PrimitiveInfo::kMax)
+      result = WorkGroup::scanExclusiveMax(value, storage);
+    else
+      result = WorkGroup::scanExclusiveAdd(value, storage);
+  }
+  else {
+    if (op == PrimitiveInfo::kMin)
+      result = WorkGroup::scanInclusiveMin(value, storage);
+    else if (op == PrimitiveInfo::kMax)
+      result = WorkGroup::scanInclusiveMax(value, storage);
+    else
+      result = WorkGroup::scanInclusiveAdd(value, storage);
+  }
+  return result;
+}
+
+/*!
+  \details The tile 0 publishes its inclusive prefix immediately.
+  The other tiles publish the aggregate first, so that successors don't
+  have to wait for the look-back of the tile.
+  The aggregate and the prefix have their own words, a reader only
+  reads the word which the observed flag guarantees to be written
+
+  \tparam Type No description.
+  \param [in,out] status No description.
+  \param [in] tile_id No description.
+  \param [in] aggregate No description.
+  \param [in] op No description.
+  \return No description
+  */
+template <typename Type> inline
+Type LookBack::lookBack(GlobalPtr<uint32b> status,
+                        const size_t tile_id,
+                        const Type aggregate,
+                        const uint32b op) noexcept
+{
+  GlobalPtr<uint32b> tile = tileStatus(status, tile_id);
+  if (tile_id == 0) {
+    store(tile + 2, castBit<uint32b>(aggregate));
+    store(tile, kPrefixReady);
+    return identity<Type>(op);
+  }
+
+  store(tile + 1, castBit<uint32b>(aggregate));
+  store(tile, kAggregateReady);
+
+  Type prefix = identity<Type>(op);
+  for (size_t id = tile_id - 1; ; --id) {
+    GlobalPtr<uint32b> pred = tileStatus(status, id);
+    uint32b flag = load(pred);
+    while (flag == kNotReady)
+      flag = load(pred);
+    const size_t index = (flag == kPrefixReady) ? 2 : 1;
+    const Type value = castBit<Type>(load(pred + index));
+    prefix = apply(op, value, prefix);
+    if (flag == kPrefixReady)
+      break;
+  }
+
+  store(tile + 2, castBit<uint32b>(apply(op, prefix, aggregate)));
+  store(tile, kPrefixReady);
+  return prefix;
+}
+
+
+/*!
+  \details No detailed description
+
+  \param [in] p No description.
+  \return No description
+  */
+inline
+uint32b LookBack::load(GlobalPtr<uint32b> p) noexcept
+{
+  const uint32b value = atomic_or(p, 0u);
+  return value;
+}
+
+/*!
+  \details No detailed description
+
+  \param [out] p No description.
+  \param [in] value No description.
+  */
+inline
+void LookBack::store(GlobalPtr<uint32b> p, const uint32b value) noexcept
+{
+  [[maybe_unused]] const uint32b old = atomic_xchg(p, value);
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] status No description.
+  \param [in] tile_id No description.
+  \return No description
+  */
+inline
+GlobalPtr<uint32b> LookBack::tileStatus(GlobalPtr<uint32b> status,
+                                        const size_t tile_id) noexcept
+{
+  GlobalPtr<uint32b> p = status + (1 + 3 * tile_id);
+  return p;
+}
+
+} // namespace zivc
+
+#endif // ZIVC_LOOK_BACK_INL_CL
@@ -0,0 +1,104 @@
+/*!
+  \file look_back.cl
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2021 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZIVC_LOOK_BACK_CL
+#define ZIVC_LOOK_BACK_CL
+
+// Zivc
+#include "zivc/cl/types.cl"
+// Internal kernel
+#include "primitive_info.cl"
+
+namespace zivc {
+
+/*!
+  \brief Single-pass prefix propagation with decoupled look-back
+
+  A tile is processed by a work-group. Tile ids are issued dynamically
+  in the order in which work-groups start, so every predecessor of a tile
+  is owned by a work-group which is already running. Each tile publishes
+  its aggregate as soon as it's known, then accumulates the published
+  values of its predecessors until it reaches a tile whose inclusive prefix
+  is available. Only the first work-item of a work-group looks back,
+  the other work-items receive the prefix through the local memory.
+  All status words are accessed with 32bit atomic operations.
+  */
+class LookBack
+{
+ public:
+  //! Status flags of a tile
+  enum Status : uint32b
+  {
+    kNotReady = 0,
+    kAggregateReady,
+    kPrefixReady
+  };
+
+
+  //! Apply the binary operation to the given values
+  template <typename Type>
+  static Type apply(const uint32b op, const Type lhs, const Type rhs) noexcept;
+
+  //! Publish the aggregate of the tile and return the exclusive prefix of the tile
+  template <typename Type>
+  static Type exchangePrefix(GlobalPtr<uint32b> status,
+                             const size_t tile_id,
+                             const Type aggregate,
+                             const uint32b op,
+                             LocalPtr<Type> storage) noexcept;
+
+  //! Return the identity element of the binary operation
+  template <typename Type>
+  static Type identity(const uint32b op) noexcept;
+
+  //! Issue a tile id to the work-group in the order in which work-groups start
+  static size_t issueTileId(GlobalPtr<uint32b> status,
+                            LocalPtr<uint32b> storage) noexcept;
+
+  //! Reduce the values of the work-group with the binary operation
+  template <typename Type>
+  static Type reduceGroup(const uint32b op,
+                          const Type value,
+                          LocalPtr<Type> storage) noexcept;
+
+  //! Scan the values of the work-group with the binary operation
+  template <bool kIsExclusive, typename Type>
+  static Type scanGroup(const uint32b op,
+                        const Type value,
+                        LocalPtr<Type> storage) noexcept;
+
+ private:
+  //! Publish the aggregate of the tile and look back the predecessors
+  template <typename Type>
+  static Type lookBack(GlobalPtr<uint32b> status,
+                       const size_t tile_id,
+                       const Type aggregate,
+                       const uint32b op) noexcept;
+
+  //! Load a status word atomically
+  static uint32b load(GlobalPtr<uint32b> p) noexcept;
+
+  //! Store a status word atomically
+  static void store(GlobalPtr<uint32b> p, const uint32b value) noexcept;
+
+  //! Return the pointer to the status of the given tile
+  static GlobalPtr<uint32b> tileStatus(GlobalPtr<uint32b> status,
+                                       const size_t tile_id) noexcept;
+};
+
+} // namespace zivc
+
+#include "look_back-inl.cl"
+
+#endif // ZIVC_LOOK_BACK_CL
@@ -0,0 +1,246 @@
+/*!
+  \file primitive_info-inl.cl
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2021 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZIVC_PRIMITIVE_INFO_INL_CL
+#define ZIVC_PRIMITIVE_INFO_INL_CL
+
+#include "primitive_info.cl"
+// Zivc
+#include "zivc/cl/bit.cl"
+#include "zivc/cl/types.cl"
+
+namespace zivc {
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+size_t PrimitiveInfo::destOffset() const noexcept
+{
+  return static_cast<size_t>(dest_offset_);
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+bool PrimitiveInfo::isExclusive() const noexcept
+{
+  const bool result = (mode_ & kExclusiveFlag) == kExclusiveFlag;
+  return result;
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Type No description.
+  \return No description
+  */
+template <typename Type> inline
+Type PrimitiveInfo::lower() const noexcept
+{
+  const Type l = castBit<Type>(lower_bits_);
+  return l;
+}
+
+/*!
+  \details The work-group collectives exchange the partial results of
+  sub-groups through a local array of this size
+
+  \return No description
+  */
+inline
+constexpr size_t PrimitiveInfo::maxNumOfSubGroups() noexcept
+{
+  const size_t s = 32;
+  return s;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+size_t PrimitiveInfo::numOfBins() const noexcept
+{
+  return static_cast<size_t>(num_of_bins_);
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+size_t PrimitiveInfo::numOfTiles() const noexcept
+{
+  const size_t n = (size() + tileSize() - 1) / tileSize();
+  return n;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+uint32b PrimitiveInfo::operation() const noexcept
+{
+  const uint32b op = mode_ & (kExclusiveFlag - 1u);
+  return op;
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] offset No description.
+  */
+inline
+void PrimitiveInfo::setDestOffset(const size_t offset) noexcept
+{
+  dest_offset_ = static_cast<uint32b>(offset);
+}
+
+/*!
+  \details The bounds are given as the bit representation of the element type
+
+  \param [in] num_of_bins No description.
+  \param [in] lower_bits No description.
+  \param [in] upper_bits No description.
+  */
+inline
+void PrimitiveInfo::setHistogramRange(const uint32b num_of_bins,
+                                      const uint32b lower_bits,
+                                      const uint32b upper_bits) noexcept
+{
+  num_of_bins_ = num_of_bins;
+  lower_bits_ = lower_bits;
+  upper_bits_ = upper_bits;
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] op No description.
+  \param [in] is_exclusive No description.
+  */
+inline
+void PrimitiveInfo::setOperation(const uint32b op, const bool is_exclusive) noexcept
+{
+  mode_ = op | (is_exclusive ? kExclusiveFlag : 0u);
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] s No description.
+  */
+inline
+void PrimitiveInfo::setSize(const size_t s) noexcept
+{
+  size_ = static_cast<uint32b>(s);
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] offset No description.
+  */
+inline
+void PrimitiveInfo::setSourceOffset(const size_t offset) noexcept
+{
+  source_offset_ = static_cast<uint32b>(offset);
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] s No description.
+  */
+inline
+void PrimitiveInfo::setTileSize(const size_t s) noexcept
+{
+  tile_size_ = static_cast<uint32b>(s);
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+size_t PrimitiveInfo::size() const noexcept
+{
+  return static_cast<size_t>(size_);
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+size_t PrimitiveInfo::sourceOffset() const noexcept
+{
+  return static_cast<size_t>(source_offset_);
+}
+
+/*!
+  \details The first word is the counter of tile ids.
+  Each tile has three words: the status flag, the aggregate and
+  the inclusive prefix
+
+  \param [in] num_of_tiles No description.
+  \return No description
+  */
+inline
+constexpr size_t PrimitiveInfo::statusSize(const size_t num_of_tiles) noexcept
+{
+  static_assert(sizeof(PrimitiveInfo) == kInfoSize, "The size of PrimitiveInfo is wrong.");
+  const size_t s = 1 + 3 * num_of_tiles;
+  return s;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+size_t PrimitiveInfo::tileSize() const noexcept
+{
+  return static_cast<size_t>(tile_size_);
+}
+
+/*!
+  \details No detailed description
+
+  \tparam Type No description.
+  \return No description
+  */
+template <typename Type> inline
+Type PrimitiveInfo::upper() const noexcept
+{
+  const Type u = castBit<Type>(upper_bits_);
+  return u;
+}
+
+} // namespace zivc
+
+#endif // ZIVC_PRIMITIVE_INFO_INL_CL
@@ -0,0 +1,120 @@
+/*!
+  \file primitive_info.cl
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2021 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZIVC_PRIMITIVE_INFO_CL
+#define ZIVC_PRIMITIVE_INFO_CL
+
+// Zivc
+#include "zivc/cl/types.cl"
+
+namespace zivc {
+
+/*!
+  \brief Parameters of device-wide primitives (reduce, scan, compact, histogram and convert)
+
+  No detailed description.
+  */
+class PrimitiveInfo
+{
+ public:
+  //! Binary operations of reduce and scan
+  enum Operation : uint32b
+  {
+    kAdd = 0,
+    kMin,
+    kMax
+  };
+
+
+  //! Return the offset index into the dest buffer
+  size_t destOffset() const noexcept;
+
+  //! Check if the scan is exclusive
+  bool isExclusive() const noexcept;
+
+  //! Return the lower bound of the histogram
+  template <typename Type>
+  Type lower() const noexcept;
+
+  //! Return the maximum number of sub-groups of a work-group of the primitives
+  static constexpr size_t maxNumOfSubGroups() noexcept;
+
+  //! Return the number of bins of the histogram
+  size_t numOfBins() const noexcept;
+
+  //! Return the number of tiles
+  size_t numOfTiles() const noexcept;
+
+  //! Return the binary operation of reduce and scan
+  uint32b operation() const noexcept;
+
+  //! Set the offset index into the dest buffer
+  void setDestOffset(const size_t offset) noexcept;
+
+  //! Set the range of the histogram
+  void setHistogramRange(const uint32b num_of_bins,
+                         const uint32b lower_bits,
+                         const uint32b upper_bits) noexcept;
+
+  //! Set the binary operation of reduce and scan
+  void setOperation(const uint32b op, const bool is_exclusive) noexcept;
+
+  //! Set the number of elements to be processed
+  void setSize(const size_t s) noexcept;
+
+  //! Set the offset index into the source buffer
+  void setSourceOffset(const size_t offset) noexcept;
+
+  //! Set the number of elements processed by a work-group
+  void setTileSize(const size_t s) noexcept;
+
+  //! Return the number of elements to be processed
+  size_t size() const noexcept;
+
+  //! Return the offset index into the source buffer
+  size_t sourceOffset() const noexcept;
+
+  //! Return the number of status words used by the look-back
+  static constexpr size_t statusSize(const size_t num_of_tiles) noexcept;
+
+  //! Return the number of elements processed by a work-group
+  size_t tileSize() const noexcept;
+
+  //! Return the upper bound of the histogram
+  template <typename Type>
+  Type upper() const noexcept;
+
+ private:
+  using uint32b = zivc::uint32b;
+
+
+  static constexpr size_t kInfoSize = 32;
+  static constexpr uint32b kExclusiveFlag = 0b1u << 16u;
+
+
+  uint32b source_offset_;
+  uint32b dest_offset_;
+  uint32b size_;
+  uint32b tile_size_;
+  uint32b mode_;
+  uint32b num_of_bins_;
+  uint32b lower_bits_;
+  uint32b upper_bits_;
+};
+
+} // namespace zivc
+
+#include "primitive_info-inl.cl"
+
+#endif // ZIVC_PRIMITIVE_INFO_CL
@@ -0,0 +1,168 @@
+/*!
+  \file random_info-inl.cl
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2021 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZIVC_RANDOM_INFO_INL_CL
+#define ZIVC_RANDOM_INFO_INL_CL
+
+#include "random_info.cl"
+// Zivc
+#include "zivc/cl/philox_engine.cl"
+#include "zivc/cl/types.cl"
+
+namespace zivc {
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+uint32b RandomInfo::blockLo() const noexcept
+{
+  return block_lo_;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+uint32b RandomInfo::blockHi() const noexcept
+{
+  return block_hi_;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+size_t RandomInfo::destOffset() const noexcept
+{
+  return static_cast<size_t>(dest_offset_);
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+size_t RandomInfo::firstLane() const noexcept
+{
+  return static_cast<size_t>(first_lane_);
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+size_t RandomInfo::numOfBlocks() const noexcept
+{
+  static_assert(sizeof(RandomInfo) == kInfoSize, "The size of RandomInfo is wrong.");
+  constexpr size_t n = PhiloxEngine::numOfWords();
+  const size_t num_of_blocks = (firstLane() + size() + n - 1) / n;
+  return num_of_blocks;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+uint32b RandomInfo::seedLo() const noexcept
+{
+  return seed_lo_;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+uint32b RandomInfo::seedHi() const noexcept
+{
+  return seed_hi_;
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] offset No description.
+  */
+inline
+void RandomInfo::setDestOffset(const size_t offset) noexcept
+{
+  dest_offset_ = static_cast<uint32b>(offset);
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] offset_lo No description.
+  \param [in] offset_hi No description.
+  */
+inline
+void RandomInfo::setOffset(const uint32b offset_lo, const uint32b offset_hi) noexcept
+{
+  // The number of words per block is 4
+  block_lo_ = (offset_lo >> 2u) | (offset_hi << 30u);
+  block_hi_ = offset_hi >> 2u;
+  first_lane_ = offset_lo & 0b11u;
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] seed_lo No description.
+  \param [in] seed_hi No description.
+  */
+inline
+void RandomInfo::setSeed(const uint32b seed_lo, const uint32b seed_hi) noexcept
+{
+  seed_lo_ = seed_lo;
+  seed_hi_ = seed_hi;
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] s No description.
+  */
+inline
+void RandomInfo::setSize(const size_t s) noexcept
+{
+  size_ = static_cast<uint32b>(s);
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+size_t RandomInfo::size() const noexcept
+{
+  return static_cast<size_t>(size_);
+}
+
+} // namespace zivc
+
+#endif // ZIVC_RANDOM_INFO_INL_CL
@@ -0,0 +1,90 @@
+/*!
+  \file random_info.cl
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2021 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZIVC_RANDOM_INFO_CL
+#define ZIVC_RANDOM_INFO_CL
+
+// Zivc
+#include "zivc/cl/types.cl"
+
+namespace zivc {
+
+/*!
+  \brief Parameters of the random number generation
+
+  The element i of the dest is the number (offset + i) of the stream of the seed.
+  The numbers are generated per block of four,
+  so the offset is divided into a block index and a lane in the block.
+  */
+class RandomInfo
+{
+ public:
+  //! Return the lower 32 bits of the index of the first block
+  uint32b blockLo() const noexcept;
+
+  //! Return the upper 32 bits of the index of the first block
+  uint32b blockHi() const noexcept;
+
+  //! Return the offset index into the dest buffer
+  size_t destOffset() const noexcept;
+
+  //! Return the lane of the first number in the first block
+  size_t firstLane() const noexcept;
+
+  //! Return the number of blocks covering the numbers
+  size_t numOfBlocks() const noexcept;
+
+  //! Return the lower 32 bits of the seed
+  uint32b seedLo() const noexcept;
+
+  //! Return the upper 32 bits of the seed
+  uint32b seedHi() const noexcept;
+
+  //! Set the offset index into the dest buffer
+  void setDestOffset(const size_t offset) noexcept;
+
+  //! Set the offset of the first number in the stream
+  void setOffset(const uint32b offset_lo, const uint32b offset_hi) noexcept;
+
+  //! Set the seed of the stream
+  void setSeed(const uint32b seed_lo, const uint32b seed_hi) noexcept;
+
+  //! Set the number of elements to be generated
+  void setSize(const size_t s) noexcept;
+
+  //! Return the number of elements to be generated
+  size_t size() const noexcept;
+
+ private:
+  using uint32b = zivc::uint32b;
+
+
+  static constexpr size_t kInfoSize = 32;
+
+
+  uint32b seed_lo_;
+  uint32b seed_hi_;
+  uint32b block_lo_;
+  uint32b block_hi_;
+  uint32b first_lane_;
+  uint32b dest_offset_;
+  uint32b size_;
+  uint32b pad_;
+};
+
+} // namespace zivc
+
+#include "random_info-inl.cl"
+
+#endif // ZIVC_RANDOM_INFO_CL
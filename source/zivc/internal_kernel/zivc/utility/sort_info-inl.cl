@@ -0,0 +1,283 @@
+/*!
+  \file sort_info-inl.cl
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2021 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZIVC_SORT_INFO_INL_CL
+#define ZIVC_SORT_INFO_INL_CL
+
+#include "sort_info.cl"
+// Zivc
+#include "zivc/cl/types.cl"
+
+namespace zivc {
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+bool SortInfo::hasSegments() const noexcept
+{
+  const bool result = 0 < num_of_segments_;
+  return result;
+}
+
+/*!
+  \details The segment passes follow the key passes
+
+  \param [in] pass No description.
+  \return No description
+  */
+inline
+bool SortInfo::isSegmentPass(const size_t pass) const noexcept
+{
+  const bool result = numOfKeyPasses() <= pass;
+  return result;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+uint32b SortInfo::keyKind() const noexcept
+{
+  return key_kind_;
+}
+
+/*!
+  \details The work-group size of the internal kernels is the sub-group size
+  of the device, which is 128 at most
+
+  \return No description
+  */
+inline
+constexpr size_t SortInfo::maxWorkGroupSize() noexcept
+{
+  const size_t s = 128;
+  return s;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+size_t SortInfo::numOfKeyPasses() const noexcept
+{
+  return static_cast<size_t>(num_of_key_passes_);
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+size_t SortInfo::numOfSegments() const noexcept
+{
+  return static_cast<size_t>(num_of_segments_);
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+size_t SortInfo::numOfTiles() const noexcept
+{
+  const size_t n = (size() + tileSize() - 1) / tileSize();
+  return n;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+size_t SortInfo::numOfValueWords() const noexcept
+{
+  return static_cast<size_t>(num_of_value_words_);
+}
+
+/*!
+  \details The elements of the user buffers start at the source offset,
+  and the elements of the temporary buffers start at zero
+
+  \param [in] buffer_index No description.
+  \return No description
+  */
+inline
+size_t SortInfo::offset(const size_t buffer_index) const noexcept
+{
+  const size_t o = (buffer_index == 0) ? sourceOffset() : 0;
+  return o;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+constexpr size_t SortInfo::radixSize() noexcept
+{
+  static_assert(sizeof(SortInfo) == kInfoSize, "The size of SortInfo is wrong.");
+  const size_t s = 1u << radixBits();
+  return s;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+constexpr size_t SortInfo::radixBits() noexcept
+{
+  const size_t bits = 8;
+  return bits;
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] kind No description.
+  */
+inline
+void SortInfo::setKeyKind(const uint32b kind) noexcept
+{
+  key_kind_ = kind;
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] num_of_passes No description.
+  */
+inline
+void SortInfo::setNumOfKeyPasses(const size_t num_of_passes) noexcept
+{
+  num_of_key_passes_ = static_cast<uint32b>(num_of_passes);
+}
+
+/*!
+  \details Zero means the elements aren't segmented
+
+  \param [in] num_of_segments No description.
+  */
+inline
+void SortInfo::setNumOfSegments(const size_t num_of_segments) noexcept
+{
+  num_of_segments_ = static_cast<uint32b>(num_of_segments);
+}
+
+/*!
+  \details Zero means the sort has no values
+
+  \param [in] num_of_words No description.
+  */
+inline
+void SortInfo::setNumOfValueWords(const size_t num_of_words) noexcept
+{
+  num_of_value_words_ = static_cast<uint32b>(num_of_words);
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] s No description.
+  */
+inline
+void SortInfo::setSize(const size_t s) noexcept
+{
+  size_ = static_cast<uint32b>(s);
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] offset No description.
+  */
+inline
+void SortInfo::setSourceOffset(const size_t offset) noexcept
+{
+  source_offset_ = static_cast<uint32b>(offset);
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] s No description.
+  */
+inline
+void SortInfo::setTileSize(const size_t s) noexcept
+{
+  tile_size_ = static_cast<uint32b>(s);
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] pass No description.
+  \return No description
+  */
+inline
+size_t SortInfo::shift(const size_t pass) const noexcept
+{
+  const size_t p = isSegmentPass(pass) ? pass - numOfKeyPasses() : pass;
+  const size_t s = radixBits() * p;
+  return s;
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+size_t SortInfo::size() const noexcept
+{
+  return static_cast<size_t>(size_);
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+size_t SortInfo::sourceOffset() const noexcept
+{
+  return static_cast<size_t>(source_offset_);
+}
+
+/*!
+  \details No detailed description
+
+  \return No description
+  */
+inline
+size_t SortInfo::tileSize() const noexcept
+{
+  return static_cast<size_t>(tile_size_);
+}
+
+} // namespace zivc
+
+#endif // ZIVC_SORT_INFO_INL_CL
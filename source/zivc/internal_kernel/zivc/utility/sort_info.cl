@@ -0,0 +1,130 @@
+/*!
+  \file sort_info.cl
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2021 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZIVC_SORT_INFO_CL
+#define ZIVC_SORT_INFO_CL
+
+// Zivc
+#include "zivc/cl/types.cl"
+
+namespace zivc {
+
+/*!
+  \brief Parameters of the radix sort
+
+  The parameters are shared by all passes of the sort.
+  The keys are moved between a ping-pong pair of buffers. The first buffer
+  is the buffer of the user and the second one is a temporary buffer.
+  A pass reads the buffer of the pass parity and writes the other one.
+  */
+class SortInfo
+{
+ public:
+  //! Kinds of keys which are converted into radix keys
+  enum KeyKind : uint32b
+  {
+    kUnsigned = 0,
+    kSigned,
+    kFloat
+  };
+
+
+  //! Check if the elements have segment ids
+  bool hasSegments() const noexcept;
+
+  //! Check if the given pass sorts the elements by the segment ids
+  bool isSegmentPass(const size_t pass) const noexcept;
+
+  //! Return the kind of the keys
+  uint32b keyKind() const noexcept;
+
+  //! Return the max number of work-items of a work-group
+  static constexpr size_t maxWorkGroupSize() noexcept;
+
+  //! Return the number of passes which sort the elements by the keys
+  size_t numOfKeyPasses() const noexcept;
+
+  //! Return the number of segments
+  size_t numOfSegments() const noexcept;
+
+  //! Return the number of tiles
+  size_t numOfTiles() const noexcept;
+
+  //! Return the number of 32bit words of a value
+  size_t numOfValueWords() const noexcept;
+
+  //! Return the offset index into the keys and values of the given ping-pong buffer
+  size_t offset(const size_t buffer_index) const noexcept;
+
+  //! Return the number of bins of a digit
+  static constexpr size_t radixSize() noexcept;
+
+  //! Return the number of bits of a digit
+  static constexpr size_t radixBits() noexcept;
+
+  //! Set the kind of the keys
+  void setKeyKind(const uint32b kind) noexcept;
+
+  //! Set the number of passes which sort the elements by the keys
+  void setNumOfKeyPasses(const size_t num_of_passes) noexcept;
+
+  //! Set the number of segments
+  void setNumOfSegments(const size_t num_of_segments) noexcept;
+
+  //! Set the number of 32bit words of a value
+  void setNumOfValueWords(const size_t num_of_words) noexcept;
+
+  //! Set the number of elements to be sorted
+  void setSize(const size_t s) noexcept;
+
+  //! Set the offset index into the source keys and values
+  void setSourceOffset(const size_t offset) noexcept;
+
+  //! Set the number of elements processed by a work-group
+  void setTileSize(const size_t s) noexcept;
+
+  //! Return the bit position of the digit of the given pass
+  size_t shift(const size_t pass) const noexcept;
+
+  //! Return the number of elements to be sorted
+  size_t size() const noexcept;
+
+  //! Return the offset index into the source keys and values
+  size_t sourceOffset() const noexcept;
+
+  //! Return the number of elements processed by a work-group
+  size_t tileSize() const noexcept;
+
+ private:
+  using uint32b = zivc::uint32b;
+
+
+  static constexpr size_t kInfoSize = 32;
+
+
+  uint32b source_offset_;
+  uint32b size_;
+  uint32b tile_size_;
+  uint32b key_kind_;
+  uint32b num_of_key_passes_;
+  uint32b num_of_value_words_;
+  uint32b num_of_segments_;
+  uint32b pad_;
+};
+
+} // namespace zivc
+
+#include "sort_info-inl.cl"
+
+#endif // ZIVC_SORT_INFO_CL
@@ -1177,6 +1177,79 @@ TEST(BufferTest, FillBufferFastRangeTest)
   }
 }
 
+TEST(BufferTest, FillBufferPatternRangeTest)
+{
+  using zisc::uint32b;
+  struct Pattern
+  {
+    uint32b x_;
+    uint32b y_;
+    uint32b z_;
+  };
+  static_assert(sizeof(Pattern) == 12);
+
+  auto platform = ztest::makePlatform();
+  const ztest::Config& config = ztest::Config::globalConfig();
+  zivc::SharedDevice device = platform->queryDevice(config.deviceId());
+
+  auto buffer_device = device->makeBuffer<Pattern>(zivc::BufferUsage::kDeviceOnly);
+  auto buffer_host = device->makeBuffer<Pattern>(zivc::BufferUsage::kHostOnly);
+
+  // Allocate memories
+  {
+    const std::size_t s = 1024ull * 1024ull + 7ull;
+    buffer_device->setSize(s);
+    buffer_host->setSize(s);
+  }
+  constexpr Pattern zero{0u, 0u, 0u};
+  constexpr Pattern v{1u, 2u, 3u};
+  constexpr std::size_t offset = 5;
+  // Fill buffer test
+  {
+    auto options = buffer_device->makeOptions();
+    options.setLabel("FillBuffer");
+    options.setExternalSyncMode(true);
+    {
+      auto result = buffer_device->fill(zero, options);
+      if (result.isAsync()) {
+        ASSERT_TRUE(result.fence()) << "The result of the filling is wrong.";
+        result.fence().wait();
+      }
+    }
+    options.setDestOffset(offset);
+    options.setSize(buffer_device->size() - 2 * offset);
+    {
+      auto result = buffer_device->fill(v, options);
+      if (result.isAsync()) {
+        ASSERT_TRUE(result.fence()) << "The result of the filling is wrong.";
+        result.fence().wait();
+      }
+    }
+  }
+  // Copy from device to host
+  {
+    auto options = buffer_device->makeOptions();
+    options.setLabel("DeviceToHostCopy");
+    options.setExternalSyncMode(true);
+    auto result = zivc::copy(*buffer_device, buffer_host.get(), options);
+    if (result.isAsync()) {
+      ASSERT_TRUE(result.fence()) << "The result of the copy is wrong.";
+      result.fence().wait();
+    }
+  }
+  {
+    auto mapped_mem = buffer_host->mapMemory();
+    const std::size_t s = mapped_mem.size();
+    for (std::size_t i = 0; i < s; ++i) {
+      const bool is_in_range = (offset <= i) && (i < (s - offset));
+      const Pattern& expected = is_in_range ? v : zero;
+      ASSERT_EQ(expected.x_, mapped_mem[i].x_) << "Filling buffer pattern failed.";
+      ASSERT_EQ(expected.y_, mapped_mem[i].y_) << "Filling buffer pattern failed.";
+      ASSERT_EQ(expected.z_, mapped_mem[i].z_) << "Filling buffer pattern failed.";
+    }
+  }
+}
+
 TEST(BufferTest, FillHostBufferTest)
 {
   using zisc::int32b;
@@ -1570,3 +1643,180 @@ TEST(BufferTest, ResizeBufferReinterpTest)
   ASSERT_EQ(buffer_device->size(), n / k) << "Reinterp adapter is wrong.";
   ASSERT_EQ(buffer_device->sizeInBytes(), s) << "Reinterp adapter is wrong.";
 }
+
+TEST(BufferTest, ResizeBufferPreservingContentsTest)
+{
+  using zivc::uint32b;
+
+  auto platform = ztest::makePlatform();
+  const ztest::Config& config = ztest::Config::globalConfig();
+  zivc::SharedDevice device = platform->queryDevice(config.deviceId());
+
+  auto buffer_host = device->makeBuffer<uint32b>(zivc::BufferUsage::kHostOnly);
+  auto buffer_device = device->makeBuffer<uint32b>(zivc::BufferUsage::kDeviceOnly);
+
+  constexpr std::size_t n = 1024;
+  constexpr std::size_t num_of_appends = 5;
+
+  buffer_host->setSize(n);
+  {
+    auto mapped_mem = buffer_host->mapMemory();
+    for (std::size_t i = 0; i < mapped_mem.size(); ++i)
+      mapped_mem[i] = zisc::cast<uint32b>(i);
+  }
+  // Append the host data repeatedly
+  std::size_t prev_capacity = 0;
+  std::size_t num_of_reallocations = 0;
+  for (std::size_t i = 0; i < num_of_appends; ++i) {
+    auto options = buffer_host->makeOptions();
+    options.setLabel("AppendBuffer");
+    options.setExternalSyncMode(true);
+    auto result = buffer_device->appendFrom(*buffer_host, options);
+    if (result.isAsync())
+      result.fence().wait();
+    ASSERT_EQ((i + 1) * n, buffer_device->size()) << "Appending buffer failed.";
+    if (prev_capacity != buffer_device->capacity())
+      ++num_of_reallocations;
+    prev_capacity = buffer_device->capacity();
+  }
+  ASSERT_GT(num_of_appends, num_of_reallocations) << "The capacity doesn't grow geometrically.";
+
+  // Shrink and extend the buffer
+  buffer_device->resize(n / 2);
+  ASSERT_EQ(n / 2, buffer_device->size()) << "Resizing buffer failed.";
+  buffer_device->resize(2 * n);
+  ASSERT_EQ(2 * n, buffer_device->size()) << "Resizing buffer failed.";
+
+  // Initialize all elements, then reserve a memory which needs a reallocation
+  auto to_value = [](const std::size_t i) noexcept
+  {
+    return zisc::cast<uint32b>(3 * i + 1);
+  };
+  buffer_host->setSize(2 * n);
+  {
+    auto mapped_mem = buffer_host->mapMemory();
+    for (std::size_t i = 0; i < mapped_mem.size(); ++i)
+      mapped_mem[i] = to_value(i);
+  }
+  // The copy isn't waited for. The reserve copies the contents on
+  // the same queue, so it's ordered after the copy
+  {
+    auto options = buffer_host->makeOptions();
+    options.setQueueIndex(0);
+    options.setExternalSyncMode(false);
+    [[maybe_unused]] auto result = zivc::copy(*buffer_host, buffer_device.get(), options);
+  }
+  ASSERT_GT(8 * num_of_appends * n, buffer_device->capacity());
+  buffer_device->reserve(8 * num_of_appends * n, zivc::LaunchOptions{});
+  ASSERT_LE(8 * num_of_appends * n, buffer_device->capacity()) << "Reserving buffer failed.";
+  ASSERT_EQ(2 * n, buffer_device->size()) << "Reserving buffer changed the size.";
+
+  // Check all the contents
+  {
+    auto mapped_mem = buffer_host->mapMemory();
+    std::fill_n(mapped_mem.begin(), mapped_mem.size(), 0);
+  }
+  {
+    auto options = buffer_host->makeOptions();
+    options.setExternalSyncMode(true);
+    auto result = zivc::copy(*buffer_device, buffer_host.get(), options);
+    if (result.isAsync())
+      result.fence().wait();
+  }
+  {
+    auto mapped_mem = buffer_host->mapMemory();
+    ASSERT_EQ(2 * n, mapped_mem.size());
+    for (std::size_t i = 0; i < mapped_mem.size(); ++i) {
+      const uint32b expected = to_value(i);
+      ASSERT_EQ(expected, mapped_mem[i]) << "The contents aren't preserved at " << i << ".";
+    }
+  }
+}
+
+TEST(BufferTest, ChunkedBufferTest)
+{
+  using zivc::uint32b;
+
+  auto platform = ztest::makePlatform();
+  const ztest::Config& config = ztest::Config::globalConfig();
+  zivc::SharedDevice device = platform->queryDevice(config.deviceId());
+
+  // Use small chunks with different capacities to cross the chunk boundaries
+  constexpr std::size_t host_chunk_capacity = 1000;
+  constexpr std::size_t device_chunk_capacity = 1024;
+  zivc::ChunkedBuffer<uint32b> buffer_host{device.get(),
+                                           zivc::BufferUsage::kHostOnly,
+                                           host_chunk_capacity};
+  zivc::ChunkedBuffer<uint32b> buffer_device{device.get(),
+                                             zivc::BufferUsage::kDeviceOnly,
+                                             device_chunk_capacity};
+
+  constexpr std::size_t n = 10 * 1024 + 3;
+  buffer_host.setSize(n);
+  ASSERT_EQ(n, buffer_host.size()) << "Resizing chunked buffer failed.";
+  ASSERT_EQ(11u, buffer_host.numOfChunks()) << "Resizing chunked buffer failed.";
+  {
+    auto mapped_mem = buffer_host.mapMemory();
+    ASSERT_EQ(n, mapped_mem.size()) << "Mapping chunked buffer failed.";
+    for (std::size_t i = 0; i < mapped_mem.size(); ++i)
+      mapped_mem[i] = zisc::cast<uint32b>(i);
+  }
+  // Copy to the device
+  buffer_device.setSize(n);
+  ASSERT_EQ(11u, buffer_device.numOfChunks()) << "Resizing chunked buffer failed.";
+  {
+    auto options = buffer_device.makeOptions();
+    options.setLabel("ChunkedCopy");
+    options.setExternalSyncMode(true);
+    auto result = buffer_device.copyFrom(buffer_host, options);
+    if (result.isAsync())
+      result.fence().wait();
+  }
+  // Fill a range which crosses the chunk boundaries
+  constexpr std::size_t fill_offset = 1000;
+  constexpr std::size_t fill_size = 3000;
+  constexpr uint32b fill_value = 0xffffffffu;
+  {
+    auto options = buffer_device.makeOptions();
+    options.setLabel("ChunkedFill");
+    options.setDestOffset(fill_offset);
+    options.setSize(fill_size);
+    options.setExternalSyncMode(true);
+    auto result = buffer_device.fill(fill_value, options);
+    if (result.isAsync())
+      result.fence().wait();
+  }
+  // Extend the buffer preserving the contents
+  buffer_device.setSize(n + device_chunk_capacity);
+  ASSERT_EQ(12u, buffer_device.numOfChunks()) << "Resizing chunked buffer failed.";
+  // Copy back to the host
+  {
+    auto options = buffer_host.makeOptions();
+    options.setExternalSyncMode(true);
+    auto result = buffer_host.copyFrom(buffer_device, options);
+    if (result.isAsync())
+      result.fence().wait();
+  }
+  {
+    const auto& host = buffer_host;
+    auto mapped_mem = host.mapMemory();
+    for (std::size_t i = 0; i < mapped_mem.size(); ++i) {
+      const bool is_filled = (fill_offset <= i) && (i < fill_offset + fill_size);
+      const uint32b expected = is_filled ? fill_value : zisc::cast<uint32b>(i);
+      ASSERT_EQ(expected, mapped_mem[i]) << "Chunked buffer operation failed at " << i;
+    }
+  }
+  // Out of range operations
+  {
+    auto options = buffer_device.makeOptions();
+    options.setDestOffset(1);
+    ASSERT_THROW(auto r = buffer_device.fill(fill_value, options), zivc::SystemError)
+        << "Filling out of range didn't fail.";
+  }
+  {
+    auto options = buffer_host.makeOptions();
+    options.setSize(buffer_device.size());
+    ASSERT_THROW(auto r = buffer_device.copyFrom(buffer_host, options), zivc::SystemError)
+        << "Copying out of range didn't fail.";
+  }
+}
@@ -18,6 +18,10 @@
 // Standard C++ library
 #include <array>
 #include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <ios>
 #include <utility>
 // Zisc
 #include "zisc/utility.hpp"
@@ -858,3 +862,98 @@ TEST(BufferTest, FillBufferInt384RangeTest)
     }
   }
 }
+
+TEST(BufferTest, HugePageBufferTest)
+{
+  using zivc::uint32b;
+
+  auto platform = ztest::makePlatform();
+  const ztest::Config& config = ztest::Config::globalConfig();
+  zivc::SharedDevice device = platform->queryDevice(config.deviceId());
+
+  zivc::BufferInitParams params{zivc::BufferUsage::kHostOnly};
+  params.setAlignment(256);
+  params.setHugePageMode(zivc::BufferInitParams::HugePageMode::kTransparent);
+  auto buffer = device->makeBuffer<uint32b>(params);
+
+  // Small buffer
+  constexpr std::size_t n0 = 100;
+  buffer->setSize(n0);
+  ASSERT_EQ(n0, buffer->size()) << "Buffer 'setSize(" << n0 << ")' failed.";
+  {
+    auto mapped_mem = buffer->mapMemory();
+    if (device->type() == zivc::SubPlatformType::kCpu) {
+      const auto address = reinterpret_cast<std::uintptr_t>(mapped_mem.data());
+      ASSERT_EQ(0, address % 256) << "The buffer memory isn't aligned.";
+    }
+    for (std::size_t i = 0; i < n0; ++i)
+      mapped_mem[i] = zisc::cast<uint32b>(i);
+  }
+  // Large buffer which can be backed by huge pages
+  constexpr std::size_t n1 = (8ull * 1024ull * 1024ull) / sizeof(uint32b);
+  buffer->setSize(n1);
+  ASSERT_EQ(n1, buffer->size()) << "Buffer 'setSize(" << n1 << ")' failed.";
+  {
+    auto mapped_mem = buffer->mapMemory();
+    // Only the cpu buffer preserves the contents in resize
+    if (device->type() == zivc::SubPlatformType::kCpu) {
+      const auto address = reinterpret_cast<std::uintptr_t>(mapped_mem.data());
+      ASSERT_EQ(0, address % 256) << "The buffer memory isn't aligned.";
+      for (std::size_t i = 0; i < n0; ++i) {
+        ASSERT_EQ(zisc::cast<uint32b>(i), mapped_mem[i])
+            << "The contents aren't preserved in resize.";
+      }
+      for (std::size_t i = n0; i < n1; ++i) {
+        ASSERT_EQ(0, mapped_mem[i]) << "The new elements aren't initialized.";
+      }
+    }
+  }
+}
+
+TEST(BufferTest, FileBufferTest)
+{
+  using zivc::uint32b;
+
+  auto platform = ztest::makePlatform();
+  const ztest::Config& config = ztest::Config::globalConfig();
+  zivc::SharedDevice device = platform->queryDevice(config.deviceId());
+
+  // Write a test file
+  constexpr std::size_t n = 3 * 1024 * 1024;
+  constexpr std::size_t offset = 4;
+  const std::filesystem::path file_path =
+      std::filesystem::temp_directory_path() / "zivc_file_buffer_test.bin";
+  {
+    std::ofstream file{file_path, std::ios_base::binary};
+    for (std::size_t i = 0; i < (n + offset); ++i) {
+      const auto v = zisc::cast<uint32b>(i);
+      file.write(reinterpret_cast<const char*>(&v), sizeof(v));
+    }
+  }
+
+  auto buffer_device = zivc::makeFileBuffer<uint32b>(device.get(),
+                                                     zivc::BufferUsage::kDeviceOnly,
+                                                     file_path,
+                                                     offset * sizeof(uint32b));
+  ASSERT_EQ(n, buffer_device->size()) << "Making a file buffer failed.";
+  auto buffer_host = device->makeBuffer<uint32b>(zivc::BufferUsage::kDeviceToHost);
+  buffer_host->setSize(n);
+  {
+    auto options = buffer_device->makeOptions();
+    options.setExternalSyncMode(true);
+    auto result = zivc::copy(*buffer_device, buffer_host.get(), options);
+    if (result.isAsync()) {
+      ASSERT_TRUE(result.fence()) << "The result of the copy is wrong.";
+      device->waitForCompletion(result.fence());
+    }
+  }
+  {
+    auto mapped_mem = buffer_host->mapMemory();
+    for (std::size_t i = 0; i < n; ++i) {
+      ASSERT_EQ(zisc::cast<uint32b>(i + offset), mapped_mem[i])
+          << "The file contents are wrong.";
+    }
+  }
+  buffer_device.reset();
+  std::filesystem::remove(file_path);
+}
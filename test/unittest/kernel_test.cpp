@@ -22,6 +22,7 @@
 #include <numeric>
 #include <type_traits>
 #include <utility>
+#include <vector>
 // Zisc
 #include "zisc/utility.hpp"
 // Zivc
@@ -1448,3 +1449,224 @@ TEST(KernelTest, WorkItemOffset3dTest)
     }
   }
 }
+
+TEST(KernelTest, WorkGroupSizeTest)
+{
+  auto platform = ztest::makePlatform();
+  const ztest::Config& config = ztest::Config::globalConfig();
+  zivc::SharedDevice device = platform->queryDevice(config.deviceId());
+
+  const std::size_t n = config.testKernelWorkSize1d();
+
+  using zivc::int32b;
+  using zivc::uint32b;
+
+  // Allocate buffers
+  auto buff_device1 = device->makeBuffer<int32b>(zivc::BufferUsage::kDeviceOnly);
+  buff_device1->setSize(n);
+  auto buff_device2 = device->makeBuffer<int32b>(zivc::BufferUsage::kDeviceOnly);
+  buff_device2->setSize(n);
+  auto buff_host = device->makeBuffer<int32b>(zivc::BufferUsage::kHostOnly);
+  buff_host->setSize(n);
+
+  // Init buffers
+  {
+    {
+      auto mem = buff_host->mapMemory();
+      std::iota(mem.begin(), mem.end(), 0);
+    }
+    auto options = buff_device1->makeOptions();
+    options.setExternalSyncMode(true);
+    auto result = zivc::copy(*buff_host, buff_device1.get(), options);
+    device->waitForCompletion(result.fence());
+  }
+
+  const auto test_kernel = [&](const auto& kernel_params, const char* label)
+  {
+    {
+      auto options = buff_device2->makeOptions();
+      options.setExternalSyncMode(true);
+      auto result = buff_device2->fill(-1, options);
+      device->waitForCompletion(result.fence());
+    }
+    auto kernel = device->makeKernel(kernel_params);
+    // The kernel is launched twice since the tuning runs on the first launch
+    for (std::size_t i = 0; i < 2; ++i) {
+      auto launch_options = kernel->makeOptions();
+      launch_options.setWorkSize({zisc::cast<uint32b>(n)});
+      launch_options.setExternalSyncMode(false);
+      launch_options.setLabel(label);
+      auto result = kernel->run(*buff_device1, *buff_device2, launch_options);
+      device->waitForCompletion();
+    }
+
+    auto options = buff_device2->makeOptions();
+    options.setExternalSyncMode(true);
+    auto result = zivc::copy(*buff_device2, buff_host.get(), options);
+    device->waitForCompletion(result.fence());
+
+    const auto mem = buff_host->mapMemory();
+    for (std::size_t i = 0; i < mem.size(); ++i) {
+      const int32b expected = zisc::cast<int32b>(i);
+      ASSERT_EQ(expected, mem[i])
+          << label << ": Copying inputs[" << i << "] to outputs[" << i << "] failed.";
+    }
+  };
+
+  // Explicit work-group size
+  {
+    auto kernel_params = ZIVC_MAKE_KERNEL_INIT_PARAMS(kernel_test, inputOutput1Kernel, 1);
+    kernel_params.setWorkGroupSize({64});
+    test_kernel(kernel_params, "ExplicitWorkGroupSize");
+  }
+  // Tuned work-group size
+  {
+    auto kernel_params = ZIVC_MAKE_KERNEL_INIT_PARAMS(kernel_test, inputOutput1Kernel, 1);
+    kernel_params.enableWorkGroupSizeTuning(true);
+    test_kernel(kernel_params, "TunedWorkGroupSize");
+  }
+}
+
+TEST(KernelTest, SpecializationTest)
+{
+  auto platform = ztest::makePlatform();
+  const ztest::Config& config = ztest::Config::globalConfig();
+  zivc::SharedDevice device = platform->queryDevice(config.deviceId());
+
+  const std::size_t n = config.testKernelWorkSize1d();
+
+  using zivc::uint32b;
+
+  // Allocate buffers
+  auto buff_input = device->makeBuffer<uint32b>(zivc::BufferUsage::kDeviceOnly);
+  buff_input->setSize(n);
+  auto buff_output = device->makeBuffer<uint32b>(zivc::BufferUsage::kDeviceOnly);
+  buff_output->setSize(2 * n);
+  auto buff_host = device->makeBuffer<uint32b>(zivc::BufferUsage::kHostOnly);
+  buff_host->setSize(2 * n);
+
+  // Init buffers
+  {
+    {
+      auto mem = buff_host->mapMemory();
+      std::iota(mem.begin(), mem.begin() + n, 0u);
+    }
+    auto options = buff_input->makeOptions();
+    options.setSize(n);
+    options.setExternalSyncMode(true);
+    auto result = zivc::copy(*buff_host, buff_input.get(), options);
+    device->waitForCompletion(result.fence());
+  }
+
+  // Make a kernel
+  auto kernel_params = ZIVC_MAKE_KERNEL_INIT_PARAMS(kernel_test, specializationKernel, 1);
+  auto kernel = device->makeKernel(kernel_params);
+  ASSERT_EQ(1, kernel->dimensionSize()) << "Wrong kernel property.";
+  ASSERT_EQ(4, kernel->argSize()) << "Wrong kernel property.";
+
+  // The count 4 is specialized and 3 runs the generic variant
+  for (const uint32b count : {4u, 3u}) {
+    {
+      auto launch_options = kernel->makeOptions();
+      launch_options.setWorkSize({zisc::cast<uint32b>(n)});
+      launch_options.setExternalSyncMode(false);
+      launch_options.setLabel("SpecializationKernel");
+      auto result = kernel->run(*buff_input, *buff_output, count, zisc::cast<uint32b>(n), launch_options);
+      device->waitForCompletion();
+    }
+
+    auto options = buff_output->makeOptions();
+    options.setExternalSyncMode(true);
+    auto result = zivc::copy(*buff_output, buff_host.get(), options);
+    device->waitForCompletion(result.fence());
+
+    const auto mem = buff_host->mapMemory();
+    const uint32b specialized = (count == 4u) ? 1u : 0u;
+    for (std::size_t i = 0; i < n; ++i) {
+      const auto value = zisc::cast<uint32b>(i);
+      const uint32b expected = count * value + (count * (count - 1)) / 2;
+      ASSERT_EQ(expected, mem[2 * i])
+          << "Specialized kernel[" << i << "] failed. count = " << count;
+      ASSERT_EQ(specialized, mem[2 * i + 1])
+          << "Specialization of the count " << count << " failed.";
+    }
+  }
+}
+
+TEST(KernelTest, ManyKernelInstancesTest)
+{
+  auto platform = ztest::makePlatform();
+  const ztest::Config& config = ztest::Config::globalConfig();
+  zivc::SharedDevice device = platform->queryDevice(config.deviceId());
+
+  constexpr std::size_t n = 256;
+  // More kernels than the first descriptor pool holds
+  constexpr std::size_t num_of_kernels = 300;
+
+  using zivc::int32b;
+  using zivc::uint32b;
+
+  // Allocate buffers
+  auto buff_device1 = device->makeBuffer<int32b>(zivc::BufferUsage::kDeviceOnly);
+  buff_device1->setSize(n);
+  auto buff_device2 = device->makeBuffer<int32b>(zivc::BufferUsage::kDeviceOnly);
+  buff_device2->setSize(n);
+  auto buff_device3 = device->makeBuffer<int32b>(zivc::BufferUsage::kDeviceOnly);
+  buff_device3->setSize(n);
+  auto buff_host = device->makeBuffer<int32b>(zivc::BufferUsage::kHostOnly);
+  buff_host->setSize(n);
+
+  // Init buffers
+  {
+    {
+      auto mem = buff_host->mapMemory();
+      std::iota(mem.begin(), mem.end(), 0);
+    }
+    auto options = buff_device1->makeOptions();
+    options.setExternalSyncMode(true);
+    auto result = zivc::copy(*buff_host, buff_device1.get(), options);
+    device->waitForCompletion(result.fence());
+  }
+
+  // Make kernels
+  auto kernel_params = ZIVC_MAKE_KERNEL_INIT_PARAMS(kernel_test, inputOutput1Kernel, 1);
+  using KernelT = decltype(device->makeKernel(kernel_params));
+  std::vector<KernelT> kernel_list;
+  kernel_list.reserve(num_of_kernels);
+  for (std::size_t i = 0; i < num_of_kernels; ++i)
+    kernel_list.emplace_back(device->makeKernel(kernel_params));
+
+  // Each kernel copies 1 -> 2, 2 -> 3 and 1 -> 2 again, so the bindings change between launches
+  for (auto& kernel : kernel_list) {
+    auto launch_options = kernel->makeOptions();
+    launch_options.setWorkSize({zisc::cast<uint32b>(n)});
+    launch_options.setExternalSyncMode(false);
+    launch_options.setLabel("ManyKernelInstances");
+    {
+      auto result = kernel->run(*buff_device1, *buff_device2, launch_options);
+      device->waitForCompletion();
+    }
+    {
+      auto result = kernel->run(*buff_device2, *buff_device3, launch_options);
+      device->waitForCompletion();
+    }
+    {
+      auto result = kernel->run(*buff_device1, *buff_device2, launch_options);
+      device->waitForCompletion();
+    }
+  }
+
+  // Check the outputs
+  {
+    auto options = buff_device3->makeOptions();
+    options.setExternalSyncMode(true);
+    auto result = zivc::copy(*buff_device3, buff_host.get(), options);
+    device->waitForCompletion(result.fence());
+
+    const auto mem = buff_host->mapMemory();
+    for (std::size_t i = 0; i < mem.size(); ++i) {
+      const int32b expected = zisc::cast<int32b>(i);
+      ASSERT_EQ(expected, mem[i]) << "Copying inputs[" << i << "] failed.";
+    }
+  }
+}
@@ -15,13 +15,18 @@
 // Standard C++ library
 #include <array>
 #include <algorithm>
+#include <chrono>
+#include <cmath>
 #include <cstddef>
+#include <iostream>
 #include <limits>
 #include <memory>
 #include <numbers>
 #include <numeric>
+#include <thread>
 #include <type_traits>
 #include <utility>
+#include <vector>
 // Zisc
 #include "zisc/concepts.hpp"
 #include "zisc/utility.hpp"
@@ -872,6 +877,222 @@ TEST(KernelTest, KernelQueueTest)
   }
 }
 
+TEST(KernelTest, KernelQueueSelectionTest)
+{
+  auto platform = ztest::makePlatform();
+  const ztest::Config& config = ztest::Config::globalConfig();
+  zivc::SharedDevice device = platform->queryDevice(config.deviceId());
+
+  using zivc::uint32b;
+
+  constexpr uint32b n = 256 * 256;
+  constexpr std::size_t num_of_launches = 16;
+  const std::size_t num_of_queues = device->numOfQueues();
+
+  for (const zivc::QueueSelection selection : {zivc::QueueSelection::kRoundRobin,
+                                               zivc::QueueSelection::kLeastLoaded}) {
+    // Independent launches which can be spread across the queues
+    std::vector<zivc::SharedBuffer<uint32b>> buffer_list;
+    std::vector<uint32b> queue_list;
+    for (std::size_t i = 0; i < num_of_launches; ++i) {
+      auto buffer = device->makeBuffer<uint32b>(zivc::BufferUsage::kDeviceOnly);
+      buffer->setSize(n);
+      auto options = buffer->makeOptions();
+      options.setExternalSyncMode(true);
+      auto result = buffer->fill(0, options);
+      device->waitForCompletion(result.fence());
+      buffer_list.emplace_back(std::move(buffer));
+    }
+
+    auto kernel_params = ZIVC_MAKE_KERNEL_INIT_PARAMS(kernel_test2, invocation1Kernel, 1);
+    std::vector<decltype(device->makeKernel(kernel_params))> kernel_list;
+    for (std::size_t i = 0; i < num_of_launches; ++i) {
+      auto kernel = device->makeKernel(kernel_params);
+      auto launch_options = kernel->makeOptions();
+      launch_options.setWorkSize({n});
+      launch_options.setQueueSelection(selection);
+      launch_options.setExternalSyncMode(false);
+      launch_options.setLabel("invocation1Kernel");
+      auto result = kernel->run(*buffer_list[i], n, launch_options);
+      ASSERT_GT(num_of_queues, result.queueIndex()) << "Invalid queue is selected.";
+      queue_list.emplace_back(result.queueIndex());
+      kernel_list.emplace_back(std::move(kernel));
+    }
+    device->waitForCompletion();
+
+    // Round robin uses all queues in the first launches
+    if (selection == zivc::QueueSelection::kRoundRobin) {
+      const std::size_t m = (std::min)(num_of_queues, num_of_launches);
+      std::vector<uint32b> used_list{queue_list.begin(), queue_list.begin() + m};
+      std::sort(used_list.begin(), used_list.end());
+      const auto last = std::unique(used_list.begin(), used_list.end());
+      ASSERT_EQ(used_list.end(), last) << "Round robin selection doesn't spread the launches.";
+    }
+
+    // Check the outputs
+    constexpr uint32b expected = 10 * 1024;
+    for (std::size_t i = 0; i < num_of_launches; ++i) {
+      const std::vector<uint32b> values = ztest::readBuffer(*device, *buffer_list[i]);
+      for (std::size_t j = 0; j < values.size(); ++j)
+        ASSERT_EQ(expected, values[j]) << "Launch[" << i << "] failed.";
+    }
+
+    // Launches of one kernel object which change the buffer and the POD argument
+    for (zivc::SharedBuffer<uint32b>& buffer : buffer_list) {
+      auto options = buffer->makeOptions();
+      options.setExternalSyncMode(true);
+      auto result = buffer->fill(0, options);
+      device->waitForCompletion(result.fence());
+    }
+    auto kernel = device->makeKernel(kernel_params);
+    for (std::size_t i = 0; i < num_of_launches; ++i) {
+      const uint32b resolution = n - zisc::cast<uint32b>(i);
+      auto launch_options = kernel->makeOptions();
+      launch_options.setWorkSize({n});
+      launch_options.setQueueSelection(selection);
+      launch_options.setExternalSyncMode(false);
+      launch_options.setLabel("invocation1Kernel");
+      auto result = kernel->run(*buffer_list[i], resolution, launch_options);
+      ASSERT_GT(num_of_queues, result.queueIndex()) << "Invalid queue is selected.";
+    }
+    device->waitForCompletion();
+    for (std::size_t i = 0; i < num_of_launches; ++i) {
+      const uint32b resolution = n - zisc::cast<uint32b>(i);
+      const std::vector<uint32b> values = ztest::readBuffer(*device, *buffer_list[i]);
+      for (std::size_t j = 0; j < values.size(); ++j) {
+        const uint32b e = (j < resolution) ? expected : 0;
+        ASSERT_EQ(e, values[j]) << "Launch[" << i << "] of the reused kernel failed.";
+      }
+    }
+  }
+}
+
+TEST(KernelTest, KernelQueuePriorityTest)
+{
+  ztest::Config& config = ztest::Config::globalConfig();
+  // A platform which declares a high and a low priority queue
+  zivc::PlatformOptions platform_options{config.memoryResource()};
+  platform_options.setPlatformName("QueuePriorityTest");
+  platform_options.enableVulkanSubPlatform(0 < config.deviceId());
+  platform_options.enableDebugMode(config.isDebugMode());
+  platform_options.setNumOfHighPriorityQueues(1);
+  platform_options.setNumOfLowPriorityQueues(1);
+  zivc::SharedPlatform platform = zivc::makePlatform(platform_options);
+  zivc::SharedDevice device = platform->queryDevice(config.deviceId());
+
+  using zivc::uint32b;
+
+  constexpr uint32b n = 256 * 256;
+  const std::size_t num_of_queues = device->numOfQueues();
+  constexpr std::array<zivc::QueuePriority, 3> priority_list{{
+      zivc::QueuePriority::kLow,
+      zivc::QueuePriority::kNormal,
+      zivc::QueuePriority::kHigh}};
+
+  std::vector<zivc::SharedBuffer<uint32b>> buffer_list;
+  for (std::size_t i = 0; i < priority_list.size(); ++i) {
+    auto buffer = device->makeBuffer<uint32b>(zivc::BufferUsage::kDeviceOnly);
+    buffer->setSize(n);
+    auto options = buffer->makeOptions();
+    options.setExternalSyncMode(true);
+    auto result = buffer->fill(0, options);
+    device->waitForCompletion(result.fence());
+    buffer_list.emplace_back(std::move(buffer));
+  }
+
+  auto kernel_params = ZIVC_MAKE_KERNEL_INIT_PARAMS(kernel_test2, invocation1Kernel, 1);
+  std::vector<decltype(device->makeKernel(kernel_params))> kernel_list;
+  std::vector<uint32b> queue_list;
+  for (std::size_t i = 0; i < priority_list.size(); ++i) {
+    auto kernel = device->makeKernel(kernel_params);
+    auto launch_options = kernel->makeOptions();
+    launch_options.setWorkSize({n});
+    launch_options.setQueuePriority(priority_list[i]);
+    launch_options.setExternalSyncMode(false);
+    launch_options.setLabel("invocation1Kernel");
+    auto result = kernel->run(*buffer_list[i], n, launch_options);
+    ASSERT_GT(num_of_queues, result.queueIndex()) << "Invalid queue is selected.";
+    queue_list.emplace_back(result.queueIndex());
+    kernel_list.emplace_back(std::move(kernel));
+  }
+  device->waitForCompletion();
+
+  // The high priority queue is the head and the low priority queue is the tail
+  ASSERT_EQ(num_of_queues - 1, queue_list[0]) << "Low priority queue isn't selected.";
+  ASSERT_EQ(0, queue_list[2]) << "High priority queue isn't selected.";
+  if (3 <= num_of_queues) {
+    ASSERT_LT(0, queue_list[1]) << "Normal priority uses the high priority queue.";
+    ASSERT_GT(num_of_queues - 1, queue_list[1]) << "Normal priority uses the low priority queue.";
+  }
+
+  // Check the outputs
+  constexpr uint32b expected = 10 * 1024;
+  for (std::size_t i = 0; i < priority_list.size(); ++i) {
+    const std::vector<uint32b> values = ztest::readBuffer(*device, *buffer_list[i]);
+    for (std::size_t j = 0; j < values.size(); ++j)
+      ASSERT_EQ(expected, values[j]) << "Launch[" << i << "] failed.";
+  }
+}
+
+TEST(KernelTest, KernelConcurrentLaunchTest)
+{
+  auto platform = ztest::makePlatform();
+  const ztest::Config& config = ztest::Config::globalConfig();
+  zivc::SharedDevice device = platform->queryDevice(config.deviceId());
+
+  using zivc::uint32b;
+
+  constexpr uint32b n = 256 * 256;
+  constexpr std::size_t num_of_threads = 4;
+  constexpr std::size_t num_of_launches = 8;
+
+  std::vector<zivc::SharedBuffer<uint32b>> buffer_list;
+  for (std::size_t i = 0; i < num_of_threads; ++i) {
+    auto buffer = device->makeBuffer<uint32b>(zivc::BufferUsage::kDeviceOnly);
+    buffer->setSize(n);
+    auto options = buffer->makeOptions();
+    options.setExternalSyncMode(true);
+    auto result = buffer->fill(0, options);
+    device->waitForCompletion(result.fence());
+    buffer_list.emplace_back(std::move(buffer));
+  }
+
+  auto kernel_params = ZIVC_MAKE_KERNEL_INIT_PARAMS(kernel_test2, invocation1Kernel, 1);
+  std::vector<decltype(device->makeKernel(kernel_params))> kernel_list;
+  for (std::size_t i = 0; i < num_of_threads; ++i)
+    kernel_list.emplace_back(device->makeKernel(kernel_params));
+
+  // Launch the kernels on the same queue from multiple threads
+  device->setFenceSize(num_of_threads);
+  std::vector<std::thread> thread_list;
+  for (std::size_t i = 0; i < num_of_threads; ++i) {
+    auto launch = [&kernel_list, &buffer_list, &device, i]()
+    {
+      auto& kernel = kernel_list[i];
+      auto launch_options = kernel->makeOptions();
+      launch_options.setWorkSize({n});
+      launch_options.setExternalSyncMode(true);
+      launch_options.setLabel("invocation1Kernel");
+      for (std::size_t j = 0; j < num_of_launches; ++j) {
+        auto result = kernel->run(*buffer_list[i], n, launch_options);
+        device->waitForCompletion(result.fence());
+      }
+    };
+    thread_list.emplace_back(launch);
+  }
+  for (std::thread& t : thread_list)
+    t.join();
+  device->waitForCompletion();
+
+  // Check the outputs
+  constexpr uint32b expected = num_of_launches * 10 * 1024;
+  for (std::size_t i = 0; i < num_of_threads; ++i) {
+    const std::vector<uint32b> values = ztest::readBuffer(*device, *buffer_list[i]);
+    for (std::size_t j = 0; j < values.size(); ++j)
+      ASSERT_EQ(expected, values[j]) << "Thread[" << i << "] failed.";
+  }
+}
+
 TEST(KernelTest, KernelFenceTest)
 {
   auto platform = ztest::makePlatform();
@@ -1020,3 +1241,227 @@ TEST(KernelTest, KernelFenceTest)
   }
 }
 
+TEST(KernelTest, IndirectDispatchTest)
+{
+  using zivc::uint32b;
+
+  auto platform = ztest::makePlatform();
+  const ztest::Config& config = ztest::Config::globalConfig();
+  zivc::SharedDevice device = platform->queryDevice(config.deviceId());
+
+  constexpr uint32b n = 4096;
+  constexpr uint32b m = 1000;
+  auto buff_device = device->makeBuffer<uint32b>(zivc::BufferUsage::kDeviceOnly);
+  buff_device->setSize(n);
+  {
+    auto options = buff_device->makeOptions();
+    options.setExternalSyncMode(true);
+    auto result = buff_device->fill(0, options);
+    device->waitForCompletion(result.fence());
+  }
+  auto buff_dims = device->makeBuffer<uint32b>(zivc::BufferUsage::kDeviceOnly);
+  buff_dims->setSize(1);
+
+  auto size_kernel_params = ZIVC_MAKE_KERNEL_INIT_PARAMS(kernel_test2, indirectSizeKernel, 1);
+  auto size_kernel = device->makeKernel(size_kernel_params);
+  ASSERT_EQ(1, size_kernel->dimensionSize()) << "Wrong kernel property.";
+  ASSERT_EQ(2, size_kernel->argSize()) << "Wrong kernel property.";
+
+  auto kernel_params = ZIVC_MAKE_KERNEL_INIT_PARAMS(kernel_test2, indirectKernel, 1);
+  auto kernel = device->makeKernel(kernel_params);
+  ASSERT_EQ(1, kernel->dimensionSize()) << "Wrong kernel property.";
+  ASSERT_EQ(2, kernel->argSize()) << "Wrong kernel property.";
+
+  // The work size is computed on the device, and the second one exceeds the bound
+  for (const uint32b size : {m, 2 * n}) {
+    {
+      auto launch_options = size_kernel->makeOptions();
+      launch_options.setWorkSize({1});
+      launch_options.setExternalSyncMode(false);
+      launch_options.setLabel("indirectSizeKernel");
+      auto result = size_kernel->run(*buff_dims, size, launch_options);
+    }
+    {
+      auto launch_options = kernel->makeOptions();
+      launch_options.setWorkSize({n});
+      launch_options.setExternalSyncMode(false);
+      launch_options.setLabel("indirectKernel");
+      auto result = kernel->runIndirect(*buff_dims, *buff_dims, *buff_device, launch_options);
+    }
+  }
+  device->waitForCompletion();
+
+  // Check the outputs
+  {
+    const std::vector<uint32b> values = ztest::readBuffer(*device, *buff_device);
+    for (std::size_t i = 0; i < values.size(); ++i) {
+      const uint32b expected = (i < m) ? 2 : 1;
+      ASSERT_EQ(expected, values[i]) << "Indirect dispatch failed at " << i << ".";
+    }
+  }
+}
+
+TEST(KernelTest, CollectiveFunctionTest)
+{
+  using zivc::uint32b;
+
+  auto platform = ztest::makePlatform();
+  const ztest::Config& config = ztest::Config::globalConfig();
+  zivc::SharedDevice device = platform->queryDevice(config.deviceId());
+
+  constexpr uint32b n = 4096;
+  auto buff_device = device->makeBuffer<uint32b>(zivc::BufferUsage::kDeviceOnly);
+  buff_device->setSize(n);
+
+  auto kernel_params = ZIVC_MAKE_KERNEL_INIT_PARAMS(kernel_test2, collectiveKernel, 1);
+  auto kernel = device->makeKernel(kernel_params);
+  ASSERT_EQ(1, kernel->dimensionSize()) << "Wrong kernel property.";
+  ASSERT_EQ(2, kernel->argSize()) << "Wrong kernel property.";
+  {
+    auto launch_options = kernel->makeOptions();
+    launch_options.setWorkSize({n});
+    launch_options.setExternalSyncMode(true);
+    launch_options.setLabel("collectiveKernel");
+    auto result = kernel->run(*buff_device, n, launch_options);
+    device->waitForCompletion(result.fence());
+  }
+
+  // Check the outputs
+  {
+    auto buff_host = device->makeBuffer<uint32b>(zivc::BufferUsage::kHostOnly);
+    buff_host->setSize(buff_device->size());
+    {
+      auto options = buff_device->makeOptions();
+      options.setExternalSyncMode(true);
+      auto result = zivc::copy(*buff_device, buff_host.get(), options);
+      device->waitForCompletion(result.fence());
+    }
+    {
+      auto mem = buff_host->mapMemory();
+      for (std::size_t i = 0; i < mem.size(); ++i)
+        ASSERT_EQ(0, mem[i]) << "Collective functions failed at " << i << ".";
+    }
+  }
+}
+
+TEST(KernelTest, MatrixFunctionTest)
+{
+  using zivc::cl::float4;
+
+  auto platform = ztest::makePlatform();
+  const ztest::Config& config = ztest::Config::globalConfig();
+  zivc::SharedDevice device = platform->queryDevice(config.deviceId());
+
+  const std::vector<float4> matrix{float4{2.0f, 1.0f, 0.0f, 1.0f},
+                                   float4{0.0f, 3.0f, 0.5f, -2.0f},
+                                   float4{1.0f, 0.0f, 4.0f, 0.5f},
+                                   float4{0.0f, 0.0f, 0.0f, 1.0f}};
+  auto buff_matrix = ztest::makeDeviceBuffer(*device, matrix);
+  auto buff_device = device->makeBuffer<float4>(zivc::BufferUsage::kDeviceOnly);
+  buff_device->setSize(14);
+
+  auto kernel_params = ZIVC_MAKE_KERNEL_INIT_PARAMS(kernel_test2, matrixKernel, 1);
+  auto kernel = device->makeKernel(kernel_params);
+  ASSERT_EQ(1, kernel->dimensionSize()) << "Wrong kernel property.";
+  ASSERT_EQ(2, kernel->argSize()) << "Wrong kernel property.";
+  {
+    auto launch_options = kernel->makeOptions();
+    launch_options.setWorkSize({1});
+    launch_options.setExternalSyncMode(true);
+    launch_options.setLabel("matrixKernel");
+    auto result = kernel->run(*buff_matrix, *buff_device, launch_options);
+    device->waitForCompletion(result.fence());
+  }
+
+  // Check the outputs
+  constexpr float e = 1.0e-5f;
+  const auto results = ztest::readBuffer(*device, *buff_device);
+  for (std::size_t i = 0; i < 4; ++i) {
+    for (std::size_t j = 0; j < 4; ++j) {
+      // m * m^-1 = I
+      float sum = 0.0f;
+      for (std::size_t k = 0; k < 4; ++k)
+        sum += matrix[i][k] * results[k][j];
+      const float id = (i == j) ? 1.0f : 0.0f;
+      EXPECT_NEAR(id, sum, e) << "Matrix inverse failed at (" << i << "," << j << ").";
+      EXPECT_NEAR(id, results[4 + i][j], e)
+          << "Matrix multiplication failed at (" << i << "," << j << ").";
+      EXPECT_EQ(matrix[j][i], results[8 + i][j])
+          << "Matrix transposition failed at (" << i << "," << j << ").";
+    }
+  }
+  EXPECT_NEAR(24.5f, results[12][0], e) << "Matrix4x4 determinant failed.";
+  EXPECT_NEAR(6.0f, results[12][1], e) << "Matrix2x2 determinant failed.";
+  EXPECT_NEAR(1.0f, results[13][0], e) << "Matrix2x2 inverse failed.";
+  EXPECT_NEAR(0.0f, results[13][1], e) << "Matrix2x2 inverse failed.";
+  EXPECT_NEAR(0.0f, results[13][2], e) << "Matrix2x2 inverse failed.";
+  EXPECT_NEAR(1.0f, results[13][3], e) << "Matrix2x2 inverse failed.";
+}
+
+TEST(KernelTest, MatrixTransformPointsTest)
+{
+  using zivc::uint32b;
+  using zivc::cl::float3;
+  using zivc::cl::float4;
+  using Clock = std::chrono::high_resolution_clock;
+
+  auto platform = ztest::makePlatform();
+  const ztest::Config& config = ztest::Config::globalConfig();
+  zivc::SharedDevice device = platform->queryDevice(config.deviceId());
+
+  // A perspective projection, so the points are divided by w
+  const std::vector<float4> matrix{float4{1.5f, 0.0f, 0.0f, 0.0f},
+                                   float4{0.0f, 2.0f, 0.0f, 0.0f},
+                                   float4{0.0f, 0.0f, -1.0f, -0.2f},
+                                   float4{0.0f, 0.0f, -1.0f, 0.0f}};
+  constexpr uint32b n = 4u * 1024u * 1024u;
+  std::vector<float3> points;
+  points.reserve(n);
+  for (uint32b i = 0; i < n; ++i) {
+    const float x = zisc::cast<float>(i % 1024) / 1024.0f - 0.5f;
+    const float y = zisc::cast<float>(i / 1024 % 1024) / 1024.0f - 0.5f;
+    const float z = -1.0f - zisc::cast<float>(i / (1024 * 1024));
+    points.emplace_back(x, y, z);
+  }
+  auto buff_matrix = ztest::makeDeviceBuffer(*device, matrix);
+  auto buff_points = ztest::makeDeviceBuffer(*device, points);
+  auto buff_device = device->makeBuffer<float3>(zivc::BufferUsage::kDeviceOnly);
+  buff_device->setSize(n);
+
+  auto kernel_params = ZIVC_MAKE_KERNEL_INIT_PARAMS(kernel_test2, transformPointsKernel, 1);
+  auto kernel = device->makeKernel(kernel_params);
+  ASSERT_EQ(1, kernel->dimensionSize()) << "Wrong kernel property.";
+  ASSERT_EQ(4, kernel->argSize()) << "Wrong kernel property.";
+  auto launch_options = kernel->makeOptions();
+  launch_options.setWorkSize({n});
+  launch_options.setExternalSyncMode(true);
+  launch_options.setLabel("transformPointsKernel");
+  auto run = [&]()
+  {
+    auto result = kernel->run(*buff_matrix, *buff_points, *buff_device, n, launch_options);
+    device->waitForCompletion(result.fence());
+  };
+
+  // Measure the throughput
+  constexpr std::size_t num_of_runs = 4;
+  run(); // Warm up
+  const auto start = Clock::now();
+  for (std::size_t i = 0; i < num_of_runs; ++i)
+    run();
+  const std::chrono::duration<double> elapsed = Clock::now() - start;
+  const double throughput = zisc::cast<double>(num_of_runs * n) / (elapsed.count() * 1.0e6);
+  std::cout << "## Transform throughput: " << throughput << " Mpoints/s" << std::endl;
+
+  // Check the outputs
+  const auto results = ztest::readBuffer(*device, *buff_device);
+  for (uint32b i = 0; i < n; ++i) {
+    const float3& p = points[i];
+    const float w = matrix[3][0] * p.x + matrix[3][1] * p.y + matrix[3][2] * p.z + matrix[3][3];
+    for (std::size_t j = 0; j < 3; ++j) {
+      const float v = matrix[j][0] * p.x + matrix[j][1] * p.y + matrix[j][2] * p.z + matrix[j][3];
+      const float expected = v / w;
+      ASSERT_NEAR(expected, results[i][j], 1.0e-5f * (std::max)(1.0f, std::abs(expected)))
+          << "Transforming points failed at " << i << ".";
+    }
+  }
+}
@@ -0,0 +1,180 @@
+/*!
+  \file kernel_test_address.cpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2021 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+// Standard C++ library
+#include <cstddef>
+#include <memory>
+#include <numeric>
+#include <vector>
+// Zisc
+#include "zisc/utility.hpp"
+// Zivc
+#include "zivc/zivc.hpp"
+#include "zivc/zivc_config.hpp"
+// Test
+#include "config.hpp"
+#include "googletest.hpp"
+#include "test.hpp"
+#include "zivc/kernel_set/kernel_set-kernel_test_address.hpp"
+
+TEST(KernelTest, BufferDeviceAddressTest)
+{
+  auto platform = ztest::makePlatform();
+  const ztest::Config& config = ztest::Config::globalConfig();
+  zivc::SharedDevice device = platform->queryDevice(config.deviceId());
+  const auto& info = device->deviceInfo();
+  if (!info.isBufferDeviceAddressSupported())
+    GTEST_SKIP() << "The device doesn't support buffer device address.";
+
+  const std::size_t n = config.testKernelWorkSize1d();
+
+  using zivc::int32b;
+  using zivc::uint32b;
+
+  // Allocate buffers
+  auto buff_device1 = device->makeBuffer<int32b>(zivc::BufferUsage::kDeviceOnly);
+  buff_device1->setSize(n);
+  auto buff_device2 = device->makeBuffer<int32b>(zivc::BufferUsage::kDeviceOnly);
+  buff_device2->setSize(n);
+  auto buff_host = device->makeBuffer<int32b>(zivc::BufferUsage::kHostOnly);
+  buff_host->setSize(n);
+  ASSERT_NE(0, buff_device1->deviceAddress()) << "Device address isn't available.";
+
+  // Init buffers
+  {
+    {
+      auto mem = buff_host->mapMemory();
+      std::iota(mem.begin(), mem.end(), 0);
+    }
+    auto options = buff_device1->makeOptions();
+    options.setExternalSyncMode(true);
+    auto result = zivc::copy(*buff_host, buff_device1.get(), options);
+    device->waitForCompletion(result.fence());
+  }
+
+  // Make a kernel
+  auto kernel_params = ZIVC_MAKE_KERNEL_INIT_PARAMS(kernel_test_address, addressKernel, 1);
+  auto kernel = device->makeKernel(kernel_params);
+  ASSERT_EQ(1, kernel->dimensionSize()) << "Wrong kernel property.";
+  ASSERT_EQ(3, kernel->argSize()) << "Wrong kernel property.";
+
+  // Launch the kernel
+  {
+    const uint32b res = zisc::cast<uint32b>(n);
+    auto launch_options = kernel->makeOptions();
+    launch_options.setWorkSize({res});
+    launch_options.setExternalSyncMode(false);
+    launch_options.setLabel("AddressKernel");
+    auto result = kernel->run(*buff_device1, *buff_device2, res, launch_options);
+    device->waitForCompletion();
+  }
+
+  // Check the outputs
+  {
+    auto options = buff_device2->makeOptions();
+    options.setExternalSyncMode(true);
+    auto result = zivc::copy(*buff_device2, buff_host.get(), options);
+    device->waitForCompletion(result.fence());
+
+    const auto mem = buff_host->mapMemory();
+    for (std::size_t i = 0; i < mem.size(); ++i) {
+      const int32b expected = 2 * zisc::cast<int32b>(i);
+      ASSERT_EQ(expected, mem[i]) << "Reading inputs[" << i << "] by address failed.";
+    }
+  }
+}
+
+TEST(KernelTest, BufferDeviceAddressTableTest)
+{
+  auto platform = ztest::makePlatform();
+  const ztest::Config& config = ztest::Config::globalConfig();
+  zivc::SharedDevice device = platform->queryDevice(config.deviceId());
+  const auto& info = device->deviceInfo();
+  if (!info.isBufferDeviceAddressSupported())
+    GTEST_SKIP() << "The device doesn't support buffer device address.";
+
+  const std::size_t n = config.testKernelWorkSize1d();
+  // More buffers than the descriptor limit of typical devices
+  constexpr std::size_t num_of_buffers = 200;
+
+  using zivc::int32b;
+  using zivc::uint32b;
+  using zivc::uint64b;
+
+  // Allocate buffers
+  std::vector<zivc::SharedBuffer<int32b>> input_list;
+  input_list.reserve(num_of_buffers);
+  for (std::size_t i = 0; i < num_of_buffers; ++i) {
+    auto buffer = device->makeBuffer<int32b>(zivc::BufferUsage::kDeviceOnly);
+    buffer->setSize(n);
+    auto options = buffer->makeOptions();
+    options.setExternalSyncMode(true);
+    auto result = zivc::fill(zisc::cast<int32b>(i), buffer.get(), options);
+    device->waitForCompletion(result.fence());
+    input_list.emplace_back(std::move(buffer));
+  }
+  auto buff_table = device->makeBuffer<uint64b>(zivc::BufferUsage::kDeviceOnly);
+  buff_table->setSize(num_of_buffers);
+  {
+    auto buff_host = device->makeBuffer<uint64b>(zivc::BufferUsage::kHostOnly);
+    buff_host->setSize(num_of_buffers);
+    {
+      auto mem = buff_host->mapMemory();
+      for (std::size_t i = 0; i < num_of_buffers; ++i)
+        mem[i] = input_list[i]->deviceAddress();
+    }
+    auto options = buff_table->makeOptions();
+    options.setExternalSyncMode(true);
+    auto result = zivc::copy(*buff_host, buff_table.get(), options);
+    device->waitForCompletion(result.fence());
+  }
+  auto buff_device = device->makeBuffer<int32b>(zivc::BufferUsage::kDeviceOnly);
+  buff_device->setSize(n);
+  auto buff_host = device->makeBuffer<int32b>(zivc::BufferUsage::kHostOnly);
+  buff_host->setSize(n);
+
+  // Make a kernel
+  auto kernel_params = ZIVC_MAKE_KERNEL_INIT_PARAMS(kernel_test_address, addressTableKernel, 1);
+  auto kernel = device->makeKernel(kernel_params);
+  ASSERT_EQ(1, kernel->dimensionSize()) << "Wrong kernel property.";
+  ASSERT_EQ(4, kernel->argSize()) << "Wrong kernel property.";
+
+  // Launch the kernel
+  {
+    const uint32b res = zisc::cast<uint32b>(n);
+    auto launch_options = kernel->makeOptions();
+    launch_options.setWorkSize({res});
+    launch_options.setExternalSyncMode(false);
+    launch_options.setLabel("AddressTableKernel");
+    auto result = kernel->run(*buff_table,
+                              *buff_device,
+                              zisc::cast<uint32b>(num_of_buffers),
+                              res,
+                              launch_options);
+    device->waitForCompletion();
+  }
+
+  // Check the outputs
+  {
+    auto options = buff_device->makeOptions();
+    options.setExternalSyncMode(true);
+    auto result = zivc::copy(*buff_device, buff_host.get(), options);
+    device->waitForCompletion(result.fence());
+
+    const int32b expected = zisc::cast<int32b>((num_of_buffers * (num_of_buffers - 1)) / 2);
+    const auto mem = buff_host->mapMemory();
+    for (std::size_t i = 0; i < mem.size(); ++i)
+      ASSERT_EQ(expected, mem[i]) << "Reading the buffers by the table failed.";
+  }
+}
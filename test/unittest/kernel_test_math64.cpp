@@ -0,0 +1,40 @@
+/*!
+  \file kernel_test_math64.cpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2021 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+// Zivc
+#include "zivc/zivc.hpp"
+#include "zivc/zivc_config.hpp"
+// Test
+#include "config.hpp"
+#include "googletest.hpp"
+#include "math_test.hpp"
+#include "test.hpp"
+#include "zivc/kernel_set/kernel_set-kernel_test_math64.hpp"
+
+TEST(KernelTest, MathDoubleTest)
+{
+  auto platform = ztest::makePlatform();
+  const ztest::Config& config = ztest::Config::globalConfig();
+  zivc::SharedDevice device = platform->queryDevice(config.deviceId());
+  const auto& info = device->deviceInfo();
+  if (!info.isFloat64Supported())
+    GTEST_SKIP() << "The device doesn't support double precision.";
+
+  auto math_params = ZIVC_MAKE_KERNEL_INIT_PARAMS(kernel_test_math64, math64Kernel, 1);
+  auto math_kernel = device->makeKernel(math_params);
+  auto loop_params = ZIVC_MAKE_KERNEL_INIT_PARAMS(kernel_test_math64, mathLoop64Kernel, 1);
+  auto loop_kernel = device->makeKernel(loop_params);
+  // The kernel set uses the fast math profile
+  ztest::testMath<double>(*device, *math_kernel, *loop_kernel, 0);
+}
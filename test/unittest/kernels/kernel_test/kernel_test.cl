@@ -17,6 +17,7 @@
 
 // Zivc
 #include "zivc/cl/atomic.cl"
+#include "zivc/cl/specialization.cl"
 #include "zivc/cl/types.cl"
 #include "zivc/cl/utility.cl"
 
@@ -536,4 +537,48 @@ __kernel void workItemOffset3dKernel(zivc::GlobalPtr<uint32b> outputs,
   }
 }
 
+namespace inner {
+
+/*!
+  \brief Add the value 'count' times
+
+  No detailed description.
+  */
+struct RepeatAdd
+{
+  template <typename CountType>
+  uint32b operator()(const CountType count, const uint32b value) const noexcept
+  {
+    uint32b sum = 0;
+    for (uint32b i = 0; i < count; ++i)
+      sum += value + i;
+    return sum;
+  }
+};
+
+} // namespace inner
+
+/*!
+  \details The counts 1, 2, 4 and 8 are specialized and others run the generic variant
+
+  \param [in] inputs No description.
+  \param [out] outputs No description.
+  \param [in] count No description.
+  \param [in] resolution No description.
+  */
+__kernel void specializationKernel(zivc::ConstGlobalPtr<uint32b> inputs,
+                                   zivc::GlobalPtr<uint32b> outputs,
+                                   const uint32b count,
+                                   const uint32b resolution)
+{
+  const size_t index = zivc::getGlobalIdX();
+  if (resolution <= index)
+    return;
+
+  using Specializer = zivc::Specializer<uint32b, 1, 2, 4, 8>;
+  const inner::RepeatAdd func{};
+  outputs[2 * index] = Specializer::dispatch(count, func, inputs[index]);
+  outputs[2 * index + 1] = Specializer::isSpecialized(count) ? 1u : 0u;
+}
+
 #endif // ZIVC_TEST_KERNEL_TEST_CL
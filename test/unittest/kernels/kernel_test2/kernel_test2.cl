@@ -17,8 +17,11 @@
 
 // Zivc
 #include "zivc/cl/atomic.cl"
+#include "zivc/cl/matrix.cl"
+#include "zivc/cl/sub_group.cl"
 #include "zivc/cl/types.cl"
 #include "zivc/cl/utility.cl"
+#include "zivc/cl/work_group.cl"
 
 using zivc::int8b;
 using zivc::int16b;
@@ -263,4 +266,131 @@ __kernel void invocation3Kernel(zivc::GlobalPtr<uint32b> values,
   values[index] = v;
 }
 
+/*!
+  \details Each work-item checks the results of the collectives and
+  writes the bits of the failed checks
+
+  \param [out] results No description.
+  \param [in] resolution No description.
+  */
+__kernel void collectiveKernel(zivc::GlobalPtr<uint32b> results,
+                               const uint32b resolution)
+{
+  zivc::Local<uint32b> storage[256];
+
+  // The work-items out of the range take part in the collectives too
+  const size_t index = zivc::getGlobalLinearId();
+  const uint32b local_id = static_cast<uint32b>(zivc::getLocalLinearId());
+  const uint32b local_size = static_cast<uint32b>(zivc::getLocalSizeX());
+  const uint32b sub_id = zivc::SubGroup::localId();
+  const uint32b sub_size = zivc::SubGroup::size();
+  uint32b result = 0;
+  // Sub-group
+  if (zivc::SubGroup::reduceAdd(1u) != sub_size)
+    result |= 0b1u << 0;
+  if (zivc::SubGroup::reduceMax(sub_id) != (sub_size - 1))
+    result |= 0b1u << 1;
+  if (zivc::SubGroup::scanExclusiveAdd(1u) != sub_id)
+    result |= 0b1u << 2;
+  if (zivc::SubGroup::scanInclusiveAdd(1u) != (sub_id + 1))
+    result |= 0b1u << 3;
+  if (zivc::SubGroup::broadcast(sub_id + 10u, 0u) != 10u)
+    result |= 0b1u << 4;
+  const uint32b next = (sub_id + 1) % sub_size;
+  if (zivc::SubGroup::shuffle(sub_id, next) != next)
+    result |= 0b1u << 5;
+  if (zivc::SubGroup::ballotCount(true) != sub_size)
+    result |= 0b1u << 6;
+  // Work-group
+  if (zivc::WorkGroup::reduceAdd(1u, storage) != local_size)
+    result |= 0b1u << 7;
+  if (zivc::WorkGroup::reduceMin(local_id + 3u, storage) != 3u)
+    result |= 0b1u << 8;
+  if (zivc::WorkGroup::scanExclusiveAdd(1u, storage) != local_id)
+    result |= 0b1u << 9;
+  if (zivc::WorkGroup::scanInclusiveMax(local_id, storage) != local_id)
+    result |= 0b1u << 10;
+  if (zivc::WorkGroup::broadcast(local_id + 5u, 0, storage) != 5u)
+    result |= 0b1u << 11;
+  if (!zivc::WorkGroup::all(true, storage) || zivc::WorkGroup::any(false, storage))
+    result |= 0b1u << 12;
+
+  if (index < resolution)
+    results[index] = result;
+}
+
+/*!
+  \details The results are the inverse, the product of the matrix and
+  the inverse, the transposed matrix and the determinant
+
+  \param [in] matrix No description.
+  \param [out] results No description.
+  */
+__kernel void matrixKernel(zivc::ConstGlobalPtr<float4> matrix,
+                           zivc::GlobalPtr<float4> results)
+{
+  const size_t index = zivc::getGlobalLinearId();
+  if (0 < index)
+    return;
+
+  const zivc::Matrix4x4f m{matrix[0], matrix[1], matrix[2], matrix[3]};
+  const zivc::Matrix4x4f inv = m.inverse();
+  const zivc::Matrix4x4f p = m * inv;
+  const zivc::Matrix4x4f t = m.transposed();
+  for (size_t i = 0; i < 4; ++i) {
+    results[i] = inv[i];
+    results[4 + i] = p[i];
+    results[8 + i] = t[i];
+  }
+  const zivc::Matrix2x2f m2{zivc::makeFloat2(matrix[0].x, matrix[0].y),
+                            zivc::makeFloat2(matrix[1].x, matrix[1].y)};
+  const zivc::Matrix2x2f p2 = m2.inverse() * m2;
+  results[12] = zivc::makeFloat4(m.determinant(), m2.determinant(), 0.0f, 0.0f);
+  results[13] = zivc::makeFloat4(p2(0, 0), p2(0, 1), p2(1, 0), p2(1, 1));
+}
+
+/*!
+  \param [in] matrix No description.
+  \param [in] points No description.
+  \param [out] results No description.
+  \param [in] resolution No description.
+  */
+__kernel void transformPointsKernel(zivc::ConstGlobalPtr<float4> matrix,
+                                    zivc::ConstGlobalPtr<float3> points,
+                                    zivc::GlobalPtr<float3> results,
+                                    const uint32b resolution)
+{
+  const zivc::Matrix4x4f m{matrix[0], matrix[1], matrix[2], matrix[3]};
+  zivc::transformPoints(m, points, results, resolution);
+}
+
+/*!
+  \details No detailed description
+
+  \param [out] dims No description.
+  \param [in] size No description.
+  */
+__kernel void indirectSizeKernel(zivc::GlobalPtr<uint32b> dims,
+                                 const uint32b size)
+{
+  const size_t index = zivc::getGlobalIdX();
+  if (index == 0)
+    dims[0] = size;
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] dims No description.
+  \param [in,out] values No description.
+  */
+__kernel void indirectKernel(zivc::ConstGlobalPtr<uint32b> dims,
+                             zivc::GlobalPtr<uint32b> values)
+{
+  const size_t index = zivc::getGlobalIdX();
+  if (dims[0] <= index)
+    return;
+  values[index] = values[index] + 1;
+}
+
 #endif // ZIVC_TEST_KERNEL_TEST2_CL
@@ -0,0 +1,69 @@
+/*!
+  \file kernel_test_address.cl
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2021 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZIVC_TEST_KERNEL_TEST_ADDRESS_CL
+#define ZIVC_TEST_KERNEL_TEST_ADDRESS_CL
+
+// Zivc
+#include "zivc/cl/types.cl"
+#include "zivc/cl/utility.cl"
+
+using zivc::int32b;
+using zivc::uint32b;
+using zivc::uint64b;
+
+/*!
+  \details No detailed description
+
+  \param [in] inputs No description.
+  \param [out] outputs No description.
+  \param [in] resolution No description.
+  */
+__kernel void addressKernel(zivc::ConstGlobalPtr<int32b> inputs,
+                            zivc::GlobalPtr<int32b> outputs,
+                            const uint32b resolution)
+{
+  const size_t index = zivc::getGlobalIdX();
+  if (resolution <= index)
+    return;
+
+  outputs[index] = 2 * inputs[index];
+}
+
+/*!
+  \details No detailed description
+
+  \param [in] address_table No description.
+  \param [out] outputs No description.
+  \param [in] num_of_buffers No description.
+  \param [in] resolution No description.
+  */
+__kernel void addressTableKernel(zivc::ConstGlobalPtr<uint64b> address_table,
+                                 zivc::GlobalPtr<int32b> outputs,
+                                 const uint32b num_of_buffers,
+                                 const uint32b resolution)
+{
+  const size_t index = zivc::getGlobalIdX();
+  if (resolution <= index)
+    return;
+
+  int32b sum = 0;
+  for (uint32b i = 0; i < num_of_buffers; ++i) {
+    zivc::ConstGlobalPtr<int32b> inputs = zivc::toGlobalPtr<const int32b>(address_table[i]);
+    sum += inputs[index];
+  }
+  outputs[index] = sum;
+}
+
+#endif // ZIVC_TEST_KERNEL_TEST_ADDRESS_CL
@@ -0,0 +1,60 @@
+/*!
+  \file kernel_test_math.cl
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2021 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZIVC_TEST_KERNEL_TEST_MATH_CL
+#define ZIVC_TEST_KERNEL_TEST_MATH_CL
+
+// Zivc
+#include "zivc/cl/types.cl"
+// Test
+#include "math_test.cl"
+
+using zivc::uint32b;
+
+//! The double version is in 'kernel_test_math64.cl'
+using Float = float;
+
+/*!
+  \details See test::testMath
+
+  \param [in] inputs1 No description.
+  \param [in] inputs2 No description.
+  \param [out] outputs No description.
+  \param [in] resolution No description.
+  */
+__kernel void mathKernel(zivc::ConstGlobalPtr<Float> inputs1,
+                         zivc::ConstGlobalPtr<Float> inputs2,
+                         zivc::GlobalPtr<Float> outputs,
+                         const uint32b resolution)
+{
+  test::testMath<Float>(inputs1, inputs2, outputs, resolution);
+}
+
+/*!
+  \details See test::testMathLoop
+
+  \param [in] inputs No description.
+  \param [out] outputs No description.
+  \param [in] resolution No description.
+  \param [in] path No description.
+  */
+__kernel void mathLoopKernel(zivc::ConstGlobalPtr<Float> inputs,
+                             zivc::GlobalPtr<Float> outputs,
+                             const uint32b resolution,
+                             const uint32b path)
+{
+  test::testMathLoop<Float>(inputs, outputs, resolution, path);
+}
+
+#endif // ZIVC_TEST_KERNEL_TEST_MATH_CL
@@ -0,0 +1,122 @@
+/*!
+  \file math_test.cl
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2021 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZIVC_TEST_MATH_TEST_CL
+#define ZIVC_TEST_MATH_TEST_CL
+
+// Zivc
+#include "zivc/cl/math.cl"
+#include "zivc/cl/types.cl"
+#include "zivc/cl/utility.cl"
+
+namespace test {
+
+using zivc::uint32b;
+
+//! The number of iterations of the throughput kernel
+constexpr uint32b kMathLoopSize = 16;
+
+/*!
+  \details The results of the builtin, the zivc, the fast and
+  the profile functions are stored in order, so
+  outputs[(4 * k + l) * resolution + index] has the k-th function of the path l
+
+  \tparam Float No description.
+  \param [in] inputs1 No description.
+  \param [in] inputs2 No description.
+  \param [out] outputs No description.
+  \param [in] resolution No description.
+  */
+template <typename Float>
+void testMath(zivc::ConstGlobalPtr<Float> inputs1,
+              zivc::ConstGlobalPtr<Float> inputs2,
+              zivc::GlobalPtr<Float> outputs,
+              const uint32b resolution)
+{
+  const size_t index = zivc::getGlobalIdX();
+  if (resolution <= index)
+    return;
+
+  using zivc::Math;
+  const Float x = inputs1[index];
+  const Float y = inputs2[index];
+  const Float e = x * static_cast<Float>(0.125);
+  zivc::GlobalPtr<Float> out = outputs + index;
+  out[0 * resolution] = Math::Builtin::exp(x);
+  out[1 * resolution] = Math::Zivc::exp(x);
+  out[2 * resolution] = Math::Fast::exp(x);
+  out[3 * resolution] = Math::exp(x);
+  out[4 * resolution] = Math::Builtin::exp2(x);
+  out[5 * resolution] = Math::Zivc::exp2(x);
+  out[6 * resolution] = Math::Fast::exp2(x);
+  out[7 * resolution] = Math::exp2(x);
+  out[8 * resolution] = Math::Builtin::log(y);
+  out[9 * resolution] = Math::Zivc::log(y);
+  out[10 * resolution] = Math::Fast::log(y);
+  out[11 * resolution] = Math::log(y);
+  out[12 * resolution] = Math::Builtin::log2(y);
+  out[13 * resolution] = Math::Zivc::log2(y);
+  out[14 * resolution] = Math::Fast::log2(y);
+  out[15 * resolution] = Math::log2(y);
+  out[16 * resolution] = Math::Builtin::pow(y, e);
+  out[17 * resolution] = Math::Zivc::pow(y, e);
+  out[18 * resolution] = Math::Fast::pow(y, e);
+  out[19 * resolution] = Math::pow(y, e);
+  out[20 * resolution] = Math::Builtin::round(x);
+  out[21 * resolution] = Math::Zivc::round(x);
+  // The fast functions don't have 'round'
+  out[22 * resolution] = Math::Zivc::round(x);
+  out[23 * resolution] = Math::round(x);
+}
+
+/*!
+  \details Each work-item repeats exp and log of the input with
+  the builtin (path 0), the zivc (path 1) or the fast (path 2) functions
+
+  \tparam Float No description.
+  \param [in] inputs No description.
+  \param [out] outputs No description.
+  \param [in] resolution No description.
+  \param [in] path No description.
+  */
+template <typename Float>
+void testMathLoop(zivc::ConstGlobalPtr<Float> inputs,
+                  zivc::GlobalPtr<Float> outputs,
+                  const uint32b resolution,
+                  const uint32b path)
+{
+  const size_t index = zivc::getGlobalIdX();
+  if (resolution <= index)
+    return;
+
+  using zivc::Math;
+  Float x = inputs[index];
+  if (path == 0) {
+    for (uint32b i = 0; i < kMathLoopSize; ++i)
+      x = Math::Builtin::log(Math::Builtin::exp(x));
+  }
+  else if (path == 1) {
+    for (uint32b i = 0; i < kMathLoopSize; ++i)
+      x = Math::Zivc::log(Math::Zivc::exp(x));
+  }
+  else {
+    for (uint32b i = 0; i < kMathLoopSize; ++i)
+      x = Math::Fast::log(Math::Fast::exp(x));
+  }
+  outputs[index] = x;
+}
+
+} // namespace test
+
+#endif // ZIVC_TEST_MATH_TEST_CL
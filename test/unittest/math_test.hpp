@@ -0,0 +1,231 @@
+/*!
+  \file math_test.hpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2021 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZIVC_TEST_MATH_TEST_HPP
+#define ZIVC_TEST_MATH_TEST_HPP
+
+// Standard C++ library
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+// Zisc
+#include "zisc/bit.hpp"
+#include "zisc/utility.hpp"
+// Zivc
+#include "zivc/zivc.hpp"
+#include "zivc/zivc_config.hpp"
+// Test
+#include "googletest.hpp"
+#include "test.hpp"
+
+namespace ztest {
+
+//! The number of the functions which are tested in the math kernel
+constexpr std::size_t kNumOfMathFuncs = 6;
+
+//! The number of the paths of each function. See 'math_test.cl'
+constexpr std::size_t kNumOfMathPaths = 4;
+
+//! The number of iterations of the throughput kernels. See 'math_test.cl'
+constexpr std::size_t kMathLoopSize = 16;
+
+//! Return the distance of the given values in units in the last place
+template <std::floating_point Float> inline
+double ulpDistance(const Float expected, const Float value) noexcept
+{
+  constexpr double inf = std::numeric_limits<double>::infinity();
+  if (std::isnan(expected) || std::isnan(value))
+    return (std::isnan(expected) && std::isnan(value)) ? 0.0 : inf;
+  if (expected == value)
+    return 0.0;
+  if (std::isinf(expected) || std::isinf(value))
+    return inf;
+
+  using Integer = std::conditional_t<sizeof(Float) == 4, zivc::int32b, zivc::int64b>;
+  // Map the bits into the monotonic integers
+  auto to_ordered = [](const Float v) noexcept
+  {
+    const auto i = zisc::bit_cast<Integer>(v);
+    return (i < 0) ? (std::numeric_limits<Integer>::min)() - i : i;
+  };
+  const double d = zisc::cast<double>(to_ordered(expected)) -
+                   zisc::cast<double>(to_ordered(value));
+  return std::abs(d);
+}
+
+/*!
+  \details The inputs are chosen so that all results are normal numbers.
+  The builtin functions are checked only on CPU since
+  the precision of the builtin functions of GPUs is implementation defined.
+  The functions of the math profile of the kernel set must be
+  same as the functions of the given path (0: builtin, 1: zivc)
+  */
+template <std::floating_point Float, typename MathKernel, typename LoopKernel> inline
+void testMath(zivc::Device& device,
+              MathKernel& math_kernel,
+              LoopKernel& loop_kernel,
+              const std::size_t profile_path)
+{
+  using zivc::uint32b;
+  using Clock = std::chrono::high_resolution_clock;
+
+  constexpr uint32b n = 64u * 1024u;
+  constexpr double bound = (sizeof(Float) == 4) ? 87.0 : 708.0;
+  std::vector<Float> inputs1;
+  inputs1.reserve(n);
+  std::vector<Float> inputs2;
+  inputs2.reserve(n);
+  for (uint32b i = 0; i < n; ++i) {
+    const double t1 = zisc::cast<double>(i) / zisc::cast<double>(n - 1);
+    const double t2 = zisc::cast<double>((i * 7919u) % n) / zisc::cast<double>(n);
+    inputs1.emplace_back(zisc::cast<Float>(bound * (2.0 * t1 - 1.0)));
+    inputs2.emplace_back(zisc::cast<Float>(std::exp2(20.0 * t2 - 10.0)));
+  }
+  auto buff_inputs1 = ztest::makeDeviceBuffer(device, inputs1);
+  auto buff_inputs2 = ztest::makeDeviceBuffer(device, inputs2);
+  auto buff_device = device.makeBuffer<Float>(zivc::BufferUsage::kDeviceOnly);
+  buff_device->setSize(kNumOfMathPaths * kNumOfMathFuncs * n);
+
+  // Accuracy
+  {
+    ASSERT_EQ(1, math_kernel.dimensionSize()) << "Wrong kernel property.";
+    ASSERT_EQ(4, math_kernel.argSize()) << "Wrong kernel property.";
+    auto launch_options = math_kernel.makeOptions();
+    launch_options.setWorkSize({n});
+    launch_options.setExternalSyncMode(true);
+    launch_options.setLabel("mathKernel");
+    auto result = math_kernel.run(*buff_inputs1, *buff_inputs2, *buff_device, n, launch_options);
+    device.waitForCompletion(result.fence());
+  }
+  const auto results = ztest::readBuffer(device, *buff_device);
+  const bool is_builtin_checked = device.type() == zivc::SubPlatformType::kCpu;
+  constexpr std::array<std::string_view, kNumOfMathFuncs> names{{
+      "exp", "exp2", "log", "log2", "pow", "round"}};
+  // The OpenCL requirements for the builtin functions
+  constexpr std::array<double, kNumOfMathFuncs> builtin_tolerances{{
+      3.0, 3.0, 3.0, 3.0, 16.0, 0.0}};
+  // The documented errors plus the rounding of the references.
+  // The zivc functions are within 1 ulp of the exact results and the references
+  // are rounded to the nearest, so they can be 2 apart across a power of 2
+  constexpr std::array<double, kNumOfMathFuncs> zivc_tolerances{{
+      2.0, 2.0, 2.0, 2.0, 2.0, 0.0}};
+  constexpr std::array<double, kNumOfMathFuncs> fast_tolerances{{
+      3.0, 3.0, 4.0, 4.0, 5.0, 0.0}};
+  for (std::size_t k = 0; k < kNumOfMathFuncs; ++k) {
+    double builtin_error = 0.0;
+    double zivc_error = 0.0;
+    double fast_error = 0.0;
+    for (uint32b i = 0; i < n; ++i) {
+      // The reference values of float are computed in double
+      using Reference = std::conditional_t<sizeof(Float) == 4, double, long double>;
+      const auto x = zisc::cast<Reference>(inputs1[i]);
+      const auto y = zisc::cast<Reference>(inputs2[i]);
+      const auto e = zisc::cast<Reference>(inputs1[i] * zisc::cast<Float>(0.125));
+      const Reference ref = (k == 0) ? std::exp(x) :
+                            (k == 1) ? std::exp2(x) :
+                            (k == 2) ? std::log(y) :
+                            (k == 3) ? std::log2(y) :
+                            (k == 4) ? std::pow(y, e)
+                                     : std::round(x);
+      const auto expected = zisc::cast<Float>(ref);
+      auto get_result = [&results, k, i](const std::size_t path) noexcept
+      {
+        return results[(kNumOfMathPaths * k + path) * n + i];
+      };
+      if (is_builtin_checked) {
+        const Float value = get_result(0);
+        const double error = ztest::ulpDistance(expected, value);
+        EXPECT_LE(error, builtin_tolerances[k])
+            << "Builtin " << names[k] << " failed at (" << inputs1[i] << ","
+            << inputs2[i] << "): expected " << expected << ", but " << value;
+        builtin_error = (std::max)(builtin_error, error);
+      }
+      {
+        const Float value = get_result(1);
+        const double error = ztest::ulpDistance(expected, value);
+        EXPECT_LE(error, zivc_tolerances[k])
+            << "Zivc " << names[k] << " failed at (" << inputs1[i] << ","
+            << inputs2[i] << "): expected " << expected << ", but " << value;
+        zivc_error = (std::max)(zivc_error, error);
+      }
+      {
+        // The error of the fast pow grows with |e * log2(y)|
+        const double tolerance = (k == 4)
+            ? fast_tolerances[k] + 2.0 * std::abs(zisc::cast<double>(e * std::log2(y)))
+            : fast_tolerances[k];
+        const Float value = get_result(2);
+        const double error = ztest::ulpDistance(expected, value);
+        EXPECT_LE(error, tolerance)
+            << "Fast " << names[k] << " failed at (" << inputs1[i] << ","
+            << inputs2[i] << "): expected " << expected << ", but " << value;
+        fast_error = (std::max)(fast_error, error);
+      }
+      {
+        const Float expected_value = get_result(profile_path);
+        const Float value = get_result(3);
+        EXPECT_EQ(0.0, ztest::ulpDistance(expected_value, value))
+            << "Math profile " << names[k] << " failed at (" << inputs1[i] << ","
+            << inputs2[i] << "): expected " << expected_value << ", but " << value;
+      }
+    }
+    std::cout << "## " << names[k] << " max error: builtin=" << builtin_error
+              << " ulp, zivc=" << zivc_error << " ulp, fast=" << fast_error
+              << " ulp" << std::endl;
+  }
+
+  // Throughput
+  {
+    ASSERT_EQ(1, loop_kernel.dimensionSize()) << "Wrong kernel property.";
+    ASSERT_EQ(4, loop_kernel.argSize()) << "Wrong kernel property.";
+    auto launch_options = loop_kernel.makeOptions();
+    launch_options.setWorkSize({n});
+    launch_options.setExternalSyncMode(true);
+    launch_options.setLabel("mathLoopKernel");
+    auto measure = [&](const uint32b path)
+    {
+      auto run = [&]()
+      {
+        auto result = loop_kernel.run(*buff_inputs1, *buff_device, n, path, launch_options);
+        device.waitForCompletion(result.fence());
+      };
+      constexpr std::size_t num_of_runs = 4;
+      run(); // Warm up
+      const auto start = Clock::now();
+      for (std::size_t i = 0; i < num_of_runs; ++i)
+        run();
+      const std::chrono::duration<double> elapsed = Clock::now() - start;
+      const std::size_t num_of_ops = 2 * kMathLoopSize * num_of_runs * n;
+      return zisc::cast<double>(num_of_ops) / (elapsed.count() * 1.0e6);
+    };
+    const double builtin_throughput = measure(0);
+    const double zivc_throughput = measure(1);
+    const double fast_throughput = measure(2);
+    std::cout << "## exp/log throughput: builtin=" << builtin_throughput
+              << " Mops/s, zivc=" << zivc_throughput
+              << " Mops/s, fast=" << fast_throughput << " Mops/s" << std::endl;
+  }
+}
+
+} // namespace ztest
+
+#endif // ZIVC_TEST_MATH_TEST_HPP
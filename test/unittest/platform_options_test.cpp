@@ -44,6 +44,13 @@ TEST(PlatformOptionsTest, SetterGetterTest)
   options.setCpuTaskBatchSize(0);
   ASSERT_FALSE(options.cpuNumOfThreads());
   ASSERT_FALSE(options.cpuTaskBatchSize());
+  // Queue priorities
+  ASSERT_FALSE(options.numOfHighPriorityQueues());
+  ASSERT_FALSE(options.numOfLowPriorityQueues());
+  options.setNumOfHighPriorityQueues(2);
+  options.setNumOfLowPriorityQueues(1);
+  ASSERT_EQ(2, options.numOfHighPriorityQueues());
+  ASSERT_EQ(1, options.numOfLowPriorityQueues());
   // Debug
   options.enableDebugMode(true);
   ASSERT_TRUE(options.debugModeEnabled());
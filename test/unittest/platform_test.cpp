@@ -24,6 +24,7 @@
 // Zivc
 #include "zivc/zivc.hpp"
 #include "zivc/zivc_config.hpp"
+#include "zivc/cpu/cpu_device_info.hpp"
 // Test
 #include "config.hpp"
 #include "googletest.hpp"
@@ -121,6 +122,46 @@ TEST(PlatformTest, DeviceInfoTest)
                                               << group_count[2] << ")."
                                               << std::endl;
   }
+  // CPU features
+  if (info->type() == zivc::SubPlatformType::kCpu) {
+    using zivc::CpuFeature;
+    using zivc::CpuIsaLevel;
+    const auto* const cpu_info = zisc::cast<const zivc::CpuDeviceInfo*>(info);
+    const CpuIsaLevel level = cpu_info->isaLevel();
+    std::cout << "## ISA level: " << zisc::cast<int>(level) << std::endl;
+    if (CpuIsaLevel::kX86_64V2 <= level) {
+      EXPECT_TRUE(cpu_info->hasFeature(CpuFeature::kSse42))
+          << "ISA level isn't consistent with the features.";
+    }
+    if (CpuIsaLevel::kX86_64V3 <= level) {
+      EXPECT_TRUE(cpu_info->hasFeature(CpuFeature::kAvx2))
+          << "ISA level isn't consistent with the features.";
+    }
+    if (CpuIsaLevel::kX86_64V4 <= level) {
+      EXPECT_TRUE(cpu_info->hasFeature(CpuFeature::kAvx512f))
+          << "ISA level isn't consistent with the features.";
+    }
+    // Topology is available through the common device info
+    const zivc::DeviceInfo& info = *cpu_info;
+    EXPECT_GT(info.numOfPhysicalCores(), 0) << "Core count isn't available.";
+    EXPECT_LE(info.numOfPhysicalCores(), info.numOfLogicalCores())
+        << "Core count isn't valid.";
+    EXPECT_GT(info.numOfNumaNodes(), 0) << "NUMA node count isn't available.";
+    std::cout << "## Cores: " << info.numOfPhysicalCores() << " physical, "
+              << info.numOfLogicalCores() << " logical, "
+              << info.numOfThreadsPerCore() << " threads per core."
+              << std::endl;
+    std::cout << "## NUMA nodes: " << info.numOfNumaNodes() << std::endl;
+    for (zivc::uint32b l = 1; l <= 3; ++l) {
+      std::cout << "## L" << l << " cache: "
+                << info.cacheSize(l) / 1024 << " KB." << std::endl;
+    }
+    std::cout << "## Cache line size: " << info.cacheLineSize() << std::endl;
+    EXPECT_GT(cpu_info->recommendedNumOfThreads(), 0)
+        << "The recommended number of threads isn't valid.";
+    EXPECT_GT(cpu_info->recommendedTaskBatchSize(), 0)
+        << "The recommended task batch size isn't valid.";
+  }
 }
 
 TEST(PlatformTest, MakeDeviceExceptionTest)
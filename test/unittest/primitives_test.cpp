@@ -0,0 +1,958 @@
+/*!
+  \file primitives_test.cpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2021 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+// Standard C++ library
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <vector>
+// Zisc
+#include "zisc/bit.hpp"
+#include "zisc/utility.hpp"
+// Zivc
+#include "zivc/zivc.hpp"
+#include "zivc/zivc_config.hpp"
+#include "zivc/cppcl/types.hpp"
+// Test
+#include "config.hpp"
+#include "googletest.hpp"
+#include "test.hpp"
+
+namespace {
+
+/*!
+  \details Compute C = alpha * A * B + beta * C of row-major matrices
+
+  \param [in] a No description.
+  \param [in] b No description.
+  \param [in,out] c No description.
+  \param [in] options No description.
+  \param [in] alpha No description.
+  \param [in] beta No description.
+  */
+void gemmReference(const std::vector<double>& a,
+                   const std::vector<double>& b,
+                   std::vector<double>* c,
+                   const zivc::GemmLaunchOptions& options,
+                   const double alpha,
+                   const double beta)
+{
+  for (std::size_t batch = 0; batch < options.batchSize(); ++batch) {
+    const std::size_t a_offset = batch * options.strideA();
+    const std::size_t b_offset = batch * options.strideB();
+    const std::size_t c_offset = batch * options.strideC();
+    for (std::size_t i = 0; i < options.m(); ++i) {
+      for (std::size_t j = 0; j < options.n(); ++j) {
+        double sum = 0.0;
+        for (std::size_t k = 0; k < options.k(); ++k)
+          sum += a[a_offset + i * options.lda() + k] * b[b_offset + k * options.ldb() + j];
+        double& result = (*c)[c_offset + i * options.ldc() + j];
+        result = alpha * sum + beta * result;
+      }
+    }
+  }
+}
+
+/*!
+  \details The number (offset) of the Philox4x32-10 stream of the seed
+
+  \param [in] seed No description.
+  \param [in] offset No description.
+  \return No description
+  */
+zivc::uint32b philoxReference(const zivc::uint64b seed, const zivc::uint64b offset)
+{
+  using zivc::uint32b;
+  using zivc::uint64b;
+  const uint64b block = offset / 4;
+  uint32b c[4] = {zisc::cast<uint32b>(block), zisc::cast<uint32b>(block >> 32), 0, 0};
+  uint32b k[2] = {zisc::cast<uint32b>(seed), zisc::cast<uint32b>(seed >> 32)};
+  for (std::size_t round = 0; round < 10; ++round) {
+    const uint64b p0 = uint64b{0xd251'1f53u} * c[0];
+    const uint64b p1 = uint64b{0xcd9e'8d57u} * c[2];
+    const uint32b r[4] = {zisc::cast<uint32b>(p1 >> 32) ^ c[1] ^ k[0],
+                          zisc::cast<uint32b>(p1),
+                          zisc::cast<uint32b>(p0 >> 32) ^ c[3] ^ k[1],
+                          zisc::cast<uint32b>(p0)};
+    std::copy_n(r, 4, c);
+    k[0] += 0x9e37'79b9u;
+    k[1] += 0xbb67'ae85u;
+  }
+  return c[offset % 4];
+}
+
+} // namespace
+
+TEST(PrimitivesTest, ReduceInt32Test)
+{
+  using zivc::int32b;
+
+  auto platform = ztest::makePlatform();
+  const ztest::Config& config = ztest::Config::globalConfig();
+  zivc::SharedDevice device = platform->queryDevice(config.deviceId());
+
+  constexpr std::size_t n = 1'000'003;
+  std::vector<int32b> data(n);
+  for (std::size_t i = 0; i < n; ++i)
+    data[i] = zisc::cast<int32b>(i % 7) - 3;
+  data[n / 3] = -1000;
+  data[n / 2] = 1000;
+  auto source = ztest::makeDeviceBuffer(*device, data);
+  auto dest = device->makeBuffer<int32b>(zivc::BufferUsage::kDeviceOnly);
+  dest->setSize(3);
+
+  auto options = source->makeOptions();
+  options.setSize(n);
+  options.setDestOffset(0);
+  zivc::reduce(*source, dest.get(), zivc::PrimitiveOp::kAdd, options);
+  options.setDestOffset(1);
+  zivc::reduce(*source, dest.get(), zivc::PrimitiveOp::kMin, options);
+  options.setDestOffset(2);
+  zivc::reduce(*source, dest.get(), zivc::PrimitiveOp::kMax, options);
+
+  const auto result = ztest::readBuffer(*device, *dest);
+  const int32b expected = std::accumulate(data.begin(), data.end(), int32b{0});
+  ASSERT_EQ(expected, result[0]) << "Reduce (add) failed.";
+  ASSERT_EQ(-1000, result[1]) << "Reduce (min) failed.";
+  ASSERT_EQ(1000, result[2]) << "Reduce (max) failed.";
+}
+
+TEST(PrimitivesTest, ReduceFloatTest)
+{
+  auto platform = ztest::makePlatform();
+  const ztest::Config& config = ztest::Config::globalConfig();
+  zivc::SharedDevice device = platform->queryDevice(config.deviceId());
+
+  // Small integers are added without rounding errors in any order
+  constexpr std::size_t n = 100'000;
+  std::vector<float> data(n);
+  for (std::size_t i = 0; i < n; ++i)
+    data[i] = zisc::cast<float>(i % 16);
+  auto source = ztest::makeDeviceBuffer(*device, data);
+  auto dest = device->makeBuffer<float>(zivc::BufferUsage::kDeviceOnly);
+  dest->setSize(2);
+
+  auto options = source->makeOptions();
+  options.setSize(n);
+  zivc::reduce(*source, dest.get(), zivc::PrimitiveOp::kAdd, options);
+  // An empty source is reduced into the identity
+  options.setSize(0);
+  options.setDestOffset(1);
+  zivc::reduce(*source, dest.get(), zivc::PrimitiveOp::kMin, options);
+
+  const auto result = ztest::readBuffer(*device, *dest);
+  const float expected = std::accumulate(data.begin(), data.end(), 0.0f);
+  ASSERT_EQ(expected, result[0]) << "Reduce (add) failed.";
+  ASSERT_EQ(std::numeric_limits<float>::infinity(), result[1])
+      << "Reduce of an empty source failed.";
+}
+
+TEST(PrimitivesTest, ScanUint32Test)
+{
+  using zivc::uint32b;
+
+  auto platform = ztest::makePlatform();
+  const ztest::Config& config = ztest::Config::globalConfig();
+  zivc::SharedDevice device = platform->queryDevice(config.deviceId());
+
+  constexpr std::size_t n = 1'000'003;
+  std::vector<uint32b> data(n);
+  for (std::size_t i = 0; i < n; ++i)
+    data[i] = zisc::cast<uint32b>((i * 7) % 11);
+  auto source = ztest::makeDeviceBuffer(*device, data);
+  auto dest = device->makeBuffer<uint32b>(zivc::BufferUsage::kDeviceOnly);
+  dest->setSize(n);
+
+  auto options = source->makeOptions();
+  options.setSize(n);
+  // Inclusive scan
+  {
+    zivc::inclusiveScan(*source, dest.get(), zivc::PrimitiveOp::kAdd, options);
+    const auto result = ztest::readBuffer(*device, *dest);
+    uint32b expected = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+      expected += data[i];
+      ASSERT_EQ(expected, result[i]) << "Inclusive scan failed at " << i << ".";
+    }
+  }
+  // Exclusive scan
+  {
+    zivc::exclusiveScan(*source, dest.get(), zivc::PrimitiveOp::kAdd, options);
+    const auto result = ztest::readBuffer(*device, *dest);
+    uint32b expected = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+      ASSERT_EQ(expected, result[i]) << "Exclusive scan failed at " << i << ".";
+      expected += data[i];
+    }
+  }
+}
+
+TEST(PrimitivesTest, ScanRangeTest)
+{
+  using zivc::int32b;
+
+  auto platform = ztest::makePlatform();
+  const ztest::Config& config = ztest::Config::globalConfig();
+  zivc::SharedDevice device = platform->queryDevice(config.deviceId());
+
+  constexpr std::size_t n = 300'000;
+  constexpr std::size_t offset = 5;
+  std::vector<int32b> data(n);
+  for (std::size_t i = 0; i < n; ++i)
+    data[i] = zisc::cast<int32b>((i * 31) % 1013) - 500;
+  auto buffer = ztest::makeDeviceBuffer(*device, data);
+
+  // In-place max scan of a sub-range
+  const std::size_t s = n - 2 * offset;
+  auto options = buffer->makeOptions();
+  options.setSourceOffset(offset);
+  options.setDestOffset(offset);
+  options.setSize(s);
+  zivc::inclusiveScan(*buffer, buffer.get(), zivc::PrimitiveOp::kMax, options);
+
+  const auto result = ztest::readBuffer(*device, *buffer);
+  int32b expected = std::numeric_limits<int32b>::lowest();
+  for (std::size_t i = 0; i < n; ++i) {
+    if ((offset <= i) && (i < offset + s)) {
+      expected = (std::max)(expected, data[i]);
+      ASSERT_EQ(expected, result[i]) << "Scan (max) failed at " << i << ".";
+    }
+    else {
+      ASSERT_EQ(data[i], result[i]) << "Out of the range is overwritten at " << i << ".";
+    }
+  }
+}
+
+TEST(PrimitivesTest, CompactTest)
+{
+  using zivc::uint32b;
+
+  auto platform = ztest::makePlatform();
+  const ztest::Config& config = ztest::Config::globalConfig();
+  zivc::SharedDevice device = platform->queryDevice(config.deviceId());
+
+  constexpr std::size_t n = 1'000'003;
+  std::vector<float> data(n);
+  std::vector<uint32b> flag_data(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    data[i] = zisc::cast<float>(i);
+    flag_data[i] = (((i * 13) % 7) < 2) ? 1u : 0u;
+  }
+  auto source = ztest::makeDeviceBuffer(*device, data);
+  auto flags = ztest::makeDeviceBuffer(*device, flag_data);
+  auto dest = device->makeBuffer<float>(zivc::BufferUsage::kDeviceOnly);
+  dest->setSize(n);
+  auto num_of_selected = device->makeBuffer<uint32b>(zivc::BufferUsage::kDeviceOnly);
+  num_of_selected->setSize(1);
+
+  auto options = source->makeOptions();
+  options.setSize(n);
+  zivc::compact(*source, *flags, dest.get(), num_of_selected.get(), options);
+
+  std::vector<float> expected;
+  for (std::size_t i = 0; i < n; ++i) {
+    if (flag_data[i] != 0)
+      expected.push_back(data[i]);
+  }
+  const auto count = ztest::readBuffer(*device, *num_of_selected);
+  ASSERT_EQ(expected.size(), count[0]) << "The number of selected elements is wrong.";
+  const auto result = ztest::readBuffer(*device, *dest);
+  for (std::size_t i = 0; i < expected.size(); ++i)
+    ASSERT_EQ(expected[i], result[i]) << "Compaction failed at " << i << ".";
+}
+
+TEST(PrimitivesTest, HistogramTest)
+{
+  using zivc::int32b;
+  using zivc::uint32b;
+
+  auto platform = ztest::makePlatform();
+  const ztest::Config& config = ztest::Config::globalConfig();
+  zivc::SharedDevice device = platform->queryDevice(config.deviceId());
+
+  constexpr std::size_t n = 1'000'003;
+  constexpr std::size_t num_of_bins = 10;
+  constexpr int32b lower = -100;
+  constexpr int32b upper = 100;
+  std::vector<int32b> data(n);
+  for (std::size_t i = 0; i < n; ++i)
+    data[i] = zisc::cast<int32b>((i * 37) % 251) - 125;
+  auto source = ztest::makeDeviceBuffer(*device, data);
+  auto bins = ztest::makeDeviceBuffer(*device, std::vector<uint32b>(num_of_bins, 0));
+
+  auto options = source->makeOptions();
+  options.setSize(n);
+  zivc::histogram(*source, bins.get(), lower, upper, options);
+
+  std::vector<uint32b> expected(num_of_bins, 0);
+  for (const int32b x : data) {
+    if ((lower <= x) && (x < upper)) {
+      const auto bin = zisc::cast<std::size_t>(x - lower) * num_of_bins /
+                       zisc::cast<std::size_t>(upper - lower);
+      ++expected[bin];
+    }
+  }
+  const auto result = ztest::readBuffer(*device, *bins);
+  for (std::size_t i = 0; i < num_of_bins; ++i)
+    ASSERT_EQ(expected[i], result[i]) << "Histogram failed at bin " << i << ".";
+
+  // The dest offset out of the bins is rejected
+  options.setDestOffset(num_of_bins + 1);
+  ASSERT_THROW(zivc::histogram(*source, bins.get(), lower, upper, options),
+               zivc::SystemError);
+}
+
+TEST(PrimitivesTest, PrimitiveStorageTest)
+{
+  using zivc::uint32b;
+
+  auto platform = ztest::makePlatform();
+  const ztest::Config& config = ztest::Config::globalConfig();
+  zivc::SharedDevice device = platform->queryDevice(config.deviceId());
+
+  constexpr std::size_t n = 500'003;
+  std::vector<uint32b> data(n);
+  for (std::size_t i = 0; i < n; ++i)
+    data[i] = zisc::cast<uint32b>((i * 5) % 3);
+  auto source = ztest::makeDeviceBuffer(*device, data);
+  auto dest = device->makeBuffer<uint32b>(zivc::BufferUsage::kDeviceOnly);
+  dest->setSize(n);
+  auto sum = device->makeBuffer<uint32b>(zivc::BufferUsage::kDeviceOnly);
+  sum->setSize(2);
+
+  // The launches are chained on one queue and only the last one is waited for.
+  // The reduce reuses the status buffer of the scan
+  zivc::PrimitiveStorage storage;
+  auto options = source->makeOptions();
+  options.setSize(n);
+  zivc::inclusiveScan(*source, dest.get(), zivc::PrimitiveOp::kAdd,
+                      options, std::addressof(storage));
+  zivc::reduce(*source, sum.get(), zivc::PrimitiveOp::kAdd,
+               options, std::addressof(storage));
+  options.setDestOffset(1);
+  options.setExternalSyncMode(true);
+  auto result = zivc::reduce(*dest, sum.get(), zivc::PrimitiveOp::kMax,
+                             options, std::addressof(storage));
+  if (result.isAsync())
+    result.fence().wait();
+  ASSERT_EQ(device.get(), storage.device()) << "The storage isn't bound to the device.";
+
+  const uint32b expected = std::accumulate(data.begin(), data.end(), uint32b{0});
+  const auto sums = ztest::readBuffer(*device, *sum);
+  ASSERT_EQ(expected, sums[0]) << "Reduce with the storage failed.";
+  ASSERT_EQ(expected, sums[1]) << "Reduce of the scan with the storage failed.";
+}
+
+TEST(PrimitivesTest, SortKeyValueTest)
+{
+  using zivc::uint32b;
+
+  auto platform = ztest::makePlatform();
+  const ztest::Config& config = ztest::Config::globalConfig();
+  zivc::SharedDevice device = platform->queryDevice(config.deviceId());
+
+  constexpr std::size_t n = 300'007;
+  std::vector<uint32b> keys(n);
+  std::vector<uint32b> values(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    keys[i] = zisc::cast<uint32b>((i * 2'654'435'761ull) % 100'003);
+    values[i] = zisc::cast<uint32b>(i);
+  }
+  auto key_buffer = ztest::makeDeviceBuffer(*device, keys);
+  auto value_buffer = ztest::makeDeviceBuffer(*device, values);
+
+  auto options = key_buffer->makeOptions();
+  options.setSize(n);
+  zivc::sort(key_buffer.get(), value_buffer.get(), options);
+
+  const auto key_result = ztest::readBuffer(*device, *key_buffer);
+  const auto value_result = ztest::readBuffer(*device, *value_buffer);
+  std::vector<std::size_t> indices(n);
+  std::iota(indices.begin(), indices.end(), std::size_t{0});
+  std::stable_sort(indices.begin(), indices.end(), [&keys](const std::size_t lhs, const std::size_t rhs)
+  {
+    return keys[lhs] < keys[rhs];
+  });
+  for (std::size_t i = 0; i < n; ++i) {
+    ASSERT_EQ(keys[indices[i]], key_result[i]) << "Sort keys failed at " << i << ".";
+    ASSERT_EQ(values[indices[i]], value_result[i]) << "Sort values aren't stable at " << i << ".";
+  }
+}
+
+TEST(PrimitivesTest, SortSignedKeyTest)
+{
+  using zivc::int32b;
+  using zivc::int64b;
+
+  auto platform = ztest::makePlatform();
+  const ztest::Config& config = ztest::Config::globalConfig();
+  zivc::SharedDevice device = platform->queryDevice(config.deviceId());
+
+  constexpr std::size_t n = 100'003;
+  std::vector<int32b> keys_i32(n);
+  std::vector<float> keys_f32(n);
+  std::vector<int64b> keys_i64(n);
+  std::vector<double> keys_f64(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    const int64b k = zisc::cast<int64b>((i * 48'271ull) % 65'537) - 32'768;
+    keys_i32[i] = zisc::cast<int32b>(k);
+    keys_f32[i] = 0.25f * zisc::cast<float>(k);
+    keys_i64[i] = k * (int64b{1} << 33);
+    keys_f64[i] = 1.0e10 * zisc::cast<double>(k);
+  }
+  keys_f32[0] = -std::numeric_limits<float>::infinity();
+  keys_f32[1] = std::numeric_limits<float>::infinity();
+  keys_i64[2] = (std::numeric_limits<int64b>::min)();
+  keys_i64[3] = (std::numeric_limits<int64b>::max)();
+
+  auto test_sort = [&device](auto keys, const char* name)
+  {
+    auto buffer = ztest::makeDeviceBuffer(*device, keys);
+    auto options = buffer->makeOptions();
+    options.setSize(keys.size());
+    zivc::sort(buffer.get(), options);
+    const auto result = ztest::readBuffer(*device, *buffer);
+    std::sort(keys.begin(), keys.end());
+    ASSERT_EQ(keys, result) << "Sort of " << name << " keys failed.";
+  };
+  test_sort(keys_i32, "int32");
+  test_sort(keys_f32, "float");
+  test_sort(keys_i64, "int64");
+  test_sort(keys_f64, "double");
+}
+
+TEST(PrimitivesTest, SegmentedSortTest)
+{
+  using zivc::uint32b;
+
+  auto platform = ztest::makePlatform();
+  const ztest::Config& config = ztest::Config::globalConfig();
+  zivc::SharedDevice device = platform->queryDevice(config.deviceId());
+
+  constexpr std::size_t n = 200'000;
+  constexpr std::size_t offset = 5;
+  std::vector<uint32b> offsets;
+  for (std::size_t i = 0; i < n; i += 1 + (i % 701))
+    offsets.push_back(zisc::cast<uint32b>(i));
+  const std::size_t num_of_segments = offsets.size();
+  auto offset_buffer = ztest::makeDeviceBuffer(*device, offsets);
+  offsets.push_back(zisc::cast<uint32b>(n));
+
+  zivc::SortStorage storage;
+  for (std::size_t iteration = 0; iteration < 2; ++iteration) {
+    std::vector<float> keys(offset + n, -1.0f);
+    for (std::size_t i = 0; i < n; ++i)
+      keys[offset + i] = zisc::cast<float>((i * 7'919 + iteration) % 1'013) - 500.0f;
+    auto key_buffer = ztest::makeDeviceBuffer(*device, keys);
+
+    auto options = key_buffer->makeOptions();
+    options.setSourceOffset(offset);
+    options.setSize(n);
+    zivc::segmentedSort(key_buffer.get(), *offset_buffer, num_of_segments,
+                        options, std::addressof(storage));
+    ASSERT_LT(0, storage.sizeInBytes()) << "The sort storage isn't used.";
+
+    const auto result = ztest::readBuffer(*device, *key_buffer);
+    for (std::size_t i = 0; i < num_of_segments; ++i) {
+      auto begin = keys.begin() + offset + offsets[i];
+      auto end = keys.begin() + offset + offsets[i + 1];
+      std::sort(begin, end);
+    }
+    ASSERT_EQ(keys, result) << "Segmented sort failed at iteration " << iteration << ".";
+  }
+}
+
+TEST(PrimitivesTest, GemmFloatTest)
+{
+  auto platform = ztest::makePlatform();
+  const ztest::Config& config = ztest::Config::globalConfig();
+  zivc::SharedDevice device = platform->queryDevice(config.deviceId());
+
+  // The shape isn't a multiple of the tiles and the rows are padded
+  zivc::GemmLaunchOptions options{67, 45, 131};
+  options.setLeadingDims(131 + 3, 45 + 5, 45 + 1);
+  const std::size_t size_a = options.m() * options.lda();
+  const std::size_t size_b = options.k() * options.ldb();
+  const std::size_t size_c = options.m() * options.ldc();
+  std::vector<float> a(size_a);
+  std::vector<float> b(size_b);
+  std::vector<float> c(size_c);
+  for (std::size_t i = 0; i < size_a; ++i)
+    a[i] = zisc::cast<float>(i % 13) * 0.25f - 1.5f;
+  for (std::size_t i = 0; i < size_b; ++i)
+    b[i] = zisc::cast<float>(i % 7) * 0.5f - 1.0f;
+  for (std::size_t i = 0; i < size_c; ++i)
+    c[i] = zisc::cast<float>(i % 5);
+  auto a_buffer = ztest::makeDeviceBuffer(*device, a);
+  auto b_buffer = ztest::makeDeviceBuffer(*device, b);
+  auto c_buffer = ztest::makeDeviceBuffer(*device, c);
+
+  constexpr float alpha = 1.5f;
+  constexpr float beta = 0.5f;
+  zivc::gemm(*a_buffer, *b_buffer, c_buffer.get(), alpha, beta, options);
+
+  std::vector<double> expected{c.begin(), c.end()};
+  ::gemmReference(std::vector<double>{a.begin(), a.end()},
+                  std::vector<double>{b.begin(), b.end()},
+                  std::addressof(expected), options, alpha, beta);
+  const auto result = ztest::readBuffer(*device, *c_buffer);
+  for (std::size_t i = 0; i < options.m(); ++i) {
+    for (std::size_t j = 0; j < options.ldc(); ++j) {
+      const std::size_t index = i * options.ldc() + j;
+      ASSERT_NEAR(expected[index], result[index], 1.0e-3 * (std::max)(1.0, std::abs(expected[index])))
+          << "Gemm failed at (" << i << "," << j << ").";
+    }
+  }
+}
+
+TEST(PrimitivesTest, GemmHalfStridedBatchedTest)
+{
+  using zivc::uint16b;
+  using zivc::cl::half;
+
+  auto platform = ztest::makePlatform();
+  const ztest::Config& config = ztest::Config::globalConfig();
+  zivc::SharedDevice device = platform->queryDevice(config.deviceId());
+
+  // B is shared by the matrices in the batch
+  constexpr std::size_t batch_size = 5;
+  zivc::GemmLaunchOptions options{33, 20, 40};
+  options.setBatch(batch_size, 33 * 40, 0, 33 * 20);
+  const std::size_t size_a = batch_size * options.strideA();
+  const std::size_t size_b = options.k() * options.ldb();
+  const std::size_t size_c = batch_size * options.strideC();
+  // The values are exact in half
+  std::vector<double> a(size_a);
+  std::vector<double> b(size_b);
+  for (std::size_t i = 0; i < size_a; ++i)
+    a[i] = zisc::cast<double>(i % 9) * 0.125 - 0.5;
+  for (std::size_t i = 0; i < size_b; ++i)
+    b[i] = zisc::cast<double>(i % 5) * 0.25 - 0.5;
+  const auto to_half = [](const std::vector<double>& data)
+  {
+    std::vector<uint16b> bits(data.size());
+    for (std::size_t i = 0; i < data.size(); ++i)
+      bits[i] = zisc::bit_cast<uint16b>(zisc::cast<half>(zisc::cast<float>(data[i])));
+    return bits;
+  };
+  auto a_buffer = ztest::makeDeviceBuffer(*device, to_half(a));
+  auto b_buffer = ztest::makeDeviceBuffer(*device, to_half(b));
+  auto c_buffer = device->makeBuffer<uint16b>(zivc::BufferUsage::kDeviceOnly);
+  c_buffer->setSize(size_c);
+
+  // C is uninitialized, but it isn't read since beta is zero
+  constexpr float alpha = 2.0f;
+  zivc::gemm(*a_buffer, *b_buffer, c_buffer.get(), alpha, 0.0f, options);
+
+  std::vector<double> expected(size_c, 0.0);
+  ::gemmReference(a, b, std::addressof(expected), options, alpha, 0.0);
+  const auto result = ztest::readBuffer(*device, *c_buffer);
+  for (std::size_t i = 0; i < size_c; ++i) {
+    const double r = zisc::cast<double>(zisc::cast<float>(zisc::bit_cast<half>(result[i])));
+    // The precision of half is 11 bits
+    ASSERT_NEAR(expected[i], r, 1.0e-3 * (std::max)(1.0, std::abs(expected[i])))
+        << "Strided-batched gemm failed at " << i << ".";
+  }
+}
+
+TEST(PrimitivesTest, GemmStorageTest)
+{
+  auto platform = ztest::makePlatform();
+  const ztest::Config& config = ztest::Config::globalConfig();
+  zivc::SharedDevice device = platform->queryDevice(config.deviceId());
+
+  zivc::GemmLaunchOptions options{70, 50, 90};
+  options.setExternalSyncMode(true);
+  const std::size_t size_a = options.m() * options.lda();
+  const std::size_t size_b = options.k() * options.ldb();
+  const std::size_t size_c = options.m() * options.ldc();
+  std::vector<float> a(size_a);
+  std::vector<float> b(size_b);
+  for (std::size_t i = 0; i < size_a; ++i)
+    a[i] = zisc::cast<float>(i % 11) * 0.25f - 1.0f;
+  for (std::size_t i = 0; i < size_b; ++i)
+    b[i] = zisc::cast<float>(i % 3) * 0.5f - 0.5f;
+  auto a_buffer = ztest::makeDeviceBuffer(*device, a);
+  auto b_buffer = ztest::makeDeviceBuffer(*device, b);
+  auto c_buffer = device->makeBuffer<float>(zivc::BufferUsage::kDeviceOnly);
+  c_buffer->setSize(size_c);
+
+  // The second launch reuses the kernel cached by the first launch
+  // and accumulates into the result of the first launch
+  zivc::GemmStorage storage;
+  for (const float beta : {0.0f, 1.0f}) {
+    auto result = zivc::gemm(*a_buffer, *b_buffer, c_buffer.get(), 1.0f, beta,
+                             options, std::addressof(storage));
+    if (result.isAsync())
+      result.fence().wait();
+  }
+  ASSERT_EQ(device.get(), storage.device()) << "The storage isn't bound to the device.";
+
+  std::vector<double> expected(size_c, 0.0);
+  ::gemmReference(std::vector<double>{a.begin(), a.end()},
+                  std::vector<double>{b.begin(), b.end()},
+                  std::addressof(expected), options, 2.0, 0.0);
+  const auto result = ztest::readBuffer(*device, *c_buffer);
+  for (std::size_t i = 0; i < size_c; ++i) {
+    ASSERT_NEAR(expected[i], result[i], 1.0e-3 * (std::max)(1.0, std::abs(expected[i])))
+        << "Gemm with the storage failed at " << i << ".";
+  }
+}
+
+TEST(PrimitivesTest, ConvertHalfTest)
+{
+  using zivc::half;
+
+  auto platform = ztest::makePlatform();
+  const ztest::Config& config = ztest::Config::globalConfig();
+  zivc::SharedDevice device = platform->queryDevice(config.deviceId());
+
+  // The size isn't a multiple of the vector size
+  constexpr std::size_t n = 4099;
+  constexpr std::size_t offset = 3;
+  std::vector<float> source(n + offset);
+  for (std::size_t i = 0; i < source.size(); ++i)
+    source[i] = zisc::cast<float>(zisc::cast<int>(i % 2001) - 1000) * 0.37f;
+  auto source_buffer = ztest::makeDeviceBuffer(*device, source);
+  auto half_buffer = device->makeBuffer<half>(zivc::BufferUsage::kDeviceOnly);
+  half_buffer->setSize(n + offset);
+  auto dest_buffer = device->makeBuffer<float>(zivc::BufferUsage::kDeviceOnly);
+  dest_buffer->setSize(n);
+
+  // float -> half
+  {
+    auto options = source_buffer->makeOptions();
+    options.setSize(n);
+    options.setSourceOffset(offset);
+    options.setDestOffset(offset);
+    options.setExternalSyncMode(true);
+    zivc::convert(*source_buffer, half_buffer.get(), options);
+    const auto result = ztest::readBuffer(*device, *half_buffer);
+    for (std::size_t i = 0; i < n; ++i) {
+      const half expected = zisc::cast<half>(source[offset + i]);
+      ASSERT_EQ(zisc::bit_cast<zivc::uint16b>(expected),
+                zisc::bit_cast<zivc::uint16b>(result[offset + i]))
+          << "Float to half conversion failed at " << i << ".";
+    }
+  }
+  // half -> float
+  {
+    auto options = half_buffer->makeOptions();
+    options.setSize(n);
+    options.setSourceOffset(offset);
+    options.setExternalSyncMode(true);
+    zivc::convert(*half_buffer, dest_buffer.get(), options);
+    const auto result = ztest::readBuffer(*device, *dest_buffer);
+    for (std::size_t i = 0; i < n; ++i) {
+      const float expected = zisc::cast<float>(zisc::cast<half>(source[offset + i]));
+      ASSERT_EQ(expected, result[i]) << "Half to float conversion failed at " << i << ".";
+    }
+  }
+}
+
+TEST(PrimitivesTest, ConvertBfloat16Test)
+{
+  using zivc::uint16b;
+  using zivc::uint32b;
+
+  auto platform = ztest::makePlatform();
+  const ztest::Config& config = ztest::Config::globalConfig();
+  zivc::SharedDevice device = platform->queryDevice(config.deviceId());
+
+  std::vector<float> source{
+      1.0f,
+      // Ties are rounded to even
+      zisc::bit_cast<float>(0x3f80'8000u),
+      zisc::bit_cast<float>(0x3f81'8000u),
+      zisc::bit_cast<float>(0x3f80'8001u),
+      -2.5f,
+      std::numeric_limits<float>::infinity(),
+      std::numeric_limits<float>::quiet_NaN(),
+      // A NaN whose payload is only in the lower bits
+      zisc::bit_cast<float>(0x7f80'0001u)};
+  const std::vector<uint16b> expected{0x3f80u, 0x3f80u, 0x3f82u, 0x3f81u,
+                                      0xc020u, 0x7f80u};
+  auto source_buffer = ztest::makeDeviceBuffer(*device, source);
+  auto bf16_buffer = device->makeBuffer<uint16b>(zivc::BufferUsage::kDeviceOnly);
+  bf16_buffer->setSize(source.size());
+  auto dest_buffer = device->makeBuffer<float>(zivc::BufferUsage::kDeviceOnly);
+  dest_buffer->setSize(source.size());
+
+  {
+    auto options = source_buffer->makeOptions();
+    options.setSize(source.size());
+    options.setExternalSyncMode(true);
+    zivc::convertToBfloat16(*source_buffer, bf16_buffer.get(), options);
+  }
+  const auto result = ztest::readBuffer(*device, *bf16_buffer);
+  for (std::size_t i = 0; i < expected.size(); ++i)
+    ASSERT_EQ(expected[i], result[i]) << "Float to bfloat16 conversion failed at " << i << ".";
+  for (std::size_t i = expected.size(); i < source.size(); ++i)
+    ASSERT_TRUE(0x7f80u < (result[i] & 0x7fffu)) << "NaN isn't kept at " << i << ".";
+
+  {
+    auto options = bf16_buffer->makeOptions();
+    options.setSize(source.size());
+    options.setExternalSyncMode(true);
+    zivc::convertFromBfloat16(*bf16_buffer, dest_buffer.get(), options);
+  }
+  const auto fresult = ztest::readBuffer(*device, *dest_buffer);
+  for (std::size_t i = 0; i < source.size(); ++i) {
+    const uint32b bits = zisc::cast<uint32b>(result[i]) << 16u;
+    ASSERT_EQ(bits, zisc::bit_cast<uint32b>(fresult[i]))
+        << "Bfloat16 to float conversion failed at " << i << ".";
+  }
+}
+
+TEST(PrimitivesTest, RandomUint32Test)
+{
+  using zivc::uint32b;
+  using zivc::uint64b;
+
+  auto platform = ztest::makePlatform();
+  const ztest::Config& config = ztest::Config::globalConfig();
+  zivc::SharedDevice device = platform->queryDevice(config.deviceId());
+
+  constexpr std::size_t n = 4099;
+  constexpr std::size_t dest_offset = 5;
+  auto buffer = device->makeBuffer<uint32b>(zivc::BufferUsage::kDeviceOnly);
+  buffer->setSize(n + dest_offset);
+
+  // The known answer of Philox4x32-10 (Random123)
+  {
+    auto options = buffer->makeOptions();
+    options.setSize(4);
+    options.setExternalSyncMode(true);
+    zivc::generateUniform(buffer.get(), 0, 0, options);
+    const auto result = ztest::readBuffer(*device, *buffer);
+    ASSERT_EQ(0x6627'e8d5u, result[0]) << "Philox4x32-10 failed.";
+    ASSERT_EQ(0xe169'c58du, result[1]) << "Philox4x32-10 failed.";
+    ASSERT_EQ(0xbc57'ac4cu, result[2]) << "Philox4x32-10 failed.";
+    ASSERT_EQ(0x9b00'dbd8u, result[3]) << "Philox4x32-10 failed.";
+  }
+  // The offset isn't aligned to a block and the block index crosses 32bit
+  constexpr uint64b seed = 0x299f'31d0'a409'3822u;
+  constexpr uint64b offset = (uint64b{1} << 34u) - 7u;
+  {
+    auto options = buffer->makeOptions();
+    options.setSize(n);
+    options.setDestOffset(dest_offset);
+    options.setExternalSyncMode(true);
+    zivc::generateUniform(buffer.get(), seed, offset, options);
+    const auto result = ztest::readBuffer(*device, *buffer);
+    for (std::size_t i = 0; i < n; ++i) {
+      ASSERT_EQ(::philoxReference(seed, offset + i), result[dest_offset + i])
+          << "Random number generation failed at " << i << ".";
+    }
+  }
+}
+
+TEST(PrimitivesTest, RandomFloatTest)
+{
+  using zivc::uint32b;
+  using zivc::uint64b;
+
+  auto platform = ztest::makePlatform();
+  const ztest::Config& config = ztest::Config::globalConfig();
+  zivc::SharedDevice device = platform->queryDevice(config.deviceId());
+
+  constexpr std::size_t n = 64 * 1024 + 3;
+  constexpr uint64b seed = 123456789;
+  constexpr uint64b offset = 2;
+  auto buffer = device->makeBuffer<float>(zivc::BufferUsage::kDeviceOnly);
+  buffer->setSize(n);
+  auto options = buffer->makeOptions();
+  options.setSize(n);
+  options.setExternalSyncMode(true);
+
+  // Uniform
+  {
+    zivc::generateUniform(buffer.get(), seed, offset, options);
+    const auto result = ztest::readBuffer(*device, *buffer);
+    for (std::size_t i = 0; i < n; ++i) {
+      const uint32b bits = ::philoxReference(seed, offset + i);
+      const float expected = zisc::cast<float>(bits >> 8u) * 0x1.0p-24f;
+      ASSERT_EQ(expected, result[i]) << "Uniform random generation failed at " << i << ".";
+    }
+  }
+  // Normal
+  {
+    zivc::generateNormal(buffer.get(), seed, offset, options);
+    const auto result = ztest::readBuffer(*device, *buffer);
+    double mean = 0.0;
+    double variance = 0.0;
+    for (std::size_t i = 0; i < n; ++i) {
+      ASSERT_TRUE(std::isfinite(result[i])) << "Normal random generation failed at " << i << ".";
+      mean += zisc::cast<double>(result[i]);
+      variance += zisc::cast<double>(result[i]) * zisc::cast<double>(result[i]);
+    }
+    mean = mean / zisc::cast<double>(n);
+    variance = variance / zisc::cast<double>(n) - mean * mean;
+    EXPECT_NEAR(0.0, mean, 0.02) << "The mean of the normal random numbers is wrong.";
+    EXPECT_NEAR(1.0, variance, 0.03) << "The variance of the normal random numbers is wrong.";
+  }
+  // Chained with a storage. Only the last launch is waited for
+  {
+    auto normal_buffer = device->makeBuffer<float>(zivc::BufferUsage::kDeviceOnly);
+    normal_buffer->setSize(n);
+    zivc::PrimitiveStorage storage;
+    auto chained_options = buffer->makeOptions();
+    chained_options.setSize(n);
+    zivc::generateUniform(buffer.get(), seed, offset,
+                          chained_options, std::addressof(storage));
+    chained_options.setExternalSyncMode(true);
+    auto r = zivc::generateNormal(normal_buffer.get(), seed, offset,
+                                  chained_options, std::addressof(storage));
+    if (r.isAsync())
+      r.fence().wait();
+    const auto result = ztest::readBuffer(*device, *buffer);
+    const auto normal_result = ztest::readBuffer(*device, *normal_buffer);
+    for (std::size_t i = 0; i < n; ++i) {
+      const uint32b bits = ::philoxReference(seed, offset + i);
+      const float expected = zisc::cast<float>(bits >> 8u) * 0x1.0p-24f;
+      ASSERT_EQ(expected, result[i]) << "Chained uniform random generation failed at " << i << ".";
+      ASSERT_TRUE(std::isfinite(normal_result[i]))
+          << "Chained normal random generation failed at " << i << ".";
+    }
+  }
+}
+
+TEST(PrimitivesTest, ThroughputTest)
+{
+  using zivc::uint32b;
+  using Clock = std::chrono::high_resolution_clock;
+
+  auto platform = ztest::makePlatform();
+  const ztest::Config& config = ztest::Config::globalConfig();
+  zivc::SharedDevice device = platform->queryDevice(config.deviceId());
+
+  constexpr std::size_t n = 16ull * 1024ull * 1024ull;
+  auto source = ztest::makeDeviceBuffer(*device, std::vector<uint32b>(n, 1));
+  auto flags = ztest::makeDeviceBuffer(*device, std::vector<uint32b>(n, 1));
+  auto dest = device->makeBuffer<uint32b>(zivc::BufferUsage::kDeviceOnly);
+  dest->setSize(n);
+  auto count = device->makeBuffer<uint32b>(zivc::BufferUsage::kDeviceOnly);
+  count->setSize(1);
+  auto options = source->makeOptions();
+  options.setSize(n);
+  options.setExternalSyncMode(true);
+
+  // Return the throughput in GB/s of the given operation
+  auto measure = [](const std::size_t bytes, auto operation)
+  {
+    constexpr std::size_t num_of_runs = 4;
+    operation(); // Warm up
+    const auto start = Clock::now();
+    for (std::size_t i = 0; i < num_of_runs; ++i)
+      operation();
+    const std::chrono::duration<double> elapsed = Clock::now() - start;
+    return zisc::cast<double>(num_of_runs * bytes) / (elapsed.count() * 1.0e9);
+  };
+  // The bytes read and written by each operation
+  constexpr std::size_t s = sizeof(uint32b) * n;
+  const double copy_bandwidth = measure(2 * s, [&]()
+  {
+    auto result = zivc::copy(*source, dest.get(), options);
+    if (result.isAsync())
+      result.fence().wait();
+  });
+  // The kernels and the status buffer are made before the measurement
+  zivc::PrimitiveStorage storage;
+  const double reduce_bandwidth = measure(s, [&]()
+  {
+    auto result = zivc::reduce(*source, count.get(), zivc::PrimitiveOp::kAdd,
+                               options, std::addressof(storage));
+    if (result.isAsync())
+      result.fence().wait();
+  });
+  {
+    const auto result = ztest::readBuffer(*device, *count);
+    ASSERT_EQ(n, result[0]) << "Reduction failed.";
+  }
+  const double scan_bandwidth = measure(2 * s, [&]()
+  {
+    auto result = zivc::inclusiveScan(*source, dest.get(), zivc::PrimitiveOp::kAdd,
+                                      options, std::addressof(storage));
+    if (result.isAsync())
+      result.fence().wait();
+  });
+  {
+    const auto result = ztest::readBuffer(*device, *dest);
+    for (std::size_t i = 0; i < n; ++i)
+      ASSERT_EQ(i + 1, result[i]) << "Scan failed at " << i << ".";
+  }
+  const double compact_bandwidth = measure(3 * s, [&]()
+  {
+    auto result = zivc::compact(*source, *flags, dest.get(), count.get(),
+                                options, std::addressof(storage));
+    if (result.isAsync())
+      result.fence().wait();
+  });
+  {
+    const auto result = ztest::readBuffer(*device, *count);
+    ASSERT_EQ(n, result[0]) << "Compaction failed.";
+  }
+
+  // The GFLOPS of a square matrix multiplication
+  constexpr std::size_t gemm_size = 1024;
+  auto gemm_a = ztest::makeDeviceBuffer(*device, std::vector<float>(gemm_size * gemm_size, 1.0f));
+  auto gemm_c = device->makeBuffer<float>(zivc::BufferUsage::kDeviceOnly);
+  gemm_c->setSize(gemm_size * gemm_size);
+  zivc::GemmLaunchOptions gemm_options{gemm_size, gemm_size, gemm_size};
+  gemm_options.setExternalSyncMode(true);
+  zivc::GemmStorage gemm_storage;
+  const double gemm_flops = measure(2 * gemm_size * gemm_size * gemm_size, [&]()
+  {
+    auto result = zivc::gemm(*gemm_a, *gemm_a, gemm_c.get(), 1.0f, 0.0f,
+                             gemm_options, std::addressof(gemm_storage));
+    if (result.isAsync())
+      result.fence().wait();
+  });
+  {
+    const auto result = ztest::readBuffer(*device, *gemm_c);
+    for (std::size_t i = 0; i < result.size(); ++i)
+      ASSERT_EQ(zisc::cast<float>(gemm_size), result[i]) << "Gemm failed at " << i << ".";
+  }
+
+  // float -> half conversion reads 4 bytes and writes 2 bytes per element
+  auto half_dest = device->makeBuffer<zivc::half>(zivc::BufferUsage::kDeviceOnly);
+  half_dest->setSize(n);
+  auto float_source = source->reinterp<float>();
+  auto convert_options = float_source.makeOptions();
+  convert_options.setSize(n);
+  convert_options.setExternalSyncMode(true);
+  const double convert_bandwidth = measure(s + s / 2, [&]()
+  {
+    auto result = zivc::convert(float_source, half_dest.get(), convert_options,
+                                std::addressof(storage));
+    if (result.isAsync())
+      result.fence().wait();
+  });
+
+  std::cout << "## Copy bandwidth   : " << copy_bandwidth << " GB/s" << std::endl;
+  std::cout << "## Reduce throughput: " << reduce_bandwidth << " GB/s ("
+            << (100.0 * reduce_bandwidth / copy_bandwidth) << "% of copy)" << std::endl;
+  std::cout << "## Scan throughput  : " << scan_bandwidth << " GB/s ("
+            << (100.0 * scan_bandwidth / copy_bandwidth) << "% of copy)" << std::endl;
+  std::cout << "## Compact throughput: " << compact_bandwidth << " GB/s ("
+            << (100.0 * compact_bandwidth / copy_bandwidth) << "% of copy)" << std::endl;
+  std::cout << "## Convert throughput: " << convert_bandwidth << " GB/s ("
+            << (100.0 * convert_bandwidth / copy_bandwidth) << "% of copy)" << std::endl;
+  std::cout << "## Gemm throughput  : " << gemm_flops << " GFLOPS" << std::endl;
+}
@@ -0,0 +1,78 @@
+/*!
+  \file test-inl.hpp
+  \author Sho Ikeda
+  \brief No brief description
+
+  \details
+  No detailed description.
+
+  \copyright
+  Copyright (c) 2015-2021 Sho Ikeda
+  This software is released under the MIT License.
+  http://opensource.org/licenses/mit-license.php
+  */
+
+#ifndef ZIVC_TEST_TEST_INL_HPP
+#define ZIVC_TEST_TEST_INL_HPP
+
+#include "test.hpp"
+// Standard C++ library
+#include <algorithm>
+#include <vector>
+// Zivc
+#include "zivc/zivc.hpp"
+#include "zivc/zivc_config.hpp"
+
+namespace ztest {
+
+/*!
+  \details The data is copied through a host buffer
+
+  \tparam Type No description.
+  \param [in] device No description.
+  \param [in] data No description.
+  \return No description
+  */
+template <zivc::KernelArg Type> inline
+zivc::SharedBuffer<Type> makeDeviceBuffer(zivc::Device& device,
+                                          const std::vector<Type>& data)
+{
+  auto buff_host = device.makeBuffer<Type>(zivc::BufferUsage::kHostOnly);
+  buff_host->setSize(data.size());
+  {
+    auto mem = buff_host->mapMemory();
+    std::copy(data.begin(), data.end(), mem.begin());
+  }
+  auto buffer = device.makeBuffer<Type>(zivc::BufferUsage::kDeviceOnly);
+  buffer->setSize(data.size());
+  auto options = buffer->makeOptions();
+  options.setExternalSyncMode(true);
+  auto result = zivc::copy(*buff_host, buffer.get(), options);
+  device.waitForCompletion(result.fence());
+  return buffer;
+}
+
+/*!
+  \details The data is copied through a host buffer
+
+  \tparam Type No description.
+  \param [in] device No description.
+  \param [in] buffer No description.
+  \return No description
+  */
+template <zivc::KernelArg Type> inline
+std::vector<Type> readBuffer(zivc::Device& device, const zivc::Buffer<Type>& buffer)
+{
+  auto buff_host = device.makeBuffer<Type>(zivc::BufferUsage::kHostOnly);
+  buff_host->setSize(buffer.size());
+  auto options = buffer.makeOptions();
+  options.setExternalSyncMode(true);
+  auto result = zivc::copy(buffer, buff_host.get(), options);
+  device.waitForCompletion(result.fence());
+  auto mem = buff_host->mapMemory();
+  return std::vector<Type>{mem.begin(), mem.end()};
+}
+
+} // namespace ztest
+
+#endif // ZIVC_TEST_TEST_INL_HPP
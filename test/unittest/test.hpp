@@ -15,6 +15,8 @@
 #ifndef ZIVC_TEST_TEST_HPP
 #define ZIVC_TEST_TEST_HPP
 
+// Standard C++ library
+#include <vector>
 // Zisc
 #include "zisc/memory/std_memory_resource.hpp"
 // Zivc
@@ -23,9 +25,20 @@
 
 namespace ztest {
 
+//! Make a device buffer which has the given data
+template <zivc::KernelArg Type>
+zivc::SharedBuffer<Type> makeDeviceBuffer(zivc::Device& device,
+                                          const std::vector<Type>& data);
+
 //! Make a platform for unit test
 zivc::SharedPlatform makePlatform();
 
+//! Read the data of the given device buffer
+template <zivc::KernelArg Type>
+std::vector<Type> readBuffer(zivc::Device& device, const zivc::Buffer<Type>& buffer);
+
 } // namespace ztest
 
+#include "test-inl.hpp"
+
 #endif // ZIVC_TEST_TEST_HPP